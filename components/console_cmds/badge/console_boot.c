@@ -0,0 +1,61 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "esp_console.h"
+
+#include "BootProfile.h"
+#include "console_boot.h"
+
+static int compareStart(const void *pA, const void *pB)
+{
+    const BootProfileStep *pStepA = pA;
+    const BootProfileStep *pStepB = pB;
+    return (pStepA->startUs > pStepB->startUs) - (pStepA->startUs < pStepB->startUs);
+}
+
+static int boot(int argc, char **argv)
+{
+    if (argc != 1)
+    {
+        printf("invalid syntax\n");
+        return 1;
+    }
+
+    BootProfileStep steps[BOOT_PROFILE_MAX_STEPS];
+    int numSteps = BootProfile_GetSteps(steps, BOOT_PROFILE_MAX_STEPS);
+    qsort(steps, numSteps, sizeof(steps[0]), compareStart);
+
+    printf("%-20s %4s %10s %10s\n", "Step", "Core", "Start (ms)", "Took (ms)");
+    for (int i = 0; i < numSteps; i++)
+    {
+        printf("%-20s %4d %10lld %10lld\n", steps[i].name, steps[i].core,
+               steps[i].startUs / 1000, (steps[i].endUs - steps[i].startUs) / 1000);
+    }
+
+    printf("\n%-20s %10s\n", "Milestone", "At (ms)");
+    for (int i = 0; i < BOOT_MILESTONE_COUNT; i++)
+    {
+        int64_t atUs = BootProfile_GetMilestoneUs(i);
+        if (atUs != 0)
+        {
+            printf("%-20s %10lld\n", BootProfile_GetMilestoneName(i), atUs / 1000);
+        }
+        else
+        {
+            printf("%-20s %10s\n", BootProfile_GetMilestoneName(i), "-");
+        }
+    }
+    return 0;
+}
+
+void register_boot_commands(void)
+{
+    const esp_console_cmd_t boot_cmd =
+    {
+        .command = "boot",
+        .help = "Prints how long each init step took, which core ran it, and when the LEDs and BLE advertising first came up",
+        .hint = NULL,
+        .func = &boot,
+    };
+    ESP_ERROR_CHECK(esp_console_cmd_register(&boot_cmd));
+}
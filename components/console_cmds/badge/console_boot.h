@@ -0,0 +1,8 @@
+#ifndef CONSOLE_BOOT_H
+#define CONSOLE_BOOT_H
+
+// Boot timeline commands
+// boot
+void register_boot_commands(void);
+
+#endif // CONSOLE_BOOT_H
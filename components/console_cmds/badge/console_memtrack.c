@@ -0,0 +1,60 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "esp_console.h"
+#include "esp_timer.h"
+#include "sdkconfig.h"
+
+#include "console_memtrack.h"
+#include "MemTrack.h"
+
+#if CONFIG_MEM_TRACK
+static uint32_t s_prevAllocCount[MEM_TAG_COUNT];
+static int64_t s_prevReportTimeUs = 0;
+
+static int mem_tags(int argc, char **argv)
+{
+    if (argc == 2 && strcmp(argv[1], "mark") == 0)
+    {
+        MemTrack_Mark();
+        printf("Marked live bytes, later reports show growth since now\n");
+        return 0;
+    }
+    else if (argc != 1)
+    {
+        printf("invalid syntax\n");
+        return 1;
+    }
+
+    // Allocation rate covers the time since the previous report
+    int64_t nowUs = esp_timer_get_time();
+    uint32_t elapsedMs = (uint32_t)((nowUs - s_prevReportTimeUs) / 1000);
+    s_prevReportTimeUs = nowUs;
+
+    printf("%-15s %8s %8s %6s %8s %8s %6s %8s %8s\n", "Tag", "Live", "Peak", "Blocks", "Allocs", "Frees", "Failed", "Allocs/s", "Growth");
+    for (uint32_t i = 0; i < MEM_TAG_COUNT; i++)
+    {
+        MemTrackStats stats;
+        MemTrack_GetStats(i, &stats);
+        uint32_t allocsPerSec = (elapsedMs > 0) ? (uint32_t)(((uint64_t)(stats.allocCount - s_prevAllocCount[i]) * 1000) / elapsedMs) : 0;
+        s_prevAllocCount[i] = stats.allocCount;
+        printf("%-15s %8lu %8lu %6lu %8lu %8lu %6lu %8lu %8ld\n", MemTrack_GetTagName(i), stats.liveBytes, stats.peakBytes,
+               stats.liveBlocks, stats.allocCount, stats.freeCount, stats.failedCount, allocsPerSec, MemTrack_GetGrowthSinceMark(i));
+    }
+    return 0;
+}
+#endif // CONFIG_MEM_TRACK
+
+void register_memtrack_commands(void)
+{
+#if CONFIG_MEM_TRACK
+    const esp_console_cmd_t mem_tags_cmd =
+    {
+        .command = "mem_tags",
+        .help = "Prints live, peak and allocation rate per heap tag. 'mark' records a baseline for growth",
+        .hint = "[mark]",
+        .func = &mem_tags,
+    };
+    ESP_ERROR_CHECK(esp_console_cmd_register(&mem_tags_cmd));
+#endif
+}
@@ -0,0 +1,8 @@
+#ifndef CONSOLE_MEMTRACK_H
+#define CONSOLE_MEMTRACK_H
+
+// Heap tag commands
+// mem_tags
+void register_memtrack_commands(void);
+
+#endif // CONSOLE_MEMTRACK_H
@@ -0,0 +1,148 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "esp_console.h"
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "sdkconfig.h"
+
+#include "console_notifications.h"
+
+#define TRACE_DRAIN_BATCH 32
+
+static NotificationDispatcher *s_pNotificationDispatcher = NULL;
+static const char TRACE_TYPE_NAMES[] = { 'P', 'D', 'H' };
+
+// Upper bound of the log2 bucket holding the given fraction of samples
+static uint32_t histogram_percentile_us(const NotificationHistogram *pHistogram, uint32_t percent)
+{
+    uint32_t target = (pHistogram->count * percent + 99) / 100;
+    uint32_t seen = 0;
+    for (uint32_t i = 0; i < NOTIFICATION_TRACE_HISTOGRAM_BUCKETS; i++)
+    {
+        seen += pHistogram->buckets[i];
+        if (seen >= target)
+        {
+            return (i == NOTIFICATION_TRACE_HISTOGRAM_BUCKETS - 1) ? pHistogram->maxUs : (1UL << i);
+        }
+    }
+    return pHistogram->maxUs;
+}
+
+static int nd_hist(int argc, char **argv)
+{
+    if (argc == 2 && strcmp(argv[1], "reset") == 0)
+    {
+        NotificationDispatcher_ResetTraceHistograms(s_pNotificationDispatcher);
+        return 0;
+    }
+
+    printf("Tracing %s, dropped posts bulk %lu high %lu, trace cost %lu ns/event\n",
+           NotificationDispatcher_IsTraceEnabled(s_pNotificationDispatcher) ? "on" : "off",
+           NotificationDispatcher_GetDroppedCount(s_pNotificationDispatcher, NOTIFICATION_LANE_BULK),
+           NotificationDispatcher_GetDroppedCount(s_pNotificationDispatcher, NOTIFICATION_LANE_HIGH),
+           NotificationDispatcher_GetTraceOverheadNs(s_pNotificationDispatcher));
+    printf("event lane  count  lat_p50 lat_p99 lat_max  run_p50 run_p99 run_max (us, p50/p99 are bucket bounds)\n");
+    for (uint32_t i = 0; i < NOTIFICATION_EVENTS_COUNT; i++)
+    {
+        NotificationHistogram latency;
+        NotificationHistogram runTime;
+        if (NotificationDispatcher_GetTraceHistograms(s_pNotificationDispatcher, i, &latency, &runTime) != ESP_OK)
+        {
+            printf("No histograms, start tracing with 'nd_trace start'\n");
+            return 1;
+        }
+        if (latency.count > 0)
+        {
+            printf("%5lu %4c %6lu  %7lu %7lu %7lu  %7lu %7lu %7lu\n", i,
+                   NotificationDispatcher_GetEventLane(i) == NOTIFICATION_LANE_HIGH ? 'H' : 'B', latency.count,
+                   histogram_percentile_us(&latency, 50), histogram_percentile_us(&latency, 99), latency.maxUs,
+                   histogram_percentile_us(&runTime, 50), histogram_percentile_us(&runTime, 99), runTime.maxUs);
+        }
+    }
+    return 0;
+}
+
+// One CSV line per record: type,timestamp_us,event,task,queue_depth,handler,duration_us,lane
+// P = posted, D = dispatched (duration is post to dispatch latency), H = handler run
+static int nd_trace_dump(void)
+{
+    // Task numbers to names so the host can label the producer tracks
+    UBaseType_t taskCount = uxTaskGetNumberOfTasks();
+    TaskStatus_t *pTasks = malloc(taskCount * sizeof(TaskStatus_t));
+    if (pTasks != NULL)
+    {
+        taskCount = uxTaskGetSystemState(pTasks, taskCount, NULL);
+        for (UBaseType_t i = 0; i < taskCount; i++)
+        {
+            printf("#task,%u,%s\n", pTasks[i].xTaskNumber, pTasks[i].pcTaskName);
+        }
+        free(pTasks);
+    }
+
+    NotificationTraceRecord records[TRACE_DRAIN_BATCH];
+    uint32_t overwritten = 0;
+    uint32_t total = 0;
+    size_t count;
+    while ((count = NotificationDispatcher_DrainTrace(s_pNotificationDispatcher, records, TRACE_DRAIN_BATCH, total == 0 ? &overwritten : NULL)) > 0)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            const NotificationTraceRecord *pRecord = &records[i];
+            printf("%c,%lu,%u,%u,%u,%u,%lu,%u\n", TRACE_TYPE_NAMES[pRecord->type], pRecord->timestampUs, pRecord->notificationEvent,
+                   pRecord->taskNumber, pRecord->queueDepth, pRecord->handlerIndex, pRecord->durationUs, pRecord->lane);
+        }
+        total += count;
+    }
+    printf("#end,%lu,%lu\n", total, overwritten);
+    return 0;
+}
+
+static int nd_trace(int argc, char **argv)
+{
+    int ret = 0;
+    if (argc == 2 && strcmp(argv[1], "start") == 0)
+    {
+        ret = NotificationDispatcher_SetTraceEnabled(s_pNotificationDispatcher, true);
+    }
+    else if (argc == 2 && strcmp(argv[1], "stop") == 0)
+    {
+        ret = NotificationDispatcher_SetTraceEnabled(s_pNotificationDispatcher, false);
+    }
+    else if (argc == 2 && strcmp(argv[1], "dump") == 0)
+    {
+        ret = nd_trace_dump();
+    }
+    else
+    {
+        printf("invalid syntax\n");
+        ret = 1;
+    }
+    return ret;
+}
+
+void register_notification_commands(NotificationDispatcher *pNotificationDispatcher)
+{
+    s_pNotificationDispatcher = pNotificationDispatcher;
+
+    const esp_console_cmd_t nd_hist_cmd =
+    {
+        .command = "nd_hist",
+        .help = "Prints per event dispatch latency and handler run time histograms",
+        .hint = "[reset]",
+        .func = &nd_hist,
+    };
+
+    const esp_console_cmd_t nd_trace_cmd =
+    {
+        .command = "nd_trace",
+        .help = "Starts, stops or drains the notification trace as CSV for conversion to a Chrome trace",
+        .hint = "<start|stop|dump>",
+        .func = &nd_trace,
+    };
+
+    ESP_ERROR_CHECK(esp_console_cmd_register(&nd_hist_cmd));
+    ESP_ERROR_CHECK(esp_console_cmd_register(&nd_trace_cmd));
+}
@@ -0,0 +1,10 @@
+#ifndef CONSOLE_NOTIFICATIONS_H
+#define CONSOLE_NOTIFICATIONS_H
+
+#include "NotificationDispatcher.h"
+
+// Notification dispatcher commands
+// nd_hist, nd_trace
+void register_notification_commands(NotificationDispatcher *pNotificationDispatcher);
+
+#endif // CONSOLE_NOTIFICATIONS_H
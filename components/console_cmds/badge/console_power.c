@@ -0,0 +1,65 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "esp_console.h"
+#include "sdkconfig.h"
+
+#include "console_power.h"
+#include "PowerManager.h"
+
+#if CONFIG_POWER_MANAGEMENT
+static uint32_t percentOf(uint64_t partUs, uint64_t totalUs)
+{
+    return (totalUs > 0) ? (uint32_t)((partUs * 100) / totalUs) : 0;
+}
+
+static int power(int argc, char **argv)
+{
+    if (argc == 2 && strcmp(argv[1], "reset") == 0)
+    {
+        PowerManager_ResetStats();
+        printf("Power statistics reset\n");
+        return 0;
+    }
+    else if (argc != 1)
+    {
+        printf("invalid syntax\n");
+        return 1;
+    }
+
+    PowerStats stats;
+    PowerManager_GetStats(&stats);
+    uint64_t lowPowerUs = stats.elapsedUs - stats.performanceUs;
+
+    printf("%-15s %12s %4s\n", "State", "Time (ms)", "%");
+    printf("%-15s %12llu %3lu%%\n", "performance", stats.performanceUs / 1000, percentOf(stats.performanceUs, stats.elapsedUs));
+    printf("%-15s %12llu %3lu%%\n", "low power", lowPowerUs / 1000, percentOf(lowPowerUs, stats.elapsedUs));
+
+    printf("\n%-15s %5s %8s %12s %4s\n", "Lock", "Held", "Acquires", "Held (ms)", "%");
+    for (int i = 0; i < POWER_LOCK_COUNT; i++)
+    {
+        PowerLockStats *pLock = &stats.locks[i];
+        printf("%-15s %5lu %8lu %12llu %3lu%%\n", PowerManager_GetLockName(i), pLock->holdCount, pLock->acquireCount,
+               pLock->heldUs / 1000, percentOf(pLock->heldUs, stats.elapsedUs));
+    }
+
+    // Splits low power into idle frequency and light sleep when esp_pm profiling is on
+    printf("\n");
+    PowerManager_DumpLocks(stdout);
+    return 0;
+}
+#endif // CONFIG_POWER_MANAGEMENT
+
+void register_power_commands(void)
+{
+#if CONFIG_POWER_MANAGEMENT
+    const esp_console_cmd_t power_cmd =
+    {
+        .command = "power",
+        .help = "Prints time at full speed and in low power, and how long each subsystem held the CPU up. 'reset' restarts the counters",
+        .hint = "[reset]",
+        .func = &power,
+    };
+    ESP_ERROR_CHECK(esp_console_cmd_register(&power_cmd));
+#endif
+}
@@ -0,0 +1,8 @@
+#ifndef CONSOLE_POWER_H
+#define CONSOLE_POWER_H
+
+// Power lock commands
+// power
+void register_power_commands(void);
+
+#endif // CONSOLE_POWER_H
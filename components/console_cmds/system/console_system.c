@@ -1,4 +1,5 @@
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
 #include <unistd.h>
@@ -8,6 +9,7 @@
 #include "esp_console.h"
 #include "esp_system.h"
 #include "esp_flash.h"
+#include "esp_heap_caps.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "sdkconfig.h"
@@ -73,6 +75,181 @@ static int get_task_info(int argc, char **argv)
 }
 #endif // CONFIG_FREERTOS_USE_STATS_FORMATTING_FUNCTIONS
 
+#ifdef CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+#define CORE_LOAD_DEFAULT_SAMPLE_MS 1000
+#define TOP_DEFAULT_INTERVAL_S      2
+#define TOP_DEFAULT_SAMPLES         5
+#define STATS_MAX_TASKS             48
+
+// Allocated once at registration so the stats commands do not allocate while measuring
+static TaskStatus_t *s_pTaskSnapshot = NULL;
+static TaskStatus_t *s_pTaskSnapshotPrev = NULL;
+
+static UBaseType_t take_task_snapshot(TaskStatus_t *pTasks, configRUN_TIME_COUNTER_TYPE *pTotalRunTime)
+{
+    UBaseType_t taskCount = uxTaskGetSystemState(pTasks, STATS_MAX_TASKS, pTotalRunTime);
+    if (taskCount == 0)
+    {
+        printf("More than %d tasks, raise STATS_MAX_TASKS\n", STATS_MAX_TASKS);
+    }
+    return taskCount;
+}
+
+static const char *core_name(BaseType_t coreId)
+{
+    return (coreId == tskNO_AFFINITY) ? "Any" : (coreId == PRO_CPU_NUM) ? "PRO" : "APP";
+}
+
+// Load is the share of the sample window each core spent outside its idle task
+static int get_core_load(int argc, char **argv)
+{
+    uint32_t sampleMs = (argc == 2) ? strtoul(argv[1], NULL, 10) : CORE_LOAD_DEFAULT_SAMPLE_MS;
+    if (sampleMs == 0)
+    {
+        printf("invalid syntax\n");
+        return 1;
+    }
+
+    configRUN_TIME_COUNTER_TYPE idleStart[portNUM_PROCESSORS];
+    for (BaseType_t core = 0; core < portNUM_PROCESSORS; core++)
+    {
+        idleStart[core] = ulTaskGetRunTimeCounter(xTaskGetIdleTaskHandleForCore(core));
+    }
+    configRUN_TIME_COUNTER_TYPE timeStart = portGET_RUN_TIME_COUNTER_VALUE();
+
+    vTaskDelay(pdMS_TO_TICKS(sampleMs));
+
+    configRUN_TIME_COUNTER_TYPE elapsed = portGET_RUN_TIME_COUNTER_VALUE() - timeStart;
+    for (BaseType_t core = 0; core < portNUM_PROCESSORS; core++)
+    {
+        configRUN_TIME_COUNTER_TYPE idle = ulTaskGetRunTimeCounter(xTaskGetIdleTaskHandleForCore(core)) - idleStart[core];
+        uint32_t idlePercent = (elapsed > 0) ? (uint32_t)(((uint64_t)idle * 100) / elapsed) : 100;
+        printf("Core %d (%s) load: %lu%%\n", core, core_name(core), 100 - MIN(idlePercent, 100));
+    }
+
+    // Where each task is placed, to compare against the Kconfig placement table
+    UBaseType_t taskCount = take_task_snapshot(s_pTaskSnapshot, NULL);
+    for (BaseType_t core = 0; core <= portNUM_PROCESSORS; core++)
+    {
+        BaseType_t coreId = (core == portNUM_PROCESSORS) ? tskNO_AFFINITY : core;
+        printf("%s:", core_name(coreId));
+        for (UBaseType_t i = 0; i < taskCount; i++)
+        {
+            if (xTaskGetCoreID(s_pTaskSnapshot[i].xHandle) == coreId)
+            {
+                printf(" %s", s_pTaskSnapshot[i].pcTaskName);
+            }
+        }
+        printf("\n");
+    }
+    return 0;
+}
+
+// CPU share of each task since boot, formatted like top. 100% is one core
+static int get_cpu_stats(int argc, char **argv)
+{
+    configRUN_TIME_COUNTER_TYPE total = 0;
+    UBaseType_t taskCount = take_task_snapshot(s_pTaskSnapshot, &total);
+    printf("%-16s %4s %10s %6s\n", "Task Name", "Core", "Run Time", "CPU%");
+    for (UBaseType_t i = 0; i < taskCount && total > 0; i++)
+    {
+        const TaskStatus_t *pTask = &s_pTaskSnapshot[i];
+        uint32_t permille = (uint32_t)(((uint64_t)pTask->ulRunTimeCounter * 1000) / total);
+        printf("%-16s %4s %10lu %4lu.%lu\n", pTask->pcTaskName, core_name(xTaskGetCoreID(pTask->xHandle)),
+               (uint32_t)pTask->ulRunTimeCounter, permille / 10, permille % 10);
+    }
+    return 0;
+}
+
+static int get_stack_stats(int argc, char **argv)
+{
+    UBaseType_t taskCount = take_task_snapshot(s_pTaskSnapshot, NULL);
+    printf("%-16s %5s %4s %s\n", "Task Name", "Prio", "Core", "Min free stack (bytes)");
+    for (UBaseType_t i = 0; i < taskCount; i++)
+    {
+        const TaskStatus_t *pTask = &s_pTaskSnapshot[i];
+        printf("%-16s %5u %4s %lu\n", pTask->pcTaskName, pTask->uxCurrentPriority, core_name(xTaskGetCoreID(pTask->xHandle)),
+               (uint32_t)pTask->usStackHighWaterMark * sizeof(StackType_t));
+    }
+    return 0;
+}
+
+// Samples per task CPU share over an interval. 100% is one core
+static int get_top(int argc, char **argv)
+{
+    uint32_t intervalS = (argc >= 2) ? strtoul(argv[1], NULL, 10) : TOP_DEFAULT_INTERVAL_S;
+    uint32_t samples = (argc >= 3) ? strtoul(argv[2], NULL, 10) : TOP_DEFAULT_SAMPLES;
+    if (intervalS == 0 || samples == 0)
+    {
+        printf("invalid syntax\n");
+        return 1;
+    }
+
+    configRUN_TIME_COUNTER_TYPE totalPrev = 0;
+    UBaseType_t countPrev = take_task_snapshot(s_pTaskSnapshotPrev, &totalPrev);
+    for (uint32_t sample = 0; sample < samples && countPrev > 0; sample++)
+    {
+        vTaskDelay(pdMS_TO_TICKS(intervalS * 1000));
+
+        configRUN_TIME_COUNTER_TYPE total = 0;
+        UBaseType_t count = take_task_snapshot(s_pTaskSnapshot, &total);
+        configRUN_TIME_COUNTER_TYPE elapsed = total - totalPrev;
+
+        printf("\n%-16s %4s %6s %s\n", "Task Name", "Core", "CPU%", "Min free stack");
+        for (UBaseType_t i = 0; i < count && elapsed > 0; i++)
+        {
+            const TaskStatus_t *pTask = &s_pTaskSnapshot[i];
+            configRUN_TIME_COUNTER_TYPE runTimePrev = pTask->ulRunTimeCounter;  // New tasks count from zero
+            for (UBaseType_t j = 0; j < countPrev; j++)
+            {
+                if (s_pTaskSnapshotPrev[j].xTaskNumber == pTask->xTaskNumber)
+                {
+                    runTimePrev = s_pTaskSnapshotPrev[j].ulRunTimeCounter;
+                    break;
+                }
+            }
+            uint32_t permille = (uint32_t)(((uint64_t)(pTask->ulRunTimeCounter - runTimePrev) * 1000) / elapsed);
+            if (permille > 0)
+            {
+                printf("%-16s %4s %4lu.%lu %lu\n", pTask->pcTaskName, core_name(xTaskGetCoreID(pTask->xHandle)),
+                       permille / 10, permille % 10, (uint32_t)pTask->usStackHighWaterMark * sizeof(StackType_t));
+            }
+        }
+
+        // Swap so the current snapshot is the baseline for the next sample
+        TaskStatus_t *pSwap = s_pTaskSnapshotPrev;
+        s_pTaskSnapshotPrev = s_pTaskSnapshot;
+        s_pTaskSnapshot = pSwap;
+        countPrev = count;
+        totalPrev = total;
+    }
+    return 0;
+}
+#endif // CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+
+// Fragmentation is the share of free memory not usable by the largest single allocation
+static int get_heap_stats(int argc, char **argv)
+{
+    static const struct { uint32_t caps; const char *pName; } HEAP_CAPS[] =
+    {
+        { MALLOC_CAP_INTERNAL, "internal" },
+        { MALLOC_CAP_DMA,      "dma" },
+        { MALLOC_CAP_SPIRAM,   "spiram" },
+        { MALLOC_CAP_DEFAULT,  "default" },
+    };
+
+    printf("%-8s %8s %8s %8s %8s %6s %s\n", "Caps", "Free", "Largest", "MinFree", "Alloc", "Blocks", "Frag%");
+    for (size_t i = 0; i < sizeof(HEAP_CAPS) / sizeof(HEAP_CAPS[0]); i++)
+    {
+        multi_heap_info_t info;
+        heap_caps_get_info(&info, HEAP_CAPS[i].caps);
+        uint32_t fragmentation = (info.total_free_bytes > 0) ? 100 - (info.largest_free_block * 100) / info.total_free_bytes : 0;
+        printf("%-8s %8u %8u %8u %8u %6u %lu\n", HEAP_CAPS[i].pName, info.total_free_bytes, info.largest_free_block,
+               info.minimum_free_bytes, info.total_allocated_bytes, info.allocated_blocks, fragmentation);
+    }
+    return 0;
+}
+
 #define LINE_SIZE 64
 #if CONFIG_CONSOLE_STORE_HISTORY
 static int get_history(int argc, char **argv)
@@ -191,6 +368,59 @@ void register_system_dev(void)
     ESP_ERROR_CHECK(esp_console_cmd_register(&task_info_cmd));
 #endif
 
+#ifdef CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+    s_pTaskSnapshot = malloc(STATS_MAX_TASKS * sizeof(TaskStatus_t));
+    s_pTaskSnapshotPrev = malloc(STATS_MAX_TASKS * sizeof(TaskStatus_t));
+    if (s_pTaskSnapshot && s_pTaskSnapshotPrev)
+    {
+        const esp_console_cmd_t core_load_cmd =
+        {
+            .command = "core_load",
+            .help = "Samples per core load and lists which core each task is pinned to",
+            .hint = "[sample ms]",
+            .func = &get_core_load,
+        };
+        const esp_console_cmd_t cpu_cmd =
+        {
+            .command = "cpu",
+            .help = "Prints each task's run time and CPU percentage since boot",
+            .hint = NULL,
+            .func = &get_cpu_stats,
+        };
+        const esp_console_cmd_t stack_cmd =
+        {
+            .command = "stack",
+            .help = "Prints each task's stack high water mark",
+            .hint = NULL,
+            .func = &get_stack_stats,
+        };
+        const esp_console_cmd_t top_cmd =
+        {
+            .command = "top",
+            .help = "Samples per task CPU percentage every interval",
+            .hint = "[interval s] [samples]",
+            .func = &get_top,
+        };
+        ESP_ERROR_CHECK(esp_console_cmd_register(&core_load_cmd));
+        ESP_ERROR_CHECK(esp_console_cmd_register(&cpu_cmd));
+        ESP_ERROR_CHECK(esp_console_cmd_register(&stack_cmd));
+        ESP_ERROR_CHECK(esp_console_cmd_register(&top_cmd));
+    }
+    else
+    {
+        ESP_LOGE(TAG, "failed to allocate buffers for runtime stats");
+    }
+#endif
+
+    const esp_console_cmd_t heap_cmd =
+    {
+        .command = "heap",
+        .help = "Prints free, largest block, watermark and fragmentation per heap capability",
+        .hint = NULL,
+        .func = &get_heap_stats,
+    };
+    ESP_ERROR_CHECK(esp_console_cmd_register(&heap_cmd));
+
     const esp_console_cmd_t cat_file_cmd =
     {
         .command = "cat",
@@ -6,7 +6,7 @@
 void register_system_basic(void);
 
 // Dev commands
-// min_heap, task_info, stack, free, cat
+// task_info, core_load, cpu, stack, top, heap, free, cat
 void register_system_dev(void);
 
 #endif // CONSOLE_SYSTEM_H
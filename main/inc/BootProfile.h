@@ -0,0 +1,37 @@
+#ifndef BOOT_PROFILE_H_
+#define BOOT_PROFILE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define BOOT_PROFILE_MAX_STEPS (32)
+
+// One init step. Times are esp_timer microseconds since power on
+typedef struct BootProfileStep_t
+{
+    const char *name;
+    int64_t startUs;
+    int64_t endUs;
+    int core;
+} BootProfileStep;
+
+// Points users see at power on. Only the first time each is reached is kept
+typedef enum BootMilestone_e
+{
+    BOOT_MILESTONE_INIT_DONE,
+    BOOT_MILESTONE_FIRST_LED,
+    BOOT_MILESTONE_ADVERTISING,
+    BOOT_MILESTONE_COUNT
+} BootMilestone;
+
+// Records a step that started at startUs and ends now
+void BootProfile_RecordStep(const char *name, int64_t startUs);
+void BootProfile_Milestone(BootMilestone milestone);
+
+// Steps are returned in the order they finished
+int BootProfile_GetSteps(BootProfileStep *pSteps, int maxSteps);
+// Zero when the milestone has not been reached
+int64_t BootProfile_GetMilestoneUs(BootMilestone milestone);
+const char *BootProfile_GetMilestoneName(BootMilestone milestone);
+
+#endif // BOOT_PROFILE_H_
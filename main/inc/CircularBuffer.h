@@ -1,6 +1,8 @@
 #ifndef CIRCULAR_BUFFER_H_
 #define CIRCULAR_BUFFER_H_
 
+#include <stdatomic.h>
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 #include "esp_err.h"
@@ -17,14 +19,23 @@ typedef struct CircularBuffer_t
     size_t size;       // size of each item in the pBuffer
     void *pHead;       // pointer to head
     void *pTail;       // pointer to tail
+
+    // Lock-free mode only. Indices run freely and are masked into the buffer on access
+    bool lockFree;
+    size_t mask;
+    atomic_size_t writeIdx; // only advanced by the producer
+    atomic_size_t readIdx;  // only advanced by the consumer
 } CircularBuffer;
 
 esp_err_t CircularBuffer_Init(CircularBuffer *cb, size_t capacity, size_t size);
+esp_err_t CircularBuffer_InitLockFree(CircularBuffer *cb, size_t capacity, size_t size);
 void CircularBuffer_Free(CircularBuffer *cb);
 void CircularBuffer_Clear(CircularBuffer *cb);
 int CircularBuffer_Count(CircularBuffer *cb);
 esp_err_t CircularBuffer_PushBack(CircularBuffer *cb, const void *item);
 esp_err_t CircularBuffer_PopFront(CircularBuffer *cb, void *item);
+size_t CircularBuffer_PushBackN(CircularBuffer *cb, const void *items, size_t numItems);
+size_t CircularBuffer_PopFrontN(CircularBuffer *cb, void *items, size_t maxItems);
 esp_err_t CircularBuffer_MatchSequence(CircularBuffer *cb, const void *sequence, size_t sequenceLength);
 
 #endif // CIRCULAR_BUFFER_H_
\ No newline at end of file
@@ -43,6 +43,7 @@ typedef struct GameState_t
     GameStateData gameStateData;
     SeenEventMap_t seenEventMap;
     PeerMap_t peerMap;
+    void *peerMapArena[HASHMAP_ARENA_SIZE(MAX_PEER_MAP_DEPTH, 0) / sizeof(void *)];
     PeerReport peerReports[MAX_PEER_MAP_DEPTH];
     uint32_t numPeerReports;
     NotificationDispatcher *pNotificationDispatcher;
@@ -52,6 +53,7 @@ typedef struct GameState_t
 } GameState;
 
 esp_err_t GameState_Init(GameState *this, NotificationDispatcher *pNotificationDispatcher, BadgeStats *pBadgeStats, UserSettings *pUserSettings, BatterySensor *pBatterySensor);
+esp_err_t GameState_Start(GameState *this);
 void GameState_SetEventId(GameState *this, char *newEventIdB64);
 void GameState_SendHeartBeat(GameState *this, uint32_t waitTimeMs);
 
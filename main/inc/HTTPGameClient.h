@@ -6,15 +6,15 @@
 
 #include "BatterySensor.h"
 #include "GameState.h"
+#include "Mutex.h"
 #include "NotificationDispatcher.h"
+#include "SiblingCache.h"
 #include "WifiClient.h"
 
 #define HTTPGAMECLIENT_MAX_REQUEST_DATA_SIZE    (8192)
 #define HTTPGAMECLIENT_MAX_RESPONSE_DATA_SIZE   (8192)
 #define PEER_REPORT_MAX_SIZE                    (1024*7)
 
-typedef HASHMAP(char, bool) SiblingMap_t;
-
 typedef enum HTTPGameClient_HTTPRequestTypes_e
 {
     HTTPGAMECLIENT_HTTPREQUEST_NONE = 0,
@@ -66,6 +66,7 @@ typedef struct HTTPGameClient_RequestList_t
 typedef struct HTTPGameClient_t
 {
     WifiClient *pWifiClient;
+    TaskHandle_t taskHandle;
     SemaphoreHandle_t requestMutex;
     HTTPGameClientRequestList requestQueue;
     HTTPGameClient_Response response;
@@ -73,11 +74,12 @@ typedef struct HTTPGameClient_t
     char peerReport[PEER_REPORT_MAX_SIZE];
     NotificationDispatcher *pNotificationDispatcher;
     BatterySensor *pBatterySensor;
-    SiblingMap_t siblingMap;
+    SiblingCache siblingCache;
 } HTTPGameClient;
 
 
 esp_err_t HTTPGameClient_Init(HTTPGameClient *this, WifiClient *pWifiClient, NotificationDispatcher *pNotificationDispatcher, BatterySensor *pBatterySensor);
+bool HTTPGameClient_MarkSiblingSeen(HTTPGameClient *this, const char *badgeIdB64);
 
 
 #endif // HTTP_CLIENT_H
\ No newline at end of file
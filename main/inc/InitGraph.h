@@ -0,0 +1,67 @@
+#ifndef INIT_GRAPH_H_
+#define INIT_GRAPH_H_
+
+#include <stdint.h>
+
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/event_groups.h"
+
+// Event groups have 24 usable bits, one is the helper done bit
+#define INIT_GRAPH_MAX_STEPS            (23)
+#define INIT_GRAPH_STEP_BIT(step)       (1UL << (step))
+#define INIT_GRAPH_EVENT_BIT(event)     (1ULL << (event))
+
+typedef esp_err_t (*InitGraphStepFunction)(void *pContext, int step);
+
+// handlesEvents and postsEvents are notification event bits. A step posting an event must depend on
+// every other step that registers a handler for it, so nothing is posted before its handlers exist
+typedef struct InitGraphStep_t
+{
+    const char *name;
+    uint32_t dependsOn;
+    uint64_t handlesEvents;
+    uint64_t postsEvents;
+} InitGraphStep;
+
+// Shared by the workers running the graph. Done steps are bits in doneEvents
+typedef struct InitGraph_t
+{
+    const InitGraphStep *pSteps;
+    int numSteps;
+    InitGraphStepFunction stepFunction;
+    void *pContext;
+    EventGroupHandle_t doneEvents;
+    portMUX_TYPE lock;
+    uint32_t startedSteps;
+} InitGraph;
+
+esp_err_t InitGraph_Init(InitGraph *this, const InitGraphStep *pSteps, int numSteps, InitGraphStepFunction stepFunction, void *pContext);
+// Each worker calls Run. A worker returns once every step has started, so wait for the helpers
+void InitGraph_Run(InitGraph *this);
+void InitGraph_HelperDone(InitGraph *this);
+void InitGraph_WaitHelperDone(InitGraph *this);
+void InitGraph_Deinit(InitGraph *this);
+
+// Subsystem init steps of SystemState, in the order ready steps are picked
+typedef enum SystemStateInitStep_e
+{
+    INIT_STEP_BATTERY,
+    INIT_STEP_USER_SETTINGS,
+    INIT_STEP_LED_SEQUENCES,
+    INIT_STEP_BADGE_STATS,
+    INIT_STEP_GAME_STATE,
+    INIT_STEP_BLE,
+    INIT_STEP_GPIO,
+    INIT_STEP_TOUCH,
+    INIT_STEP_LED_CONTROL,
+    INIT_STEP_WIFI,
+    INIT_STEP_SYNTH,
+    INIT_STEP_OTA,
+    INIT_STEP_HTTP,
+    INIT_STEP_COUNT
+} SystemStateInitStep;
+
+extern const InitGraphStep SystemStateInitSteps[INIT_STEP_COUNT];
+
+#endif // INIT_GRAPH_H_
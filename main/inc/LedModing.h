@@ -3,6 +3,9 @@
 
 #include <stdio.h>
 
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
 #include "LedControl.h"
 
 typedef struct LedModing_t
@@ -22,6 +25,8 @@ typedef struct LedModing_t
     bool bleReconnecting;
     // LedStatusIndicator curStatusIndicator;
     LedControl *pLedControl;
+    // Setters run on both notification lanes and in timer callbacks
+    SemaphoreHandle_t modeMutex;
 } LedModing;
 
 esp_err_t LedModing_Init(LedModing *this, LedControl *pLedControl);
@@ -0,0 +1,54 @@
+#ifndef MEMTRACK_H_
+#define MEMTRACK_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "sdkconfig.h"
+
+// Subsystems whose heap use is tracked. Blocks carry their tag so frees need no tag
+typedef enum MemTag_e
+{
+    MEM_TAG_LED_SEQUENCES,
+    MEM_TAG_SEEN_EVENT_MAP,
+    MEM_TAG_HTTP_QUEUE,
+    MEM_TAG_HTTP_REQUEST,
+    MEM_TAG_CJSON,
+    MEM_TAG_COUNT
+} MemTag;
+
+typedef struct MemTrackStats_t
+{
+    uint32_t liveBytes;
+    uint32_t peakBytes;
+    uint32_t liveBlocks;
+    uint32_t allocCount;
+    uint32_t freeCount;
+    uint32_t failedCount;
+} MemTrackStats;
+
+const char *MemTrack_GetTagName(MemTag tag);
+
+#if CONFIG_MEM_TRACK
+
+void *MemTrack_Malloc(MemTag tag, size_t size);
+void *MemTrack_Calloc(MemTag tag, size_t count, size_t size);
+void MemTrack_Free(void *pMemory);
+void MemTrack_GetStats(MemTag tag, MemTrackStats *pStats);
+
+// Records current live bytes so later growth can be checked against it
+void MemTrack_Mark(void);
+// Bytes gained by the tag since the last mark. Non zero after a balanced workload is a leak
+int32_t MemTrack_GetGrowthSinceMark(MemTag tag);
+
+#else
+
+static inline void *MemTrack_Malloc(MemTag tag, size_t size) { return malloc(size); }
+static inline void *MemTrack_Calloc(MemTag tag, size_t count, size_t size) { return calloc(count, size); }
+static inline void MemTrack_Free(void *pMemory) { free(pMemory); }
+
+#endif // CONFIG_MEM_TRACK
+
+#endif // MEMTRACK_H_
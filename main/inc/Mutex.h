@@ -7,4 +7,19 @@ esp_err_t Mutex_Free(SemaphoreHandle_t *pMutex);
 esp_err_t Mutex_Lock(SemaphoreHandle_t *pMutex, TickType_t xTicksToWait);
 esp_err_t Mutex_Unlock(SemaphoreHandle_t *pMutex);
 
+// Many readers or one writer. The write semaphore is binary rather than a mutex
+// because the last reader out may not be the reader that took it
+typedef struct RWLock_t
+{
+    SemaphoreHandle_t readerMutex;
+    SemaphoreHandle_t writeSemaphore;
+    uint32_t readerCount;
+} RWLock;
+
+esp_err_t RWLock_Create(RWLock *pLock);
+esp_err_t RWLock_ReadLock(RWLock *pLock, TickType_t xTicksToWait);
+esp_err_t RWLock_ReadUnlock(RWLock *pLock);
+esp_err_t RWLock_WriteLock(RWLock *pLock, TickType_t xTicksToWait);
+esp_err_t RWLock_WriteUnlock(RWLock *pLock);
+
 #endif // MUTEX_JOSE_H_
@@ -2,6 +2,8 @@
 #ifndef NOTE_FREQUENCIES_H_
 #define NOTE_FREQUENCIES_H_
 
+#include <stdint.h>
+
 typedef enum NoteNameBase_t
 {
   NOTE_BASE_NONE = -1,
@@ -357,7 +359,7 @@ typedef enum NoteName_t
 #define FREQ_NOTE_BF8 7458.62
 #define FREQ_NOTE_B8  7902.13
 
-float GetNoteFrequency(NoteName note);
+uint16_t GetNoteFrequency(NoteName note);
 NoteParts GetNoteParts(NoteName note);
 
 #endif // NOTE_FREQUENCIES_H_
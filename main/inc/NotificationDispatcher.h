@@ -2,10 +2,28 @@
 #ifndef NOTIFICATION_DISPATCHER_H_
 #define NOTIFICATION_DISPATCHER_H_
 
+#include <stdatomic.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
 #include "esp_event.h"
 
 #define DEFAULT_NOTIFY_WAIT_DURATION 100 //ms
 
+// Size of each lane's queue before dropping messages. Must be powers of two
+#define NOTIFICATION_QUEUE_SIZE                 (128)
+#define NOTIFICATION_HIGH_QUEUE_SIZE            (32)
+#define NOTIFICATION_MAX_SUBSCRIBERS_PER_EVENT  (8)
+
+// Fixed block payload pools. Larger payloads fall back to the heap
+#define NOTIFICATION_POOL_SMALL_BLOCK_SIZE      (64)
+#define NOTIFICATION_POOL_SMALL_BLOCK_COUNT     (NOTIFICATION_QUEUE_SIZE + NOTIFICATION_HIGH_QUEUE_SIZE)
+#define NOTIFICATION_POOL_LARGE_BLOCK_SIZE      (1024)      // Fits HeartBeatRequest
+#define NOTIFICATION_POOL_LARGE_BLOCK_COUNT     (4)
+
+// Log2 microsecond buckets. Bucket 0 is under 1us, bucket n covers [2^(n-1), 2^n) us, the last bucket is open ended
+#define NOTIFICATION_TRACE_HISTOGRAM_BUCKETS    (16)
+
 typedef enum NotificationEvents_e
 {
     NOTIFICATION_EVENTS_TOUCH_SENSE_ACTION,
@@ -42,20 +60,166 @@ typedef enum NotificationEvents_e
     NOTIFICATION_EVENTS_SONG_NOTE_ACTION,
     NOTIFICATION_EVENTS_OCARINA_SONG_MATCHED,
     NOTIFICATION_EVENTS_INTERACTIVE_GAME_STATE_CHANGE,
-    NOTIFICATION_EVENTS_INTERACTIVE_GAME_ACTION
+    NOTIFICATION_EVENTS_INTERACTIVE_GAME_ACTION,
+    NOTIFICATION_EVENTS_COUNT
 } NotificationEvent;
 
+// Each lane has its own queue and dispatch task. Events not listed as high priority go to the bulk lane
+typedef enum NotificationLaneIndex_e
+{
+    NOTIFICATION_LANE_BULK,         // Peer reports, heartbeats, stats and everything else
+    NOTIFICATION_LANE_HIGH,         // Touch, song note and LED mode changes
+    NOTIFICATION_LANE_COUNT
+} NotificationLaneIndex;
+
+typedef enum NotificationPoolIndex_e
+{
+    NOTIFICATION_POOL_SMALL,
+    NOTIFICATION_POOL_LARGE,
+    NOTIFICATION_POOL_COUNT,
+    NOTIFICATION_POOL_HEAP = NOTIFICATION_POOL_COUNT,
+} NotificationPoolIndex;
+
+// Precedes every payload handed to subscribers
+typedef struct NotificationPayloadHeader_t
+{
+    struct NotificationPayloadHeader_t *pNext;  // Free list link while in the pool
+    uint32_t size;
+    uint16_t refCount;
+    uint8_t poolIndex;
+} NotificationPayloadHeader;
+
+typedef struct NotificationPoolStats_t
+{
+    uint32_t blockSize;
+    uint32_t blockCount;
+    uint32_t inUse;
+    uint32_t highWater;
+    uint32_t acquired;
+    uint32_t exhausted;         // Acquires that found the pool empty
+} NotificationPoolStats;
+
+typedef struct NotificationPool_t
+{
+    uint8_t *pBlocks;
+    NotificationPayloadHeader *pFreeList;
+    NotificationPoolStats stats;
+} NotificationPool;
+
+typedef enum NotificationTraceType_e
+{
+    NOTIFICATION_TRACE_POST,        // durationUs unused
+    NOTIFICATION_TRACE_DISPATCH,    // durationUs is post to dispatch latency
+    NOTIFICATION_TRACE_HANDLER,     // timestampUs is handler start, durationUs is its run time
+} NotificationTraceType;
+
+typedef struct NotificationTraceRecord_t
+{
+    uint32_t timestampUs;
+    uint32_t durationUs;
+    uint16_t taskNumber;            // Producer task (uxTaskGetTaskNumber)
+    uint8_t type;
+    uint8_t notificationEvent;
+    uint8_t queueDepth;
+    uint8_t handlerIndex;
+    uint8_t lane;
+    uint8_t reserved;
+} NotificationTraceRecord;
+
+typedef struct NotificationHistogram_t
+{
+    uint32_t buckets[NOTIFICATION_TRACE_HISTOGRAM_BUCKETS];
+    uint32_t count;
+    uint32_t maxUs;
+} NotificationHistogram;
+
+typedef struct NotificationTrace_t
+{
+    NotificationTraceRecord *pRecords;
+    uint32_t head;                  // Next record written
+    uint32_t tail;                  // Next record drained
+    uint32_t overwritten;           // Records lost because the ring was not drained
+    NotificationHistogram dispatchLatency[NOTIFICATION_EVENTS_COUNT];
+    NotificationHistogram handlerTime[NOTIFICATION_EVENTS_COUNT];
+    uint64_t overheadCycles;        // Time spent tracing, to keep the cost visible
+    uint32_t overheadSamples;
+} NotificationTrace;
+
+typedef struct NotificationSubscriber_t
+{
+    esp_event_handler_t eventHandler;
+    void *eventHandlerArgs;
+} NotificationSubscriber;
+
+// Slot of a bounded MPSC ring. sequence tells producers and the consumer who owns the slot
+typedef struct NotificationSlot_t
+{
+    atomic_uint sequence;
+    NotificationEvent notificationEvent;
+    void *pData;                // Payload reference owned by the ring until dispatched
+    uint32_t postTimeUs;        // Only set while tracing
+    uint16_t producerTask;
+} NotificationSlot;
+
+typedef struct NotificationRing_t
+{
+    atomic_uint enqueuePos;     // Claimed by producers with compare and swap
+    uint32_t dequeuePos;        // Only touched by the dispatch task
+    atomic_uint droppedCount;   // Posts that timed out on a full ring
+    uint32_t size;
+    NotificationSlot slots[];
+} NotificationRing;
+
+typedef struct NotificationLane_t
+{
+    struct NotificationDispatcher_t *pNotificationDispatcher;
+    NotificationRing *pRing;    // Allocated in internal RAM, compare and swap does not work on PSRAM
+    TaskHandle_t dispatchTaskHandle;
+    NotificationLaneIndex laneIndex;
+} NotificationLane;
+
 typedef struct NotificationDispatcher_t
 {
-    esp_event_loop_handle_t eventLoopHandle;
     esp_event_base_t notificationEventBase;
-    SemaphoreHandle_t notifyMutex;
+    NotificationLane lanes[NOTIFICATION_LANE_COUNT];
+
+    // Append only so the dispatch task can read it without a lock
+    NotificationSubscriber subscribers[NOTIFICATION_EVENTS_COUNT][NOTIFICATION_MAX_SUBSCRIBERS_PER_EVENT];
+    atomic_uint subscriberCount[NOTIFICATION_EVENTS_COUNT];
+    portMUX_TYPE registerLock;
+
+    NotificationPool pools[NOTIFICATION_POOL_COUNT];
+    uint32_t heapPayloads;      // Payloads that did not fit or found every pool empty
+    portMUX_TYPE poolLock;
+
+    NotificationTrace *pTrace;  // Allocated when tracing first starts
+    volatile bool traceEnabled;
+    portMUX_TYPE traceLock;
 } NotificationDispatcher;
 
 esp_err_t NotificationDispatcher_Init(NotificationDispatcher *this);
 esp_err_t NotificationDispatcher_NotifyEvent(NotificationDispatcher *this, NotificationEvent notificationEvent, void *data, int dataSize, uint32_t waitDurationMSec);
 esp_err_t NotificationDispatcher_RegisterNotificationEventHandler(NotificationDispatcher *this, NotificationEvent notificationEvent, esp_event_handler_t eventHandler, void *eventHandlerArgs);
 
+// Zero copy posting. Acquire a payload, fill it in place and post it with NotifyPayload, which takes
+// over the caller's reference. Subscribers that keep a payload past their handler Retain and later
+// Release it. The payload returns to its pool when the last reference is released
+void *NotificationDispatcher_AcquirePayload(NotificationDispatcher *this, size_t size);
+esp_err_t NotificationDispatcher_NotifyPayload(NotificationDispatcher *this, NotificationEvent notificationEvent, void *pPayload, uint32_t waitDurationMSec);
+void NotificationDispatcher_RetainPayload(NotificationDispatcher *this, void *pPayload);
+void NotificationDispatcher_ReleasePayload(NotificationDispatcher *this, void *pPayload);
+esp_err_t NotificationDispatcher_GetPoolStats(NotificationDispatcher *this, NotificationPoolStats pStats[NOTIFICATION_POOL_COUNT], uint32_t *pHeapPayloads);
+
+// Tracing. Records posts, dispatches and handler runs into a ring drained from the console
+esp_err_t NotificationDispatcher_SetTraceEnabled(NotificationDispatcher *this, bool enabled);
+bool NotificationDispatcher_IsTraceEnabled(NotificationDispatcher *this);
+size_t NotificationDispatcher_DrainTrace(NotificationDispatcher *this, NotificationTraceRecord *pRecords, size_t maxRecords, uint32_t *pOverwritten);
+esp_err_t NotificationDispatcher_GetTraceHistograms(NotificationDispatcher *this, NotificationEvent notificationEvent, NotificationHistogram *pDispatchLatency, NotificationHistogram *pHandlerTime);
+void NotificationDispatcher_ResetTraceHistograms(NotificationDispatcher *this);
+uint32_t NotificationDispatcher_GetTraceOverheadNs(NotificationDispatcher *this);
+uint32_t NotificationDispatcher_GetDroppedCount(NotificationDispatcher *this, NotificationLaneIndex laneIndex);
+NotificationLaneIndex NotificationDispatcher_GetEventLane(NotificationEvent notificationEvent);
+
 
 
 #endif // NOTIFICATION_DISPATCHER_H_
@@ -0,0 +1,53 @@
+#ifndef OCARINA_MATCHER_H_
+#define OCARINA_MATCHER_H_
+
+#include <stdint.h>
+
+#include "Song.h"
+
+#define OCARINA_SONG_MAX_NAME_LENGTH 32
+#define OCARINA_MAX_SONG_KEYS 8
+#define OCARINA_NUM_SONGS 12
+// Worst case the song key sets share no prefixes, plus the root state
+#define OCARINA_MAX_MATCH_STATES (OCARINA_NUM_SONGS * OCARINA_MAX_SONG_KEYS + 1)
+
+typedef enum OcarinaKey_t
+{
+  OCARINA_KEY_L = 0,  // D3
+  UNUSED_KEY_E3,
+  OCARINA_KEY_R,      // F3
+  UNUSED_KEY_G3,
+  OCARINA_KEY_Y,      // A4
+  OCARINA_KEY_X,      // B4
+  UNUSED_KEY_C4,
+  OCARINA_KEY_A,      // D4
+  UNUSED_KEY_E4,
+  OCARINA_NUM_KEYS
+} OcarinaKey;
+
+
+typedef struct OcarinaKeySet_t {
+  const char Name[OCARINA_SONG_MAX_NAME_LENGTH];
+  int NumKeys;
+  Song Song;
+  OcarinaKey Keys[OCARINA_MAX_SONG_KEYS];
+} OcarinaKeySet;
+
+extern const OcarinaKeySet OcarinaSongKeySets[OCARINA_NUM_SONGS];
+
+// Aho-Corasick automaton over the song key sets, built once with failure links folded in.
+// Each key press is a single transition, matchedKeySet is the first key set ending at a state or -1
+typedef struct OcarinaMatcher_t
+{
+    uint8_t state;
+    uint8_t numStates;
+    uint8_t transitions[OCARINA_MAX_MATCH_STATES][OCARINA_NUM_KEYS];
+    int8_t matchedKeySet[OCARINA_MAX_MATCH_STATES];
+} OcarinaMatcher;
+
+void OcarinaMatcher_Build(OcarinaMatcher *this, const OcarinaKeySet *pKeySets, int numKeySets);
+void OcarinaMatcher_Reset(OcarinaMatcher *this);
+// Returns the index of the key set completed by this key, or -1. A match resets to the root state
+int OcarinaMatcher_PressKey(OcarinaMatcher *this, OcarinaKey key);
+
+#endif // OCARINA_MATCHER_H_
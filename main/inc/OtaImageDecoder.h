@@ -0,0 +1,60 @@
+#ifndef OTA_IMAGE_DECODER_H_
+#define OTA_IMAGE_DECODER_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "esp_err.h"
+#include "esp_partition.h"
+#include "rom/miniz.h"
+
+// Delta patch records, little endian. Applied to the inflated stream
+//   COPY:   u8 type, u32 source offset, u32 length  -> bytes copied from the running partition
+//   INSERT: u8 type, u32 length, length bytes       -> literal bytes
+//   END:    u8 type
+#define OTA_DELTA_RECORD_COPY       0
+#define OTA_DELTA_RECORD_INSERT     1
+#define OTA_DELTA_RECORD_END        2
+#define OTA_DELTA_RECORD_MAX_HEADER 9
+
+typedef enum OtaImageEncoding_e
+{
+    OTA_IMAGE_ENCODING_RAW = 0,
+    OTA_IMAGE_ENCODING_DEFLATE,     // zlib stream of the full image
+    OTA_IMAGE_ENCODING_DELTA,       // zlib stream of delta records against the running partition
+    OTA_IMAGE_ENCODING_UNKNOWN,
+} OtaImageEncoding;
+
+typedef struct OtaImageDecoder_t
+{
+    OtaImageEncoding encoding;
+    const esp_partition_t *pTarget;
+    const esp_partition_t *pSource;
+    uint32_t outputOffset;          // Bytes written into the target partition
+    uint32_t erasedEnd;
+
+    // Inflate state, the dictionary doubles as the output window
+    tinfl_decompressor *pInflator;
+    uint8_t *pDictionary;
+    size_t dictionaryOffset;
+    bool inflateDone;
+
+    // Delta state
+    uint8_t recordHeader[OTA_DELTA_RECORD_MAX_HEADER];
+    size_t recordHeaderLength;
+    uint32_t insertRemaining;
+    uint8_t *pCopyBuffer;
+    bool deltaDone;
+} OtaImageDecoder;
+
+esp_err_t OtaImageDecoder_Init(OtaImageDecoder *this, OtaImageEncoding encoding, const esp_partition_t *pTarget, uint32_t startOffset);
+void OtaImageDecoder_Deinit(OtaImageDecoder *this);
+
+// Decodes a chunk of the transfer stream into the target partition
+esp_err_t OtaImageDecoder_Write(OtaImageDecoder *this, const uint8_t *pData, size_t length);
+
+// Checks the stream was complete. Returns the decoded image size in pImageSize
+esp_err_t OtaImageDecoder_Finish(OtaImageDecoder *this, uint32_t *pImageSize);
+
+#endif // OTA_IMAGE_DECODER_H_
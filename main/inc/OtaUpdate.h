@@ -4,14 +4,68 @@
 #include "esp_err.h"
 
 #include "NotificationDispatcher.h"
-#include "WifiClient.h"
+
+// Only the task talks to the WiFi client, so the check code builds without it
+typedef struct WifiClient_t WifiClient;
+
+#define OTA_MANIFEST_SHA256_HEX_LENGTH  64
+#define OTA_MANIFEST_MAX_URL_LENGTH     256
+#define OTA_MANIFEST_MAX_SIGNED_LENGTH  (3 * OTA_MANIFEST_MAX_URL_LENGTH + 256)
+#define OTA_MANIFEST_MAX_SIGNATURE_SIZE 512
+#define OTA_MANIFEST_MAX_PUBLIC_KEY_SIZE 600     // DER SubjectPublicKeyInfo, up to RSA 4096
+
+// Small descriptor served next to the firmware so checks don't need to open the image
+typedef struct OtaUpdate_Manifest_t
+{
+  char version[32];
+  char elfSha256[OTA_MANIFEST_SHA256_HEX_LENGTH + 1];
+  uint32_t size;
+  char url[OTA_MANIFEST_MAX_URL_LENGTH];
+
+  // Optional encoded streams of the same image, empty when not offered
+  char deflateUrl[OTA_MANIFEST_MAX_URL_LENGTH];
+  uint32_t deflateSize;
+  char deltaUrl[OTA_MANIFEST_MAX_URL_LENGTH];
+  uint32_t deltaSize;
+  char deltaSourceSha256[OTA_MANIFEST_SHA256_HEX_LENGTH + 1];   // Delta only applies on top of this image
+} OtaUpdate_Manifest;
+
+typedef struct OtaUpdate_Stats_t
+{
+  uint32_t checks;
+  uint32_t downloadsSkipped;      // Manifest matched the running app
+  uint32_t downloadsStarted;
+  uint32_t manifestFallbacks;     // No manifest, image header was read instead
+  uint32_t lastCheckBytes;        // Body bytes transferred by the last check
+  uint64_t totalBytes;
+  uint32_t resumes;               // Downloads continued from a saved offset
+} OtaUpdate_Stats;
+
+// Persisted in NVS while streaming a raw image into the inactive slot
+typedef struct OtaUpdate_ResumeState_t
+{
+  char elfSha256[OTA_MANIFEST_SHA256_HEX_LENGTH + 1];
+  uint32_t imageSize;
+  uint32_t partitionAddress;
+  uint32_t offset;
+} OtaUpdate_ResumeState;
+
+typedef void (*OtaUpdate_ProgressCallback)(void *pContext, uint32_t bytesWritten, uint32_t imageSize);
 
 typedef struct OtaUpdate_t
 {
   WifiClient *pWifiClient;
   NotificationDispatcher * pNotificationDispatcher;
+  OtaUpdate_Stats stats;
+  OtaUpdate_Manifest manifest;      // Last fetched manifest, kept off the task stack
+  OtaUpdate_ProgressCallback progressCallback;
+  void *pProgressContext;
+  TickType_t nextProgressTime;
 } OtaUpdate;
 
 esp_err_t OtaUpdate_Init(OtaUpdate *this, WifiClient *pWifiClient, NotificationDispatcher * pNotificationDispatcher);
 
+// Called from the OTA task at most once per CONFIG_OTA_PROGRESS_INTERVAL_MS while downloading
+esp_err_t OtaUpdate_SetProgressCallback(OtaUpdate *this, OtaUpdate_ProgressCallback callback, void *pContext);
+
 #endif // OTA_UPDATE_TASK_H
\ No newline at end of file
@@ -0,0 +1,16 @@
+#ifndef OTA_UPDATE_CHECK_H
+#define OTA_UPDATE_CHECK_H
+
+#include "OtaUpdate.h"
+
+#define OTA_HTTP_RESPONSE_BUFFER_SIZE 2048
+
+// Runs one check over a connected link and adds its transfer to this->stats. Restarts the
+// badge when a new image was installed. response_buffer holds OTA_HTTP_RESPONSE_BUFFER_SIZE + 1 bytes
+void OtaUpdate_RunCheck(OtaUpdate * this, char * response_buffer);
+
+#if CONFIG_OTA_RESUMABLE_DOWNLOAD
+esp_err_t OtaUpdate_LoadResumeState(OtaUpdate_ResumeState * pState);
+#endif // CONFIG_OTA_RESUMABLE_DOWNLOAD
+
+#endif // OTA_UPDATE_CHECK_H
@@ -0,0 +1,43 @@
+#ifndef POLY_SYNTH_H_
+#define POLY_SYNTH_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "driver/gpio.h"
+#include "driver/i2s_pdm.h"
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "PolySynthMixer.h"
+
+#define POLY_SYNTH_DMA_BUFFERS      (3)
+
+// Render cost per DMA buffer against the time the buffer takes to play
+typedef struct PolySynthStats_t
+{
+    uint32_t renderedBuffers;
+    uint32_t lastRenderUs;
+    uint32_t maxRenderUs;
+    uint32_t budgetUs;
+    uint32_t overBudgetCount;
+} PolySynthStats;
+
+typedef struct PolySynth_t
+{
+    PolySynthMixer mixer;
+    portMUX_TYPE statsLock;
+    i2s_chan_handle_t txChannel;
+    TaskHandle_t renderTaskHandle;
+    PolySynthStats stats;
+    int16_t buffer[POLY_SYNTH_BUFFER_SAMPLES];
+} PolySynth;
+
+esp_err_t PolySynth_Init(PolySynth *this, gpio_num_t gpio);
+esp_err_t PolySynth_NoteOn(PolySynth *this, int voice, uint32_t frequencyHz, PolySynthWaveform waveform);
+esp_err_t PolySynth_NoteOff(PolySynth *this, int voice);
+void PolySynth_AllNotesOff(PolySynth *this);
+void PolySynth_GetStats(PolySynth *this, PolySynthStats *pStats);
+
+#endif // POLY_SYNTH_H_
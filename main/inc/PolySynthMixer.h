@@ -0,0 +1,65 @@
+#ifndef POLY_SYNTH_MIXER_H_
+#define POLY_SYNTH_MIXER_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+
+#include "sdkconfig.h"
+
+#ifdef CONFIG_SYNTH_POLY_VOICES
+#define POLY_SYNTH_MAX_VOICES       CONFIG_SYNTH_POLY_VOICES
+#define POLY_SYNTH_SAMPLE_RATE      CONFIG_SYNTH_POLY_SAMPLE_RATE
+#else
+#define POLY_SYNTH_MAX_VOICES       (4)
+#define POLY_SYNTH_SAMPLE_RATE      (16000)
+#endif
+#define POLY_SYNTH_BUFFER_SAMPLES   (128)
+#define POLY_SYNTH_WAVETABLE_SIZE   (256)
+
+typedef enum PolySynthWaveform_e
+{
+    POLY_SYNTH_WAVEFORM_SQUARE = 0,
+    POLY_SYNTH_WAVEFORM_SINE,
+} PolySynthWaveform;
+
+typedef enum PolySynthEnvelopeStage_e
+{
+    POLY_SYNTH_ENVELOPE_IDLE = 0,
+    POLY_SYNTH_ENVELOPE_ATTACK,
+    POLY_SYNTH_ENVELOPE_SUSTAIN,
+    POLY_SYNTH_ENVELOPE_RELEASE,
+} PolySynthEnvelopeStage;
+
+// Phase is a 32 bit accumulator, level is Q15
+typedef struct PolySynthVoice_t
+{
+    // Written by NoteOn/NoteOff under voiceLock
+    uint32_t phaseIncrement;
+    PolySynthWaveform waveform;
+    bool gate;
+    uint32_t triggerCount;
+
+    // Owned by the render task
+    uint32_t phase;
+    int32_t level;
+    PolySynthEnvelopeStage stage;
+    uint32_t renderedTriggerCount;
+} PolySynthVoice;
+
+// Voices and their envelopes, mixed into sample buffers. No hardware, so it renders on the host too
+typedef struct PolySynthMixer_t
+{
+    PolySynthVoice voices[POLY_SYNTH_MAX_VOICES];
+    portMUX_TYPE voiceLock;
+} PolySynthMixer;
+
+void PolySynthMixer_Init(PolySynthMixer *this);
+esp_err_t PolySynthMixer_NoteOn(PolySynthMixer *this, int voice, uint32_t frequencyHz, PolySynthWaveform waveform);
+esp_err_t PolySynthMixer_NoteOff(PolySynthMixer *this, int voice);
+// Renders one buffer. Returns false once every voice is idle
+bool PolySynthMixer_Render(PolySynthMixer *this, int16_t *pBuffer);
+
+#endif // POLY_SYNTH_MIXER_H_
@@ -0,0 +1,58 @@
+#ifndef POWER_MANAGER_H_
+#define POWER_MANAGER_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "esp_err.h"
+
+#include "sdkconfig.h"
+
+// Subsystems that need full CPU speed while active. With none held the CPU drops to
+// the idle frequency and, when enabled, light sleeps between task wakeups
+typedef enum PowerLock_e
+{
+    POWER_LOCK_LED_ANIMATION,
+    POWER_LOCK_SYNTH,
+    POWER_LOCK_WIFI,
+    POWER_LOCK_BLE_TRANSFER,
+    POWER_LOCK_COUNT
+} PowerLock;
+
+typedef struct PowerLockStats_t
+{
+    uint32_t holdCount;
+    uint32_t acquireCount;
+    uint64_t heldUs;
+} PowerLockStats;
+
+// Times are since boot or the last reset and include any hold still in progress
+typedef struct PowerStats_t
+{
+    uint64_t elapsedUs;
+    uint64_t performanceUs;     // At least one lock held
+    PowerLockStats locks[POWER_LOCK_COUNT];
+} PowerStats;
+
+const char *PowerManager_GetLockName(PowerLock lock);
+
+#if CONFIG_POWER_MANAGEMENT
+
+esp_err_t PowerManager_Init(void);
+void PowerManager_Acquire(PowerLock lock);
+void PowerManager_Release(PowerLock lock);
+void PowerManager_GetStats(PowerStats *pStats);
+void PowerManager_ResetStats(void);
+// Prints the esp_pm lock table. Time per esp_pm mode is included with CONFIG_PM_PROFILING
+void PowerManager_DumpLocks(FILE *pStream);
+
+#else
+
+static inline esp_err_t PowerManager_Init(void) { return ESP_OK; }
+static inline void PowerManager_Acquire(PowerLock lock) { }
+static inline void PowerManager_Release(PowerLock lock) { }
+
+#endif // CONFIG_POWER_MANAGEMENT
+
+#endif // POWER_MANAGER_H_
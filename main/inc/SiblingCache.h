@@ -0,0 +1,40 @@
+#ifndef SIBLING_CACHE_H_
+#define SIBLING_CACHE_H_
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "esp_err.h"
+
+#include "GameTypes.h"
+#include "Mutex.h"
+
+#define SIBLING_CACHE_CAPACITY                  (32)
+
+// Generation is the heartbeat response that last listed the sibling. Anything older is evicted
+typedef struct SiblingCacheEntry_t
+{
+    uint8_t badgeId[BADGE_ID_SIZE];
+    uint32_t generation;
+    bool inUse;
+    atomic_bool seen;
+} SiblingCacheEntry;
+
+// Written by the HTTP task under the write lock. The peer heartbeat handler only reads
+// entries and flips seen, so it gets by with the read lock
+typedef struct SiblingCache_t
+{
+    SiblingCacheEntry entries[SIBLING_CACHE_CAPACITY];
+    uint32_t generation;
+    RWLock lock;
+} SiblingCache;
+
+esp_err_t SiblingCache_Init(SiblingCache *this);
+bool SiblingCache_DecodeId(const char *badgeIdB64, uint8_t *pBadgeId);
+void SiblingCache_Update(SiblingCache *this, uint8_t badgeIds[][BADGE_ID_SIZE], int count);
+bool SiblingCache_MarkSeen(SiblingCache *this, const char *badgeIdB64);
+
+#endif // SIBLING_CACHE_H_
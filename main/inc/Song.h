@@ -2,44 +2,78 @@
 #ifndef SONG_H_
 #define SONG_H_
 
+#include <stdbool.h>
 #include <stdint.h>
 #include "Notes.h"
 
-#define SONG_MAX_NAME_LENGTH (32)
-#define SONG_MAX_NOTES       (256)
+// Duration codes stored in packed song events, as fractions of a whole note
+typedef enum NoteDuration_e
+{
+    NOTE_DURATION_WHOLE,
+    NOTE_DURATION_HALF,
+    NOTE_DURATION_QUARTER,
+    NOTE_DURATION_EIGHTH,
+    NOTE_DURATION_SIXTEENTH,
+    NOTE_DURATION_THIRTY_SECOND,
+    NOTE_DURATION_SIXTY_FOURTH,
+    NOTE_DURATION_HALF_DOT,
+    NOTE_DURATION_HALF_DOT_DOT,
+    NOTE_DURATION_QUARTER_DOT,
+    NOTE_DURATION_QUARTER_DOT_DOT,
+    NOTE_DURATION_EIGHTH_DOT,
+    NOTE_DURATION_QUARTER_TRIPLET,
+    NOTE_DURATION_QUARTER_TRIPLET_DOUBLE,
+    NOTE_DURATION_QUARTER_NINELET,
+    NUM_NOTE_DURATIONS
+} NoteDuration;
+
+// Songs are stored as packed byte events and decoded in order with a SongCursor
+//   timed event: u8 0x80 | note, u8 slur << 4 | duration  -> sets duration and slur
+//   note event:  u8 note                                   -> reuses the previous duration and slur
+// Note indexes must stay below 0x80, which covers everything up to NOTE_B6
+#define SONG_EVENT_TIMED_FLAG      (0x80)
+#define SONG_EVENT_NOTE_MASK       (0x7F)
+#define SONG_EVENT_DURATION_MASK   (0x0F)
+#define SONG_EVENT_SLUR_SHIFT      (4)
 
-typedef float NoteType;
-#define NOTE_TYPE_WHOLE            (1.0)
-#define NOTE_TYPE_HALF             (1.0/2.0)
-#define NOTE_TYPE_QUARTER          (1.0/4.0)
-#define NOTE_TYPE_EIGHTH           (1.0/8.0)
-#define NOTE_TYPE_SIXTEENTH        (1.0/16.0)
-#define NOTE_TYPE_THIRTY_SECOND    (1.0/32.0)
-#define NOTE_TYPE_SIXTY_FOURTH     (1.0/64.0)
-#define NOTE_TYPE_HALF_DOT         (NOTE_TYPE_HALF+NOTE_TYPE_QUARTER)
-#define NOTE_TYPE_HALF_DOT_DOT     (NOTE_TYPE_HALF_DOT+NOTE_TYPE_EIGHTH)
-#define NOTE_TYPE_QUARTER_DOT      (NOTE_TYPE_QUARTER+NOTE_TYPE_EIGHTH)
-#define NOTE_TYPE_QUARTER_DOT_DOT  (NOTE_TYPE_QUARTER_DOT+NOTE_TYPE_SIXTEENTH)
-#define NOTE_TYPE_EIGHTH_DOT       (NOTE_TYPE_EIGHTH+NOTE_TYPE_SIXTEENTH)
-#define NOTE_TYPE_QUARTER_TRIPLET  (NOTE_TYPE_QUARTER/3.0)
-#define NOTE_TYPE_QUARTER_TRIPLET_DOUBLE  (NOTE_TYPE_QUARTER_TRIPLET * 2.0)
-#define NOTE_TYPE_QUARTER_NINELET  (NOTE_TYPE_QUARTER/9.0)
+#define SONG_NOTE_TIMED(note, duration, slur) \
+    (uint8_t)(SONG_EVENT_TIMED_FLAG | (note)), (uint8_t)(((slur) << SONG_EVENT_SLUR_SHIFT) | NOTE_DURATION_##duration)
+#define SONG_NOTE(note) (uint8_t)(note)
 
 typedef struct Note_t
 {
     NoteName note;
-    NoteType noteType;
+    NoteDuration duration;
+    uint16_t durationMs;
     int slur;
 } Note;
 
 typedef struct SongNotes_t
 {
-    const char songName[SONG_MAX_NAME_LENGTH];
-    int tempo;
-    int numNotes;
-    Note notes[SONG_MAX_NOTES];
+    const char *songName;
+    uint16_t tempo;
+    uint16_t numNotes;
+    uint16_t numEventBytes;
+    const uint8_t *pEvents;
 } SongNotes;
 
+// Note lengths for one tempo, computed when a song starts
+typedef struct SongTiming_t
+{
+    uint16_t tempo;
+    uint16_t durationMs[NUM_NOTE_DURATIONS];
+} SongTiming;
+
+typedef struct SongCursor_t
+{
+    const SongNotes *pSong;
+    SongTiming timing;
+    uint16_t eventOffset;
+    uint16_t noteIdx;
+    NoteDuration duration;
+    int slur;
+} SongCursor;
+
 typedef enum Song_e
 {
     SONG_NONE = -1,
@@ -69,6 +103,12 @@ typedef enum Song_e
 } Song;
 
 const SongNotes * GetSong(Song song);
-int GetNoteTypeInMilliseconds(int tempo, float noteType);
+int GetNoteDurationInMilliseconds(int tempo, NoteDuration duration);
+
+void SongTiming_Init(SongTiming *this, int tempo);
+
+void SongCursor_Init(SongCursor *this, const SongNotes *pSong);
+// Decodes the next note into pNote. Returns false at the end of the song
+bool SongCursor_Next(SongCursor *this, Note *pNote);
 
 #endif // SONG_H_
\ No newline at end of file
@@ -0,0 +1,35 @@
+#ifndef SONG_SEQUENCER_H_
+#define SONG_SEQUENCER_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "esp_err.h"
+#include "esp_timer.h"
+
+#include "Notes.h"
+#include "Song.h"
+
+// Called from the timer task. NOTE_REST means the song voice goes quiet
+typedef void (*SongSequencerToneFunction)(void *pContext, NoteName note);
+// Called from the timer task once the last note has been held
+typedef void (*SongSequencerDoneFunction)(void *pContext);
+
+// Steps a song from an esp_timer against absolute deadlines
+typedef struct SongSequencer_t
+{
+    esp_timer_handle_t timer;
+    SongCursor songCursor;
+    int64_t nextDeadlineUs;
+    int64_t maxLatenessUs;
+    bool releasePending;
+    SongSequencerToneFunction toneFunction;
+    SongSequencerDoneFunction doneFunction;
+    void *pContext;
+} SongSequencer;
+
+esp_err_t SongSequencer_Init(SongSequencer *this, SongSequencerToneFunction toneFunction, SongSequencerDoneFunction doneFunction, void *pContext);
+esp_err_t SongSequencer_Start(SongSequencer *this, const SongNotes *pSong);
+void SongSequencer_Stop(SongSequencer *this);
+
+#endif // SONG_SEQUENCER_H_
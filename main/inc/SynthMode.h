@@ -7,7 +7,9 @@
 #include "CircularBuffer.h"
 #include "LedControl.h"
 #include "NotificationDispatcher.h"
+#include "PolySynth.h"
 #include "Song.h"
+#include "SongSequencer.h"
 #include "SynthModeNotifications.h"
 #include "UserSettings.h"
 #include "Utilities.h"
@@ -19,11 +21,16 @@ typedef struct SynthMode_t
     bool touchSoundEnabled;
     int octaveShift;
     Song selectedSong;
-    int currentNoteIdx;
     CircularBuffer songQueue;
-    SemaphoreHandle_t queueMutex;
     SemaphoreHandle_t toneMutex;
-    TickType_t nextNotePlayTime;
+    TaskHandle_t taskHandle;
+
+    SongSequencer sequencer;
+    volatile bool songFinished;
+
+#if CONFIG_SYNTH_POLYPHONIC
+    PolySynth polySynth;
+#endif
     NotificationDispatcher* pNotificationDispatcher;
     UserSettings* pUserSettings;
 } SynthMode;
@@ -39,6 +39,8 @@ typedef struct SystemState_t
     bool networkTestActive;
     bool peerSongPlaying;
     bool peerSongWaitingCooldown;
+    portMUX_TYPE peerSongLock;      // Peer song flags are written on both notification lanes and by the cooldown timer
+    portMUX_TYPE menuLock;          // Touch menu flags are written by touch commands (high lane), the bulk lane and the menu timers
     bool bleReconnecting;
     InteractiveGameData interactiveGameTouchSensorsToLightBits;
     TimerHandle_t touchActiveTimer;
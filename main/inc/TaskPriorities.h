@@ -1,8 +1,12 @@
 #ifndef TASK_PRIORITIES_H_
 #define TASK_PRIORITIES_H_
 
+#include "sdkconfig.h"
+
 // FreeRTOS priority increases with larger integers
 #define BLE_CONTROL_TASK_PRIORITY           21
+#define SYNTH_RENDER_TASK_PRIORITY          17
+#define NOTIFICATIONS_HIGH_TASK_PRIORITY    16
 #define LED_CONTROL_TASK_PRIORITY           15
 #define TOUCH_SENSOR_TASK_PRIORITY          14
 #define SYSTEM_STATE_TASK_PRIORITY          13
@@ -11,7 +15,7 @@
 #define WIFI_CONTROL_TASK_PRIORITY          10
 #define GAME_STATE_TASK_PRIORITY            9
 #define CAPT_DNS_TASK_PRIORITY              8
-#define NOTIFICATIONS_TASK_PRIORITY         7
+#define NOTIFICATIONS_BULK_TASK_PRIORITY    7
 #define BLE_DISABLE_TASK_PRIORITY           6
 #define CONSOLE_TASK_PRIORITY               5
 #define USER_SETTINGS_TASK_PRIORITY         4
@@ -19,4 +23,23 @@
 #define OTA_UPDATE_TASK_PRIORITY            2
 #define BATT_SENSE_TASK_PRIORITY            1
 
+// Core placement from Kconfig, applied at create time. -1 lets the task run on either core
+#define TASK_CORE(kconfigCore)              (((kconfigCore) < 0) ? tskNO_AFFINITY : (kconfigCore))
+#define LED_CONTROL_TASK_CORE               TASK_CORE(CONFIG_LED_CONTROL_TASK_CORE)
+#define TOUCH_SENSOR_TASK_CORE              TASK_CORE(CONFIG_TOUCH_SENSOR_TASK_CORE)
+#define SYNTH_MODE_TASK_CORE                TASK_CORE(CONFIG_SYNTH_MODE_TASK_CORE)
+#define NOTIFICATIONS_HIGH_TASK_CORE        TASK_CORE(CONFIG_NOTIFICATIONS_HIGH_TASK_CORE)
+#define NOTIFICATIONS_BULK_TASK_CORE        TASK_CORE(CONFIG_NOTIFICATIONS_BULK_TASK_CORE)
+#define SYSTEM_STATE_TASK_CORE              TASK_CORE(CONFIG_SYSTEM_STATE_TASK_CORE)
+#define BLE_CONTROL_TASK_CORE               TASK_CORE(CONFIG_BLE_CONTROL_TASK_CORE)
+#define HTTP_GAME_CLIENT_TASK_CORE          TASK_CORE(CONFIG_HTTP_GAME_CLIENT_TASK_CORE)
+#define WIFI_CONTROL_TASK_CORE              TASK_CORE(CONFIG_WIFI_CONTROL_TASK_CORE)
+#define GAME_STATE_TASK_CORE                TASK_CORE(CONFIG_GAME_STATE_TASK_CORE)
+#define USER_SETTINGS_TASK_CORE             TASK_CORE(CONFIG_USER_SETTINGS_TASK_CORE)
+#define BADGE_STAT_TASK_CORE                TASK_CORE(CONFIG_BADGE_STAT_TASK_CORE)
+#define OTA_UPDATE_TASK_CORE                TASK_CORE(CONFIG_OTA_UPDATE_TASK_CORE)
+#define BATT_SENSE_TASK_CORE                TASK_CORE(CONFIG_BATT_SENSE_TASK_CORE)
+#define CONSOLE_TASK_CORE                   TASK_CORE(CONFIG_CONSOLE_TASK_CORE)
+#define SYNTH_RENDER_TASK_CORE              SYNTH_MODE_TASK_CORE
+
 #endif // TASK_PRIORITIES_H_
\ No newline at end of file
@@ -19,9 +19,14 @@ typedef enum TouchActionsCmd_e
     TOUCH_ACTIONS_CMD_NETWORK_TEST
 } TouchActionsCmd;
 
+// Power of two, at least twice the largest gesture table
+#define TOUCH_ACTIONS_GESTURE_SLOTS (32)
+
 typedef struct TouchActions_t
 {
     TouchSensorEvent touchSensorValue[TOUCH_SENSOR_NUM_BUTTONS];
+    uint16_t pressedPadMask;
+    uint8_t gestureSlots[TOUCH_ACTIONS_GESTURE_SLOTS];
     NotificationDispatcher *pNotificationDispatcher;
 } TouchActions;
 
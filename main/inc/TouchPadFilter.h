@@ -0,0 +1,29 @@
+#ifndef TOUCH_PAD_FILTER_H_
+#define TOUCH_PAD_FILTER_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define TOUCH_PAD_FILTER_HISTORY_SIZE (3)
+
+// Baseline and noise are Q4 fixed point and lastValue is the latest sample fed to the baseline.
+// History holds the latest raw samples for spike rejection. A pad reads as touched below
+// touchThreshold and as released again above releaseThreshold
+typedef struct TouchPadFilter_t
+{
+    uint32_t baselineQ4;
+    uint32_t noiseQ4;
+    uint16_t lastValue;
+    uint16_t history[TOUCH_PAD_FILTER_HISTORY_SIZE];
+    uint8_t historyIdx;
+    uint16_t touchThreshold;
+    uint16_t releaseThreshold;
+} TouchPadFilter;
+
+void TouchPadFilter_Reset(TouchPadFilter *this, uint16_t value);
+uint16_t TouchPadFilter_FilterSample(TouchPadFilter *this, uint16_t value);
+void TouchPadFilter_TrackBaseline(TouchPadFilter *this, uint16_t value);
+// Filters a raw sample and returns whether the pad is touched after it. Released samples feed the baseline
+bool TouchPadFilter_Update(TouchPadFilter *this, uint16_t rawValue, bool touched, uint16_t *pFilteredValue);
+
+#endif // TOUCH_PAD_FILTER_H_
@@ -4,8 +4,7 @@
 #include "esp_err.h"
 #include "esp_event.h"
 #include "NotificationDispatcher.h"
-
-#define DELTA_VALUE_HISTORY_SIZE 1
+#include "TouchPadFilter.h"
 
 typedef enum TouchSensorEvent_t
 {
@@ -94,20 +93,31 @@ typedef enum TouchSensorFman25Names_t
 } TouchSensorNames;
 #endif 
 
+// Time from the threshold interrupt to the touched notification being posted
+typedef struct TouchSensorLatencyStats_t
+{
+    uint32_t count;
+    uint32_t lastUs;
+    uint32_t maxUs;
+    uint64_t totalUs;
+} TouchSensorLatencyStats;
+
 typedef struct TouchSensor_t
 {
     NotificationDispatcher *pNotificationDispatcher;
-    int prevDeltaValueCtr[TOUCH_SENSOR_NUM_BUTTONS];
-    int prevDeltaValues[TOUCH_SENSOR_NUM_BUTTONS][DELTA_VALUE_HISTORY_SIZE];
-    int prevTouchValue[TOUCH_SENSOR_NUM_BUTTONS];
+    TaskHandle_t taskHandle;
     int touchSensorActive[TOUCH_SENSOR_NUM_BUTTONS];
     TickType_t touchSensorActiveTimeStamp[TOUCH_SENSOR_NUM_BUTTONS];
-    esp_event_loop_handle_t touch_notify_loop_task;
+    TouchPadFilter padFilter[TOUCH_SENSOR_NUM_BUTTONS];
+    uint16_t padThreshold[TOUCH_SENSOR_NUM_BUTTONS];    // Last touch threshold written to the hardware
+    volatile int64_t interruptTimeUs;
+    TouchSensorLatencyStats latencyStats;
     bool touchEnabled;
 } TouchSensor;
 
 esp_err_t TouchSensor_Init(TouchSensor *this, NotificationDispatcher *pNotificationDispatcher);
 int TouchSensor_GetTouchSensorActive(TouchSensor *this, int pad_num);
 esp_err_t TouchSensor_SetTouchEnabled(TouchSensor *this, bool enabled);
+void TouchSensor_GetLatencyStats(TouchSensor *this, TouchSensorLatencyStats *pStats);
 
 #endif // TOUCH_SENSOR_H_
\ No newline at end of file
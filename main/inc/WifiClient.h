@@ -4,6 +4,7 @@
 #include "freertos/FreeRTOS.h"
 #include "freertos/event_groups.h"
 #include "freertos/semphr.h"
+#include "freertos/timers.h"
 #include "esp_wifi.h"
 #include "esp_netif.h"
 #include "esp_event.h"
@@ -23,6 +24,48 @@ typedef enum WifiClient_State_e
     WIFI_CLIENT_STATE_FAILED,
 } WifiClient_State;
 
+// Enable-to-IP latency histogram bucket upper bounds in ms. Last bucket is open ended
+#define WIFI_CLIENT_LATENCY_BUCKET_BOUNDS_MS { 250, 500, 1000, 2000, 4000, 8000 }
+#define WIFI_CLIENT_NUM_LATENCY_BUCKETS      (7)
+
+typedef enum WifiClient_ConnectPath_e
+{
+    WIFI_CLIENT_CONNECT_PATH_CACHED = 0,    // Directed connect to the cached BSSID/channel
+    WIFI_CLIENT_CONNECT_PATH_SCAN,          // Full all-channel scan before connecting
+    WIFI_CLIENT_NUM_CONNECT_PATHS
+} WifiClient_ConnectPath;
+
+// Last AP we successfully got an IP from. Persisted in NVS
+typedef struct WifiClient_ApCache_t
+{
+    uint8_t ssid[MAX_SSID_LENGTH];
+    uint8_t bssid[6];
+    uint8_t channel;
+    uint8_t authmode;           // wifi_auth_mode_t
+    uint8_t pairwiseCipher;     // wifi_cipher_type_t
+    uint8_t groupCipher;        // wifi_cipher_type_t
+    uint8_t valid;
+} WifiClient_ApCache;
+
+typedef struct WifiClient_LatencyHistogram_t
+{
+    uint32_t buckets[WIFI_CLIENT_NUM_LATENCY_BUCKETS];
+    uint32_t count;
+    uint32_t minMs;
+    uint32_t maxMs;
+    uint64_t totalMs;
+} WifiClient_LatencyHistogram;
+
+typedef struct WifiClient_Stats_t
+{
+    WifiClient_LatencyHistogram enableToIp[WIFI_CLIENT_NUM_CONNECT_PATHS];
+    uint32_t cachedConnectAttempts;
+    uint32_t cachedConnectFallbacks;
+    uint32_t scans;
+    uint32_t connectTimeouts;
+    uint32_t sharedAssociations;    // Connect requests served by an existing association
+} WifiClient_Stats;
+
 typedef struct WifiClient_t
 {
     WifiClient_State state;
@@ -39,6 +82,14 @@ typedef struct WifiClient_t
     TickType_t desiredStartTime;
     int32_t numClients;
 
+    WifiClient_ApCache apCache;
+    WifiClient_ConnectPath connectPath;
+    TickType_t attemptDeadline;
+    TimerHandle_t lingerTimer;
+    int64_t enableStartTimeUs;
+    WifiClient_Stats stats;
+    bool powerLockHeld;         // Held from enable until the radio is stopped
+
     NotificationDispatcher *pNotificationDispatcher;
     UserSettings *pUserSettings;
 } WifiClient;
@@ -69,4 +120,7 @@ WifiClient_State WifiClient_GetState(WifiClient *this);
 
 void WifiClient_TestConnect(WifiClient *this);
 
+// Copies out the connect path counters and enable-to-IP latency histograms
+esp_err_t WifiClient_GetStats(WifiClient *this, WifiClient_Stats *pStats);
+
 #endif // WIFI_CLIENT_H
\ No newline at end of file
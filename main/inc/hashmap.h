@@ -128,6 +128,34 @@ extern "C" {
     hashmap_base_init(&(h)->map_base, (size_t (*)(const void *))__map_hash, (int (*)(const void *, const void *))__map_compare); \
 } while (0)
 
+/*
+ * Initialize an empty fixed capacity hashmap backed by a caller supplied arena.
+ * The map never allocates or rehashes, and hashmap_put() returns -ENOSPC once
+ * it holds capacity entries.
+ *
+ * Parameters:
+ *   HASHMAP(<key_type>, <data_type>) *h - hashmap pointer
+ *   size_t (*hash_func)(const <key_type> *) - as for hashmap_init()
+ *   int (*compare_func)(const <key_type> *, const <key_type> *) - as for hashmap_init()
+ *   void *arena - pointer aligned slab of at least HASHMAP_ARENA_SIZE(capacity, key_size) bytes
+ *   size_t arena_size - size of the slab in bytes
+ *   size_t capacity - maximum number of entries
+ *   size_t key_size - bytes per key slot, or 0 to leave keys owned by the caller
+ *   int (*key_copy_func)(<key_type> *, const <key_type> *, size_t) - copies a key into a slot
+ *              of the given size, returning <0 if it does not fit. NULL copies key_size bytes.
+ *              hashmap_key_copy_string() handles string keys.
+ *
+ * Returns 0 on success, or -EINVAL if the arena is too small or misaligned.
+ */
+#define hashmap_init_arena(h, hash_func, compare_func, arena, arena_size, capacity, key_size, key_copy_func) ({ \
+    typeof((h)->map_types->t_hash_func) __map_hash = (hash_func);       \
+    typeof((h)->map_types->t_compare_func) __map_compare = (compare_func); \
+    int (*__map_key_copy)(typeof((h)->map_types->t_key_dup_func(NULL)), typeof((h)->map_types->t_key), size_t) = (key_copy_func); \
+    hashmap_base_init_arena(&(h)->map_base, (size_t (*)(const void *))__map_hash, \
+        (int (*)(const void *, const void *))__map_compare, (arena), (arena_size), (capacity), \
+        (key_size), (int (*)(void *, const void *, size_t))__map_key_copy); \
+})
+
 /*
  * Free the hashmap and all associated memory.
  *
@@ -436,6 +464,26 @@ extern "C" {
 #define hashmap_collisions_variance(h)                                  \
     hashmap_base_collisions_variance(&(h)->map_base)
 
+/*
+ * Copy the running lookup counters: lookups, probes walked, longest probe,
+ * rehashes and puts rejected by a full arena map.
+ *
+ * Parameters:
+ *   HASHMAP(<key_type>, <data_type>) *h - hashmap pointer
+ *   struct hashmap_stats *stats - destination for the counters
+ */
+#define hashmap_stats(h, stats)                                         \
+    hashmap_base_stats(&(h)->map_base, (stats))
+
+/*
+ * Zero the running lookup counters.
+ *
+ * Parameters:
+ *   HASHMAP(<key_type>, <data_type>) *h - hashmap pointer
+ */
+#define hashmap_stats_reset(h)                                          \
+    hashmap_base_stats_reset(&(h)->map_base)
+
 #ifdef __cplusplus
 }
 #endif
\ No newline at end of file
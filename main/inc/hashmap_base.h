@@ -9,6 +9,15 @@
 
 struct hashmap_entry;
 
+/* Running counters, updated by get, put and remove */
+struct hashmap_stats {
+    size_t lookups;
+    size_t probes;          /* Total collisions walked past by all lookups */
+    size_t max_probe;       /* Longest single probe sequence */
+    size_t rehashes;
+    size_t full;            /* Puts rejected because a fixed capacity map was full */
+};
+
 struct hashmap_base {
     size_t table_size_init;
     size_t table_size;
@@ -18,10 +27,38 @@ struct hashmap_base {
     int (*compare)(const void *, const void *);
     void *(*key_dup)(const void *);
     void (*key_free)(void *);
+
+    /* Arena mode: table and key slots live in a caller supplied slab and never grow */
+    size_t capacity;
+    void *key_slots;
+    size_t key_size;
+    size_t key_slot_size;
+    void *key_free_list;
+    int (*key_copy)(void *, const void *, size_t);
+
+    struct hashmap_stats stats;
 };
 
+/* Table size used by an arena map with the given capacity, keeping the load factor at or below 0.75 */
+#define __HASHMAP_OR_SHIFT(x, s)        ((x) | ((x) >> (s)))
+#define __HASHMAP_ROUND_POW2(x)         (__HASHMAP_OR_SHIFT(__HASHMAP_OR_SHIFT(__HASHMAP_OR_SHIFT( \
+    __HASHMAP_OR_SHIFT(__HASHMAP_OR_SHIFT((size_t)(x) - 1, 1), 2), 4), 8), 16) + 1)
+#define HASHMAP_ARENA_TABLE_SIZE(capacity) __HASHMAP_ROUND_POW2((capacity) + (capacity) / 3)
+
+/* Key slots are pointer aligned and hold the free list link while unused */
+#define HASHMAP_ARENA_KEY_SLOT_SIZE(key_size) \
+    (((key_size) + sizeof(void *) - 1) / sizeof(void *) * sizeof(void *))
+
+/* Bytes of pointer aligned slab needed for an arena map. key_size 0 leaves keys owned by the caller */
+#define HASHMAP_ARENA_SIZE(capacity, key_size) \
+    (HASHMAP_ARENA_TABLE_SIZE(capacity) * 2 * sizeof(void *) + (capacity) * HASHMAP_ARENA_KEY_SLOT_SIZE(key_size))
+
 void hashmap_base_init(struct hashmap_base *hb,
         size_t (*hash_func)(const void *), int (*compare_func)(const void *, const void *));
+int hashmap_base_init_arena(struct hashmap_base *hb,
+        size_t (*hash_func)(const void *), int (*compare_func)(const void *, const void *),
+        void *arena, size_t arena_size, size_t capacity,
+        size_t key_size, int (*key_copy_func)(void *, const void *, size_t));
 void hashmap_base_cleanup(struct hashmap_base *hb);
 
 void hashmap_base_set_key_alloc_funcs(struct hashmap_base *hb,
@@ -49,7 +86,10 @@ double hashmap_base_load_factor(const struct hashmap_base *hb);
 size_t hashmap_base_collisions(const struct hashmap_base *hb, const void *key);
 double hashmap_base_collisions_mean(const struct hashmap_base *hb);
 double hashmap_base_collisions_variance(const struct hashmap_base *hb);
+void hashmap_base_stats(const struct hashmap_base *hb, struct hashmap_stats *stats);
+void hashmap_base_stats_reset(struct hashmap_base *hb);
 
 size_t hashmap_hash_default(const void *data, size_t len);
 size_t hashmap_hash_string(const char *key);
 size_t hashmap_hash_string_i(const char *key);
+int hashmap_key_copy_string(char *dst, const char *src, size_t size);
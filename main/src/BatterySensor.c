@@ -109,7 +109,7 @@ esp_err_t BatterySensor_Init(BatterySensor *this, NotificationDispatcher *pNotif
                 break;
         }
 
-        assert(xTaskCreatePinnedToCore(BatterySensorTask, "BatterySensorTask", configMINIMAL_STACK_SIZE * 2, this, BATT_SENSE_TASK_PRIORITY, NULL, APP_CPU_NUM) == pdPASS);
+        assert(xTaskCreatePinnedToCore(BatterySensorTask, "BatterySensorTask", configMINIMAL_STACK_SIZE * 2, this, BATT_SENSE_TASK_PRIORITY, NULL, BATT_SENSE_TASK_CORE) == pdPASS);
     }
 
     return retVal;
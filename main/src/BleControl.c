@@ -247,7 +247,7 @@ esp_err_t BleControl_Init(BleControl *this, NotificationDispatcher *pNotificatio
 
     /* Set the default device name. */
     assert(ble_svc_gap_device_name_set(this->bleName)==0);
-    assert(xTaskCreatePinnedToCore(_BleControlTask, "NimbleHostTask", NIMBLE_HS_STACK_SIZE, this, BLE_CONTROL_TASK_PRIORITY, NULL, APP_CPU_NUM) == pdPASS);
+    assert(xTaskCreatePinnedToCore(_BleControlTask, "NimbleHostTask", NIMBLE_HS_STACK_SIZE, this, BLE_CONTROL_TASK_PRIORITY, NULL, BLE_CONTROL_TASK_CORE) == pdPASS);
     
     vTaskDelay(1000 / portTICK_PERIOD_MS);
 
@@ -20,6 +20,7 @@
 #include "BleControl_Service.h"
 #include "BleControl_ServiceChar_FileTransfer.h"
 #include "BleControl_ServiceChar_InteractiveGame.h"
+#include "BootProfile.h"
 
 #define TAG "BLE"
 #define BLE_DISABLE_TIMER_TIMEOUT_USEC      60 * 1000 * 1000    // 1 minute of service inactivity
@@ -262,6 +263,7 @@ void _BleControl_StartAdvertisement(BleControl *this, bool advertiseService)
         ESP_LOGE(TAG, "error enabling advertisement; rc=%d", rc);
         return;
     }
+    BootProfile_Milestone(BOOT_MILESTONE_ADVERTISING);
 }
 
 esp_err_t BleControl_UpdateEventId(BleControl *this, char *newEventIdB64)
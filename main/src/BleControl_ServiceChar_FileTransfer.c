@@ -8,6 +8,7 @@
 #include "BleControl_Service.h"
 #include "JsonUtils.h"
 #include "LedSequences.h"
+#include "PowerManager.h"
 
 static esp_err_t _BleControl_ProcessTransferedFile(BleControl *this);
 static esp_err_t _BleControl_VerifyAllFramesPresent(BleControl *this);
@@ -39,6 +40,8 @@ esp_err_t _BleControl_BleReceiveFileDataAction(BleControl *this, uint8_t * data,
         else if (curFrame == 0 && numFrames > 0 && frameLen > DATA_FRAME_HEADER_SIZE && frameLen < DATA_FRAME_MAX_SIZE)
         {
             this->fileTransferFrameContext.configFrameProcessed = true;
+            // Released when the frame context is reset after the file or on disconnect
+            PowerManager_Acquire(POWER_LOCK_BLE_TRANSFER);
             this->fileTransferFrameContext.frameReceived[curFrame] = 1;
             this->fileTransferFrameContext.curNumFrames = numFrames+1; // store 1 based frame count
             this->fileTransferFrameContext.frameLen = frameLen;
@@ -226,6 +229,10 @@ static esp_err_t _BleControl_ProcessTransferedFile(BleControl *this)
 void _BleControl_ResetFrameContext(BleControl *this)
 {
     assert(this);
+    if (this->fileTransferFrameContext.configFrameProcessed)
+    {
+        PowerManager_Release(POWER_LOCK_BLE_TRANSFER);
+    }
     memset((void*)this->fileTransferFrameContext.frameReceived, 0, MAX_BLE_FRAMES);
     this->fileTransferFrameContext.curNumFrames = 0;
     this->fileTransferFrameContext.frameLen = 0;
@@ -0,0 +1,74 @@
+#include <string.h>
+
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+
+#include "BootProfile.h"
+#include "Utilities.h"
+
+// Internal Constants
+static const char * const MILESTONE_NAMES[BOOT_MILESTONE_COUNT] =
+{
+    [BOOT_MILESTONE_INIT_DONE]   = "init_done",
+    [BOOT_MILESTONE_FIRST_LED]   = "first_led",
+    [BOOT_MILESTONE_ADVERTISING] = "advertising",
+};
+
+// Internal Variables
+static BootProfileStep steps[BOOT_PROFILE_MAX_STEPS];
+static int numSteps;
+static int64_t milestoneUs[BOOT_MILESTONE_COUNT];
+static portMUX_TYPE profileLock = portMUX_INITIALIZER_UNLOCKED;
+
+void BootProfile_RecordStep(const char *name, int64_t startUs)
+{
+    int64_t nowUs = esp_timer_get_time();
+    taskENTER_CRITICAL(&profileLock);
+    if (numSteps < BOOT_PROFILE_MAX_STEPS)
+    {
+        BootProfileStep *pStep = &steps[numSteps++];
+        pStep->name = name;
+        pStep->startUs = startUs;
+        pStep->endUs = nowUs;
+        pStep->core = xPortGetCoreID();
+    }
+    taskEXIT_CRITICAL(&profileLock);
+}
+
+// Cheap enough to call on every LED flush or advertising restart
+void BootProfile_Milestone(BootMilestone milestone)
+{
+    assert(milestone < BOOT_MILESTONE_COUNT);
+    if (milestoneUs[milestone] != 0)
+    {
+        return;
+    }
+
+    int64_t nowUs = esp_timer_get_time();
+    taskENTER_CRITICAL(&profileLock);
+    if (milestoneUs[milestone] == 0)
+    {
+        milestoneUs[milestone] = nowUs;
+    }
+    taskEXIT_CRITICAL(&profileLock);
+}
+
+int BootProfile_GetSteps(BootProfileStep *pSteps, int maxSteps)
+{
+    assert(pSteps);
+    taskENTER_CRITICAL(&profileLock);
+    int count = MIN(numSteps, maxSteps);
+    memcpy(pSteps, steps, count * sizeof(*pSteps));
+    taskEXIT_CRITICAL(&profileLock);
+    return count;
+}
+
+int64_t BootProfile_GetMilestoneUs(BootMilestone milestone)
+{
+    return (milestone < BOOT_MILESTONE_COUNT) ? milestoneUs[milestone] : 0;
+}
+
+const char *BootProfile_GetMilestoneName(BootMilestone milestone)
+{
+    return (milestone < BOOT_MILESTONE_COUNT) ? MILESTONE_NAMES[milestone] : "unknown";
+}
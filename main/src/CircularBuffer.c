@@ -4,6 +4,7 @@
 #include <string.h>
 
 #include "CircularBuffer.h"
+#include "Utilities.h"
 
 static const char *TAG = "CBUF";
 
@@ -32,9 +33,42 @@ esp_err_t CircularBuffer_Init(CircularBuffer *cb, size_t capacity, size_t size)
   cb->size = size;
   cb->pHead = cb->pBuffer;
   cb->pTail = cb->pBuffer;
+  cb->lockFree = false;
   return ESP_OK;
 }
 
+/**
+ * Initializes a circular buffer that one producer and one consumer can share without a lock.
+ * PushBack/PushBackN must only be called from the producer and PopFront/PopFrontN only from the consumer.
+ * Clear is only safe while neither side is running.
+ *
+ * @param cb Pointer to the circular buffer structure to be initialized.
+ * @param capacity The minimum number of elements the buffer can hold. Rounded up to a power of two.
+ * @param size The size of each element in the circular buffer.
+ *
+ * @return ESP_OK if the circular buffer is successfully initialized, ESP_FAIL otherwise.
+ *
+ * @throws None
+ */
+esp_err_t CircularBuffer_InitLockFree(CircularBuffer *cb, size_t capacity, size_t size)
+{
+  size_t roundedCapacity = 1;
+  while(roundedCapacity < capacity)
+  {
+    roundedCapacity <<= 1;
+  }
+
+  esp_err_t ret = CircularBuffer_Init(cb, roundedCapacity, size);
+  if(ret == ESP_OK)
+  {
+    cb->lockFree = true;
+    cb->mask = roundedCapacity - 1;
+    atomic_init(&cb->writeIdx, 0);
+    atomic_init(&cb->readIdx, 0);
+  }
+  return ret;
+}
+
 /**
  * Frees the memory allocated for the circular pBuffer.
  *
@@ -61,6 +95,8 @@ void CircularBuffer_Free(CircularBuffer *cb)
  */
 void CircularBuffer_Clear(CircularBuffer *cb)
 {
+  atomic_store(&cb->writeIdx, 0);
+  atomic_store(&cb->readIdx, 0);
   cb->count = 0;
   cb->pHead = cb->pBuffer;
   cb->pTail = cb->pBuffer;
@@ -77,6 +113,11 @@ void CircularBuffer_Clear(CircularBuffer *cb)
  */
 int CircularBuffer_Count(CircularBuffer *cb)
 {
+  if(cb->lockFree)
+  {
+    size_t readIdx = atomic_load_explicit(&cb->readIdx, memory_order_acquire);
+    return atomic_load_explicit(&cb->writeIdx, memory_order_acquire) - readIdx;
+  }
   return cb->count;
 }
 
@@ -92,6 +133,16 @@ int CircularBuffer_Count(CircularBuffer *cb)
  */
 esp_err_t CircularBuffer_PushBack(CircularBuffer *cb, const void *item)
 {
+  if(cb->lockFree)
+  {
+    if(CircularBuffer_PushBackN(cb, item, 1) != 1)
+    {
+      ESP_LOGE(TAG, "Circular pBuffer is full");
+      return ESP_FAIL;
+    }
+    return ESP_OK;
+  }
+
   if(cb->count == cb->capacity)
   {
     ESP_LOGE(TAG, "Circular pBuffer is full");
@@ -121,6 +172,16 @@ esp_err_t CircularBuffer_PushBack(CircularBuffer *cb, const void *item)
  */
 esp_err_t CircularBuffer_PopFront(CircularBuffer *cb, void *item)
 {
+  if(cb->lockFree)
+  {
+    if(CircularBuffer_PopFrontN(cb, item, 1) != 1)
+    {
+      ESP_LOGE(TAG, "Circular pBuffer is empty");
+      return ESP_FAIL;
+    }
+    return ESP_OK;
+  }
+
   if(cb->count == 0)
   {
     ESP_LOGE(TAG, "Circular pBuffer is empty");
@@ -138,6 +199,91 @@ esp_err_t CircularBuffer_PopFront(CircularBuffer *cb, void *item)
   return ESP_OK;
 }
 
+/**
+ * Copies numItems items between a flat array and the buffer starting at byte offset, wrapping at most once.
+ */
+static void CircularBuffer_CopyIn(CircularBuffer *cb, size_t offset, const char *items, size_t numItems)
+{
+  size_t bytes = numItems * cb->size;
+  size_t bufferBytes = cb->capacity * cb->size;
+  size_t firstBytes = (offset + bytes > bufferBytes) ? bufferBytes - offset : bytes;
+  memcpy((char *)cb->pBuffer + offset, items, firstBytes);
+  memcpy(cb->pBuffer, items + firstBytes, bytes - firstBytes);
+}
+
+static void CircularBuffer_CopyOut(CircularBuffer *cb, size_t offset, char *items, size_t numItems)
+{
+  size_t bytes = numItems * cb->size;
+  size_t bufferBytes = cb->capacity * cb->size;
+  size_t firstBytes = (offset + bytes > bufferBytes) ? bufferBytes - offset : bytes;
+  memcpy(items, (char *)cb->pBuffer + offset, firstBytes);
+  memcpy(items + firstBytes, cb->pBuffer, bytes - firstBytes);
+}
+
+/**
+ * Pushes as many items as fit to the back of the circular buffer.
+ *
+ * @param cb Pointer to the circular buffer structure.
+ * @param items Pointer to an array of numItems items.
+ * @param numItems Number of items to push.
+ *
+ * @return The number of items pushed, which is less than numItems if the buffer filled up.
+ *
+ * @throws None
+ */
+size_t CircularBuffer_PushBackN(CircularBuffer *cb, const void *items, size_t numItems)
+{
+  if(cb->lockFree)
+  {
+    size_t writeIdx = atomic_load_explicit(&cb->writeIdx, memory_order_relaxed);
+    size_t readIdx = atomic_load_explicit(&cb->readIdx, memory_order_acquire);
+    size_t numPushed = MIN(numItems, cb->capacity - (writeIdx - readIdx));
+    CircularBuffer_CopyIn(cb, (writeIdx & cb->mask) * cb->size, items, numPushed);
+    // Release publishes the copied items before the consumer can see the new index
+    atomic_store_explicit(&cb->writeIdx, writeIdx + numPushed, memory_order_release);
+    return numPushed;
+  }
+
+  size_t numPushed = MIN(numItems, cb->capacity - cb->count);
+  size_t offset = (char *)cb->pHead - (char *)cb->pBuffer;
+  CircularBuffer_CopyIn(cb, offset, items, numPushed);
+  cb->pHead = (char *)cb->pBuffer + (offset + numPushed * cb->size) % (cb->capacity * cb->size);
+  cb->count += numPushed;
+  return numPushed;
+}
+
+/**
+ * Pops up to maxItems items from the front of the circular buffer.
+ *
+ * @param cb Pointer to the circular buffer structure.
+ * @param items Pointer to an array with room for maxItems items.
+ * @param maxItems Maximum number of items to pop.
+ *
+ * @return The number of items popped, which is less than maxItems if the buffer ran empty.
+ *
+ * @throws None
+ */
+size_t CircularBuffer_PopFrontN(CircularBuffer *cb, void *items, size_t maxItems)
+{
+  if(cb->lockFree)
+  {
+    size_t readIdx = atomic_load_explicit(&cb->readIdx, memory_order_relaxed);
+    size_t writeIdx = atomic_load_explicit(&cb->writeIdx, memory_order_acquire);
+    size_t numPopped = MIN(maxItems, writeIdx - readIdx);
+    CircularBuffer_CopyOut(cb, (readIdx & cb->mask) * cb->size, items, numPopped);
+    // Release keeps the producer from reusing the slots until the copy is done
+    atomic_store_explicit(&cb->readIdx, readIdx + numPopped, memory_order_release);
+    return numPopped;
+  }
+
+  size_t numPopped = MIN(maxItems, cb->count);
+  size_t offset = (char *)cb->pTail - (char *)cb->pBuffer;
+  CircularBuffer_CopyOut(cb, offset, items, numPopped);
+  cb->pTail = (char *)cb->pBuffer + (offset + numPopped * cb->size) % (cb->capacity * cb->size);
+  cb->count -= numPopped;
+  return numPopped;
+}
+
 /**
  * Matches the last N elements of the sequence in the circular buffer.
  * 
@@ -149,6 +295,26 @@ esp_err_t CircularBuffer_PopFront(CircularBuffer *cb, void *item)
  */
 esp_err_t CircularBuffer_MatchSequence(CircularBuffer *cb, const void *sequence, size_t sequence_length)
 {
+  if(cb->lockFree)
+  {
+    // Producer side only, since it reads the newest items
+    size_t writeIdx = atomic_load_explicit(&cb->writeIdx, memory_order_relaxed);
+    if(sequence_length > (size_t)CircularBuffer_Count(cb))
+    {
+      ESP_LOGE(TAG, "Sequence length is greater than the number of elements in the circular buffer");
+      return ESP_FAIL;
+    }
+    for(size_t i = 0; i < sequence_length; i++)
+    {
+      const char *current = (const char *)cb->pBuffer + ((writeIdx - sequence_length + i) & cb->mask) * cb->size;
+      if(memcmp(current, (const char *)sequence + i * cb->size, cb->size) != 0)
+      {
+        return ESP_FAIL;
+      }
+    }
+    return ESP_OK;
+  }
+
   if(sequence_length > cb->count)
   {
     ESP_LOGE(TAG, "Sequence length is greater than the number of elements in the circular buffer");
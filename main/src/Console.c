@@ -21,6 +21,9 @@
 #include "esp_vfs_fat.h"
 
 #include "DiskUtilities.h"
+#include "console_boot.h"
+#include "console_memtrack.h"
+#include "console_power.h"
 #include "console_system.h"
 #include "Console.h"
 #include "TaskPriorities.h"
@@ -142,6 +145,9 @@ esp_err_t Console_Init(void)
 
 #if CONFIG_DEBUG_FEATURES
     register_system_dev();
+    register_boot_commands();
+    register_memtrack_commands();
+    register_power_commands();
 #endif
 
     // register_badge_commands();
@@ -168,7 +174,7 @@ esp_err_t Console_Init(void)
 #endif //CONFIG_LOG_COLORS
     }
     
-    assert(xTaskCreatePinnedToCore(ConsoleTask, "ConsoleTask", configMINIMAL_STACK_SIZE * 2, NULL, CONSOLE_TASK_PRIORITY, NULL, APP_CPU_NUM) == pdPASS);
+    assert(xTaskCreatePinnedToCore(ConsoleTask, "ConsoleTask", configMINIMAL_STACK_SIZE * 2, NULL, CONSOLE_TASK_PRIORITY, NULL, CONSOLE_TASK_CORE) == pdPASS);
     return ret;
 }
 
@@ -8,6 +8,7 @@
 #include "DiskDefines.h"
 #include "DiskUtilities.h"
 #include "GameState.h"
+#include "MemTrack.h"
 #include "NotificationDispatcher.h"
 #include "SynthModeNotifications.h"
 #include "TaskPriorities.h"
@@ -20,6 +21,8 @@
 #define GAME_TASK_DELAY_MS               (100)
 #define FIRST_HEARTBEAT_POWERON_DELAY_MS (5000)
 
+_Static_assert(sizeof(HeartBeatRequest) <= NOTIFICATION_POOL_LARGE_BLOCK_SIZE, "HeartBeatRequest no longer fits a pooled notification payload");
+
 static const char *TAG = "GME";
 static int mapIndices[MAX_PEER_MAP_DEPTH];
 
@@ -44,7 +47,8 @@ esp_err_t GameState_Init(GameState *this, NotificationDispatcher *pNotificationD
         mapIndices[i] = i;
     }
 
-    hashmap_init(&this->peerMap, hashmap_hash_string, strcmp);
+    // Peer reports own the keys and the map never holds more than MAX_PEER_MAP_DEPTH, so it never needs the heap
+    assert(hashmap_init_arena(&this->peerMap, hashmap_hash_string, strcmp, this->peerMapArena, sizeof(this->peerMapArena), MAX_PEER_MAP_DEPTH, 0, NULL) == 0);
     hashmap_init(&this->seenEventMap, hashmap_hash_string, strcmp);
     this->pNotificationDispatcher = pNotificationDispatcher;
     this->pBadgeStats = pBadgeStats;
@@ -66,7 +70,14 @@ esp_err_t GameState_Init(GameState *this, NotificationDispatcher *pNotificationD
     ESP_ERROR_CHECK(NotificationDispatcher_RegisterNotificationEventHandler(this->pNotificationDispatcher, NOTIFICATION_EVENTS_WIFI_HEARTBEAT_RESPONSE_RECV, &_GameState_NotificationHandler, this));
     ESP_ERROR_CHECK(NotificationDispatcher_RegisterNotificationEventHandler(this->pNotificationDispatcher, NOTIFICATION_EVENTS_SEND_HEARTBEAT, &_GameState_SendHeartbeatHandler, this));
     ESP_ERROR_CHECK(NotificationDispatcher_RegisterNotificationEventHandler(this->pNotificationDispatcher, NOTIFICATION_EVENTS_OCARINA_SONG_MATCHED, &_GameState_NotificationHandler, this));
-    assert(xTaskCreatePinnedToCore(_GameState_Task, "GameStateTask", configMINIMAL_STACK_SIZE * 3, this, GAME_STATE_TASK_PRIORITY, NULL, APP_CPU_NUM) == pdPASS);
+    return ESP_OK;
+}
+
+// Separate from init, the task posts heartbeats and game events whose handlers register later in boot
+esp_err_t GameState_Start(GameState *this)
+{
+    assert(this);
+    assert(xTaskCreatePinnedToCore(_GameState_Task, "GameStateTask", configMINIMAL_STACK_SIZE * 3, this, GAME_STATE_TASK_PRIORITY, NULL, GAME_STATE_TASK_CORE) == pdPASS);
     return ESP_OK;
 }
 
@@ -77,11 +88,23 @@ void GameState_SendHeartBeat(GameState *this, uint32_t waitTimeMs)
     this->sendHeartbeatImmediately = false;
     if (xSemaphoreTake(this->gameStateDataMutex, pdMS_TO_TICKS(MUTEX_MAX_WAIT_MS)) == pdTRUE)
     {
-        HeartBeatRequest heartBeatRequest = { .gameStateData = this->gameStateData, .badgeStats = this->pBadgeStats->badgeStats, .waitTimeMs = 0, .numPeerReports = this->numPeerReports };
-        memcpy(heartBeatRequest.badgeIdB64, this->pUserSettings->badgeIdB64, sizeof(heartBeatRequest.badgeIdB64));
-        memcpy(heartBeatRequest.keyB64, this->pUserSettings->keyB64, sizeof(heartBeatRequest.keyB64));
-        memcpy(heartBeatRequest.peerReports, this->peerReports, sizeof(heartBeatRequest.peerReports));
-        NotificationDispatcher_NotifyEvent(this->pNotificationDispatcher, NOTIFICATION_EVENTS_WIFI_HEARTBEAT_READY_TO_SEND, &heartBeatRequest, sizeof(heartBeatRequest), DEFAULT_NOTIFY_WAIT_DURATION);
+        // Filled in place in a pooled payload so the request is never copied through the dispatcher
+        HeartBeatRequest *pHeartBeatRequest = NotificationDispatcher_AcquirePayload(this->pNotificationDispatcher, sizeof(HeartBeatRequest));
+        if (pHeartBeatRequest != NULL)
+        {
+            pHeartBeatRequest->gameStateData = this->gameStateData;
+            pHeartBeatRequest->badgeStats = this->pBadgeStats->badgeStats;
+            pHeartBeatRequest->waitTimeMs = 0;
+            pHeartBeatRequest->numPeerReports = this->numPeerReports;
+            memcpy(pHeartBeatRequest->badgeIdB64, this->pUserSettings->badgeIdB64, sizeof(pHeartBeatRequest->badgeIdB64));
+            memcpy(pHeartBeatRequest->keyB64, this->pUserSettings->keyB64, sizeof(pHeartBeatRequest->keyB64));
+            memcpy(pHeartBeatRequest->peerReports, this->peerReports, sizeof(pHeartBeatRequest->peerReports));
+            NotificationDispatcher_NotifyPayload(this->pNotificationDispatcher, NOTIFICATION_EVENTS_WIFI_HEARTBEAT_READY_TO_SEND, pHeartBeatRequest, DEFAULT_NOTIFY_WAIT_DURATION);
+        }
+        else
+        {
+            ESP_LOGE(TAG, "Failed to acquire heartbeat payload");
+        }
         hashmap_clear(&this->peerMap);
         memset(this->peerReports, 0, sizeof(this->peerReports));
         if (xSemaphoreGive(this->gameStateDataMutex) != pdTRUE)
@@ -208,7 +231,7 @@ static bool _GameState_TryAddSeenEventId(GameState *this, char *newEventIdB64)
         if (pIndex == NULL)
         {
             ESP_LOGI(TAG, "Adding new seen event id %s", newEventIdB64);
-            char *pEventIdB64 = calloc(EVENT_ID_B64_SIZE, 1);
+            char *pEventIdB64 = MemTrack_Calloc(MEM_TAG_SEEN_EVENT_MAP, EVENT_ID_B64_SIZE, 1);
             if (pEventIdB64)
             {
                 strncpy(pEventIdB64, newEventIdB64, EVENT_ID_B64_SIZE - 1);
@@ -17,6 +17,7 @@
 #include "BatterySensor.h"
 #include "GameState.h"
 #include "HTTPGameClient.h"
+#include "MemTrack.h"
 #include "SynthModeNotifications.h"
 #include "TaskPriorities.h"
 #include "TimeUtils.h"
@@ -26,7 +27,7 @@
 static esp_err_t HttpEventHandler(esp_http_client_event_t *evt);
 static void HTTPGameClientTask(void *pvParameters);
 static void HTTPGameClient_GameStateRequestNotificationHandler(void *pObj, esp_event_base_t eventBase, int32_t notificationEvent, void *notificationData);
-static esp_err_t _ParseJsonResponseString(NotificationDispatcher *pNotificationDispatcher, char *pData, HeartBeatResponse *pHeartBeatResponse, SiblingMap_t *pSiblings);
+static esp_err_t _ParseJsonResponseString(NotificationDispatcher *pNotificationDispatcher, char *pData, HeartBeatResponse *pHeartBeatResponse, SiblingCache *pSiblings);
 static void _PrintHeartBeatResponse(HeartBeatResponse *pHeartBeatResponse);
 
 
@@ -81,7 +82,7 @@ esp_err_t _RequestQueue_Enqueue(HTTPGameClientRequestList* this, HTTPGameClient_
     if(this->size == 0)
     {
         // First insert
-        HTTPGameClient_RequestItem * pNewItem = calloc(1, sizeof(HTTPGameClient_RequestItem));
+        HTTPGameClient_RequestItem * pNewItem = MemTrack_Calloc(MEM_TAG_HTTP_QUEUE, 1, sizeof(HTTPGameClient_RequestItem));
         assert(pNewItem);
         // Copy the data into the new item
         memcpy(pNewItem->request.pData, request->pData, copySize);
@@ -121,7 +122,7 @@ esp_err_t _RequestQueue_Enqueue(HTTPGameClientRequestList* this, HTTPGameClient_
         }
         else
         {
-            HTTPGameClient_RequestItem * pNewItem = calloc(1, sizeof(HTTPGameClient_RequestItem));
+            HTTPGameClient_RequestItem * pNewItem = MemTrack_Calloc(MEM_TAG_HTTP_QUEUE, 1, sizeof(HTTPGameClient_RequestItem));
             assert(pNewItem);
 
             // Copy the data into the new item
@@ -176,7 +177,7 @@ esp_err_t _RequestQueue_Dequeue(HTTPGameClientRequestList* this, HTTPGameClient_
         if(this->size == 1)
         {
             // Delete last item
-            free(pDelete);
+            MemTrack_Free(pDelete);
             pDelete = this->head = this->tail = NULL;
         }
         else
@@ -198,7 +199,7 @@ esp_err_t _RequestQueue_Dequeue(HTTPGameClientRequestList* this, HTTPGameClient_
                 // Point over deleted item, even if NULL
                 pBeforeDelete->pNext = pDelete->pNext;
             }
-            free(pDelete);
+            MemTrack_Free(pDelete);
             pDelete = NULL;
         }
         
@@ -226,7 +227,7 @@ esp_err_t HTTPGameClient_Init(HTTPGameClient *this, WifiClient *pWifiClient, Not
     this->requestQueue.capacity = MAX_PENDING_REQUESTS;
 
     // Intialize rest of structure variables
-    hashmap_init(&this->siblingMap, hashmap_hash_string, strcmp);
+    ESP_ERROR_CHECK(SiblingCache_Init(&this->siblingCache));
     this->pNotificationDispatcher = pNotificationDispatcher;
     this->pWifiClient = pWifiClient;
     this->pBatterySensor = pBatterySensor;
@@ -238,9 +239,10 @@ esp_err_t HTTPGameClient_Init(HTTPGameClient *this, WifiClient *pWifiClient, Not
     // _ParseJsonResponseString(responseTest, &response);
     // _PrintHeartBeatResponse(&response);
 
-    ESP_ERROR_CHECK(NotificationDispatcher_RegisterNotificationEventHandler(this->pNotificationDispatcher, NOTIFICATION_EVENTS_WIFI_HEARTBEAT_READY_TO_SEND, &HTTPGameClient_GameStateRequestNotificationHandler, this));
+    // Task first, the request handler notifies it
+    assert(xTaskCreatePinnedToCore(HTTPGameClientTask, "HTTPGameClientTask", configMINIMAL_STACK_SIZE * 4, this, HTTP_GAME_CLIENT_TASK_PRIORITY, &this->taskHandle, HTTP_GAME_CLIENT_TASK_CORE) == pdPASS);
 
-    assert(xTaskCreatePinnedToCore(HTTPGameClientTask, "HTTPGameClientTask", configMINIMAL_STACK_SIZE * 4, this, HTTP_GAME_CLIENT_TASK_PRIORITY, NULL, APP_CPU_NUM) == pdPASS);
+    ESP_ERROR_CHECK(NotificationDispatcher_RegisterNotificationEventHandler(this->pNotificationDispatcher, NOTIFICATION_EVENTS_WIFI_HEARTBEAT_READY_TO_SEND, &HTTPGameClient_GameStateRequestNotificationHandler, this));
     return ESP_OK;
 }
 
@@ -313,7 +315,7 @@ static void _PrintHeartBeatResponse(HeartBeatResponse *pHeartBeatResponse)
     ESP_LOGI(TAG, "    mSecRemaining:     %lu", pHeartBeatResponse->status.eventData.mSecRemaining);
 }
 
-static esp_err_t _ParseJsonResponseString(NotificationDispatcher *pNotificationDispatcher, char *pData, HeartBeatResponse *pHeartBeatResponse, SiblingMap_t *pSiblings)
+static esp_err_t _ParseJsonResponseString(NotificationDispatcher *pNotificationDispatcher, char *pData, HeartBeatResponse *pHeartBeatResponse, SiblingCache *pSiblings)
 {
     esp_err_t ret = ESP_FAIL;
     ESP_LOGI(TAG, "Parsing JSON Response: %s", pData);
@@ -478,6 +480,8 @@ static esp_err_t _ParseJsonResponseString(NotificationDispatcher *pNotificationD
         cJSON *siblingsArray = cJSON_GetObjectItem(root, "siblings");
         if (siblingsArray != NULL)
         {
+            uint8_t siblingIds[SIBLING_CACHE_CAPACITY][BADGE_ID_SIZE];
+            int siblingCount = 0;
             int siblingsArraySize = cJSON_GetArraySize(siblingsArray);
             for (int siblingIndex = 0; siblingIndex < siblingsArraySize; siblingIndex++)
             {
@@ -493,26 +497,19 @@ static esp_err_t _ParseJsonResponseString(NotificationDispatcher *pNotificationD
                     ESP_LOGE(TAG, "Sibling(%d) invalid type %d", siblingIndex, sibling->type);
                     continue;
                 }
-                char *siblingValue = sibling->valuestring;
-                bool *pSeen = hashmap_get(pSiblings, siblingValue);
-                if (pSeen == NULL)
+                if (siblingCount >= SIBLING_CACHE_CAPACITY)
                 {
-                    ESP_LOGI(TAG, "Sibling %s not in map, adding", siblingValue);
-                    bool *siblingSeen = calloc(sizeof(bool), 1);
-                    char *badgeIdB64 = calloc(BADGE_ID_B64_SIZE, sizeof(char));
-                    strncpy(badgeIdB64, siblingValue, BADGE_ID_B64_SIZE - 1);
-
-                    // TODO : EMP doesn't yet account for removing a sibling from the map, must power cycle to reset
-                    if (hashmap_put(pSiblings, badgeIdB64, siblingSeen))
-                    {
-                        ESP_LOGE(TAG, "Failed to add sibling %s to map", siblingValue);
-                    }
+                    ESP_LOGE(TAG, "Sibling cache full, dropping %d siblings", siblingsArraySize - siblingIndex);
+                    break;
                 }
-                else
+                if (!SiblingCache_DecodeId(sibling->valuestring, siblingIds[siblingCount]))
                 {
-                    ESP_LOGD(TAG, "Sibling index %d already in map", siblingIndex);
+                    ESP_LOGE(TAG, "Sibling(%d) invalid id %s", siblingIndex, sibling->valuestring);
+                    continue;
                 }
+                siblingCount++;
             }
+            SiblingCache_Update(pSiblings, siblingIds, siblingCount);
         }
 
         cJSON_Delete(root);
@@ -527,7 +524,13 @@ static esp_err_t _ParseJsonResponseString(NotificationDispatcher *pNotificationD
 }
 
 
-// Assumes WIFI is enabled already from task
+// Returns true if the badge is a sibling that was already seen. Non-siblings are never seen
+bool HTTPGameClient_MarkSiblingSeen(HTTPGameClient *this, const char *badgeIdB64)
+{
+    assert(this);
+    return SiblingCache_MarkSeen(&this->siblingCache, badgeIdB64);
+}
+
 void _HTTPGameClient_ProcessRequestList(HTTPGameClient *this)
 {
     assert(this);
@@ -616,7 +619,7 @@ void _HTTPGameClient_ProcessRequestList(HTTPGameClient *this)
                         if (this->response.pData[0] != 0)
                         {
                             ESP_LOG_BUFFER_HEX_LEVEL(TAG, this->response.pData, this->response.dataLength, ESP_LOG_DEBUG);
-                            if (_ParseJsonResponseString(this->pNotificationDispatcher, (char *)this->response.pData, &this->responseStruct, &this->siblingMap) == ESP_OK)
+                            if (_ParseJsonResponseString(this->pNotificationDispatcher, (char *)this->response.pData, &this->responseStruct, &this->siblingCache) == ESP_OK)
                             {
                                 // ESP_LOGI(TAG, "Event id: %s", this->responseStruct.status.eventData.currentEventIdB64);
                                 _PrintHeartBeatResponse(&this->responseStruct);
@@ -672,7 +675,7 @@ static void HTTPGameClientTask(void *pvParameters)
 
     while(true)
     {
-        // Check if queue has data (I know this does not grab mutex but in the worst case we wait another 10 ms. We use the mutex when we use the queue)
+        // Check if queue has data (I know this does not grab mutex but a request queued meanwhile also notifies the task. We use the mutex when we use the queue)
         if(this->requestQueue.size > 0)
         {
             int nextStartTimeMS = -INT_MAX;
@@ -757,7 +760,8 @@ static void HTTPGameClientTask(void *pvParameters)
             }
         }
 
-        vTaskDelay(pdMS_TO_TICKS(10));
+        // An empty queue sleeps until the next request is queued instead of polling
+        ulTaskNotifyTake(pdTRUE, (this->requestQueue.size > 0) ? pdMS_TO_TICKS(10) : portMAX_DELAY);
     }
 
     ESP_LOGE(TAG, "HTTPGameClientTask exiting...");
@@ -809,7 +813,7 @@ static void HTTPGameClient_GameStateRequestNotificationHandler(void *pObj, esp_e
 
     // Prepare full request json
     // HTTPGameClient_Request *pHttpRequest = (HTTPGameClient_Request *)malloc(sizeof(HTTPGameClient_Request));
-    HTTPGameClient_Request *pHttpRequest = (HTTPGameClient_Request *)malloc(sizeof(HTTPGameClient_Request));
+    HTTPGameClient_Request *pHttpRequest = (HTTPGameClient_Request *)MemTrack_Malloc(MEM_TAG_HTTP_REQUEST, sizeof(HTTPGameClient_Request));
     
     pHttpRequest->methodType = HTTPGAMECLIENT_HTTPMETHOD_POST;
     pHttpRequest->requestType = HTTPGAMECLIENT_HTTPREQUEST_HEARTBEAT;
@@ -835,6 +839,7 @@ static void HTTPGameClient_GameStateRequestNotificationHandler(void *pObj, esp_e
                 if (res1 < 0)
                 {
                     ESP_LOGE(TAG, "Failed to add song to json");
+                    MemTrack_Free(pHttpRequest);
                     return;
                 }
 
@@ -845,6 +850,7 @@ static void HTTPGameClient_GameStateRequestNotificationHandler(void *pObj, esp_e
             if (res2 < 0)
             {
                 ESP_LOGE(TAG, "Failed to add song to json");
+                MemTrack_Free(pHttpRequest);
                 return;
             }
 
@@ -889,13 +895,14 @@ static void HTTPGameClient_GameStateRequestNotificationHandler(void *pObj, esp_e
         }
 
         xSemaphoreGive(this->requestMutex);
+        xTaskNotifyGive(this->taskHandle);
     }
     else
     {
         ESP_LOGE(TAG, "GameStateRequest failed to obtain mutex");
     }
     // free((void*)pHttpRequest);
-    free((void*)pHttpRequest);
+    MemTrack_Free((void*)pHttpRequest);
 }
 
 static esp_err_t HttpEventHandler(esp_http_client_event_t *evt)
@@ -0,0 +1,98 @@
+#include <string.h>
+
+#include "esp_log.h"
+
+#include "InitGraph.h"
+
+static const char * TAG = "INIT";
+
+esp_err_t InitGraph_Init(InitGraph *this, const InitGraphStep *pSteps, int numSteps, InitGraphStepFunction stepFunction, void *pContext)
+{
+    assert(this);
+    assert(pSteps);
+    assert(stepFunction);
+
+    if (numSteps <= 0 || numSteps > INIT_GRAPH_MAX_STEPS)
+    {
+        ESP_LOGE(TAG, "Invalid step count %d", numSteps);
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    memset(this, 0, sizeof(*this));
+    this->pSteps = pSteps;
+    this->numSteps = numSteps;
+    this->stepFunction = stepFunction;
+    this->pContext = pContext;
+    portMUX_INITIALIZE(&this->lock);
+    this->doneEvents = xEventGroupCreate();
+    if (this->doneEvents == NULL)
+    {
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+// Each worker claims the first step whose dependencies are done until every step has started
+void InitGraph_Run(InitGraph *this)
+{
+    assert(this);
+    uint32_t allSteps = INIT_GRAPH_STEP_BIT(this->numSteps) - 1;
+
+    while (true)
+    {
+        uint32_t doneSteps = xEventGroupGetBits(this->doneEvents) & allSteps;
+        int step = this->numSteps;
+
+        taskENTER_CRITICAL(&this->lock);
+        for (int i = 0; i < this->numSteps; i++)
+        {
+            if (!(this->startedSteps & INIT_GRAPH_STEP_BIT(i)) && (this->pSteps[i].dependsOn & ~doneSteps) == 0)
+            {
+                this->startedSteps |= INIT_GRAPH_STEP_BIT(i);
+                step = i;
+                break;
+            }
+        }
+        uint32_t startedSteps = this->startedSteps;
+        taskEXIT_CRITICAL(&this->lock);
+
+        if (step < this->numSteps)
+        {
+            this->stepFunction(this->pContext, step);
+            xEventGroupSetBits(this->doneEvents, INIT_GRAPH_STEP_BIT(step));
+        }
+        else if (startedSteps == allSteps)
+        {
+            break;
+        }
+        else
+        {
+            // Nothing is ready, wait for one of the running steps to finish
+            uint32_t runningSteps = startedSteps & ~doneSteps;
+            assert(runningSteps);
+            xEventGroupWaitBits(this->doneEvents, runningSteps, pdFALSE, pdFALSE, portMAX_DELAY);
+        }
+    }
+}
+
+void InitGraph_HelperDone(InitGraph *this)
+{
+    assert(this);
+    xEventGroupSetBits(this->doneEvents, INIT_GRAPH_STEP_BIT(this->numSteps));
+}
+
+void InitGraph_WaitHelperDone(InitGraph *this)
+{
+    assert(this);
+    xEventGroupWaitBits(this->doneEvents, INIT_GRAPH_STEP_BIT(this->numSteps), pdFALSE, pdTRUE, portMAX_DELAY);
+}
+
+void InitGraph_Deinit(InitGraph *this)
+{
+    assert(this);
+    if (this->doneEvents != NULL)
+    {
+        vEventGroupDelete(this->doneEvents);
+        this->doneEvents = NULL;
+    }
+}
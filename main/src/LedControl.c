@@ -10,12 +10,14 @@
 
 // #include "JsonUtils.h"
 #include "BatterySensor.h"
+#include "BootProfile.h"
 #include "DiskUtilities.h"
 #include "GameState.h"
 #include "JsonUtils.h"
 #include "LedControl.h"
 #include "LedSequences.h"
 #include "NotificationDispatcher.h"
+#include "PowerManager.h"
 #include "SynthModeNotifications.h"
 #include "TaskPriorities.h"
 #include "TimeUtils.h"
@@ -26,6 +28,8 @@
 #define MAX_EVENT_TIME_MSEC (15*60*1000)
 
 #define LED_CONTROL_TASK_PERIOD (50)
+// Frames without a change before an animation counts as stopped
+#define LED_CONTROL_ANIMATION_IDLE_FRAMES (4)
 #define NUM_LED_NOTES (15)
 #define TOUCH_NOTE_OFFSET (7)
 
@@ -403,7 +407,7 @@ esp_err_t LedControl_Init(LedControl *this, NotificationDispatcher *pNotificatio
     ESP_ERROR_CHECK(NotificationDispatcher_RegisterNotificationEventHandler(this->pNotificationDispatcher, NOTIFICATION_EVENTS_SONG_NOTE_ACTION, &LedControl_SongNoteActionNotificationHandler, this));
     ESP_ERROR_CHECK(NotificationDispatcher_RegisterNotificationEventHandler(this->pNotificationDispatcher, NOTIFICATION_EVENTS_INTERACTIVE_GAME_ACTION, &LedControl_InteractiveGameActionNotificationHandler, this));
 
-    assert(xTaskCreatePinnedToCore(LedControlTask, "LedControlTask", configMINIMAL_STACK_SIZE * 2, this, LED_CONTROL_TASK_PRIORITY, NULL, APP_CPU_NUM) == pdPASS);
+    assert(xTaskCreatePinnedToCore(LedControlTask, "LedControlTask", configMINIMAL_STACK_SIZE * 2, this, LED_CONTROL_TASK_PRIORITY, NULL, LED_CONTROL_TASK_CORE) == pdPASS);
     return ret;
 }
 
@@ -461,6 +465,8 @@ static void LedControlTask(void *pvParameters)
 {
     LedControl * this = (LedControl *)pvParameters;
     assert(this);
+    bool animating = false;
+    int idleFrames = 0;
     while (true)
     {
         LedControl_ServiceDrawNoneSequence             ( this, this->ledControlModeSettings.outerLedState == OUTER_LED_STATE_OFF,                   this->ledControlModeSettings.innerLedState == INNER_LED_STATE_OFF              );
@@ -477,7 +483,21 @@ static void LedControlTask(void *pvParameters)
         LedControl_ServiceDrawOtaDownloadInProgSequence( this, this->ledControlModeSettings.outerLedState == OUTER_LED_STATE_OTA_DOWNLOAD_IP,       false                                                                          );
         LedControl_ServiceDrawNetworkTestSequence      ( this, this->ledControlModeSettings.outerLedState == OUTER_LED_STATE_NETWORK_TEST,          this->ledControlModeSettings.innerLedState == INNER_LED_STATE_NETWORK_TEST     );
         LedControl_ServiceDrawSongModeSequence         ( this, this->ledControlModeSettings.outerLedState == OUTER_LED_STATE_SONG_MODE,             false                                                                          );
+        bool frameChanged = this->flushNeeded;
         LedControl_FlushLedStrip(this);
+
+        // Changing frames hold the CPU at full speed. A static pattern lets it idle
+        idleFrames = frameChanged ? 0 : idleFrames + 1;
+        if (frameChanged && !animating)
+        {
+            PowerManager_Acquire(POWER_LOCK_LED_ANIMATION);
+            animating = true;
+        }
+        else if (animating && idleFrames >= LED_CONTROL_ANIMATION_IDLE_FRAMES)
+        {
+            PowerManager_Release(POWER_LOCK_LED_ANIMATION);
+            animating = false;
+        }
         vTaskDelay(pdMS_TO_TICKS(LED_CONTROL_TASK_PERIOD));
     }
 }
@@ -490,6 +510,10 @@ static esp_err_t LedControl_FlushLedStrip(LedControl *this)
         this->flushNeeded = false;
         // ESP_LOGI(TAG, "Refreshing led strip");
         ret = led_strip_refresh(this->ledStripHandle);
+        if (ret == ESP_OK)
+        {
+            BootProfile_Milestone(BOOT_MILESTONE_FIRST_LED);
+        }
     }
     return ret;
 }
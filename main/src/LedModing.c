@@ -13,6 +13,8 @@ esp_err_t LedModing_Init(LedModing *this, LedControl *pLedControl)
     assert(this);
     memset(this, 0, sizeof(*this));
     this->pLedControl = pLedControl;
+    this->modeMutex = xSemaphoreCreateMutex();
+    assert(this->modeMutex);
     return ESP_OK;
 }
 
@@ -21,6 +23,9 @@ static esp_err_t LedMode_SetLedMode(LedModing *this)
     esp_err_t ret = ESP_OK;
     assert(this);
 
+    // The last caller in sees every flag written before it, so the final mode is never stale
+    xSemaphoreTake(this->modeMutex, portMAX_DELAY);
+
     // if (this->curStatusIndicator != LED_STATUS_INDICATOR_NONE)
     // {
     //     ESP_LOGI(TAG, "Setting Led Mode to Status for status %d", this->curStatusIndicator);
@@ -97,6 +102,7 @@ static esp_err_t LedMode_SetLedMode(LedModing *this)
         ESP_LOGI(TAG, "Setting Led Mode to Normal");
         ret = LedControl_SetLedMode(this->pLedControl, LED_MODE_SEQUENCE);
     }
+    xSemaphoreGive(this->modeMutex);
     return ret;
 }
 
@@ -163,14 +169,21 @@ esp_err_t LedModing_SetNetworkTestActive(LedModing *this, bool active)
     return LedMode_SetLedMode(this);
 }
 
+// Sequence changes come from touch commands (high lane) and BLE settings (bulk lane)
 esp_err_t LedModing_SetLedCustomSequence(LedModing *this, int newCustomIndex)
 {
-    return LedControl_SetLedCustomSequence(this->pLedControl, newCustomIndex);
+    xSemaphoreTake(this->modeMutex, portMAX_DELAY);
+    esp_err_t ret = LedControl_SetLedCustomSequence(this->pLedControl, newCustomIndex);
+    xSemaphoreGive(this->modeMutex);
+    return ret;
 }
 
 esp_err_t LedModing_CycleSelectedLedSequence(LedModing *this, bool direction)
 {
-    return LedControl_CycleSelectedLedSequence(this->pLedControl, direction);
+    xSemaphoreTake(this->modeMutex, portMAX_DELAY);
+    esp_err_t ret = LedControl_CycleSelectedLedSequence(this->pLedControl, direction);
+    xSemaphoreGive(this->modeMutex);
+    return ret;
 }
 
 esp_err_t LedModing_SetLedSequencePreviewActive(LedModing *this, bool active)
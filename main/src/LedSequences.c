@@ -13,6 +13,7 @@
 #include "DiskUtilities.h"
 #include "LedControl.h"
 #include "LedSequences.h"
+#include "MemTrack.h"
 
 #ifdef FMAN25_BADGE
 #define LED_SEQ_NUM_BUILT_IN_SEQUENCES 4
@@ -113,7 +114,7 @@ esp_err_t LedSequences_Init(BatterySensor *pBatterySensorRef)
   memset(custom_led_sequences_sharecodes, 0, sizeof(custom_led_sequences_sharecodes));
   for (int i = 0; i < LED_SEQ_NUM_CUSTOM_SEQUENCES; i++)
   {
-    custom_led_sequences[i] = (char *)malloc(MAX_CUSTOM_LED_SEQUENCE_SIZE);
+    custom_led_sequences[i] = (char *)MemTrack_Malloc(MEM_TAG_LED_SEQUENCES, MAX_CUSTOM_LED_SEQUENCE_SIZE);
     memset((void *)custom_led_sequences[i], 0, MAX_CUSTOM_LED_SEQUENCE_SIZE);
 
     // Append custom_led_sequences to end of all user_led_sequences
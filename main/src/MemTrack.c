@@ -0,0 +1,144 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+
+#include "MemTrack.h"
+#include "Utilities.h"
+
+// Internal Constants
+static const char * const TAG_NAMES[MEM_TAG_COUNT] =
+{
+    [MEM_TAG_LED_SEQUENCES]  = "led_sequences",
+    [MEM_TAG_SEEN_EVENT_MAP] = "seen_event_map",
+    [MEM_TAG_HTTP_QUEUE]     = "http_queue",
+    [MEM_TAG_HTTP_REQUEST]   = "http_request",
+    [MEM_TAG_CJSON]          = "cjson",
+};
+
+const char *MemTrack_GetTagName(MemTag tag)
+{
+    return (tag < MEM_TAG_COUNT) ? TAG_NAMES[tag] : "unknown";
+}
+
+#if CONFIG_MEM_TRACK
+
+#define MEM_TRACK_MAGIC 0xA11C
+
+// Precedes each tracked block. Padded to 8 bytes to keep the caller's alignment
+typedef struct MemTrackHeader_t
+{
+    uint32_t size;
+    uint16_t tag;
+    uint16_t magic;
+} MemTrackHeader;
+
+_Static_assert(sizeof(MemTrackHeader) == 8, "MemTrackHeader must keep 8 byte alignment");
+
+// Internal Variables
+static MemTrackStats stats[MEM_TAG_COUNT];
+static uint32_t markBytes[MEM_TAG_COUNT];
+static portMUX_TYPE statsLock = portMUX_INITIALIZER_UNLOCKED;
+
+// Internal Constants
+static const char * TAG = "MEM";
+
+void *MemTrack_Malloc(MemTag tag, size_t size)
+{
+    assert(tag < MEM_TAG_COUNT);
+    // A size within a header of SIZE_MAX would wrap to a tiny block
+    MemTrackHeader *pHeader = (size <= SIZE_MAX - sizeof(MemTrackHeader)) ? malloc(sizeof(MemTrackHeader) + size) : NULL;
+
+    taskENTER_CRITICAL(&statsLock);
+    MemTrackStats *pStats = &stats[tag];
+    if (pHeader != NULL)
+    {
+        pStats->liveBytes += size;
+        pStats->peakBytes = MAX(pStats->peakBytes, pStats->liveBytes);
+        ++pStats->liveBlocks;
+        ++pStats->allocCount;
+    }
+    else
+    {
+        ++pStats->failedCount;
+    }
+    taskEXIT_CRITICAL(&statsLock);
+
+    if (pHeader == NULL)
+    {
+        ESP_LOGE(TAG, "Failed to allocate %u bytes for %s", size, TAG_NAMES[tag]);
+        return NULL;
+    }
+    pHeader->size = size;
+    pHeader->tag = tag;
+    pHeader->magic = MEM_TRACK_MAGIC;
+    return pHeader + 1;
+}
+
+void *MemTrack_Calloc(MemTag tag, size_t count, size_t size)
+{
+    if (size != 0 && count > SIZE_MAX / size)
+    {
+        return NULL;
+    }
+    void *pMemory = MemTrack_Malloc(tag, count * size);
+    if (pMemory != NULL)
+    {
+        memset(pMemory, 0, count * size);
+    }
+    return pMemory;
+}
+
+void MemTrack_Free(void *pMemory)
+{
+    if (pMemory == NULL)
+    {
+        return;
+    }
+
+    MemTrackHeader *pHeader = (MemTrackHeader *)pMemory - 1;
+    // Catches untracked blocks handed to MemTrack_Free and double frees
+    assert(pHeader->magic == MEM_TRACK_MAGIC);
+    assert(pHeader->tag < MEM_TAG_COUNT);
+
+    taskENTER_CRITICAL(&statsLock);
+    MemTrackStats *pStats = &stats[pHeader->tag];
+    pStats->liveBytes -= pHeader->size;
+    --pStats->liveBlocks;
+    ++pStats->freeCount;
+    taskEXIT_CRITICAL(&statsLock);
+
+    pHeader->magic = 0;
+    free(pHeader);
+}
+
+void MemTrack_GetStats(MemTag tag, MemTrackStats *pStats)
+{
+    assert(tag < MEM_TAG_COUNT);
+    assert(pStats);
+    taskENTER_CRITICAL(&statsLock);
+    *pStats = stats[tag];
+    taskEXIT_CRITICAL(&statsLock);
+}
+
+void MemTrack_Mark(void)
+{
+    taskENTER_CRITICAL(&statsLock);
+    for (uint32_t i = 0; i < MEM_TAG_COUNT; i++)
+    {
+        markBytes[i] = stats[i].liveBytes;
+    }
+    taskEXIT_CRITICAL(&statsLock);
+}
+
+int32_t MemTrack_GetGrowthSinceMark(MemTag tag)
+{
+    assert(tag < MEM_TAG_COUNT);
+    taskENTER_CRITICAL(&statsLock);
+    int32_t growth = (int32_t)(stats[tag].liveBytes - markBytes[tag]);
+    taskEXIT_CRITICAL(&statsLock);
+    return growth;
+}
+
+#endif // CONFIG_MEM_TRACK
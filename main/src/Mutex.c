@@ -84,3 +84,78 @@ esp_err_t Mutex_Unlock(SemaphoreHandle_t *pMutex)
         return ESP_FAIL;
     }
 }
+
+esp_err_t RWLock_Create(RWLock *pLock)
+{
+    pLock->readerCount = 0;
+    pLock->readerMutex = xSemaphoreCreateMutex();
+    pLock->writeSemaphore = xSemaphoreCreateBinary();
+    if (pLock->readerMutex == NULL || pLock->writeSemaphore == NULL)
+    {
+        ESP_LOGE(TAG, "RWLock failed to create");
+        return ESP_FAIL;
+    }
+    xSemaphoreGive(pLock->writeSemaphore);
+    return ESP_OK;
+}
+
+esp_err_t RWLock_ReadLock(RWLock *pLock, TickType_t xTicksToWait)
+{
+    if (xSemaphoreTake(pLock->readerMutex, xTicksToWait) != pdTRUE)
+    {
+        ESP_LOGE(TAG, "RWLock failed to read lock");
+        return ESP_FAIL;
+    }
+
+    esp_err_t ret = ESP_OK;
+    // First reader in holds off writers for the whole group
+    if (pLock->readerCount == 0 && xSemaphoreTake(pLock->writeSemaphore, xTicksToWait) != pdTRUE)
+    {
+        ESP_LOGE(TAG, "RWLock failed to read lock. writer active");
+        ret = ESP_FAIL;
+    }
+    else
+    {
+        pLock->readerCount++;
+    }
+    xSemaphoreGive(pLock->readerMutex);
+    return ret;
+}
+
+esp_err_t RWLock_ReadUnlock(RWLock *pLock)
+{
+    xSemaphoreTake(pLock->readerMutex, portMAX_DELAY);
+    if (pLock->readerCount == 0)
+    {
+        xSemaphoreGive(pLock->readerMutex);
+        ESP_LOGE(TAG, "RWLock read unlock without read lock");
+        return ESP_FAIL;
+    }
+    pLock->readerCount--;
+    if (pLock->readerCount == 0)
+    {
+        xSemaphoreGive(pLock->writeSemaphore);
+    }
+    xSemaphoreGive(pLock->readerMutex);
+    return ESP_OK;
+}
+
+esp_err_t RWLock_WriteLock(RWLock *pLock, TickType_t xTicksToWait)
+{
+    if (xSemaphoreTake(pLock->writeSemaphore, xTicksToWait) == pdTRUE)
+    {
+        return ESP_OK;
+    }
+    ESP_LOGE(TAG, "RWLock failed to write lock");
+    return ESP_FAIL;
+}
+
+esp_err_t RWLock_WriteUnlock(RWLock *pLock)
+{
+    if (xSemaphoreGive(pLock->writeSemaphore) == pdTRUE)
+    {
+        return ESP_OK;
+    }
+    ESP_LOGE(TAG, "RWLock failed to write unlock");
+    return ESP_FAIL;
+}
@@ -5,157 +5,168 @@
 
 static const char * TAG = "NOTE";
 
-const float NoteFrequencies[NOTE_TOTAL_NUM_NOTES] = 
+// Rounded to whole hertz at build time, which is all the LEDC timer takes
+#define NOTE_FREQ_HZ(freq) ((uint16_t)((freq) + 0.5))
+
+const uint16_t NoteFrequencies[NOTE_TOTAL_NUM_NOTES] = 
 {
-  FREQ_NOTE_REST,
-  FREQ_NOTE_C0,
-  FREQ_NOTE_CS0,
-  FREQ_NOTE_DF0,
-  FREQ_NOTE_D0,
-  FREQ_NOTE_DS0,
-  FREQ_NOTE_EF0,
-  FREQ_NOTE_E0,
-  FREQ_NOTE_F0,
-  FREQ_NOTE_FS0,
-  FREQ_NOTE_GF0,
-  FREQ_NOTE_G0,
-  FREQ_NOTE_GS0,
-  FREQ_NOTE_AF0,
-  FREQ_NOTE_A0,
-  FREQ_NOTE_AS0,
-  FREQ_NOTE_BF0,
-  FREQ_NOTE_B0,
-  FREQ_NOTE_C1,
-  FREQ_NOTE_CS1,
-  FREQ_NOTE_DF1,
-  FREQ_NOTE_D1,
-  FREQ_NOTE_DS1,
-  FREQ_NOTE_EF1,
-  FREQ_NOTE_E1,
-  FREQ_NOTE_F1,
-  FREQ_NOTE_FS1,
-  FREQ_NOTE_GF1,
-  FREQ_NOTE_G1,
-  FREQ_NOTE_GS1,
-  FREQ_NOTE_AF1,
-  FREQ_NOTE_A1,
-  FREQ_NOTE_AS1,
-  FREQ_NOTE_BF1,
-  FREQ_NOTE_B1,
-  FREQ_NOTE_C2,
-  FREQ_NOTE_CS2,
-  FREQ_NOTE_DF2,
-  FREQ_NOTE_D2,
-  FREQ_NOTE_DS2,
-  FREQ_NOTE_EF2,
-  FREQ_NOTE_E2,
-  FREQ_NOTE_F2,
-  FREQ_NOTE_FS2,
-  FREQ_NOTE_GF2,
-  FREQ_NOTE_G2,
-  FREQ_NOTE_GS2,
-  FREQ_NOTE_AF2,
-  FREQ_NOTE_A2,
-  FREQ_NOTE_AS2,
-  FREQ_NOTE_BF2,
-  FREQ_NOTE_B2,
-  FREQ_NOTE_C3,
-  FREQ_NOTE_CS3,
-  FREQ_NOTE_DF3,
-  FREQ_NOTE_D3,
-  FREQ_NOTE_DS3,
-  FREQ_NOTE_EF3,
-  FREQ_NOTE_E3,
-  FREQ_NOTE_F3,
-  FREQ_NOTE_FS3,
-  FREQ_NOTE_GF3,
-  FREQ_NOTE_G3,
-  FREQ_NOTE_GS3,
-  FREQ_NOTE_AF3,
-  FREQ_NOTE_A3,
-  FREQ_NOTE_AS3,
-  FREQ_NOTE_BF3,
-  FREQ_NOTE_B3,
-  FREQ_NOTE_C4,
-  FREQ_NOTE_CS4,
-  FREQ_NOTE_DF4,
-  FREQ_NOTE_D4,
-  FREQ_NOTE_DS4,
-  FREQ_NOTE_EF4,
-  FREQ_NOTE_E4,
-  FREQ_NOTE_F4,
-  FREQ_NOTE_FS4,
-  FREQ_NOTE_GF4,
-  FREQ_NOTE_G4,
-  FREQ_NOTE_GS4,
-  FREQ_NOTE_AF4,
-  FREQ_NOTE_A4,
-  FREQ_NOTE_AS4,
-  FREQ_NOTE_BF4,
-  FREQ_NOTE_B4,
-  FREQ_NOTE_C5,
-  FREQ_NOTE_CS5,
-  FREQ_NOTE_DF5,
-  FREQ_NOTE_D5,
-  FREQ_NOTE_DS5,
-  FREQ_NOTE_EF5,
-  FREQ_NOTE_E5,
-  FREQ_NOTE_F5,
-  FREQ_NOTE_FS5,
-  FREQ_NOTE_GF5,
-  FREQ_NOTE_G5,
-  FREQ_NOTE_GS5,
-  FREQ_NOTE_AF5,
-  FREQ_NOTE_A5,
-  FREQ_NOTE_AS5,
-  FREQ_NOTE_BF5,
-  FREQ_NOTE_B5,
-  FREQ_NOTE_C6,
-  FREQ_NOTE_CS6,
-  FREQ_NOTE_DF6,
-  FREQ_NOTE_D6,
-  FREQ_NOTE_DS6,
-  FREQ_NOTE_EF6,
-  FREQ_NOTE_E6,
-  FREQ_NOTE_F6,
-  FREQ_NOTE_FS6,
-  FREQ_NOTE_GF6,
-  FREQ_NOTE_G6,
-  FREQ_NOTE_GS6,
-  FREQ_NOTE_AF6,
-  FREQ_NOTE_A6,
-  FREQ_NOTE_AS6,
-  FREQ_NOTE_BF6,
-  FREQ_NOTE_B6,
-  FREQ_NOTE_C7,
-  FREQ_NOTE_CS7,
-  FREQ_NOTE_DF7,
-  FREQ_NOTE_D7,
-  FREQ_NOTE_DS7,
-  FREQ_NOTE_EF7,
-  FREQ_NOTE_E7,
-  FREQ_NOTE_F7,
-  FREQ_NOTE_FS7,
-  FREQ_NOTE_GF7,
-  FREQ_NOTE_G7,
-  FREQ_NOTE_GS7,
-  FREQ_NOTE_AF7,
-  FREQ_NOTE_A7,
-  FREQ_NOTE_AS7,
-  FREQ_NOTE_BF7,
-  FREQ_NOTE_B7,
-  FREQ_NOTE_C8,
-  FREQ_NOTE_CS8,
-  FREQ_NOTE_DF8,
-  FREQ_NOTE_D8,
-  FREQ_NOTE_DS8,
-  FREQ_NOTE_EF8,
-  FREQ_NOTE_E8,
-  FREQ_NOTE_F8,
-  FREQ_NOTE_FS8
+  NOTE_FREQ_HZ(FREQ_NOTE_REST),
+  NOTE_FREQ_HZ(FREQ_NOTE_C0),
+  NOTE_FREQ_HZ(FREQ_NOTE_CS0),
+  NOTE_FREQ_HZ(FREQ_NOTE_DF0),
+  NOTE_FREQ_HZ(FREQ_NOTE_D0),
+  NOTE_FREQ_HZ(FREQ_NOTE_DS0),
+  NOTE_FREQ_HZ(FREQ_NOTE_EF0),
+  NOTE_FREQ_HZ(FREQ_NOTE_E0),
+  NOTE_FREQ_HZ(FREQ_NOTE_F0),
+  NOTE_FREQ_HZ(FREQ_NOTE_FS0),
+  NOTE_FREQ_HZ(FREQ_NOTE_GF0),
+  NOTE_FREQ_HZ(FREQ_NOTE_G0),
+  NOTE_FREQ_HZ(FREQ_NOTE_GS0),
+  NOTE_FREQ_HZ(FREQ_NOTE_AF0),
+  NOTE_FREQ_HZ(FREQ_NOTE_A0),
+  NOTE_FREQ_HZ(FREQ_NOTE_AS0),
+  NOTE_FREQ_HZ(FREQ_NOTE_BF0),
+  NOTE_FREQ_HZ(FREQ_NOTE_B0),
+  NOTE_FREQ_HZ(FREQ_NOTE_C1),
+  NOTE_FREQ_HZ(FREQ_NOTE_CS1),
+  NOTE_FREQ_HZ(FREQ_NOTE_DF1),
+  NOTE_FREQ_HZ(FREQ_NOTE_D1),
+  NOTE_FREQ_HZ(FREQ_NOTE_DS1),
+  NOTE_FREQ_HZ(FREQ_NOTE_EF1),
+  NOTE_FREQ_HZ(FREQ_NOTE_E1),
+  NOTE_FREQ_HZ(FREQ_NOTE_F1),
+  NOTE_FREQ_HZ(FREQ_NOTE_FS1),
+  NOTE_FREQ_HZ(FREQ_NOTE_GF1),
+  NOTE_FREQ_HZ(FREQ_NOTE_G1),
+  NOTE_FREQ_HZ(FREQ_NOTE_GS1),
+  NOTE_FREQ_HZ(FREQ_NOTE_AF1),
+  NOTE_FREQ_HZ(FREQ_NOTE_A1),
+  NOTE_FREQ_HZ(FREQ_NOTE_AS1),
+  NOTE_FREQ_HZ(FREQ_NOTE_BF1),
+  NOTE_FREQ_HZ(FREQ_NOTE_B1),
+  NOTE_FREQ_HZ(FREQ_NOTE_C2),
+  NOTE_FREQ_HZ(FREQ_NOTE_CS2),
+  NOTE_FREQ_HZ(FREQ_NOTE_DF2),
+  NOTE_FREQ_HZ(FREQ_NOTE_D2),
+  NOTE_FREQ_HZ(FREQ_NOTE_DS2),
+  NOTE_FREQ_HZ(FREQ_NOTE_EF2),
+  NOTE_FREQ_HZ(FREQ_NOTE_E2),
+  NOTE_FREQ_HZ(FREQ_NOTE_F2),
+  NOTE_FREQ_HZ(FREQ_NOTE_FS2),
+  NOTE_FREQ_HZ(FREQ_NOTE_GF2),
+  NOTE_FREQ_HZ(FREQ_NOTE_G2),
+  NOTE_FREQ_HZ(FREQ_NOTE_GS2),
+  NOTE_FREQ_HZ(FREQ_NOTE_AF2),
+  NOTE_FREQ_HZ(FREQ_NOTE_A2),
+  NOTE_FREQ_HZ(FREQ_NOTE_AS2),
+  NOTE_FREQ_HZ(FREQ_NOTE_BF2),
+  NOTE_FREQ_HZ(FREQ_NOTE_B2),
+  NOTE_FREQ_HZ(FREQ_NOTE_C3),
+  NOTE_FREQ_HZ(FREQ_NOTE_CS3),
+  NOTE_FREQ_HZ(FREQ_NOTE_DF3),
+  NOTE_FREQ_HZ(FREQ_NOTE_D3),
+  NOTE_FREQ_HZ(FREQ_NOTE_DS3),
+  NOTE_FREQ_HZ(FREQ_NOTE_EF3),
+  NOTE_FREQ_HZ(FREQ_NOTE_E3),
+  NOTE_FREQ_HZ(FREQ_NOTE_F3),
+  NOTE_FREQ_HZ(FREQ_NOTE_FS3),
+  NOTE_FREQ_HZ(FREQ_NOTE_GF3),
+  NOTE_FREQ_HZ(FREQ_NOTE_G3),
+  NOTE_FREQ_HZ(FREQ_NOTE_GS3),
+  NOTE_FREQ_HZ(FREQ_NOTE_AF3),
+  NOTE_FREQ_HZ(FREQ_NOTE_A3),
+  NOTE_FREQ_HZ(FREQ_NOTE_AS3),
+  NOTE_FREQ_HZ(FREQ_NOTE_BF3),
+  NOTE_FREQ_HZ(FREQ_NOTE_B3),
+  NOTE_FREQ_HZ(FREQ_NOTE_C4),
+  NOTE_FREQ_HZ(FREQ_NOTE_CS4),
+  NOTE_FREQ_HZ(FREQ_NOTE_DF4),
+  NOTE_FREQ_HZ(FREQ_NOTE_D4),
+  NOTE_FREQ_HZ(FREQ_NOTE_DS4),
+  NOTE_FREQ_HZ(FREQ_NOTE_EF4),
+  NOTE_FREQ_HZ(FREQ_NOTE_E4),
+  NOTE_FREQ_HZ(FREQ_NOTE_F4),
+  NOTE_FREQ_HZ(FREQ_NOTE_FS4),
+  NOTE_FREQ_HZ(FREQ_NOTE_GF4),
+  NOTE_FREQ_HZ(FREQ_NOTE_G4),
+  NOTE_FREQ_HZ(FREQ_NOTE_GS4),
+  NOTE_FREQ_HZ(FREQ_NOTE_AF4),
+  NOTE_FREQ_HZ(FREQ_NOTE_A4),
+  NOTE_FREQ_HZ(FREQ_NOTE_AS4),
+  NOTE_FREQ_HZ(FREQ_NOTE_BF4),
+  NOTE_FREQ_HZ(FREQ_NOTE_B4),
+  NOTE_FREQ_HZ(FREQ_NOTE_C5),
+  NOTE_FREQ_HZ(FREQ_NOTE_CS5),
+  NOTE_FREQ_HZ(FREQ_NOTE_DF5),
+  NOTE_FREQ_HZ(FREQ_NOTE_D5),
+  NOTE_FREQ_HZ(FREQ_NOTE_DS5),
+  NOTE_FREQ_HZ(FREQ_NOTE_EF5),
+  NOTE_FREQ_HZ(FREQ_NOTE_E5),
+  NOTE_FREQ_HZ(FREQ_NOTE_F5),
+  NOTE_FREQ_HZ(FREQ_NOTE_FS5),
+  NOTE_FREQ_HZ(FREQ_NOTE_GF5),
+  NOTE_FREQ_HZ(FREQ_NOTE_G5),
+  NOTE_FREQ_HZ(FREQ_NOTE_GS5),
+  NOTE_FREQ_HZ(FREQ_NOTE_AF5),
+  NOTE_FREQ_HZ(FREQ_NOTE_A5),
+  NOTE_FREQ_HZ(FREQ_NOTE_AS5),
+  NOTE_FREQ_HZ(FREQ_NOTE_BF5),
+  NOTE_FREQ_HZ(FREQ_NOTE_B5),
+  NOTE_FREQ_HZ(FREQ_NOTE_C6),
+  NOTE_FREQ_HZ(FREQ_NOTE_CS6),
+  NOTE_FREQ_HZ(FREQ_NOTE_DF6),
+  NOTE_FREQ_HZ(FREQ_NOTE_D6),
+  NOTE_FREQ_HZ(FREQ_NOTE_DS6),
+  NOTE_FREQ_HZ(FREQ_NOTE_EF6),
+  NOTE_FREQ_HZ(FREQ_NOTE_E6),
+  NOTE_FREQ_HZ(FREQ_NOTE_F6),
+  NOTE_FREQ_HZ(FREQ_NOTE_FS6),
+  NOTE_FREQ_HZ(FREQ_NOTE_GF6),
+  NOTE_FREQ_HZ(FREQ_NOTE_G6),
+  NOTE_FREQ_HZ(FREQ_NOTE_GS6),
+  NOTE_FREQ_HZ(FREQ_NOTE_AF6),
+  NOTE_FREQ_HZ(FREQ_NOTE_A6),
+  NOTE_FREQ_HZ(FREQ_NOTE_AS6),
+  NOTE_FREQ_HZ(FREQ_NOTE_BF6),
+  NOTE_FREQ_HZ(FREQ_NOTE_B6),
+  NOTE_FREQ_HZ(FREQ_NOTE_C7),
+  NOTE_FREQ_HZ(FREQ_NOTE_CS7),
+  NOTE_FREQ_HZ(FREQ_NOTE_DF7),
+  NOTE_FREQ_HZ(FREQ_NOTE_D7),
+  NOTE_FREQ_HZ(FREQ_NOTE_DS7),
+  NOTE_FREQ_HZ(FREQ_NOTE_EF7),
+  NOTE_FREQ_HZ(FREQ_NOTE_E7),
+  NOTE_FREQ_HZ(FREQ_NOTE_F7),
+  NOTE_FREQ_HZ(FREQ_NOTE_FS7),
+  NOTE_FREQ_HZ(FREQ_NOTE_GF7),
+  NOTE_FREQ_HZ(FREQ_NOTE_G7),
+  NOTE_FREQ_HZ(FREQ_NOTE_GS7),
+  NOTE_FREQ_HZ(FREQ_NOTE_AF7),
+  NOTE_FREQ_HZ(FREQ_NOTE_A7),
+  NOTE_FREQ_HZ(FREQ_NOTE_AS7),
+  NOTE_FREQ_HZ(FREQ_NOTE_BF7),
+  NOTE_FREQ_HZ(FREQ_NOTE_B7),
+  NOTE_FREQ_HZ(FREQ_NOTE_C8),
+  NOTE_FREQ_HZ(FREQ_NOTE_CS8),
+  NOTE_FREQ_HZ(FREQ_NOTE_DF8),
+  NOTE_FREQ_HZ(FREQ_NOTE_D8),
+  NOTE_FREQ_HZ(FREQ_NOTE_DS8),
+  NOTE_FREQ_HZ(FREQ_NOTE_EF8),
+  NOTE_FREQ_HZ(FREQ_NOTE_E8),
+  NOTE_FREQ_HZ(FREQ_NOTE_F8),
+  NOTE_FREQ_HZ(FREQ_NOTE_FS8),
+  NOTE_FREQ_HZ(FREQ_NOTE_GF8),
+  NOTE_FREQ_HZ(FREQ_NOTE_G8),
+  NOTE_FREQ_HZ(FREQ_NOTE_GS8),
+  NOTE_FREQ_HZ(FREQ_NOTE_AF8),
+  NOTE_FREQ_HZ(FREQ_NOTE_A8),
+  NOTE_FREQ_HZ(FREQ_NOTE_AS8),
+  NOTE_FREQ_HZ(FREQ_NOTE_BF8),
+  NOTE_FREQ_HZ(FREQ_NOTE_B8)
 };
 
-float GetNoteFrequency(NoteName note)
+uint16_t GetNoteFrequency(NoteName note)
 {
   if (note < NOTE_TOTAL_NUM_NOTES)
   {
@@ -163,7 +174,7 @@ float GetNoteFrequency(NoteName note)
   }
   
   ESP_LOGI(TAG, "Invalid note: %d", note);
-  return 0.0;
+  return 0;
 }
 
 NoteParts GetNoteParts(NoteName note)
@@ -1,23 +1,74 @@
 
 #include <stdint.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include "esp_check.h"
+#include "esp_cpu.h"
+#include "esp_heap_caps.h"
 #include "esp_log.h"
+#include "esp_rom_sys.h"
+#include "esp_timer.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 
 #include "NotificationDispatcher.h"
-#include "SystemState.h"
 #include "TaskPriorities.h"
+#include "TimeUtils.h"
 
-// Size of notification queue before dropping messages
-#define NOTIFICATION_QUEUE_SIZE (100)
-#define MUTEX_WAIT_DURATION_MS  (100)
+#define NOTIFICATION_PAYLOAD_HEADER_SIZE ((sizeof(NotificationPayloadHeader) + 7) & ~7)
+#define PAYLOAD_TO_HEADER(pPayload) ((NotificationPayloadHeader *)((uint8_t *)(pPayload) - NOTIFICATION_PAYLOAD_HEADER_SIZE))
+#define HEADER_TO_PAYLOAD(pHeader)  ((void *)((uint8_t *)(pHeader) + NOTIFICATION_PAYLOAD_HEADER_SIZE))
+
+#if CONFIG_NOTIFICATION_TRACE
+#define NOTIFICATION_TRACE_MASK (CONFIG_NOTIFICATION_TRACE_RECORDS - 1)
+_Static_assert((CONFIG_NOTIFICATION_TRACE_RECORDS & NOTIFICATION_TRACE_MASK) == 0, "CONFIG_NOTIFICATION_TRACE_RECORDS must be a power of two");
+#endif
+
+// Internal Function Declarations
+static void _NotificationDispatcher_Task(void *pvParameters);
+static void _NotificationDispatcher_LaneInit(NotificationDispatcher *this, NotificationLaneIndex laneIndex);
+static bool _NotificationRing_Push(NotificationRing *pRing, NotificationEvent notificationEvent, void *pData, uint32_t postTimeUs, uint16_t producerTask);
+static bool _NotificationRing_Pop(NotificationRing *pRing, NotificationSlot *pItem);
+static void _NotificationPool_Init(NotificationPool *pPool, NotificationPoolIndex poolIndex);
+#if CONFIG_NOTIFICATION_TRACE
+static void _NotificationDispatcher_TraceRecord(NotificationDispatcher *this, NotificationLane *pLane, NotificationTraceType type, NotificationEvent notificationEvent, uint16_t taskNumber, uint32_t timestampUs, uint32_t durationUs, uint8_t handlerIndex);
+static uint8_t _NotificationDispatcher_QueueDepth(NotificationLane *pLane);
+static void _NotificationHistogram_Add(NotificationHistogram *pHistogram, uint32_t valueUs);
+#endif
 
 // Internal Constants
+static const size_t POOL_BLOCK_SIZES[NOTIFICATION_POOL_COUNT] = { NOTIFICATION_POOL_SMALL_BLOCK_SIZE, NOTIFICATION_POOL_LARGE_BLOCK_SIZE };
+static const size_t POOL_BLOCK_COUNTS[NOTIFICATION_POOL_COUNT] = { NOTIFICATION_POOL_SMALL_BLOCK_COUNT, NOTIFICATION_POOL_LARGE_BLOCK_COUNT };
+static const uint32_t LANE_QUEUE_SIZES[NOTIFICATION_LANE_COUNT] = { NOTIFICATION_QUEUE_SIZE, NOTIFICATION_HIGH_QUEUE_SIZE };
+static const UBaseType_t LANE_TASK_PRIORITIES[NOTIFICATION_LANE_COUNT] = { NOTIFICATIONS_BULK_TASK_PRIORITY, NOTIFICATIONS_HIGH_TASK_PRIORITY };
+static const BaseType_t LANE_TASK_CORES[NOTIFICATION_LANE_COUNT] = { NOTIFICATIONS_BULK_TASK_CORE, NOTIFICATIONS_HIGH_TASK_CORE };
+static const char * const LANE_TASK_NAMES[NOTIFICATION_LANE_COUNT] = { "NotificationsEventLoop", "NotificationsHighLoop" };
+
+// Latency sensitive events. Events of one feature stay in one lane so their order is kept.
+// The two lanes run on different tasks, so a module whose handlers span both lanes must lock the
+// state they share. Keep a module on one lane unless it needs the latency. Modules on both lanes:
+//   LedControl  - song notes (high) and game/BLE/interactive (bulk) write separate runtime info fields
+//   LedModing   - setters and sequence changes are serialized by modeMutex
+//   SystemState - touch sense and song notes (high) share the peer song flags with the bulk
+//                 handlers under peerSongLock. Touch commands (high) share the menu flags with the
+//                 interactive game handler (bulk) and the menu timers under menuLock. Touch sense
+//                 reads touchActive and the interactive game flag unlocked; a stale value costs one
+//                 timer reset or vibration pulse
+static const uint8_t EVENT_LANES[NOTIFICATION_EVENTS_COUNT] =
+{
+    [NOTIFICATION_EVENTS_TOUCH_SENSE_ACTION]    = NOTIFICATION_LANE_HIGH,
+    [NOTIFICATION_EVENTS_TOUCH_ACTION_CMD]      = NOTIFICATION_LANE_HIGH,
+    [NOTIFICATION_EVENTS_TOUCH_ENABLED]         = NOTIFICATION_LANE_HIGH,
+    [NOTIFICATION_EVENTS_TOUCH_DISABLED]        = NOTIFICATION_LANE_HIGH,
+    [NOTIFICATION_EVENTS_PLAY_SONG]             = NOTIFICATION_LANE_HIGH,
+    [NOTIFICATION_EVENTS_SONG_NOTE_ACTION]      = NOTIFICATION_LANE_HIGH,
+};
 static const char * TAG = "ND";
 
+_Static_assert((NOTIFICATION_QUEUE_SIZE & (NOTIFICATION_QUEUE_SIZE - 1)) == 0, "NOTIFICATION_QUEUE_SIZE must be a power of two");
+_Static_assert((NOTIFICATION_HIGH_QUEUE_SIZE & (NOTIFICATION_HIGH_QUEUE_SIZE - 1)) == 0, "NOTIFICATION_HIGH_QUEUE_SIZE must be a power of two");
+
 esp_err_t NotificationDispatcher_Init(NotificationDispatcher *this)
 {
     static bool initialized = false;
@@ -30,21 +81,24 @@ esp_err_t NotificationDispatcher_Init(NotificationDispatcher *this)
         initialized = true;
         memset(this, 0, sizeof(*this));
         this->notificationEventBase = "NotificationEventBase";
+        portMUX_INITIALIZE(&this->registerLock);
+        portMUX_INITIALIZE(&this->poolLock);
+        portMUX_INITIALIZE(&this->traceLock);
 
-        // Create the event loop
-        esp_event_loop_args_t touchTaskArgs =
+        for (uint32_t i = 0; i < NOTIFICATION_POOL_COUNT; i++)
         {
-            .queue_size = NOTIFICATION_QUEUE_SIZE,
-            .task_name = "NotificationsEventLoop",
-            .task_priority = NOTIFICATIONS_TASK_PRIORITY,
-            .task_stack_size = configMINIMAL_STACK_SIZE * 3,
-            .task_core_id = APP_CPU_NUM
-        };
-        ESP_ERROR_CHECK(esp_event_loop_create(&touchTaskArgs, &this->eventLoopHandle));
+            _NotificationPool_Init(&this->pools[i], i);
+        }
 
-        // Create mutex for notifies
-        this->notifyMutex = xSemaphoreCreateMutex();
-        assert(this->notifyMutex);
+        for (uint32_t i = 0; i < NOTIFICATION_EVENTS_COUNT; i++)
+        {
+            atomic_init(&this->subscriberCount[i], 0);
+        }
+
+        for (uint32_t i = 0; i < NOTIFICATION_LANE_COUNT; i++)
+        {
+            _NotificationDispatcher_LaneInit(this, i);
+        }
 
         ret = ESP_OK;
     }
@@ -54,40 +108,78 @@ esp_err_t NotificationDispatcher_Init(NotificationDispatcher *this)
 esp_err_t NotificationDispatcher_NotifyEvent(NotificationDispatcher *this, NotificationEvent notificationEvent, void *data, int dataSize, uint32_t waitDurationMSec)
 {
     assert(this);
-    assert(this->eventLoopHandle);
-    assert(this->notificationEventBase);
-    assert(this->notifyMutex);
+
+    void *pPayload = NULL;
+
+    // Copied so the publisher can reuse its buffer
+    if (data != NULL && dataSize > 0)
+    {
+        pPayload = NotificationDispatcher_AcquirePayload(this, dataSize);
+        if (pPayload == NULL)
+        {
+            ESP_LOGE(TAG, "Failed to allocate notification data");
+            return ESP_ERR_NO_MEM;
+        }
+        memcpy(pPayload, data, dataSize);
+    }
+
+    return NotificationDispatcher_NotifyPayload(this, notificationEvent, pPayload, waitDurationMSec);
+}
+
+esp_err_t NotificationDispatcher_NotifyPayload(NotificationDispatcher *this, NotificationEvent notificationEvent, void *pPayload, uint32_t waitDurationMSec)
+{
+    assert(this);
 
     esp_err_t ret = ESP_FAIL;
 
-    if(xSemaphoreTake(this->notifyMutex, pdMS_TO_TICKS(MUTEX_WAIT_DURATION_MS)) != pdTRUE)
+    if (notificationEvent < 0 || notificationEvent >= NOTIFICATION_EVENTS_COUNT)
     {
-        ESP_LOGE(TAG, "Failed to take mutex");
+        ESP_LOGE(TAG, "Invalid base or event");
+        NotificationDispatcher_ReleasePayload(this, pPayload);
+        return ESP_ERR_INVALID_ARG;
     }
-    else
+
+    NotificationLane *pLane = &this->lanes[EVENT_LANES[notificationEvent]];
+    assert(pLane->pRing);
+    assert(pLane->dispatchTaskHandle);
+
+    uint32_t postTimeUs = 0;
+    uint16_t producerTask = 0;
+#if CONFIG_NOTIFICATION_TRACE
+    if (this->traceEnabled)
     {
-        ret = esp_event_post_to(this->eventLoopHandle,
-                                this->notificationEventBase,
-                                notificationEvent,
-                                data,
-                                dataSize,
-                                pdMS_TO_TICKS(waitDurationMSec));       // Time to wait for full queue before timing out
-        switch(ret)
+        postTimeUs = (uint32_t)esp_timer_get_time();
+        producerTask = (uint16_t)uxTaskGetTaskNumber(xTaskGetCurrentTaskHandle());
+    }
+#endif
+
+    TickType_t expireTime = TimeUtils_GetFutureTimeTicks(waitDurationMSec);
+    while (ret != ESP_OK)
+    {
+        if (_NotificationRing_Push(pLane->pRing, notificationEvent, pPayload, postTimeUs, producerTask))
         {
-            case ESP_OK:
-                ESP_LOGD(TAG, "Notification (%d) Posted", notificationEvent);
-                break;
-            case ESP_ERR_TIMEOUT:
-                ESP_LOGE(TAG, "Notification Queue Full");
-                break;
-            case ESP_ERR_INVALID_ARG:
-                ESP_LOGE(TAG, "Invalid base or event");
-                break;
+#if CONFIG_NOTIFICATION_TRACE
+            if (postTimeUs != 0)
+            {
+                _NotificationDispatcher_TraceRecord(this, pLane, NOTIFICATION_TRACE_POST, notificationEvent, producerTask, postTimeUs, 0, 0);
+            }
+#endif
+            xTaskNotifyGive(pLane->dispatchTaskHandle);
+            ESP_LOGD(TAG, "Notification (%d) Posted", notificationEvent);
+            ret = ESP_OK;
         }
-
-        if(xSemaphoreGive(this->notifyMutex) != pdTRUE)
+        else if (TimeUtils_IsTimeExpired(expireTime))
+        {
+            ESP_LOGE(TAG, "Notification Queue Full (lane %d)", pLane->laneIndex);
+            atomic_fetch_add_explicit(&pLane->pRing->droppedCount, 1, memory_order_relaxed);
+            NotificationDispatcher_ReleasePayload(this, pPayload);
+            ret = ESP_ERR_TIMEOUT;
+            break;
+        }
+        else
         {
-            ESP_LOGE(TAG, "Failed to give mutex");
+            // Wait for the dispatch task to drain
+            vTaskDelay(1);
         }
     }
 
@@ -96,11 +188,484 @@ esp_err_t NotificationDispatcher_NotifyEvent(NotificationDispatcher *this, Notif
 
 esp_err_t NotificationDispatcher_RegisterNotificationEventHandler(NotificationDispatcher *this, NotificationEvent notificationEvent, esp_event_handler_t eventHandler, void *eventHandlerArgs)
 {
+    esp_err_t ret = ESP_ERR_NO_MEM;
+    assert(this);
+    assert(eventHandler);
+
+    if (notificationEvent < 0 || notificationEvent >= NOTIFICATION_EVENTS_COUNT)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    // Write the entry before publishing the new count so the dispatch task never sees a partial entry
+    taskENTER_CRITICAL(&this->registerLock);
+    uint32_t count = atomic_load_explicit(&this->subscriberCount[notificationEvent], memory_order_relaxed);
+    if (count < NOTIFICATION_MAX_SUBSCRIBERS_PER_EVENT)
+    {
+        this->subscribers[notificationEvent][count].eventHandler = eventHandler;
+        this->subscribers[notificationEvent][count].eventHandlerArgs = eventHandlerArgs;
+        atomic_store_explicit(&this->subscriberCount[notificationEvent], count + 1, memory_order_release);
+        ret = ESP_OK;
+    }
+    taskEXIT_CRITICAL(&this->registerLock);
+
+    if (ret != ESP_OK)
+    {
+        ESP_LOGE(TAG, "Too many subscribers for notification (%d)", notificationEvent);
+    }
+    return ret;
+}
+
+void *NotificationDispatcher_AcquirePayload(NotificationDispatcher *this, size_t size)
+{
+    assert(this);
+    NotificationPayloadHeader *pHeader = NULL;
+
+    // Smallest pool that fits, moving up a size when it is empty
+    taskENTER_CRITICAL(&this->poolLock);
+    for (uint32_t i = 0; i < NOTIFICATION_POOL_COUNT && pHeader == NULL; i++)
+    {
+        NotificationPool *pPool = &this->pools[i];
+        if (size <= pPool->stats.blockSize)
+        {
+            if (pPool->pFreeList != NULL)
+            {
+                pHeader = pPool->pFreeList;
+                pPool->pFreeList = pHeader->pNext;
+                ++pPool->stats.acquired;
+                if (++pPool->stats.inUse > pPool->stats.highWater)
+                {
+                    pPool->stats.highWater = pPool->stats.inUse;
+                }
+            }
+            else
+            {
+                ++pPool->stats.exhausted;
+            }
+        }
+    }
+    if (pHeader == NULL)
+    {
+        ++this->heapPayloads;
+    }
+    taskEXIT_CRITICAL(&this->poolLock);
+
+    if (pHeader == NULL)
+    {
+        pHeader = malloc(NOTIFICATION_PAYLOAD_HEADER_SIZE + size);
+        if (pHeader == NULL)
+        {
+            return NULL;
+        }
+        pHeader->poolIndex = NOTIFICATION_POOL_HEAP;
+    }
+    pHeader->pNext = NULL;
+    pHeader->size = size;
+    pHeader->refCount = 1;
+    return HEADER_TO_PAYLOAD(pHeader);
+}
+
+void NotificationDispatcher_RetainPayload(NotificationDispatcher *this, void *pPayload)
+{
+    assert(this);
+    if (pPayload != NULL)
+    {
+        NotificationPayloadHeader *pHeader = PAYLOAD_TO_HEADER(pPayload);
+        taskENTER_CRITICAL(&this->poolLock);
+        assert(pHeader->refCount > 0);
+        ++pHeader->refCount;
+        taskEXIT_CRITICAL(&this->poolLock);
+    }
+}
+
+void NotificationDispatcher_ReleasePayload(NotificationDispatcher *this, void *pPayload)
+{
+    assert(this);
+    if (pPayload != NULL)
+    {
+        NotificationPayloadHeader *pHeader = PAYLOAD_TO_HEADER(pPayload);
+        bool freeToHeap = false;
+
+        taskENTER_CRITICAL(&this->poolLock);
+        assert(pHeader->refCount > 0);
+        if (--pHeader->refCount == 0)
+        {
+            if (pHeader->poolIndex < NOTIFICATION_POOL_COUNT)
+            {
+                NotificationPool *pPool = &this->pools[pHeader->poolIndex];
+                pHeader->pNext = pPool->pFreeList;
+                pPool->pFreeList = pHeader;
+                --pPool->stats.inUse;
+            }
+            else
+            {
+                freeToHeap = true;
+            }
+        }
+        taskEXIT_CRITICAL(&this->poolLock);
+
+        if (freeToHeap)
+        {
+            free(pHeader);
+        }
+    }
+}
+
+esp_err_t NotificationDispatcher_GetPoolStats(NotificationDispatcher *this, NotificationPoolStats pStats[NOTIFICATION_POOL_COUNT], uint32_t *pHeapPayloads)
+{
+    assert(this);
+    assert(pStats);
+
+    taskENTER_CRITICAL(&this->poolLock);
+    for (uint32_t i = 0; i < NOTIFICATION_POOL_COUNT; i++)
+    {
+        pStats[i] = this->pools[i].stats;
+    }
+    if (pHeapPayloads)
+    {
+        *pHeapPayloads = this->heapPayloads;
+    }
+    taskEXIT_CRITICAL(&this->poolLock);
+    return ESP_OK;
+}
+
+uint32_t NotificationDispatcher_GetDroppedCount(NotificationDispatcher *this, NotificationLaneIndex laneIndex)
+{
+    assert(this);
+    assert(laneIndex < NOTIFICATION_LANE_COUNT);
+    assert(this->lanes[laneIndex].pRing);
+    return atomic_load_explicit(&this->lanes[laneIndex].pRing->droppedCount, memory_order_relaxed);
+}
+
+NotificationLaneIndex NotificationDispatcher_GetEventLane(NotificationEvent notificationEvent)
+{
+    assert(notificationEvent >= 0 && notificationEvent < NOTIFICATION_EVENTS_COUNT);
+    return EVENT_LANES[notificationEvent];
+}
+
+esp_err_t NotificationDispatcher_SetTraceEnabled(NotificationDispatcher *this, bool enabled)
+{
+    assert(this);
+#if CONFIG_NOTIFICATION_TRACE
+    if (enabled && this->pTrace == NULL)
+    {
+        // Internal RAM keeps the per event cost down
+        NotificationTrace *pTrace = heap_caps_calloc(1, sizeof(NotificationTrace), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+        NotificationTraceRecord *pRecords = heap_caps_calloc(CONFIG_NOTIFICATION_TRACE_RECORDS, sizeof(NotificationTraceRecord), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+        if (pTrace == NULL || pRecords == NULL)
+        {
+            free(pTrace);
+            free(pRecords);
+            ESP_LOGE(TAG, "Failed to allocate notification trace");
+            return ESP_ERR_NO_MEM;
+        }
+        pTrace->pRecords = pRecords;
+        this->pTrace = pTrace;
+    }
+    this->traceEnabled = enabled;
+    return ESP_OK;
+#else
+    return enabled ? ESP_ERR_NOT_SUPPORTED : ESP_OK;
+#endif
+}
+
+bool NotificationDispatcher_IsTraceEnabled(NotificationDispatcher *this)
+{
+    assert(this);
+    return this->traceEnabled;
+}
+
+size_t NotificationDispatcher_DrainTrace(NotificationDispatcher *this, NotificationTraceRecord *pRecords, size_t maxRecords, uint32_t *pOverwritten)
+{
+    assert(this);
+    assert(pRecords);
+    size_t count = 0;
+
+#if CONFIG_NOTIFICATION_TRACE
+    if (this->pTrace != NULL)
+    {
+        NotificationTrace *pTrace = this->pTrace;
+        taskENTER_CRITICAL(&this->traceLock);
+        while (count < maxRecords && pTrace->tail != pTrace->head)
+        {
+            pRecords[count++] = pTrace->pRecords[pTrace->tail++ & NOTIFICATION_TRACE_MASK];
+        }
+        if (pOverwritten)
+        {
+            *pOverwritten = pTrace->overwritten;
+        }
+        pTrace->overwritten = 0;
+        taskEXIT_CRITICAL(&this->traceLock);
+    }
+#endif
+    return count;
+}
+
+esp_err_t NotificationDispatcher_GetTraceHistograms(NotificationDispatcher *this, NotificationEvent notificationEvent, NotificationHistogram *pDispatchLatency, NotificationHistogram *pHandlerTime)
+{
+    assert(this);
+    if (notificationEvent < 0 || notificationEvent >= NOTIFICATION_EVENTS_COUNT)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+#if CONFIG_NOTIFICATION_TRACE
+    if (this->pTrace == NULL)
+    {
+        return ESP_ERR_INVALID_STATE;
+    }
+    taskENTER_CRITICAL(&this->traceLock);
+    if (pDispatchLatency)
+    {
+        *pDispatchLatency = this->pTrace->dispatchLatency[notificationEvent];
+    }
+    if (pHandlerTime)
+    {
+        *pHandlerTime = this->pTrace->handlerTime[notificationEvent];
+    }
+    taskEXIT_CRITICAL(&this->traceLock);
+    return ESP_OK;
+#else
+    return ESP_ERR_NOT_SUPPORTED;
+#endif
+}
+
+void NotificationDispatcher_ResetTraceHistograms(NotificationDispatcher *this)
+{
+    assert(this);
+#if CONFIG_NOTIFICATION_TRACE
+    if (this->pTrace != NULL)
+    {
+        taskENTER_CRITICAL(&this->traceLock);
+        memset(this->pTrace->dispatchLatency, 0, sizeof(this->pTrace->dispatchLatency));
+        memset(this->pTrace->handlerTime, 0, sizeof(this->pTrace->handlerTime));
+        this->pTrace->overheadCycles = 0;
+        this->pTrace->overheadSamples = 0;
+        taskEXIT_CRITICAL(&this->traceLock);
+    }
+#endif
+}
+
+// Average tracing cost per dispatched event, covering its post, dispatch and handler records
+uint32_t NotificationDispatcher_GetTraceOverheadNs(NotificationDispatcher *this)
+{
+    assert(this);
+    uint32_t overheadNs = 0;
+#if CONFIG_NOTIFICATION_TRACE
+    if (this->pTrace != NULL)
+    {
+        taskENTER_CRITICAL(&this->traceLock);
+        uint64_t cycles = this->pTrace->overheadCycles;
+        uint32_t samples = this->pTrace->overheadSamples;
+        taskEXIT_CRITICAL(&this->traceLock);
+        if (samples > 0)
+        {
+            overheadNs = (uint32_t)((cycles * 1000) / ((uint64_t)samples * esp_rom_get_cpu_ticks_per_us()));
+        }
+    }
+#endif
+    return overheadNs;
+}
+
+static void _NotificationPool_Init(NotificationPool *pPool, NotificationPoolIndex poolIndex)
+{
+    size_t blockSize = POOL_BLOCK_SIZES[poolIndex];
+    size_t blockCount = POOL_BLOCK_COUNTS[poolIndex];
+    size_t stride = NOTIFICATION_PAYLOAD_HEADER_SIZE + ((blockSize + 7) & ~7);
+    memset(pPool, 0, sizeof(*pPool));
+    pPool->stats.blockSize = blockSize;
+    pPool->pBlocks = malloc(stride * blockCount);
+    if (pPool->pBlocks == NULL)
+    {
+        // Acquires from this pool fall back to the heap
+        ESP_LOGE(TAG, "Failed to allocate notification pool (%u x %u)", blockCount, blockSize);
+        return;
+    }
+
+    pPool->stats.blockCount = blockCount;
+    for (size_t i = 0; i < blockCount; i++)
+    {
+        NotificationPayloadHeader *pHeader = (NotificationPayloadHeader *)(pPool->pBlocks + i * stride);
+        pHeader->poolIndex = poolIndex;
+        pHeader->pNext = pPool->pFreeList;
+        pPool->pFreeList = pHeader;
+    }
+}
+
+static void _NotificationDispatcher_LaneInit(NotificationDispatcher *this, NotificationLaneIndex laneIndex)
+{
+    NotificationLane *pLane = &this->lanes[laneIndex];
+    uint32_t size = LANE_QUEUE_SIZES[laneIndex];
+
+    pLane->pNotificationDispatcher = this;
+    pLane->laneIndex = laneIndex;
+    pLane->pRing = heap_caps_calloc(1, sizeof(NotificationRing) + size * sizeof(NotificationSlot), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    assert(pLane->pRing);
+    pLane->pRing->size = size;
+    for (uint32_t i = 0; i < size; i++)
+    {
+        atomic_init(&pLane->pRing->slots[i].sequence, i);
+    }
+    atomic_init(&pLane->pRing->enqueuePos, 0);
+    atomic_init(&pLane->pRing->droppedCount, 0);
+    pLane->pRing->dequeuePos = 0;
+
+    assert(xTaskCreatePinnedToCore(_NotificationDispatcher_Task, LANE_TASK_NAMES[laneIndex], configMINIMAL_STACK_SIZE * 3, pLane, LANE_TASK_PRIORITIES[laneIndex], &pLane->dispatchTaskHandle, LANE_TASK_CORES[laneIndex]) == pdPASS);
+}
+
+// One per lane. Handlers of high lane events can preempt bulk handlers
+static void _NotificationDispatcher_Task(void *pvParameters)
+{
+    NotificationLane *pLane = (NotificationLane *)pvParameters;
+    assert(pLane);
+    NotificationDispatcher *this = pLane->pNotificationDispatcher;
     assert(this);
-    return esp_event_handler_instance_register_with(this->eventLoopHandle,
-                                                    this->notificationEventBase,
-                                                    notificationEvent,
-                                                    eventHandler,
-                                                    eventHandlerArgs,
-                                                    NULL);
+
+    while (true)
+    {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        NotificationSlot item;
+        while (_NotificationRing_Pop(pLane->pRing, &item))
+        {
+            uint32_t count = atomic_load_explicit(&this->subscriberCount[item.notificationEvent], memory_order_acquire);
+#if CONFIG_NOTIFICATION_TRACE
+            // Posts made before tracing started carry no timestamp
+            bool traced = this->traceEnabled && item.postTimeUs != 0;
+            if (traced)
+            {
+                uint32_t dispatchTimeUs = (uint32_t)esp_timer_get_time();
+                _NotificationDispatcher_TraceRecord(this, pLane, NOTIFICATION_TRACE_DISPATCH, item.notificationEvent, item.producerTask, dispatchTimeUs, dispatchTimeUs - item.postTimeUs, 0);
+            }
+#endif
+            for (uint32_t i = 0; i < count; i++)
+            {
+                NotificationSubscriber *pSubscriber = &this->subscribers[item.notificationEvent][i];
+#if CONFIG_NOTIFICATION_TRACE
+                uint32_t handlerStartUs = traced ? (uint32_t)esp_timer_get_time() : 0;
+#endif
+                pSubscriber->eventHandler(pSubscriber->eventHandlerArgs, this->notificationEventBase, item.notificationEvent, item.pData);
+#if CONFIG_NOTIFICATION_TRACE
+                if (traced)
+                {
+                    _NotificationDispatcher_TraceRecord(this, pLane, NOTIFICATION_TRACE_HANDLER, item.notificationEvent, item.producerTask, handlerStartUs, (uint32_t)esp_timer_get_time() - handlerStartUs, i);
+                }
+#endif
+            }
+            NotificationDispatcher_ReleasePayload(this, item.pData);
+        }
+    }
+}
+
+// Bounded MPMC ring (Vyukov) used with a single consumer. Producers never block each other
+static bool _NotificationRing_Push(NotificationRing *pRing, NotificationEvent notificationEvent, void *pData, uint32_t postTimeUs, uint16_t producerTask)
+{
+    unsigned int pos = atomic_load_explicit(&pRing->enqueuePos, memory_order_relaxed);
+    while (true)
+    {
+        NotificationSlot *pSlot = &pRing->slots[pos & (pRing->size - 1)];
+        unsigned int sequence = atomic_load_explicit(&pSlot->sequence, memory_order_acquire);
+        int diff = (int)(sequence - pos);
+        if (diff == 0)
+        {
+            if (atomic_compare_exchange_weak_explicit(&pRing->enqueuePos, &pos, pos + 1, memory_order_relaxed, memory_order_relaxed))
+            {
+                pSlot->notificationEvent = notificationEvent;
+                pSlot->pData = pData;
+                pSlot->postTimeUs = postTimeUs;
+                pSlot->producerTask = producerTask;
+                atomic_store_explicit(&pSlot->sequence, pos + 1, memory_order_release);
+                return true;
+            }
+        }
+        else if (diff < 0)
+        {
+            // Full
+            return false;
+        }
+        else
+        {
+            pos = atomic_load_explicit(&pRing->enqueuePos, memory_order_relaxed);
+        }
+    }
+}
+
+static bool _NotificationRing_Pop(NotificationRing *pRing, NotificationSlot *pItem)
+{
+    NotificationSlot *pSlot = &pRing->slots[pRing->dequeuePos & (pRing->size - 1)];
+    unsigned int sequence = atomic_load_explicit(&pSlot->sequence, memory_order_acquire);
+    if ((int)(sequence - (pRing->dequeuePos + 1)) < 0)
+    {
+        // Empty or producer has not finished filling the slot
+        return false;
+    }
+
+    pItem->notificationEvent = pSlot->notificationEvent;
+    pItem->pData = pSlot->pData;
+    pItem->postTimeUs = pSlot->postTimeUs;
+    pItem->producerTask = pSlot->producerTask;
+    atomic_store_explicit(&pSlot->sequence, pRing->dequeuePos + pRing->size, memory_order_release);
+    ++pRing->dequeuePos;
+    return true;
+}
+
+#if CONFIG_NOTIFICATION_TRACE
+// Called by producers and the dispatch task. The ring overwrites its oldest record when full
+static void _NotificationDispatcher_TraceRecord(NotificationDispatcher *this, NotificationLane *pLane, NotificationTraceType type, NotificationEvent notificationEvent, uint16_t taskNumber, uint32_t timestampUs, uint32_t durationUs, uint8_t handlerIndex)
+{
+    uint32_t startCycles = esp_cpu_get_cycle_count();
+    NotificationTrace *pTrace = this->pTrace;
+    uint8_t queueDepth = _NotificationDispatcher_QueueDepth(pLane);
+
+    taskENTER_CRITICAL(&this->traceLock);
+    NotificationTraceRecord *pRecord = &pTrace->pRecords[pTrace->head++ & NOTIFICATION_TRACE_MASK];
+    if (pTrace->head - pTrace->tail > CONFIG_NOTIFICATION_TRACE_RECORDS)
+    {
+        ++pTrace->tail;
+        ++pTrace->overwritten;
+    }
+    pRecord->timestampUs = timestampUs;
+    pRecord->durationUs = durationUs;
+    pRecord->taskNumber = taskNumber;
+    pRecord->type = type;
+    pRecord->notificationEvent = notificationEvent;
+    pRecord->queueDepth = queueDepth;
+    pRecord->handlerIndex = handlerIndex;
+    pRecord->lane = pLane->laneIndex;
+
+    if (type == NOTIFICATION_TRACE_DISPATCH)
+    {
+        _NotificationHistogram_Add(&pTrace->dispatchLatency[notificationEvent], durationUs);
+        ++pTrace->overheadSamples;
+    }
+    else if (type == NOTIFICATION_TRACE_HANDLER)
+    {
+        _NotificationHistogram_Add(&pTrace->handlerTime[notificationEvent], durationUs);
+    }
+    // Both cores read their own cycle counter, the delta stays valid inside the critical section
+    pTrace->overheadCycles += esp_cpu_get_cycle_count() - startCycles;
+    taskEXIT_CRITICAL(&this->traceLock);
+}
+
+static uint8_t _NotificationDispatcher_QueueDepth(NotificationLane *pLane)
+{
+    // Racy snapshot, good enough for a trace
+    uint32_t depth = atomic_load_explicit(&pLane->pRing->enqueuePos, memory_order_relaxed) - pLane->pRing->dequeuePos;
+    return (depth > UINT8_MAX) ? UINT8_MAX : depth;
+}
+
+static void _NotificationHistogram_Add(NotificationHistogram *pHistogram, uint32_t valueUs)
+{
+    uint32_t bucket = (valueUs == 0) ? 0 : 32 - __builtin_clz(valueUs);
+    if (bucket >= NOTIFICATION_TRACE_HISTOGRAM_BUCKETS)
+    {
+        bucket = NOTIFICATION_TRACE_HISTOGRAM_BUCKETS - 1;
+    }
+    ++pHistogram->buckets[bucket];
+    ++pHistogram->count;
+    if (valueUs > pHistogram->maxUs)
+    {
+        pHistogram->maxUs = valueUs;
+    }
 }
+#endif
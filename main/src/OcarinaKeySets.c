@@ -0,0 +1,23 @@
+#include "OcarinaMatcher.h"
+
+const OcarinaKeySet OcarinaSongKeySets[OCARINA_NUM_SONGS] =
+{
+  {"Zelda's Lullaby",    6, SONG_ZELDAS_LULLABY,        {OCARINA_KEY_X,  OCARINA_KEY_A,  OCARINA_KEY_Y,  OCARINA_KEY_X,  OCARINA_KEY_A,  OCARINA_KEY_Y}},
+  {"Epona's Song",       6, SONG_EPONAS_SONG,           {OCARINA_KEY_A,  OCARINA_KEY_X,  OCARINA_KEY_Y,  OCARINA_KEY_A,  OCARINA_KEY_X,  OCARINA_KEY_Y}},
+  {"Saria's Song",       6, SONG_SARIAS_SONG,           {OCARINA_KEY_R,  OCARINA_KEY_Y,  OCARINA_KEY_X,  OCARINA_KEY_R,  OCARINA_KEY_Y,  OCARINA_KEY_X}},
+  {"Sun's Song",         6, SONG_SUNS_SONG,             {OCARINA_KEY_Y,  OCARINA_KEY_R,  OCARINA_KEY_A,  OCARINA_KEY_Y,  OCARINA_KEY_R,  OCARINA_KEY_A}},
+  {"Song of Time",       6, SONG_SONG_OF_TIME,          {OCARINA_KEY_Y,  OCARINA_KEY_L,  OCARINA_KEY_R,  OCARINA_KEY_Y,  OCARINA_KEY_L,  OCARINA_KEY_R}},
+  {"Song of Storms",     6, SONG_SONG_OF_STORMS,        {OCARINA_KEY_L,  OCARINA_KEY_R,  OCARINA_KEY_A,  OCARINA_KEY_L,  OCARINA_KEY_R,  OCARINA_KEY_A}},
+  {"Minuet of Forest",   6, SONG_MINUET_OF_FOREST,      {OCARINA_KEY_L,  OCARINA_KEY_A,  OCARINA_KEY_X,  OCARINA_KEY_Y,  OCARINA_KEY_X,  OCARINA_KEY_Y}},
+  {"Bolero of Fire",     8, SONG_BOLERO_OF_FIRE,        {OCARINA_KEY_R,  OCARINA_KEY_L,  OCARINA_KEY_R,  OCARINA_KEY_L,  OCARINA_KEY_Y,  OCARINA_KEY_R,  OCARINA_KEY_Y,  OCARINA_KEY_R}},
+  {"Serenade of Water",  5, SONG_SERENADE_OF_WATER,     {OCARINA_KEY_L,  OCARINA_KEY_R,  OCARINA_KEY_Y,  OCARINA_KEY_Y,  OCARINA_KEY_X                }},
+  {"Nocturne of Shadow", 7, SONG_NOCTURNE_OF_SHADOW,    {OCARINA_KEY_X,  OCARINA_KEY_Y,  OCARINA_KEY_Y,  OCARINA_KEY_L,  OCARINA_KEY_X,  OCARINA_KEY_Y,  OCARINA_KEY_R}},
+  {"Requiem of Spirit",  6, SONG_REQUIEM_OF_SPIRIT,     {OCARINA_KEY_L,  OCARINA_KEY_R,  OCARINA_KEY_L,  OCARINA_KEY_Y,  OCARINA_KEY_R,  OCARINA_KEY_L}},
+  {"Prelude of Light",   6, SONG_PRELUDE_OF_LIGHT,      {OCARINA_KEY_A,  OCARINA_KEY_Y,  OCARINA_KEY_A,  OCARINA_KEY_Y,  OCARINA_KEY_X,  OCARINA_KEY_A}}
+};
+
+//   OCARINA_KEY_A       D4   TOUCH_SENSOR_LEFT_WING_FEATHER_2    T7
+//   OCARINA_KEY_X       B3   TOUCH_SENSOR_LEFT_WING_FEATHER_4    T5
+//   OCARINA_KEY_Y       A3   TOUCH_SENSOR_TAIL_FEATHER           T4
+//   OCARINA_KEY_R       F3   TOUCH_SENSOR_RIGHT_WING_FEATHER_3   T2
+//   OCARINA_KEY_L       D3   TOUCH_SENSOR_RIGHT_WING_FEATHER_1   T0
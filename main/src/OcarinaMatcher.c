@@ -0,0 +1,102 @@
+#include <assert.h>
+#include <string.h>
+
+#include "OcarinaMatcher.h"
+
+// Builds the key set trie, then walks it breadth first to fold the failure links into the transitions
+void OcarinaMatcher_Build(OcarinaMatcher *this, const OcarinaKeySet *pKeySets, int numKeySets)
+{
+    uint8_t failure[OCARINA_MAX_MATCH_STATES] = {0};
+    uint8_t queue[OCARINA_MAX_MATCH_STATES];
+    int queueHead = 0;
+    int queueTail = 0;
+
+    assert(this);
+    assert(pKeySets);
+    assert(numKeySets <= OCARINA_NUM_SONGS);
+    memset(this->transitions, 0, sizeof(this->transitions));
+    memset(this->matchedKeySet, -1, sizeof(this->matchedKeySet));
+    this->numStates = 1;
+    this->state = 0;
+
+    // 0 doubles as "no child" while building, the root is never a child
+    for (int i = 0; i < numKeySets; i++)
+    {
+        const OcarinaKeySet *pKeySet = &pKeySets[i];
+        assert(pKeySet->NumKeys <= OCARINA_MAX_SONG_KEYS);
+        uint8_t state = 0;
+        for (int k = 0; k < pKeySet->NumKeys; k++)
+        {
+            OcarinaKey key = pKeySet->Keys[k];
+            assert(key >= 0 && key < OCARINA_NUM_KEYS);
+            if (this->transitions[state][key] == 0)
+            {
+                assert(this->numStates < OCARINA_MAX_MATCH_STATES);
+                this->transitions[state][key] = this->numStates++;
+            }
+            state = this->transitions[state][key];
+        }
+        if (this->matchedKeySet[state] < 0)
+        {
+            this->matchedKeySet[state] = i;
+        }
+    }
+
+    for (int key = 0; key < OCARINA_NUM_KEYS; key++)
+    {
+        if (this->transitions[0][key] != 0)
+        {
+            queue[queueTail++] = this->transitions[0][key];
+        }
+    }
+
+    while (queueHead < queueTail)
+    {
+        uint8_t state = queue[queueHead++];
+        // A key set ending in the longest proper suffix also ends here. Lower table index wins like the old linear scan
+        int8_t suffixKeySet = this->matchedKeySet[failure[state]];
+        if (suffixKeySet >= 0 && (this->matchedKeySet[state] < 0 || suffixKeySet < this->matchedKeySet[state]))
+        {
+            this->matchedKeySet[state] = suffixKeySet;
+        }
+
+        for (int key = 0; key < OCARINA_NUM_KEYS; key++)
+        {
+            uint8_t child = this->transitions[state][key];
+            uint8_t fallback = this->transitions[failure[state]][key];
+            if (child != 0)
+            {
+                failure[child] = fallback;
+                queue[queueTail++] = child;
+            }
+            else
+            {
+                this->transitions[state][key] = fallback;
+            }
+        }
+    }
+}
+
+void OcarinaMatcher_Reset(OcarinaMatcher *this)
+{
+    assert(this);
+    this->state = 0;
+}
+
+int OcarinaMatcher_PressKey(OcarinaMatcher *this, OcarinaKey key)
+{
+    assert(this);
+    if (key < 0 || key >= OCARINA_NUM_KEYS)
+    {
+        return -1;
+    }
+
+    this->state = this->transitions[this->state][key];
+    int matched = this->matchedKeySet[this->state];
+    if (matched >= 0)
+    {
+        // Keys played before a match don't carry into the next song
+        this->state = 0;
+    }
+    return matched;
+}
@@ -0,0 +1,283 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "esp_log.h"
+#include "esp_ota_ops.h"
+#include "spi_flash_mmap.h"
+
+#include "OtaImageDecoder.h"
+#include "Utilities.h"
+
+#define OTA_DECODER_COPY_CHUNK_SIZE 1024
+
+// Internal Function Declarations
+static esp_err_t _OtaImageDecoder_WriteOutput(OtaImageDecoder *this, const uint8_t *pData, size_t length);
+static esp_err_t _OtaImageDecoder_Inflate(OtaImageDecoder *this, const uint8_t *pData, size_t length);
+static esp_err_t _OtaImageDecoder_ApplyDelta(OtaImageDecoder *this, const uint8_t *pData, size_t length);
+static esp_err_t _OtaImageDecoder_CopyFromSource(OtaImageDecoder *this, uint32_t sourceOffset, uint32_t length);
+static uint32_t _OtaImageDecoder_ReadU32(const uint8_t *pData);
+
+// Internal Constants
+static const char * TAG = "ota_decoder";
+
+esp_err_t OtaImageDecoder_Init(OtaImageDecoder *this, OtaImageEncoding encoding, const esp_partition_t *pTarget, uint32_t startOffset)
+{
+    esp_err_t ret = ESP_OK;
+    assert(this);
+    assert(pTarget);
+    memset(this, 0, sizeof(*this));
+
+    this->encoding = encoding;
+    this->pTarget = pTarget;
+    this->outputOffset = startOffset;
+    this->erasedEnd = startOffset;
+
+    if (encoding == OTA_IMAGE_ENCODING_DEFLATE || encoding == OTA_IMAGE_ENCODING_DELTA)
+    {
+        // Resuming mid-stream would need the whole inflate window, so encoded streams start over
+        assert(startOffset == 0);
+        this->pInflator = malloc(sizeof(tinfl_decompressor));
+        this->pDictionary = malloc(TINFL_LZ_DICT_SIZE);
+        if (this->pInflator && this->pDictionary)
+        {
+            tinfl_init(this->pInflator);
+        }
+        else
+        {
+            ret = ESP_ERR_NO_MEM;
+        }
+    }
+
+    if (ret == ESP_OK && encoding == OTA_IMAGE_ENCODING_DELTA)
+    {
+        this->pSource = esp_ota_get_running_partition();
+        this->pCopyBuffer = malloc(OTA_DECODER_COPY_CHUNK_SIZE);
+        if (this->pSource == NULL || this->pCopyBuffer == NULL)
+        {
+            ret = ESP_ERR_NO_MEM;
+        }
+    }
+
+    if (encoding >= OTA_IMAGE_ENCODING_UNKNOWN)
+    {
+        ret = ESP_ERR_NOT_SUPPORTED;
+    }
+
+    if (ret != ESP_OK)
+    {
+        ESP_LOGE(TAG, "Failed to init decoder(%d). error code = %s", encoding, esp_err_to_name(ret));
+        OtaImageDecoder_Deinit(this);
+    }
+    return ret;
+}
+
+void OtaImageDecoder_Deinit(OtaImageDecoder *this)
+{
+    assert(this);
+    free(this->pInflator);
+    free(this->pDictionary);
+    free(this->pCopyBuffer);
+    this->pInflator = NULL;
+    this->pDictionary = NULL;
+    this->pCopyBuffer = NULL;
+}
+
+esp_err_t OtaImageDecoder_Write(OtaImageDecoder *this, const uint8_t *pData, size_t length)
+{
+    esp_err_t ret = ESP_FAIL;
+    assert(this);
+
+    switch (this->encoding)
+    {
+        case OTA_IMAGE_ENCODING_RAW:
+            ret = _OtaImageDecoder_WriteOutput(this, pData, length);
+            break;
+        case OTA_IMAGE_ENCODING_DEFLATE:
+        case OTA_IMAGE_ENCODING_DELTA:
+            ret = _OtaImageDecoder_Inflate(this, pData, length);
+            break;
+        default:
+            ret = ESP_ERR_NOT_SUPPORTED;
+            break;
+    }
+    return ret;
+}
+
+esp_err_t OtaImageDecoder_Finish(OtaImageDecoder *this, uint32_t *pImageSize)
+{
+    esp_err_t ret = ESP_OK;
+    assert(this);
+
+    if (this->encoding != OTA_IMAGE_ENCODING_RAW && !this->inflateDone)
+    {
+        ESP_LOGE(TAG, "Compressed stream truncated");
+        ret = ESP_ERR_INVALID_SIZE;
+    }
+    else if (this->encoding == OTA_IMAGE_ENCODING_DELTA && !this->deltaDone)
+    {
+        ESP_LOGE(TAG, "Delta stream missing end record");
+        ret = ESP_ERR_INVALID_SIZE;
+    }
+
+    if (pImageSize)
+    {
+        *pImageSize = this->outputOffset;
+    }
+    return ret;
+}
+
+// Erases whole sectors ahead of the write position
+static esp_err_t _OtaImageDecoder_WriteOutput(OtaImageDecoder *this, const uint8_t *pData, size_t length)
+{
+    esp_err_t ret = ESP_OK;
+    uint32_t writeEnd = this->outputOffset + length;
+
+    if (writeEnd > this->pTarget->size)
+    {
+        ESP_LOGE(TAG, "Decoded image exceeds partition size");
+        ret = ESP_ERR_INVALID_SIZE;
+    }
+    else if (writeEnd > this->erasedEnd)
+    {
+        uint32_t eraseEnd = (writeEnd + SPI_FLASH_SEC_SIZE - 1) & ~(SPI_FLASH_SEC_SIZE - 1);
+        ret = esp_partition_erase_range(this->pTarget, this->erasedEnd, eraseEnd - this->erasedEnd);
+        this->erasedEnd = eraseEnd;
+    }
+
+    if (ret == ESP_OK && length > 0)
+    {
+        ret = esp_partition_write(this->pTarget, this->outputOffset, pData, length);
+    }
+
+    if (ret == ESP_OK)
+    {
+        this->outputOffset = writeEnd;
+    }
+    else
+    {
+        ESP_LOGE(TAG, "Failed to write update partition. error code = %s", esp_err_to_name(ret));
+    }
+    return ret;
+}
+
+static esp_err_t _OtaImageDecoder_Inflate(OtaImageDecoder *this, const uint8_t *pData, size_t length)
+{
+    esp_err_t ret = ESP_OK;
+    size_t consumed = 0;
+
+    while (ret == ESP_OK && !this->inflateDone)
+    {
+        size_t inBytes = length - consumed;
+        size_t outBytes = TINFL_LZ_DICT_SIZE - this->dictionaryOffset;
+        tinfl_status status = tinfl_decompress(this->pInflator,
+                                               pData + consumed, &inBytes,
+                                               this->pDictionary, this->pDictionary + this->dictionaryOffset, &outBytes,
+                                               TINFL_FLAG_PARSE_ZLIB_HEADER | TINFL_FLAG_HAS_MORE_INPUT);
+        consumed += inBytes;
+
+        if (outBytes > 0)
+        {
+            const uint8_t *pOut = this->pDictionary + this->dictionaryOffset;
+            ret = (this->encoding == OTA_IMAGE_ENCODING_DELTA) ? _OtaImageDecoder_ApplyDelta(this, pOut, outBytes)
+                                                               : _OtaImageDecoder_WriteOutput(this, pOut, outBytes);
+            this->dictionaryOffset = (this->dictionaryOffset + outBytes) & (TINFL_LZ_DICT_SIZE - 1);
+        }
+
+        if (status == TINFL_STATUS_DONE)
+        {
+            this->inflateDone = true;
+        }
+        else if (status < TINFL_STATUS_DONE)
+        {
+            ESP_LOGE(TAG, "Inflate failed(%d)", status);
+            ret = ESP_ERR_INVALID_RESPONSE;
+        }
+        else if (status == TINFL_STATUS_NEEDS_MORE_INPUT && consumed >= length)
+        {
+            break;
+        }
+    }
+    return ret;
+}
+
+// Parses delta records from the inflated stream. Records can span chunk boundaries
+static esp_err_t _OtaImageDecoder_ApplyDelta(OtaImageDecoder *this, const uint8_t *pData, size_t length)
+{
+    esp_err_t ret = ESP_OK;
+    size_t consumed = 0;
+
+    while (ret == ESP_OK && consumed < length)
+    {
+        if (this->deltaDone)
+        {
+            ESP_LOGE(TAG, "Data after delta end record");
+            ret = ESP_ERR_INVALID_RESPONSE;
+        }
+        else if (this->insertRemaining > 0)
+        {
+            size_t insertLength = MIN(this->insertRemaining, length - consumed);
+            ret = _OtaImageDecoder_WriteOutput(this, pData + consumed, insertLength);
+            this->insertRemaining -= insertLength;
+            consumed += insertLength;
+        }
+        else
+        {
+            this->recordHeader[this->recordHeaderLength++] = pData[consumed++];
+
+            uint8_t type = this->recordHeader[0];
+            size_t headerLength = (type == OTA_DELTA_RECORD_COPY) ? 9 : (type == OTA_DELTA_RECORD_INSERT) ? 5 : 1;
+            if (this->recordHeaderLength == headerLength)
+            {
+                this->recordHeaderLength = 0;
+                if (type == OTA_DELTA_RECORD_COPY)
+                {
+                    ret = _OtaImageDecoder_CopyFromSource(this, _OtaImageDecoder_ReadU32(&this->recordHeader[1]),
+                                                          _OtaImageDecoder_ReadU32(&this->recordHeader[5]));
+                }
+                else if (type == OTA_DELTA_RECORD_INSERT)
+                {
+                    this->insertRemaining = _OtaImageDecoder_ReadU32(&this->recordHeader[1]);
+                }
+                else if (type == OTA_DELTA_RECORD_END)
+                {
+                    this->deltaDone = true;
+                }
+                else
+                {
+                    ESP_LOGE(TAG, "Unknown delta record(%d)", type);
+                    ret = ESP_ERR_INVALID_RESPONSE;
+                }
+            }
+        }
+    }
+    return ret;
+}
+
+static esp_err_t _OtaImageDecoder_CopyFromSource(OtaImageDecoder *this, uint32_t sourceOffset, uint32_t length)
+{
+    esp_err_t ret = ESP_OK;
+
+    if ((uint64_t)sourceOffset + length > this->pSource->size)
+    {
+        ESP_LOGE(TAG, "Delta copy outside source partition");
+        ret = ESP_ERR_INVALID_SIZE;
+    }
+
+    while (ret == ESP_OK && length > 0)
+    {
+        uint32_t chunkLength = MIN(length, OTA_DECODER_COPY_CHUNK_SIZE);
+        ret = esp_partition_read(this->pSource, sourceOffset, this->pCopyBuffer, chunkLength);
+        if (ret == ESP_OK)
+        {
+            ret = _OtaImageDecoder_WriteOutput(this, this->pCopyBuffer, chunkLength);
+        }
+        sourceOffset += chunkLength;
+        length -= chunkLength;
+    }
+    return ret;
+}
+
+static uint32_t _OtaImageDecoder_ReadU32(const uint8_t *pData)
+{
+    return (uint32_t)pData[0] | ((uint32_t)pData[1] << 8) | ((uint32_t)pData[2] << 16) | ((uint32_t)pData[3] << 24);
+}
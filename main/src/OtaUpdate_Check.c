@@ -0,0 +1,866 @@
+#include <stdlib.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "esp_http_client.h"
+#include "esp_tls.h"
+#include "esp_log.h"
+#include "esp_ota_ops.h"
+#include "esp_https_ota.h"
+#include "esp_crt_bundle.h"
+#include "esp_app_desc.h"
+#include "esp_partition.h"
+#include "esp_system.h"
+#include "spi_flash_mmap.h"
+#include "nvs.h"
+#include "cJSON.h"
+#include "mbedtls/base64.h"
+#include "mbedtls/pk.h"
+#include "mbedtls/sha256.h"
+
+#include "OtaImageDecoder.h"
+#include "OtaUpdate.h"
+#include "OtaUpdate_Check.h"
+#include "TimeUtils.h"
+#include "Utilities.h"
+
+// Internal Function Declarations
+static esp_err_t HttpEventHandler(esp_http_client_event_t *evt);
+static esp_err_t CheckUpdateRequired(OtaUpdate * this, esp_app_desc_t * new_app_info);
+#if CONFIG_OTA_MANIFEST_CHECK
+static esp_err_t FetchManifest(OtaUpdate * this, char * response_buffer, OtaUpdate_Manifest * pManifest);
+static esp_err_t VerifyManifestSignature(const OtaUpdate_Manifest * pManifest, const char * signatureB64);
+#if CONFIG_OTA_ENCODED_IMAGES
+static bool ParseManifestStream(cJSON * root, const char * name, char * url, uint32_t * pSize);
+#endif // CONFIG_OTA_ENCODED_IMAGES
+static bool ManifestUpdateRequired(OtaUpdate * this, const OtaUpdate_Manifest * pManifest);
+#endif // CONFIG_OTA_MANIFEST_CHECK
+static void PerformImageUpdate(OtaUpdate * this, const char * url, char * response_buffer);
+static void ReportProgress(OtaUpdate * this, uint32_t bytesWritten, uint32_t imageSize, bool force);
+#if CONFIG_OTA_RESUMABLE_DOWNLOAD
+static void SelectImageStream(const OtaUpdate_Manifest * pManifest, const char ** pUrl, OtaImageEncoding * pEncoding, uint32_t * pTransferSize);
+static esp_err_t ImageHttpEventHandler(esp_http_client_event_t *evt);
+static void PerformResumableImageUpdate(OtaUpdate * this, const OtaUpdate_Manifest * pManifest);
+static esp_err_t SaveResumeState(const OtaUpdate_ResumeState * pState);
+static esp_err_t ClearResumeState(void);
+#endif // CONFIG_OTA_RESUMABLE_DOWNLOAD
+
+// Internal Constants
+static const char * TAG = "ota_task";
+
+#if defined(TRON_BADGE)
+#define OTA_URL CONFIG_OTA_UPDATE_URL"_TRON"
+#elif defined(REACTOR_BADGE)
+#define OTA_URL CONFIG_OTA_UPDATE_URL"_REACTOR"
+#elif defined(CREST_BADGE)
+#define OTA_URL CONFIG_OTA_UPDATE_URL"_CREST"
+#elif defined(FMAN25_BADGE)
+#define OTA_URL CONFIG_OTA_UPDATE_URL"_FMAN25"
+#endif
+
+#define OTA_MANIFEST_URL OTA_URL".json"     // Served next to the firmware image
+
+#if CONFIG_OTA_MANIFEST_CHECK && !CONFIG_OTA_MANIFEST_ALLOW_UNSIGNED
+// The CMake check stops the firmware build first, this covers anything compiling the file directly
+_Static_assert(sizeof(CONFIG_OTA_MANIFEST_PUBLIC_KEY) > 1, "CONFIG_OTA_MANIFEST_PUBLIC_KEY is empty and unsigned manifests are not allowed");
+#endif
+
+#define OTA_RESUME_NVS_NAMESPACE    "ota_resume"
+#define OTA_RESUME_NVS_KEY          "state"
+#define OTA_RESUME_SAVE_INTERVAL    (64 * 1024)                 // Bytes between NVS offset saves
+#define OTA_DOWNLOAD_CHUNK_SIZE     4096
+#define OTA_RESUME_RETRY_DELAY_MS   5000
+
+// Rate bounded by CONFIG_OTA_PROGRESS_INTERVAL_MS so the download loop never spends time reporting
+static void ReportProgress(OtaUpdate * this, uint32_t bytesWritten, uint32_t imageSize, bool force)
+{
+    if (force || TimeUtils_IsTimeExpired(this->nextProgressTime))
+    {
+        this->nextProgressTime = TimeUtils_GetFutureTimeTicks(CONFIG_OTA_PROGRESS_INTERVAL_MS);
+        ESP_LOGI(TAG, "Firmware image download progress(%lu%%) %lu/%lu",
+                 imageSize ? (uint32_t)((uint64_t)bytesWritten * 100 / imageSize) : 0, bytesWritten, imageSize);
+        if (this->progressCallback)
+        {
+            this->progressCallback(this->pProgressContext, bytesWritten, imageSize);
+        }
+    }
+}
+
+// Checks header information to see if updating should proceed
+static esp_err_t CheckUpdateRequired(OtaUpdate * this, esp_app_desc_t * new_app_info)
+{
+    esp_err_t ret = ESP_FAIL;
+    assert(this);
+
+    if (new_app_info)
+    {
+        const esp_partition_t *running = esp_ota_get_running_partition();
+        esp_app_desc_t running_app_info;
+        if (esp_ota_get_partition_description(running, &running_app_info) == ESP_OK) 
+        {
+            ESP_LOGI(TAG, "current firmware version:");
+            ESP_LOG_BUFFER_HEX_LEVEL(TAG, running_app_info.app_elf_sha256, sizeof(running_app_info.app_elf_sha256), ESP_LOG_INFO);
+            ESP_LOGI(TAG, "new firmware version:");
+            ESP_LOG_BUFFER_HEX_LEVEL(TAG, new_app_info->app_elf_sha256, sizeof(new_app_info->app_elf_sha256), ESP_LOG_INFO);
+            if (memcmp(new_app_info->app_elf_sha256, running_app_info.app_elf_sha256, sizeof(new_app_info->app_elf_sha256)) == 0) 
+            {
+                ESP_LOGI(TAG, "Current version matches update. OTA Skip");
+            }
+            else
+            {
+                // TODO: Do we need to validate this version?
+                ESP_LOGI(TAG, "OTA Update Starting");
+                ret = ESP_OK;
+                NotificationDispatcher_NotifyEvent(this->pNotificationDispatcher, NOTIFICATION_EVENTS_OTA_REQUIRED, NULL, 0, DEFAULT_NOTIFY_WAIT_DURATION);
+            }
+        }
+
+        // TODO: We can implement anti-rollback later if we care, excluding checks for now
+    }
+
+    return ret;
+}
+
+#if CONFIG_OTA_MANIFEST_CHECK
+// Fetches and parses the manifest served next to the image
+// Returns ESP_ERR_INVALID_CRC when a public key is configured and the signature does not verify
+static esp_err_t FetchManifest(OtaUpdate * this, char * response_buffer, OtaUpdate_Manifest * pManifest)
+{
+    esp_err_t ret = ESP_FAIL;
+    assert(this);
+    assert(response_buffer);
+    assert(pManifest);
+
+    memset(pManifest, 0, sizeof(*pManifest));
+    memset(response_buffer, 0, OTA_HTTP_RESPONSE_BUFFER_SIZE + 1);
+
+    ESP_LOGI(TAG, "Making request to %s", OTA_MANIFEST_URL);
+    esp_http_client_config_t http_config = 
+    {
+        .url = OTA_MANIFEST_URL,
+        .timeout_ms = CONFIG_OTA_UPDATE_RECV_TIMEOUT,
+        .crt_bundle_attach = esp_crt_bundle_attach,         // Attach the default certificate bundle
+        .skip_cert_common_name_check = false,
+        .event_handler = HttpEventHandler,
+        .user_data = response_buffer,
+        .disable_auto_redirect = true,
+    };
+
+    esp_http_client_handle_t client = esp_http_client_init(&http_config);
+    if (client != NULL)
+    {
+        esp_err_t err = esp_http_client_perform(client);
+        int status_code = esp_http_client_get_status_code(client);
+        esp_http_client_cleanup(client);
+
+        if (err == ESP_OK && status_code == 200)
+        {
+            this->stats.lastCheckBytes += strlen(response_buffer);
+
+            cJSON *root = cJSON_Parse(response_buffer);
+            if (root != NULL)
+            {
+                cJSON *versionJSON = cJSON_GetObjectItem(root, "version");
+                cJSON *shaJSON = cJSON_GetObjectItem(root, "elf_sha256");
+                cJSON *sizeJSON = cJSON_GetObjectItem(root, "size");
+                cJSON *urlJSON = cJSON_GetObjectItem(root, "url");
+                cJSON *signatureJSON = cJSON_GetObjectItem(root, "signature");
+
+                if (cJSON_IsString(shaJSON) && strlen(shaJSON->valuestring) == OTA_MANIFEST_SHA256_HEX_LENGTH &&
+                    cJSON_IsNumber(sizeJSON) && sizeJSON->valuedouble > 0)
+                {
+                    if (cJSON_IsString(versionJSON))
+                    {
+                        strncpy(pManifest->version, versionJSON->valuestring, sizeof(pManifest->version) - 1);
+                    }
+                    strncpy(pManifest->elfSha256, shaJSON->valuestring, sizeof(pManifest->elfSha256) - 1);
+                    pManifest->size = (uint32_t)sizeJSON->valuedouble;
+                    if (cJSON_IsString(urlJSON) && strncmp(urlJSON->valuestring, "https://", 8) == 0 &&
+                        strlen(urlJSON->valuestring) < sizeof(pManifest->url))
+                    {
+                        strncpy(pManifest->url, urlJSON->valuestring, sizeof(pManifest->url) - 1);
+                    }
+#if CONFIG_OTA_ENCODED_IMAGES
+                    ParseManifestStream(root, "deflate", pManifest->deflateUrl, &pManifest->deflateSize);
+                    if (ParseManifestStream(root, "delta", pManifest->deltaUrl, &pManifest->deltaSize))
+                    {
+                        cJSON *deltaSourceJSON = cJSON_GetObjectItem(root, "delta_source_elf_sha256");
+                        if (cJSON_IsString(deltaSourceJSON) && strlen(deltaSourceJSON->valuestring) == OTA_MANIFEST_SHA256_HEX_LENGTH)
+                        {
+                            strncpy(pManifest->deltaSourceSha256, deltaSourceJSON->valuestring, sizeof(pManifest->deltaSourceSha256) - 1);
+                        }
+                    }
+#endif // CONFIG_OTA_ENCODED_IMAGES
+
+                    // Only a build with CONFIG_OTA_MANIFEST_ALLOW_UNSIGNED gets here without a key
+                    if (sizeof(CONFIG_OTA_MANIFEST_PUBLIC_KEY) <= 1)
+                    {
+                        ret = ESP_OK;
+                    }
+                    else if (cJSON_IsString(signatureJSON) &&
+                             VerifyManifestSignature(pManifest, signatureJSON->valuestring) == ESP_OK)
+                    {
+                        ret = ESP_OK;
+                    }
+                    else
+                    {
+                        ret = ESP_ERR_INVALID_CRC;
+                    }
+                }
+                else
+                {
+                    ESP_LOGE(TAG, "Manifest missing required fields");
+                }
+                cJSON_Delete(root);
+            }
+            else
+            {
+                ESP_LOGE(TAG, "Failed to parse manifest");
+            }
+        }
+        else
+        {
+            ESP_LOGW(TAG, "Manifest request failed. status=%d error=%s", status_code, esp_err_to_name(err));
+        }
+    }
+    else
+    {
+        ESP_LOGE(TAG, "Failed to create manifest http client");
+    }
+
+    return ret;
+}
+
+#if CONFIG_OTA_ENCODED_IMAGES
+// Reads the optional "<name>_url" and "<name>_size" pair for an encoded stream
+static bool ParseManifestStream(cJSON * root, const char * name, char * url, uint32_t * pSize)
+{
+    bool found = false;
+    char key[32];
+    snprintf(key, sizeof(key), "%s_url", name);
+    cJSON *urlJSON = cJSON_GetObjectItem(root, key);
+    snprintf(key, sizeof(key), "%s_size", name);
+    cJSON *sizeJSON = cJSON_GetObjectItem(root, key);
+
+    if (cJSON_IsString(urlJSON) && strncmp(urlJSON->valuestring, "https://", 8) == 0 &&
+        strlen(urlJSON->valuestring) < OTA_MANIFEST_MAX_URL_LENGTH &&
+        cJSON_IsNumber(sizeJSON) && sizeJSON->valuedouble > 0)
+    {
+        strncpy(url, urlJSON->valuestring, OTA_MANIFEST_MAX_URL_LENGTH - 1);
+        *pSize = (uint32_t)sizeJSON->valuedouble;
+        found = true;
+    }
+    return found;
+}
+#endif // CONFIG_OTA_ENCODED_IMAGES
+
+// Signature is over the newline joined fields below, base64 encoded DER
+// version, elf_sha256, size, url, deflate_url, deflate_size, delta_url, delta_size, delta_source_elf_sha256
+static esp_err_t VerifyManifestSignature(const OtaUpdate_Manifest * pManifest, const char * signatureB64)
+{
+    esp_err_t ret = ESP_FAIL;
+    char * message = calloc(1, OTA_MANIFEST_MAX_SIGNED_LENGTH);
+    uint8_t * signature = calloc(1, OTA_MANIFEST_MAX_SIGNATURE_SIZE);
+    uint8_t * public_key = calloc(1, OTA_MANIFEST_MAX_PUBLIC_KEY_SIZE);
+
+    if (message && signature && public_key)
+    {
+        int message_len = snprintf(message, OTA_MANIFEST_MAX_SIGNED_LENGTH, "%s\n%s\n%lu\n%s\n%s\n%lu\n%s\n%lu\n%s",
+                                   pManifest->version, pManifest->elfSha256, pManifest->size, pManifest->url,
+                                   pManifest->deflateUrl, pManifest->deflateSize,
+                                   pManifest->deltaUrl, pManifest->deltaSize, pManifest->deltaSourceSha256);
+        size_t signature_len = 0;
+        size_t public_key_len = 0;
+        uint8_t hash[32];
+        mbedtls_pk_context pk;
+        mbedtls_pk_init(&pk);
+
+        if (message_len > 0 && message_len < OTA_MANIFEST_MAX_SIGNED_LENGTH &&
+            mbedtls_base64_decode(signature, OTA_MANIFEST_MAX_SIGNATURE_SIZE, &signature_len,
+                                  (const uint8_t *)signatureB64, strlen(signatureB64)) == 0 &&
+            mbedtls_sha256((const uint8_t *)message, message_len, hash, 0) == 0 &&
+            mbedtls_base64_decode(public_key, OTA_MANIFEST_MAX_PUBLIC_KEY_SIZE, &public_key_len,
+                                  (const uint8_t *)CONFIG_OTA_MANIFEST_PUBLIC_KEY, sizeof(CONFIG_OTA_MANIFEST_PUBLIC_KEY) - 1) == 0 &&
+            mbedtls_pk_parse_public_key(&pk, public_key, public_key_len) == 0 &&
+            mbedtls_pk_verify(&pk, MBEDTLS_MD_SHA256, hash, sizeof(hash), signature, signature_len) == 0)
+        {
+            ret = ESP_OK;
+        }
+        else
+        {
+            ESP_LOGE(TAG, "Manifest signature verification failed");
+        }
+        mbedtls_pk_free(&pk);
+    }
+    else
+    {
+        ESP_LOGE(TAG, "Failed to allocate signature buffers");
+    }
+
+    free(message);
+    free(signature);
+    free(public_key);
+    return ret;
+}
+
+// Compares the manifest against the running app without touching the image
+static bool ManifestUpdateRequired(OtaUpdate * this, const OtaUpdate_Manifest * pManifest)
+{
+    bool updateRequired = false;
+    assert(this);
+    assert(pManifest);
+
+    char running_sha256[OTA_MANIFEST_SHA256_HEX_LENGTH + 1] = {0};
+    esp_app_get_elf_sha256(running_sha256, sizeof(running_sha256));
+    ESP_LOGI(TAG, "current firmware: %s", running_sha256);
+    ESP_LOGI(TAG, "manifest firmware: %s (%s, %lu bytes)", pManifest->elfSha256, pManifest->version, pManifest->size);
+
+    const esp_partition_t *update_partition = esp_ota_get_next_update_partition(NULL);
+    if (strncasecmp(running_sha256, pManifest->elfSha256, OTA_MANIFEST_SHA256_HEX_LENGTH) == 0)
+    {
+        ESP_LOGI(TAG, "Current version matches manifest. OTA Skip");
+    }
+    else if (update_partition == NULL || pManifest->size > update_partition->size)
+    {
+        ESP_LOGE(TAG, "Manifest image does not fit the update partition. OTA Skip");
+    }
+    else
+    {
+        updateRequired = true;
+    }
+
+    return updateRequired;
+}
+#endif // CONFIG_OTA_MANIFEST_CHECK
+
+// One check over an already connected link: manifest first, then the image only if it differs
+void OtaUpdate_RunCheck(OtaUpdate * this, char * response_buffer)
+{
+    assert(this);
+    assert(response_buffer);
+
+    ++this->stats.checks;
+    this->stats.lastCheckBytes = 0;
+
+#if CONFIG_OTA_MANIFEST_CHECK
+    // Only open the image when the manifest says it differs from the running app
+    esp_err_t manifest_ret = FetchManifest(this, response_buffer, &this->manifest);
+    if (manifest_ret == ESP_OK)
+    {
+        if (ManifestUpdateRequired(this, &this->manifest))
+        {
+#if CONFIG_OTA_RESUMABLE_DOWNLOAD
+            PerformResumableImageUpdate(this, &this->manifest);
+#else
+            PerformImageUpdate(this, (this->manifest.url[0] != '\0') ? this->manifest.url : OTA_URL, response_buffer);
+#endif // CONFIG_OTA_RESUMABLE_DOWNLOAD
+        }
+        else
+        {
+            ++this->stats.downloadsSkipped;
+        }
+    }
+    else if (manifest_ret == ESP_ERR_INVALID_CRC)
+    {
+        // Never fall back on a bad signature, that would defeat the point of signing
+        ESP_LOGE(TAG, "Manifest signature invalid. OTA Skip");
+    }
+    else
+    {
+        // Server without a manifest, fall back to reading the image header
+        ++this->stats.manifestFallbacks;
+        PerformImageUpdate(this, OTA_URL, response_buffer);
+    }
+#else
+    PerformImageUpdate(this, OTA_URL, response_buffer);
+#endif // CONFIG_OTA_MANIFEST_CHECK
+
+    this->stats.totalBytes += this->stats.lastCheckBytes;
+    ESP_LOGI(TAG, "OTA check transferred %lu bytes (total %llu over %lu checks)",
+             this->stats.lastCheckBytes, this->stats.totalBytes, this->stats.checks);
+}
+
+// Opens the image, checks the app descriptor and streams it into the inactive slot if needed
+static void PerformImageUpdate(OtaUpdate * this, const char * url, char * response_buffer)
+{
+    ESP_LOGI(TAG, "Making request to %s", url);
+    esp_http_client_config_t http_config = 
+    {
+        .url = url,
+        .timeout_ms = CONFIG_OTA_UPDATE_RECV_TIMEOUT,
+        .crt_bundle_attach = esp_crt_bundle_attach,         // Attach the default certificate bundle
+        .skip_cert_common_name_check = false,               // Allow any CN with cert
+        .event_handler = HttpEventHandler,
+        .user_data = response_buffer,
+        .disable_auto_redirect = true,
+        .keep_alive_enable = true,
+    };
+
+    // Grab the new OTA image
+    esp_https_ota_config_t ota_config = 
+    {
+        .http_config = &http_config,
+    };
+    esp_https_ota_handle_t https_ota_handle = NULL;
+    if(esp_https_ota_begin(&ota_config, &https_ota_handle) == ESP_OK)
+    {
+        esp_app_desc_t app_desc;
+        if (esp_https_ota_get_img_desc(https_ota_handle, &app_desc) == ESP_OK) 
+        {
+            this->stats.lastCheckBytes += esp_https_ota_get_image_len_read(https_ota_handle);
+            if (CheckUpdateRequired(this, &app_desc) == ESP_OK) 
+            {
+                ESP_LOGI(TAG, "image update required");
+                ESP_LOGI(TAG, "image download starting");
+                NotificationDispatcher_NotifyEvent(this->pNotificationDispatcher, NOTIFICATION_EVENTS_OTA_DOWNLOAD_INITIATED, NULL, 0, DEFAULT_NOTIFY_WAIT_DURATION);
+
+                // Retrieve the ota image
+                esp_err_t ota_status;
+                int ota_image_size = esp_https_ota_get_image_size(https_ota_handle);
+                int header_len = esp_https_ota_get_image_len_read(https_ota_handle);
+                ++this->stats.downloadsStarted;
+                ReportProgress(this, header_len, ota_image_size, true);
+                while((ota_status = esp_https_ota_perform(https_ota_handle)) == ESP_ERR_HTTPS_OTA_IN_PROGRESS)
+                {
+                    ReportProgress(this, esp_https_ota_get_image_len_read(https_ota_handle), ota_image_size, false);
+                }
+                ReportProgress(this, esp_https_ota_get_image_len_read(https_ota_handle), ota_image_size, true);
+                this->stats.lastCheckBytes += esp_https_ota_get_image_len_read(https_ota_handle) - header_len;
+
+                // Check if transfer completed
+                if(esp_https_ota_is_complete_data_received(https_ota_handle))
+                {
+                    ESP_LOGI(TAG, "Firmware image download complete");
+
+                    esp_err_t ota_finish_err = esp_https_ota_finish(https_ota_handle);
+                    if ((ota_status == ESP_OK) && (ota_finish_err == ESP_OK)) 
+                    {
+                        ESP_LOGI(TAG, "Firmware upgrade successful. Rebooting in one");
+                        NotificationDispatcher_NotifyEvent(this->pNotificationDispatcher, NOTIFICATION_EVENTS_OTA_DOWNLOAD_COMPLETE, NULL, 0, DEFAULT_NOTIFY_WAIT_DURATION);
+                        vTaskDelay(pdMS_TO_TICKS(1000));
+                        esp_restart();
+                    }
+                    else
+                    {
+                        if (ota_finish_err == ESP_ERR_OTA_VALIDATE_FAILED) 
+                        {
+                            ESP_LOGE(TAG, "firmware validation failed, image corrupted");
+                        }
+                        ESP_LOGE(TAG, "firmware upgrade failed 0x%x", ota_finish_err);
+                        NotificationDispatcher_NotifyEvent(this->pNotificationDispatcher, NOTIFICATION_EVENTS_OTA_DOWNLOAD_COMPLETE, NULL, 0, DEFAULT_NOTIFY_WAIT_DURATION);
+                    }
+                }
+                else
+                {
+                    ESP_LOGE(TAG, "Failed to retrieve complete firmware image");
+                    NotificationDispatcher_NotifyEvent(this->pNotificationDispatcher, NOTIFICATION_EVENTS_OTA_DOWNLOAD_COMPLETE, NULL, 0, DEFAULT_NOTIFY_WAIT_DURATION);
+                }
+            }
+            else
+            {
+                esp_https_ota_abort(https_ota_handle);
+                ESP_LOGI(TAG, "update not required");
+            }
+        }
+        else
+        {
+            esp_https_ota_abort(https_ota_handle);
+            ESP_LOGE(TAG, "esp_https_ota_get_img_desc failed");
+        }
+    }
+    else
+    {
+        ESP_LOGE(TAG, "esp_https_ota_begin failed");
+    }
+}
+
+#if CONFIG_OTA_RESUMABLE_DOWNLOAD
+// Picks the cheapest stream the manifest offers for this badge: delta from the running image,
+// then the compressed full image, then the raw image
+static void SelectImageStream(const OtaUpdate_Manifest * pManifest, const char ** pUrl, OtaImageEncoding * pEncoding, uint32_t * pTransferSize)
+{
+    *pUrl = (pManifest->url[0] != '\0') ? pManifest->url : OTA_URL;
+    *pEncoding = OTA_IMAGE_ENCODING_RAW;
+    *pTransferSize = pManifest->size;
+
+#if CONFIG_OTA_ENCODED_IMAGES
+    char running_sha256[OTA_MANIFEST_SHA256_HEX_LENGTH + 1] = {0};
+    esp_app_get_elf_sha256(running_sha256, sizeof(running_sha256));
+
+    if (pManifest->deltaUrl[0] != '\0' && pManifest->deltaSize > 0 &&
+        strncasecmp(running_sha256, pManifest->deltaSourceSha256, OTA_MANIFEST_SHA256_HEX_LENGTH) == 0)
+    {
+        *pUrl = pManifest->deltaUrl;
+        *pEncoding = OTA_IMAGE_ENCODING_DELTA;
+        *pTransferSize = pManifest->deltaSize;
+    }
+    else if (pManifest->deflateUrl[0] != '\0' && pManifest->deflateSize > 0)
+    {
+        *pUrl = pManifest->deflateUrl;
+        *pEncoding = OTA_IMAGE_ENCODING_DEFLATE;
+        *pTransferSize = pManifest->deflateSize;
+    }
+#endif // CONFIG_OTA_ENCODED_IMAGES
+}
+
+// Captures the first byte offset of a 206 response so it can be checked against the requested offset
+static esp_err_t ImageHttpEventHandler(esp_http_client_event_t *evt)
+{
+    if (evt->event_id == HTTP_EVENT_ON_HEADER && evt->user_data &&
+        strcasecmp(evt->header_key, "Content-Range") == 0)
+    {
+        int64_t *pRangeStart = (int64_t *)evt->user_data;
+        unsigned long rangeStart = 0;
+        if (sscanf(evt->header_value, "bytes %lu-", &rangeStart) == 1)
+        {
+            *pRangeStart = rangeStart;
+        }
+    }
+    return ESP_OK;
+}
+
+// Streams the image straight into the inactive slot using Range requests. For raw images the
+// offset is persisted in NVS so a dropped link or reboot continues where it left off. Encoded
+// streams can't be resumed without the inflate window, so they restart from zero on a drop
+static void PerformResumableImageUpdate(OtaUpdate * this, const OtaUpdate_Manifest * pManifest)
+{
+    assert(this);
+    assert(pManifest);
+
+    const char * url = NULL;
+    OtaImageEncoding encoding = OTA_IMAGE_ENCODING_RAW;
+    uint32_t transfer_size = 0;
+    SelectImageStream(pManifest, &url, &encoding, &transfer_size);
+
+    const esp_partition_t *partition = esp_ota_get_next_update_partition(NULL);
+    uint8_t *buffer = malloc(OTA_DOWNLOAD_CHUNK_SIZE);
+    if (partition == NULL || buffer == NULL)
+    {
+        ESP_LOGE(TAG, "Failed to prepare resumable download");
+        free(buffer);
+        return;
+    }
+
+    OtaUpdate_ResumeState state;
+    if (encoding == OTA_IMAGE_ENCODING_RAW &&
+        OtaUpdate_LoadResumeState(&state) == ESP_OK &&
+        strncmp(state.elfSha256, pManifest->elfSha256, sizeof(state.elfSha256)) == 0 &&
+        state.imageSize == transfer_size &&
+        state.partitionAddress == partition->address &&
+        state.offset <= state.imageSize)
+    {
+        // The sector at the offset may hold bytes written after the last save, so redo it
+        state.offset = state.offset & ~(SPI_FLASH_SEC_SIZE - 1);
+        ++this->stats.resumes;
+        ESP_LOGI(TAG, "Resuming download at %lu/%lu", state.offset, state.imageSize);
+    }
+    else
+    {
+        // Any saved partial raw image is about to be overwritten
+        ClearResumeState();
+        memset(&state, 0, sizeof(state));
+        strncpy(state.elfSha256, pManifest->elfSha256, sizeof(state.elfSha256) - 1);
+        state.imageSize = transfer_size;
+        state.partitionAddress = partition->address;
+    }
+
+    ESP_LOGI(TAG, "image download starting (encoding %d, %lu bytes for %lu byte image)", encoding, transfer_size, pManifest->size);
+    ++this->stats.downloadsStarted;
+    NotificationDispatcher_NotifyEvent(this->pNotificationDispatcher, NOTIFICATION_EVENTS_OTA_DOWNLOAD_INITIATED, NULL, 0, DEFAULT_NOTIFY_WAIT_DURATION);
+
+    OtaImageDecoder decoder;
+    esp_err_t flash_err = OtaImageDecoder_Init(&decoder, encoding, partition, state.offset);
+    uint32_t savedOffset = state.offset;
+    uint32_t attempts = 0;
+    ReportProgress(this, state.offset, state.imageSize, true);
+
+    while (state.offset < state.imageSize && flash_err == ESP_OK && attempts++ <= CONFIG_OTA_RESUME_MAX_RETRIES)
+    {
+        int64_t rangeStart = -1;
+        esp_http_client_config_t http_config = 
+        {
+            .url = url,
+            .event_handler = ImageHttpEventHandler,
+            .user_data = &rangeStart,
+            .timeout_ms = CONFIG_OTA_UPDATE_RECV_TIMEOUT,
+            .crt_bundle_attach = esp_crt_bundle_attach,         // Attach the default certificate bundle
+            .skip_cert_common_name_check = false,
+            .disable_auto_redirect = true,
+            .keep_alive_enable = true,
+        };
+        esp_http_client_handle_t client = esp_http_client_init(&http_config);
+        if (client == NULL)
+        {
+            ESP_LOGE(TAG, "Failed to create image http client");
+            break;
+        }
+
+        char range[32];
+        snprintf(range, sizeof(range), "bytes=%lu-", state.offset);
+        esp_http_client_set_header(client, "Range", range);
+
+        esp_err_t err = esp_http_client_open(client, 0);
+        if (err == ESP_OK && esp_http_client_fetch_headers(client) >= 0)
+        {
+            int status_code = esp_http_client_get_status_code(client);
+            bool rangeMismatch = false;
+            if (status_code == 200 && state.offset != 0)
+            {
+                // Server ignored the range, take the whole image from the start
+                ESP_LOGW(TAG, "Server does not support range requests, restarting download");
+                state.offset = 0;
+                OtaImageDecoder_Deinit(&decoder);
+                flash_err = OtaImageDecoder_Init(&decoder, encoding, partition, 0);
+            }
+            else if (status_code == 206 && rangeStart != (int64_t)state.offset)
+            {
+                // Writing these bytes would put them at the wrong place in the partition. Drop
+                // the connection and ask for the whole image on the next attempt
+                ESP_LOGW(TAG, "Server returned range from %lld instead of %lu, restarting download", rangeStart, state.offset);
+                rangeMismatch = true;
+                state.offset = 0;
+                OtaImageDecoder_Deinit(&decoder);
+                flash_err = OtaImageDecoder_Init(&decoder, encoding, partition, 0);
+            }
+
+            if (flash_err == ESP_OK && !rangeMismatch && (status_code == 200 || status_code == 206))
+            {
+                while (state.offset < state.imageSize)
+                {
+                    int read_len = esp_http_client_read(client, (char *)buffer, MIN(OTA_DOWNLOAD_CHUNK_SIZE, state.imageSize - state.offset));
+                    if (read_len <= 0)
+                    {
+                        break;
+                    }
+
+                    flash_err = OtaImageDecoder_Write(&decoder, buffer, read_len);
+                    if (flash_err != ESP_OK)
+                    {
+                        break;
+                    }
+
+                    state.offset += read_len;
+                    this->stats.lastCheckBytes += read_len;
+                    if (encoding == OTA_IMAGE_ENCODING_RAW && state.offset - savedOffset >= OTA_RESUME_SAVE_INTERVAL)
+                    {
+                        SaveResumeState(&state);
+                        savedOffset = state.offset;
+                    }
+                    ReportProgress(this, state.offset, state.imageSize, false);
+                }
+            }
+            else if (flash_err == ESP_OK && !rangeMismatch)
+            {
+                ESP_LOGE(TAG, "Image request failed. status=%d", status_code);
+            }
+        }
+        else
+        {
+            ESP_LOGW(TAG, "Failed to open image connection. error code = %s", esp_err_to_name(err));
+        }
+        esp_http_client_close(client);
+        esp_http_client_cleanup(client);
+
+        if (state.offset < state.imageSize && flash_err == ESP_OK)
+        {
+            if (encoding == OTA_IMAGE_ENCODING_RAW)
+            {
+                SaveResumeState(&state);
+                savedOffset = state.offset;
+            }
+            else
+            {
+                state.offset = 0;
+                OtaImageDecoder_Deinit(&decoder);
+                flash_err = OtaImageDecoder_Init(&decoder, encoding, partition, 0);
+            }
+            ESP_LOGW(TAG, "Download interrupted, retrying from %lu/%lu", state.offset, state.imageSize);
+            vTaskDelay(pdMS_TO_TICKS(OTA_RESUME_RETRY_DELAY_MS));
+        }
+    }
+    free(buffer);
+    ReportProgress(this, state.offset, state.imageSize, true);
+
+    uint32_t image_size = 0;
+    if (state.offset >= state.imageSize && flash_err == ESP_OK)
+    {
+        flash_err = OtaImageDecoder_Finish(&decoder, &image_size);
+    }
+    OtaImageDecoder_Deinit(&decoder);
+
+    if (state.offset >= state.imageSize && flash_err == ESP_OK)
+    {
+        ESP_LOGI(TAG, "Firmware image download complete");
+
+        // Setting the boot partition verifies the image checksum and appended SHA256
+        esp_app_desc_t app_desc;
+        char new_sha256[OTA_MANIFEST_SHA256_HEX_LENGTH + 1] = {0};
+        esp_err_t ota_err = esp_ota_get_partition_description(partition, &app_desc);
+        if (ota_err == ESP_OK)
+        {
+            for (int i = 0; i < OTA_MANIFEST_SHA256_HEX_LENGTH / 2; i++)
+            {
+                snprintf(&new_sha256[i * 2], 3, "%02x", app_desc.app_elf_sha256[i]);
+            }
+            ota_err = (strncasecmp(new_sha256, pManifest->elfSha256, OTA_MANIFEST_SHA256_HEX_LENGTH) == 0) ? ESP_OK : ESP_ERR_OTA_VALIDATE_FAILED;
+        }
+        if (ota_err == ESP_OK)
+        {
+            ota_err = esp_ota_set_boot_partition(partition);
+        }
+        ClearResumeState();
+
+        if (ota_err == ESP_OK)
+        {
+            ESP_LOGI(TAG, "Firmware upgrade successful. Rebooting in one");
+            NotificationDispatcher_NotifyEvent(this->pNotificationDispatcher, NOTIFICATION_EVENTS_OTA_DOWNLOAD_COMPLETE, NULL, 0, DEFAULT_NOTIFY_WAIT_DURATION);
+            vTaskDelay(pdMS_TO_TICKS(1000));
+            esp_restart();
+        }
+        else
+        {
+            ESP_LOGE(TAG, "firmware validation failed, image corrupted 0x%x", ota_err);
+            NotificationDispatcher_NotifyEvent(this->pNotificationDispatcher, NOTIFICATION_EVENTS_OTA_DOWNLOAD_COMPLETE, NULL, 0, DEFAULT_NOTIFY_WAIT_DURATION);
+        }
+    }
+    else
+    {
+        if (flash_err != ESP_OK)
+        {
+            ClearResumeState();
+        }
+        ESP_LOGE(TAG, "Failed to retrieve complete firmware image");
+        NotificationDispatcher_NotifyEvent(this->pNotificationDispatcher, NOTIFICATION_EVENTS_OTA_DOWNLOAD_COMPLETE, NULL, 0, DEFAULT_NOTIFY_WAIT_DURATION);
+    }
+}
+
+esp_err_t OtaUpdate_LoadResumeState(OtaUpdate_ResumeState * pState)
+{
+    nvs_handle_t nvsHandle;
+    esp_err_t ret = nvs_open(OTA_RESUME_NVS_NAMESPACE, NVS_READONLY, &nvsHandle);
+    if (ret == ESP_OK)
+    {
+        size_t length = sizeof(*pState);
+        ret = nvs_get_blob(nvsHandle, OTA_RESUME_NVS_KEY, pState, &length);
+        if (ret != ESP_OK || length != sizeof(*pState))
+        {
+            memset(pState, 0, sizeof(*pState));
+            ret = ESP_ERR_NOT_FOUND;
+        }
+        nvs_close(nvsHandle);
+    }
+    return ret;
+}
+
+static esp_err_t SaveResumeState(const OtaUpdate_ResumeState * pState)
+{
+    nvs_handle_t nvsHandle;
+    esp_err_t ret = nvs_open(OTA_RESUME_NVS_NAMESPACE, NVS_READWRITE, &nvsHandle);
+    if (ret == ESP_OK)
+    {
+        ret = nvs_set_blob(nvsHandle, OTA_RESUME_NVS_KEY, pState, sizeof(*pState));
+        if (ret == ESP_OK)
+        {
+            ret = nvs_commit(nvsHandle);
+        }
+        nvs_close(nvsHandle);
+    }
+
+    if (ret != ESP_OK)
+    {
+        ESP_LOGE(TAG, "Failed to save OTA resume state. error code = %s", esp_err_to_name(ret));
+    }
+    return ret;
+}
+
+static esp_err_t ClearResumeState(void)
+{
+    nvs_handle_t nvsHandle;
+    esp_err_t ret = nvs_open(OTA_RESUME_NVS_NAMESPACE, NVS_READWRITE, &nvsHandle);
+    if (ret == ESP_OK)
+    {
+        ret = nvs_erase_key(nvsHandle, OTA_RESUME_NVS_KEY);
+        if (ret == ESP_ERR_NVS_NOT_FOUND)
+        {
+            ret = ESP_OK;
+        }
+        else if (ret == ESP_OK)
+        {
+            ret = nvs_commit(nvsHandle);
+        }
+        nvs_close(nvsHandle);
+    }
+    return ret;
+}
+#endif // CONFIG_OTA_RESUMABLE_DOWNLOAD
+
+static esp_err_t HttpEventHandler(esp_http_client_event_t *evt)
+{
+    static int output_len;
+    switch(evt->event_id) 
+    {
+        case HTTP_EVENT_ERROR:
+            ESP_LOGD(TAG, "HTTP_EVENT_ERROR");
+            break;
+        case HTTP_EVENT_ON_CONNECTED:
+            ESP_LOGD(TAG, "HTTP_EVENT_ON_CONNECTED");
+            break;
+        case HTTP_EVENT_HEADER_SENT:
+            ESP_LOGD(TAG, "HTTP_EVENT_HEADER_SENT");
+            break;
+        case HTTP_EVENT_ON_HEADER:
+            ESP_LOGD(TAG, "HTTP_EVENT_ON_HEADER, key=%s, value=%s", evt->header_key, evt->header_value);
+            break;
+        case HTTP_EVENT_ON_DATA:
+            ESP_LOGD(TAG, "HTTP_EVENT_ON_DATA, len=%d", evt->data_len);
+
+            // Clean the buffer in case of a new request
+            if (output_len == 0 && evt->user_data)
+            {
+                memset(evt->user_data, 0, OTA_HTTP_RESPONSE_BUFFER_SIZE);
+            }
+            /*
+             *  Check for chunked encoding is added as the URL for chunked encoding used in this example returns binary data.
+             *  However, event handler can also be used in case chunked encoding is used.
+             */
+            if (!esp_http_client_is_chunked_response(evt->client)) 
+            {
+                int32_t copy_len = 0;
+                // Copy data from http response
+                if (evt->user_data)
+                {
+                    // The last byte in evt->user_data is kept for the NULL character in case of out-of-bound access.
+                    copy_len = MIN(evt->data_len, (OTA_HTTP_RESPONSE_BUFFER_SIZE - output_len));
+                    if (copy_len)
+                    {
+                        memcpy(evt->user_data + output_len, evt->data, copy_len);
+                    }
+                }
+                output_len += copy_len;
+            }
+            break;
+        case HTTP_EVENT_ON_FINISH:
+            ESP_LOGD(TAG, "HTTP_EVENT_ON_FINISH: %d", output_len);
+            output_len = 0;
+            break;
+        case HTTP_EVENT_DISCONNECTED:
+            ESP_LOGD(TAG, "HTTP_EVENT_DISCONNECTED");
+            int mbedtls_err = 0;
+            esp_err_t err = esp_tls_get_and_clear_last_error((esp_tls_error_handle_t)evt->data, &mbedtls_err, NULL);
+            if (err != 0) 
+            {
+                ESP_LOGI(TAG, "Last esp error code: 0x%x", err);
+                ESP_LOGI(TAG, "Last mbedtls failure: 0x%x", mbedtls_err);
+            }
+            output_len = 0;
+            break;
+        case HTTP_EVENT_REDIRECT:
+            ESP_LOGD(TAG, "HTTP_EVENT_REDIRECT");
+            // Not going to follow redirect for now
+            // esp_http_client_set_header(evt->client, "Accept", "text/html");
+            //esp_http_client_set_redirection(evt->client);
+            break;
+    }
+    return ESP_OK;
+}
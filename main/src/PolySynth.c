@@ -0,0 +1,142 @@
+#include <string.h>
+
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#include "PolySynth.h"
+#include "TaskPriorities.h"
+#include "Utilities.h"
+
+#if CONFIG_SYNTH_POLYPHONIC
+
+// Internal Function Declarations
+static void PolySynthRenderTask(void *pvParameters);
+
+// Internal Constants
+static const char * TAG = "PSYN";
+
+esp_err_t PolySynth_Init(PolySynth *this, gpio_num_t gpio)
+{
+    esp_err_t ret = ESP_OK;
+    assert(this);
+    memset(this, 0, sizeof(*this));
+    portMUX_INITIALIZE(&this->statsLock);
+    PolySynthMixer_Init(&this->mixer);
+    this->stats.budgetUs = (uint32_t)((1000000ULL * POLY_SYNTH_BUFFER_SAMPLES) / POLY_SYNTH_SAMPLE_RATE);
+
+    i2s_chan_config_t chanConfig = I2S_CHANNEL_DEFAULT_CONFIG(I2S_NUM_0, I2S_ROLE_MASTER);
+    chanConfig.dma_desc_num = POLY_SYNTH_DMA_BUFFERS;
+    chanConfig.dma_frame_num = POLY_SYNTH_BUFFER_SAMPLES;
+    ret = i2s_new_channel(&chanConfig, &this->txChannel, NULL);
+
+    if (ret == ESP_OK)
+    {
+        i2s_pdm_tx_config_t pdmConfig =
+        {
+            .clk_cfg = I2S_PDM_TX_CLK_DEFAULT_CONFIG(POLY_SYNTH_SAMPLE_RATE),
+            .slot_cfg = I2S_PDM_TX_SLOT_DEFAULT_CONFIG(I2S_DATA_BIT_WIDTH_16BIT, I2S_SLOT_MODE_MONO),
+            .gpio_cfg =
+            {
+                .clk = I2S_GPIO_UNUSED,
+                .dout = gpio,
+                .invert_flags = { .clk_inv = false },
+            },
+        };
+        ret = i2s_channel_init_pdm_tx_mode(this->txChannel, &pdmConfig);
+    }
+
+    if (ret == ESP_OK)
+    {
+        assert(xTaskCreatePinnedToCore(PolySynthRenderTask, "PolySynthRender", configMINIMAL_STACK_SIZE * 2, this, SYNTH_RENDER_TASK_PRIORITY, &this->renderTaskHandle, SYNTH_RENDER_TASK_CORE) == pdPASS);
+        ESP_LOGI(TAG, "%d voices at %d Hz, %lu us per buffer", POLY_SYNTH_MAX_VOICES, POLY_SYNTH_SAMPLE_RATE, this->stats.budgetUs);
+    }
+    else
+    {
+        ESP_LOGE(TAG, "Failed to init PDM output. error code = %s", esp_err_to_name(ret));
+    }
+    return ret;
+}
+
+esp_err_t PolySynth_NoteOn(PolySynth *this, int voice, uint32_t frequencyHz, PolySynthWaveform waveform)
+{
+    assert(this);
+    esp_err_t ret = PolySynthMixer_NoteOn(&this->mixer, voice, frequencyHz, waveform);
+    if (ret == ESP_OK)
+    {
+        xTaskNotifyGive(this->renderTaskHandle);
+    }
+    return ret;
+}
+
+esp_err_t PolySynth_NoteOff(PolySynth *this, int voice)
+{
+    assert(this);
+    return PolySynthMixer_NoteOff(&this->mixer, voice);
+}
+
+void PolySynth_AllNotesOff(PolySynth *this)
+{
+    for (int i = 0; i < POLY_SYNTH_MAX_VOICES; i++)
+    {
+        PolySynth_NoteOff(this, i);
+    }
+}
+
+void PolySynth_GetStats(PolySynth *this, PolySynthStats *pStats)
+{
+    assert(this);
+    assert(pStats);
+    taskENTER_CRITICAL(&this->statsLock);
+    *pStats = this->stats;
+    taskEXIT_CRITICAL(&this->statsLock);
+}
+
+// Keeps the DMA ring fed while any voice sounds, then parks the channel until the next note
+static void PolySynthRenderTask(void *pvParameters)
+{
+    PolySynth *this = (PolySynth *)pvParameters;
+    assert(this);
+    bool channelEnabled = false;
+
+    while (true)
+    {
+        int64_t startUs = esp_timer_get_time();
+        bool active = PolySynthMixer_Render(&this->mixer, this->buffer);
+        uint32_t renderUs = (uint32_t)(esp_timer_get_time() - startUs);
+
+        taskENTER_CRITICAL(&this->statsLock);
+        this->stats.renderedBuffers++;
+        this->stats.lastRenderUs = renderUs;
+        this->stats.maxRenderUs = MAX(this->stats.maxRenderUs, renderUs);
+        if (renderUs > this->stats.budgetUs)
+        {
+            this->stats.overBudgetCount++;
+        }
+        taskEXIT_CRITICAL(&this->statsLock);
+
+        if (active && !channelEnabled)
+        {
+            ESP_ERROR_CHECK(i2s_channel_enable(this->txChannel));
+            channelEnabled = true;
+        }
+
+        if (channelEnabled)
+        {
+            // Blocks until a DMA buffer frees up, which paces the loop at the sample rate
+            size_t bytesWritten = 0;
+            i2s_channel_write(this->txChannel, this->buffer, sizeof(this->buffer), &bytesWritten, portMAX_DELAY);
+        }
+
+        if (!active)
+        {
+            if (channelEnabled)
+            {
+                ESP_ERROR_CHECK(i2s_channel_disable(this->txChannel));
+                channelEnabled = false;
+            }
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        }
+    }
+}
+
+#endif // CONFIG_SYNTH_POLYPHONIC
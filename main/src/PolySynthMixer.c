@@ -0,0 +1,128 @@
+#include <assert.h>
+#include <math.h>
+#include <string.h>
+
+#include "PolySynthMixer.h"
+
+#if CONFIG_SYNTH_POLYPHONIC
+
+// Envelope steps per sample, Q15. About 5ms attack and 20ms release at 16kHz
+#define POLY_SYNTH_LEVEL_MAX        (32767)
+#define POLY_SYNTH_ATTACK_STEP      (POLY_SYNTH_LEVEL_MAX / (POLY_SYNTH_SAMPLE_RATE / 200))
+#define POLY_SYNTH_RELEASE_STEP     (POLY_SYNTH_LEVEL_MAX / (POLY_SYNTH_SAMPLE_RATE / 50))
+// Each voice gets an equal share of full scale so the mix can't clip
+#define POLY_SYNTH_VOICE_AMPLITUDE  (POLY_SYNTH_LEVEL_MAX / POLY_SYNTH_MAX_VOICES)
+
+// Internal Constants
+static int16_t sineTable[POLY_SYNTH_WAVETABLE_SIZE];
+
+void PolySynthMixer_Init(PolySynthMixer *this)
+{
+    assert(this);
+    memset(this, 0, sizeof(*this));
+    portMUX_INITIALIZE(&this->voiceLock);
+
+    for (int i = 0; i < POLY_SYNTH_WAVETABLE_SIZE; i++)
+    {
+        sineTable[i] = (int16_t)(POLY_SYNTH_LEVEL_MAX * sinf(2.0f * (float)M_PI * i / POLY_SYNTH_WAVETABLE_SIZE));
+    }
+}
+
+esp_err_t PolySynthMixer_NoteOn(PolySynthMixer *this, int voice, uint32_t frequencyHz, PolySynthWaveform waveform)
+{
+    assert(this);
+    if (voice < 0 || voice >= POLY_SYNTH_MAX_VOICES || frequencyHz == 0 || frequencyHz >= POLY_SYNTH_SAMPLE_RATE / 2)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    uint32_t phaseIncrement = (uint32_t)(((uint64_t)frequencyHz << 32) / POLY_SYNTH_SAMPLE_RATE);
+    taskENTER_CRITICAL(&this->voiceLock);
+    PolySynthVoice *pVoice = &this->voices[voice];
+    pVoice->phaseIncrement = phaseIncrement;
+    pVoice->waveform = waveform;
+    pVoice->gate = true;
+    pVoice->triggerCount++;
+    taskEXIT_CRITICAL(&this->voiceLock);
+    return ESP_OK;
+}
+
+esp_err_t PolySynthMixer_NoteOff(PolySynthMixer *this, int voice)
+{
+    assert(this);
+    if (voice < 0 || voice >= POLY_SYNTH_MAX_VOICES)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    taskENTER_CRITICAL(&this->voiceLock);
+    this->voices[voice].gate = false;
+    taskEXIT_CRITICAL(&this->voiceLock);
+    return ESP_OK;
+}
+
+bool PolySynthMixer_Render(PolySynthMixer *this, int16_t *pBuffer)
+{
+    assert(this);
+    assert(pBuffer);
+    PolySynthVoice controls[POLY_SYNTH_MAX_VOICES];
+    taskENTER_CRITICAL(&this->voiceLock);
+    memcpy(controls, this->voices, sizeof(controls));
+    taskEXIT_CRITICAL(&this->voiceLock);
+
+    bool active = false;
+    memset(pBuffer, 0, POLY_SYNTH_BUFFER_SAMPLES * sizeof(int16_t));
+    for (int v = 0; v < POLY_SYNTH_MAX_VOICES; v++)
+    {
+        PolySynthVoice *pVoice = &this->voices[v];
+        if (controls[v].triggerCount != pVoice->renderedTriggerCount)
+        {
+            pVoice->renderedTriggerCount = controls[v].triggerCount;
+            pVoice->stage = POLY_SYNTH_ENVELOPE_ATTACK;
+        }
+        if (!controls[v].gate && pVoice->stage != POLY_SYNTH_ENVELOPE_IDLE)
+        {
+            pVoice->stage = POLY_SYNTH_ENVELOPE_RELEASE;
+        }
+        if (pVoice->stage == POLY_SYNTH_ENVELOPE_IDLE)
+        {
+            continue;
+        }
+
+        uint32_t phase = pVoice->phase;
+        int32_t level = pVoice->level;
+        for (int i = 0; i < POLY_SYNTH_BUFFER_SAMPLES; i++)
+        {
+            if (pVoice->stage == POLY_SYNTH_ENVELOPE_ATTACK)
+            {
+                level += POLY_SYNTH_ATTACK_STEP;
+                if (level >= POLY_SYNTH_LEVEL_MAX)
+                {
+                    level = POLY_SYNTH_LEVEL_MAX;
+                    pVoice->stage = POLY_SYNTH_ENVELOPE_SUSTAIN;
+                }
+            }
+            else if (pVoice->stage == POLY_SYNTH_ENVELOPE_RELEASE)
+            {
+                level -= POLY_SYNTH_RELEASE_STEP;
+                if (level <= 0)
+                {
+                    level = 0;
+                    pVoice->stage = POLY_SYNTH_ENVELOPE_IDLE;
+                    break;
+                }
+            }
+
+            int32_t sample = (controls[v].waveform == POLY_SYNTH_WAVEFORM_SINE) ? sineTable[phase >> 24]
+                           : (phase & 0x80000000) ? -POLY_SYNTH_LEVEL_MAX : POLY_SYNTH_LEVEL_MAX;
+            phase += controls[v].phaseIncrement;
+            pBuffer[i] += (int16_t)((((sample * level) >> 15) * POLY_SYNTH_VOICE_AMPLITUDE) >> 15);
+        }
+        pVoice->phase = phase;
+        pVoice->level = level;
+        active = true;
+    }
+    return active;
+}
+
+#endif // CONFIG_SYNTH_POLYPHONIC
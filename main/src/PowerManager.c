@@ -0,0 +1,191 @@
+#include <string.h>
+
+#include "driver/uart.h"
+#include "esp_log.h"
+#include "esp_pm.h"
+#include "esp_sleep.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+
+#include "PowerManager.h"
+
+// Internal Constants
+static const char * const LOCK_NAMES[POWER_LOCK_COUNT] =
+{
+    [POWER_LOCK_LED_ANIMATION] = "led_animation",
+    [POWER_LOCK_SYNTH]         = "synth",
+    [POWER_LOCK_WIFI]          = "wifi",
+    [POWER_LOCK_BLE_TRANSFER]  = "ble_transfer",
+};
+
+const char *PowerManager_GetLockName(PowerLock lock)
+{
+    return (lock < POWER_LOCK_COUNT) ? LOCK_NAMES[lock] : "unknown";
+}
+
+#if CONFIG_POWER_MANAGEMENT
+
+// RX edges needed to wake the console UART. The characters that wake it are lost
+#define POWER_UART_WAKEUP_THRESHOLD (3)
+
+// Internal Variables
+static esp_pm_lock_handle_t pmLocks[POWER_LOCK_COUNT];
+static PowerLockStats lockStats[POWER_LOCK_COUNT];
+static int64_t lockStartUs[POWER_LOCK_COUNT];
+static uint32_t activeLocks;
+static int64_t performanceStartUs;
+static uint64_t performanceUs;
+static int64_t statsStartUs;
+static portMUX_TYPE statsLock = portMUX_INITIALIZER_UNLOCKED;
+
+// Internal Constants
+static const char * TAG = "PWR";
+
+esp_err_t PowerManager_Init(void)
+{
+    esp_pm_config_t pmConfig =
+    {
+        .max_freq_mhz = CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ,
+        .min_freq_mhz = CONFIG_POWER_MIN_CPU_FREQ_MHZ,
+#if CONFIG_POWER_LIGHT_SLEEP
+        .light_sleep_enable = true,
+#endif
+    };
+    esp_err_t ret = esp_pm_configure(&pmConfig);
+    for (int i = 0; i < POWER_LOCK_COUNT && ret == ESP_OK; i++)
+    {
+        ret = esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, LOCK_NAMES[i], &pmLocks[i]);
+    }
+
+#if CONFIG_POWER_LIGHT_SLEEP
+    // Touches and console input still have to get through while the badge sleeps
+    if (ret == ESP_OK)
+    {
+        ret = esp_sleep_enable_touchpad_wakeup();
+    }
+    if (ret == ESP_OK)
+    {
+        ret = uart_set_wakeup_threshold(CONFIG_ESP_CONSOLE_UART_NUM, POWER_UART_WAKEUP_THRESHOLD);
+    }
+    if (ret == ESP_OK)
+    {
+        ret = esp_sleep_enable_uart_wakeup(CONFIG_ESP_CONSOLE_UART_NUM);
+    }
+#endif
+
+    if (ret == ESP_OK)
+    {
+        statsStartUs = esp_timer_get_time();
+        ESP_LOGI(TAG, "CPU %d-%d MHz, light sleep %s", CONFIG_POWER_MIN_CPU_FREQ_MHZ, CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ,
+                 pmConfig.light_sleep_enable ? "on" : "off");
+    }
+    else
+    {
+        ESP_LOGE(TAG, "Failed to configure power management. error code = %s", esp_err_to_name(ret));
+    }
+    return ret;
+}
+
+// Locks are counted, so nested holds from the same subsystem are fine
+void PowerManager_Acquire(PowerLock lock)
+{
+    assert(lock < POWER_LOCK_COUNT);
+    if (pmLocks[lock] == NULL)
+    {
+        return;
+    }
+
+    int64_t nowUs = esp_timer_get_time();
+    taskENTER_CRITICAL(&statsLock);
+    PowerLockStats *pStats = &lockStats[lock];
+    if (pStats->holdCount++ == 0)
+    {
+        ++pStats->acquireCount;
+        lockStartUs[lock] = nowUs;
+        if (activeLocks++ == 0)
+        {
+            performanceStartUs = nowUs;
+        }
+    }
+    taskEXIT_CRITICAL(&statsLock);
+
+    esp_pm_lock_acquire(pmLocks[lock]);
+}
+
+void PowerManager_Release(PowerLock lock)
+{
+    assert(lock < POWER_LOCK_COUNT);
+    if (pmLocks[lock] == NULL)
+    {
+        return;
+    }
+
+    int64_t nowUs = esp_timer_get_time();
+    bool held = true;
+    taskENTER_CRITICAL(&statsLock);
+    PowerLockStats *pStats = &lockStats[lock];
+    if (pStats->holdCount == 0)
+    {
+        held = false;
+    }
+    else if (--pStats->holdCount == 0)
+    {
+        pStats->heldUs += nowUs - lockStartUs[lock];
+        if (--activeLocks == 0)
+        {
+            performanceUs += nowUs - performanceStartUs;
+        }
+    }
+    taskEXIT_CRITICAL(&statsLock);
+
+    if (held)
+    {
+        esp_pm_lock_release(pmLocks[lock]);
+    }
+    else
+    {
+        ESP_LOGE(TAG, "Released %s without holding it", LOCK_NAMES[lock]);
+    }
+}
+
+void PowerManager_GetStats(PowerStats *pStats)
+{
+    assert(pStats);
+    int64_t nowUs = esp_timer_get_time();
+    taskENTER_CRITICAL(&statsLock);
+    pStats->elapsedUs = nowUs - statsStartUs;
+    pStats->performanceUs = performanceUs + ((activeLocks > 0) ? nowUs - performanceStartUs : 0);
+    for (int i = 0; i < POWER_LOCK_COUNT; i++)
+    {
+        pStats->locks[i] = lockStats[i];
+        if (lockStats[i].holdCount > 0)
+        {
+            pStats->locks[i].heldUs += nowUs - lockStartUs[i];
+        }
+    }
+    taskEXIT_CRITICAL(&statsLock);
+}
+
+// Held locks restart their timers from now so the next report only covers the new window
+void PowerManager_ResetStats(void)
+{
+    int64_t nowUs = esp_timer_get_time();
+    taskENTER_CRITICAL(&statsLock);
+    statsStartUs = nowUs;
+    performanceUs = 0;
+    performanceStartUs = nowUs;
+    for (int i = 0; i < POWER_LOCK_COUNT; i++)
+    {
+        lockStats[i].acquireCount = 0;
+        lockStats[i].heldUs = 0;
+        lockStartUs[i] = nowUs;
+    }
+    taskEXIT_CRITICAL(&statsLock);
+}
+
+void PowerManager_DumpLocks(FILE *pStream)
+{
+    esp_pm_dump_locks(pStream);
+}
+
+#endif // CONFIG_POWER_MANAGEMENT
@@ -0,0 +1,123 @@
+#include <assert.h>
+#include <string.h>
+
+#include "esp_log.h"
+#include "mbedtls/base64.h"
+
+#include "SiblingCache.h"
+
+// Internal Function Declarations
+static SiblingCacheEntry * _SiblingCache_Find(SiblingCache *this, const uint8_t *pBadgeId);
+
+// Internal Constants
+#define MUTEX_WAIT_TIME_MS          10000
+
+static const char * TAG = "SIB";
+
+esp_err_t SiblingCache_Init(SiblingCache *this)
+{
+    assert(this);
+    memset(this->entries, 0, sizeof(this->entries));
+    this->generation = 0;
+    return RWLock_Create(&this->lock);
+}
+
+bool SiblingCache_DecodeId(const char *badgeIdB64, uint8_t *pBadgeId)
+{
+    size_t outlen = 0;
+    size_t inlen = strnlen(badgeIdB64, BADGE_ID_B64_SIZE);
+    return inlen < BADGE_ID_B64_SIZE
+        && mbedtls_base64_decode(pBadgeId, BADGE_ID_SIZE, &outlen, (const uint8_t *)badgeIdB64, inlen) == 0
+        && outlen == BADGE_ID_SIZE;
+}
+
+static SiblingCacheEntry * _SiblingCache_Find(SiblingCache *this, const uint8_t *pBadgeId)
+{
+    for (int i = 0; i < SIBLING_CACHE_CAPACITY; i++)
+    {
+        SiblingCacheEntry *pEntry = &this->entries[i];
+        if (pEntry->inUse && memcmp(pEntry->badgeId, pBadgeId, BADGE_ID_SIZE) == 0)
+        {
+            return pEntry;
+        }
+    }
+    return NULL;
+}
+
+// The latest response is the whole sibling list, so anything it doesn't confirm is evicted.
+// Eviction runs before inserts so a full cache always has room for the new list
+void SiblingCache_Update(SiblingCache *this, uint8_t badgeIds[][BADGE_ID_SIZE], int count)
+{
+    assert(this);
+    if (RWLock_WriteLock(&this->lock, pdMS_TO_TICKS(MUTEX_WAIT_TIME_MS)) != ESP_OK)
+    {
+        ESP_LOGE(TAG, "Failed to lock sibling cache, keeping previous siblings");
+        return;
+    }
+
+    uint32_t generation = ++this->generation;
+    for (int i = 0; i < count; i++)
+    {
+        SiblingCacheEntry *pEntry = _SiblingCache_Find(this, badgeIds[i]);
+        if (pEntry != NULL)
+        {
+            pEntry->generation = generation;
+        }
+    }
+
+    for (int slot = 0; slot < SIBLING_CACHE_CAPACITY; slot++)
+    {
+        SiblingCacheEntry *pEntry = &this->entries[slot];
+        if (pEntry->inUse && pEntry->generation != generation)
+        {
+            ESP_LOGI(TAG, "Sibling in slot %d no longer listed, evicting", slot);
+            pEntry->inUse = false;
+        }
+    }
+
+    int freeSlot = 0;
+    for (int i = 0; i < count; i++)
+    {
+        if (_SiblingCache_Find(this, badgeIds[i]) != NULL)
+        {
+            continue;
+        }
+        while (freeSlot < SIBLING_CACHE_CAPACITY && this->entries[freeSlot].inUse)
+        {
+            freeSlot++;
+        }
+        if (freeSlot == SIBLING_CACHE_CAPACITY)
+        {
+            ESP_LOGE(TAG, "Sibling cache full, dropping %d siblings", count - i);
+            break;
+        }
+        SiblingCacheEntry *pEntry = &this->entries[freeSlot];
+        memcpy(pEntry->badgeId, badgeIds[i], BADGE_ID_SIZE);
+        pEntry->generation = generation;
+        atomic_store(&pEntry->seen, false);
+        pEntry->inUse = true;
+        ESP_LOGI(TAG, "Sibling %d added to cache slot %d", i, freeSlot);
+    }
+    RWLock_WriteUnlock(&this->lock);
+}
+
+// Returns true if the badge is a sibling that was already seen. Non-siblings are never seen
+bool SiblingCache_MarkSeen(SiblingCache *this, const char *badgeIdB64)
+{
+    assert(this);
+    uint8_t badgeId[BADGE_ID_SIZE];
+    if (!SiblingCache_DecodeId(badgeIdB64, badgeId)
+        || RWLock_ReadLock(&this->lock, pdMS_TO_TICKS(MUTEX_WAIT_TIME_MS)) != ESP_OK)
+    {
+        return false;
+    }
+
+    bool wasSeen = false;
+    SiblingCacheEntry *pEntry = _SiblingCache_Find(this, badgeId);
+    if (pEntry != NULL)
+    {
+        wasSeen = atomic_exchange(&pEntry->seen, true);
+    }
+    RWLock_ReadUnlock(&this->lock);
+    return wasSeen;
+}
@@ -0,0 +1,116 @@
+#include <assert.h>
+#include <string.h>
+
+#include "esp_log.h"
+
+#include "SongSequencer.h"
+#include "Utilities.h"
+
+#define SONG_NOTE_PAUSE_MS    (50)
+
+static const char * TAG = "SEQ";
+
+// Internal Function Declarations
+static void SongSequencer_TimerHandler(void *arg);
+static void SongSequencer_Schedule(SongSequencer *this, int64_t delayUs);
+
+esp_err_t SongSequencer_Init(SongSequencer *this, SongSequencerToneFunction toneFunction, SongSequencerDoneFunction doneFunction, void *pContext)
+{
+    assert(this);
+    assert(toneFunction);
+    assert(doneFunction);
+    memset(this, 0, sizeof(SongSequencer));
+    SongCursor_Init(&this->songCursor, NULL);
+    this->toneFunction = toneFunction;
+    this->doneFunction = doneFunction;
+    this->pContext = pContext;
+
+    const esp_timer_create_args_t timerArgs =
+    {
+        .callback = &SongSequencer_TimerHandler,
+        .arg = (void*)this,
+        .dispatch_method = ESP_TIMER_TASK,
+        .name = "song-sequencer",
+    };
+    esp_err_t ret = esp_timer_create(&timerArgs, &this->timer);
+    if (ret != ESP_OK)
+    {
+        ESP_LOGE(TAG, "Failed to create sequencer timer. error code = %s", esp_err_to_name(ret));
+    }
+    return ret;
+}
+
+// Restarts from the first note, cutting off whatever was playing
+esp_err_t SongSequencer_Start(SongSequencer *this, const SongNotes *pSong)
+{
+    assert(this);
+    esp_timer_stop(this->timer);
+    SongCursor_Init(&this->songCursor, pSong);
+    this->releasePending = false;
+    this->maxLatenessUs = 0;
+    this->nextDeadlineUs = esp_timer_get_time();
+    SongSequencer_Schedule(this, 0);
+    return ESP_OK;
+}
+
+void SongSequencer_Stop(SongSequencer *this)
+{
+    assert(this);
+    esp_timer_stop(this->timer);
+    SongCursor_Init(&this->songCursor, NULL);
+    this->releasePending = false;
+}
+
+// Runs in the esp_timer task. Each step either releases a note for its pause or starts the next one
+static void SongSequencer_TimerHandler(void *arg)
+{
+    SongSequencer *this = (SongSequencer *)arg;
+    assert(this);
+
+    int64_t latenessUs = esp_timer_get_time() - this->nextDeadlineUs;
+    this->maxLatenessUs = MAX(this->maxLatenessUs, latenessUs);
+
+    if (this->releasePending)
+    {
+        this->releasePending = false;
+        this->toneFunction(this->pContext, NOTE_REST);
+        SongSequencer_Schedule(this, SONG_NOTE_PAUSE_MS * 1000);
+        return;
+    }
+
+    Note note;
+    int noteIdx = this->songCursor.noteIdx;
+    if (SongCursor_Next(&this->songCursor, &note))
+    {
+        int holdTimeMs = note.durationMs;
+        if (note.slur == 0)
+        {
+            holdTimeMs -= SONG_NOTE_PAUSE_MS;
+            this->releasePending = true;
+        }
+        ESP_LOGD(TAG, "Note Idx %d - Note: %d  Type: %d  HoldTime: %d  Freq: %d",
+            noteIdx,
+            note.note,
+            note.duration,
+            holdTimeMs,
+            GetNoteFrequency(note.note));
+        this->toneFunction(this->pContext, note.note);
+        SongSequencer_Schedule(this, holdTimeMs * 1000);
+    }
+    else
+    {
+        this->doneFunction(this->pContext);
+    }
+}
+
+// Deadlines advance from the previous deadline, not from now, so late callbacks don't accumulate drift
+static void SongSequencer_Schedule(SongSequencer *this, int64_t delayUs)
+{
+    this->nextDeadlineUs += delayUs;
+    int64_t timeoutUs = MAX(this->nextDeadlineUs - esp_timer_get_time(), 0);
+    esp_err_t ret = esp_timer_start_once(this->timer, timeoutUs);
+    if (ret != ESP_OK)
+    {
+        ESP_LOGE(TAG, "Failed to start sequencer timer. error code = %s", esp_err_to_name(ret));
+    }
+}
@@ -1,4 +1,5 @@
 
+#include <assert.h>
 #include <stdio.h>
 #include "esp_log.h"
 #include "Song.h"
@@ -8,6 +9,29 @@
 
 static const char * TAG = "SONG";
 
+_Static_assert(NOTE_B6 < SONG_EVENT_TIMED_FLAG, "Packed song events can't address every note");
+_Static_assert(NUM_NOTE_DURATIONS <= SONG_EVENT_DURATION_MASK + 1, "Duration codes don't fit in a packed song event");
+
+// Whole note fractions as {numerator, denominator}
+static const uint8_t noteDurationFractions[NUM_NOTE_DURATIONS][2] =
+{
+    [NOTE_DURATION_WHOLE]                  = {1, 1},
+    [NOTE_DURATION_HALF]                   = {1, 2},
+    [NOTE_DURATION_QUARTER]                = {1, 4},
+    [NOTE_DURATION_EIGHTH]                 = {1, 8},
+    [NOTE_DURATION_SIXTEENTH]              = {1, 16},
+    [NOTE_DURATION_THIRTY_SECOND]          = {1, 32},
+    [NOTE_DURATION_SIXTY_FOURTH]           = {1, 64},
+    [NOTE_DURATION_HALF_DOT]               = {3, 4},
+    [NOTE_DURATION_HALF_DOT_DOT]           = {7, 8},
+    [NOTE_DURATION_QUARTER_DOT]            = {3, 8},
+    [NOTE_DURATION_QUARTER_DOT_DOT]        = {7, 16},
+    [NOTE_DURATION_EIGHTH_DOT]             = {3, 16},
+    [NOTE_DURATION_QUARTER_TRIPLET]        = {1, 12},
+    [NOTE_DURATION_QUARTER_TRIPLET_DOUBLE] = {1, 6},
+    [NOTE_DURATION_QUARTER_NINELET]        = {1, 36},
+};
+
 extern const SongNotes SecretSound;
 extern const SongNotes SuccessSound;
 extern const SongNotes ChestSound;
@@ -59,23 +83,28 @@ static const SongNotes *pSongs[NUM_SONGS] =
 
 // Function to calculate the duration of a note in milliseconds
 // 'tempo' is the tempo in beats per minute
-// 'noteType' is the type of the note as a fraction of a whole note
-// For example, 1 for a whole note, 1/2 for a half note, 1/4 for a quarter note, etc.
-int GetNoteTypeInMilliseconds(int tempo, float noteType)
+// 'duration' is the note length code, a fraction of a whole note (four beats)
+// Integer math only, the result is floored and clamped to the filter period
+int GetNoteDurationInMilliseconds(int tempo, NoteDuration duration)
 {
-    if (tempo <= 0 || noteType <= 0.0)
+    if (tempo <= 0 || duration < 0 || duration >= NUM_NOTE_DURATIONS)
     {
-        ESP_LOGI(TAG, "Error: Tempo and note type must be positive integers.\n");
+        ESP_LOGI(TAG, "Error: Invalid tempo %d or duration %d", tempo, duration);
         return -1;  // Error case
     }
 
-    // Calculate the duration of one beat in milliseconds
-    double beatDuration = 60000.0 / tempo;
-
-    // Calculate the note duration based on the type of the note
-    double NoteType = MAX(beatDuration * 4.0 * noteType, SONG_FILTER_PERIOD_MS);
+    uint32_t durationMs = (4 * 60000UL * noteDurationFractions[duration][0]) / ((uint32_t)tempo * noteDurationFractions[duration][1]);
+    return MAX(durationMs, SONG_FILTER_PERIOD_MS);
+}
 
-    return (int)NoteType;
+void SongTiming_Init(SongTiming *this, int tempo)
+{
+    assert(this);
+    this->tempo = tempo;
+    for (int i = 0; i < NUM_NOTE_DURATIONS; i++)
+    {
+        this->durationMs[i] = MAX(GetNoteDurationInMilliseconds(tempo, i), 0);
+    }
 }
 
 const SongNotes * GetSong(Song song)
@@ -90,3 +119,48 @@ const SongNotes * GetSong(Song song)
     }
     
 }
+
+void SongCursor_Init(SongCursor *this, const SongNotes *pSong)
+{
+    assert(this);
+    this->pSong = pSong;
+    if (pSong)
+    {
+        SongTiming_Init(&this->timing, pSong->tempo);
+    }
+    this->eventOffset = 0;
+    this->noteIdx = 0;
+    this->duration = NOTE_DURATION_QUARTER;
+    this->slur = 0;
+}
+
+bool SongCursor_Next(SongCursor *this, Note *pNote)
+{
+    assert(this);
+    assert(pNote);
+    const SongNotes *pSong = this->pSong;
+    if (pSong == NULL || this->noteIdx >= pSong->numNotes || this->eventOffset >= pSong->numEventBytes)
+    {
+        return false;
+    }
+
+    uint8_t event = pSong->pEvents[this->eventOffset++];
+    if (event & SONG_EVENT_TIMED_FLAG)
+    {
+        if (this->eventOffset >= pSong->numEventBytes)
+        {
+            ESP_LOGE(TAG, "Song %s truncated at note %d", pSong->songName, this->noteIdx);
+            return false;
+        }
+        uint8_t timing = pSong->pEvents[this->eventOffset++];
+        this->duration = MIN(timing & SONG_EVENT_DURATION_MASK, NUM_NOTE_DURATIONS - 1);
+        this->slur = (timing >> SONG_EVENT_SLUR_SHIFT) & 1;
+    }
+
+    pNote->note = (NoteName)(event & SONG_EVENT_NOTE_MASK);
+    pNote->duration = this->duration;
+    pNote->durationMs = this->timing.durationMs[this->duration];
+    pNote->slur = this->slur;
+    this->noteIdx++;
+    return true;
+}
@@ -7,12 +7,13 @@
 #include "freertos/timers.h"
 
 #include "NotificationDispatcher.h"
+#include "PowerManager.h"
 #include "TaskPriorities.h"
 #include "TouchSensor.h"
 #include "Song.h"
+#include "SongSequencer.h"
 #include "SynthMode.h"
 #include "TouchSensor.h"
-#include "TimeUtils.h"
 #include "UserSettings.h"
 
 #define SPEAKER_GPIO_NUM GPIO_NUM_18
@@ -26,9 +27,19 @@
 #define DEFAULT_LEDC_FREQ 440
 
 #define MUTEX_MAX_WAIT_MS     (50)
+#define SYNTH_IDLE_WAIT_MS    (50)
 
 #define DISABLE_SOUND (1)
 
+// Songs play on the first voice. With polyphonic output each touch key gets its own voice
+#define SYNTH_SONG_VOICE      (0)
+#define SYNTH_ALL_VOICES      (-1)
+#if CONFIG_SYNTH_POLYPHONIC
+#define SYNTH_TOUCH_VOICE(touchSensorIdx) ((touchSensorIdx) % POLY_SYNTH_MAX_VOICES)
+#else
+#define SYNTH_TOUCH_VOICE(touchSensorIdx) (SYNTH_SONG_VOICE)
+#endif
+
 static const char * TAG = "SYN";
 
 // middle C - major scale
@@ -67,12 +78,16 @@ const int touchFrequencyMapping[TOUCH_SENSOR_NUM_BUTTONS] =
 #endif
 
 static void SynthModeTask(void *pvParameters);
+static void SynthMode_SequencerTone(void *pContext, NoteName note);
+static void SynthMode_SequencerDone(void *pContext);
 static void SynthMode_TouchSensorNotificationHandler(void *pObj, esp_event_base_t eventBase, int32_t notificationEvent, void *notificationData);
 static void SynthMode_PlaySongNotificationHandler(void *pObj, esp_event_base_t eventBase, int32_t notificationEvent, void *notificationData);
+#if !CONFIG_SYNTH_POLYPHONIC
 static esp_err_t SynthMode_ConfigurePWM(SynthMode *this);
-static esp_err_t SynthMode_StopTone(SynthMode* this);
+#endif
+static esp_err_t SynthMode_StopTone(SynthMode* this, int voice, uint32_t notifyWaitMs);
 static esp_err_t SynthMode_PlaySong(SynthMode* this, Song song);
-static esp_err_t SynthMode_PlayTone(SynthMode* this, NoteName note);
+static esp_err_t SynthMode_PlayTone(SynthMode* this, int voice, NoteName note, uint32_t notifyWaitMs);
 
 
 esp_err_t SynthMode_Init(SynthMode *this, NotificationDispatcher *pNotificationDispatcher, UserSettings* pUserSettings)
@@ -85,24 +100,26 @@ esp_err_t SynthMode_Init(SynthMode *this, NotificationDispatcher *pNotificationD
         this->initialized = true;
         this->touchSoundEnabled = false;
         this->selectedSong = SONG_NONE;
-        this->currentNoteIdx = 0;
-        this->nextNotePlayTime = 0;
         this->octaveShift = 0;
         this->pNotificationDispatcher = pNotificationDispatcher;
         this->pUserSettings = pUserSettings;
-        this->queueMutex = xSemaphoreCreateMutex();
-        assert(this->queueMutex);
         this->toneMutex = xSemaphoreCreateMutex();
         assert(this->toneMutex);
-        assert(CircularBuffer_Init(&this->songQueue, 10, sizeof(PlaySongEventNotificationData)) == ESP_OK);
+        // Pushed from the notification handler and popped by the synth task
+        assert(CircularBuffer_InitLockFree(&this->songQueue, 16, sizeof(PlaySongEventNotificationData)) == ESP_OK);
+        ESP_ERROR_CHECK(SongSequencer_Init(&this->sequencer, &SynthMode_SequencerTone, &SynthMode_SequencerDone, this));
+#if CONFIG_SYNTH_POLYPHONIC
+        esp_err_t ret = PolySynth_Init(&this->polySynth, SPEAKER_GPIO_NUM);
+#else
         esp_err_t ret = SynthMode_ConfigurePWM(this);
+#endif
         if (ret == ESP_OK)
         {
             this->initialized = true;
             ESP_LOGI(TAG, "Synth Mode succesfully initialized");
             NotificationDispatcher_RegisterNotificationEventHandler(this->pNotificationDispatcher, NOTIFICATION_EVENTS_TOUCH_SENSE_ACTION, &SynthMode_TouchSensorNotificationHandler, this);
             NotificationDispatcher_RegisterNotificationEventHandler(this->pNotificationDispatcher, NOTIFICATION_EVENTS_PLAY_SONG, &SynthMode_PlaySongNotificationHandler, this);
-            assert(xTaskCreatePinnedToCore(SynthModeTask, "SynthModeTask", configMINIMAL_STACK_SIZE * 2, this, SYNTH_MODE_TASK_PRIORITY, NULL, APP_CPU_NUM) == pdPASS);
+            assert(xTaskCreatePinnedToCore(SynthModeTask, "SynthModeTask", configMINIMAL_STACK_SIZE * 2, this, SYNTH_MODE_TASK_PRIORITY, &this->taskHandle, SYNTH_MODE_TASK_CORE) == pdPASS);
             return ESP_OK;
         }
         else
@@ -115,84 +132,73 @@ esp_err_t SynthMode_Init(SynthMode *this, NotificationDispatcher *pNotificationD
     return ESP_FAIL;
 }
 
+// Notes are stepped by the sequencer timer. The task only starts queued songs and reports finished ones
 static void SynthModeTask(void *pvParameters)
 {
     SynthMode* this = (SynthMode*)pvParameters;
     assert(this);
     while (true)
     {
-        if (this->selectedSong != SONG_NONE)
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(SYNTH_IDLE_WAIT_MS));
+        if (this->songFinished)
         {
-            const SongNotes *pSong = GetSong(this->selectedSong);
-            ESP_LOGD(TAG, "Playing song %s (%d) note %d of %d", pSong->songName, this->selectedSong, this->currentNoteIdx, pSong->numNotes);
-            if (this->currentNoteIdx < pSong->numNotes)
-            {
-                this->nextNotePlayTime = TimeUtils_GetFutureTimeTicks(0);
-                int pauseTime = 50; //msec
-                int frequency = (int)GetNoteFrequency(pSong->notes[this->currentNoteIdx].note);
-                int holdTimeMs = GetNoteTypeInMilliseconds(pSong->tempo, pSong->notes[this->currentNoteIdx].noteType);
-                if (pSong->notes[this->currentNoteIdx].slur == 0)
-                {
-                    holdTimeMs -= pauseTime;
-                }
-                ESP_LOGD(TAG, "Note Idx %d - Note: %d  Type: %f  HoldTime: %d  Freq: %d", 
-                    this->currentNoteIdx,
-                    pSong->notes[this->currentNoteIdx].note,
-                    pSong->notes[this->currentNoteIdx].noteType,
-                    holdTimeMs,
-                    frequency);
-                if (pSong->notes[this->currentNoteIdx].note == NOTE_REST)
-                {
-                    SynthMode_StopTone(this);
-                }
-                else
-                {
-                    SynthMode_PlayTone(this, pSong->notes[this->currentNoteIdx].note);
-                }
-                vTaskDelay(pdMS_TO_TICKS(holdTimeMs));
-                if (pSong->notes[this->currentNoteIdx].slur == 0)
-                {
-                    SynthMode_StopTone(this);
-                    vTaskDelay(pdMS_TO_TICKS(pauseTime));
-                }
-                this->currentNoteIdx++;
-            }
-            if (this->currentNoteIdx >= pSong->numNotes)
-            {
-                SongNoteChangeEventNotificationData data;
-                data.song = this->selectedSong;
-                data.action = SONG_NOTE_CHANGE_TYPE_SONG_STOP;
-                data.note = SONG_NONE;
-
-                this->selectedSong = SONG_NONE;
-                this->currentNoteIdx = 0;
-                SynthMode_StopTone(this);
-                ESP_LOGI(TAG, "Finished playing song");
-                NotificationDispatcher_NotifyEvent(this->pNotificationDispatcher, NOTIFICATION_EVENTS_SONG_NOTE_ACTION, &data, sizeof(data), DEFAULT_NOTIFY_WAIT_DURATION);
-            }
+            SongNoteChangeEventNotificationData data;
+            data.song = this->selectedSong;
+            data.action = SONG_NOTE_CHANGE_TYPE_SONG_STOP;
+            data.note = SONG_NONE;
+
+            this->songFinished = false;
+            this->selectedSong = SONG_NONE;
+            SongSequencer_Stop(&this->sequencer);
+            SynthMode_StopTone(this, SYNTH_ALL_VOICES, DEFAULT_NOTIFY_WAIT_DURATION);
+            PowerManager_Release(POWER_LOCK_SYNTH);
+            ESP_LOGI(TAG, "Finished playing song. Max note lateness %lld us", this->sequencer.maxLatenessUs);
+#if CONFIG_SYNTH_POLYPHONIC
+            PolySynthStats stats;
+            PolySynth_GetStats(&this->polySynth, &stats);
+            ESP_LOGI(TAG, "Synth render %lu/%lu us per buffer (max/budget), %lu of %lu buffers over budget",
+                     stats.maxRenderUs, stats.budgetUs, stats.overBudgetCount, stats.renderedBuffers);
+#endif
+            NotificationDispatcher_NotifyEvent(this->pNotificationDispatcher, NOTIFICATION_EVENTS_SONG_NOTE_ACTION, &data, sizeof(data), DEFAULT_NOTIFY_WAIT_DURATION);
         }
-        else
+
+        if (this->selectedSong == SONG_NONE)
         {
-            // if (xSemaphoreTake(this->queueMutex, pdMS_TO_TICKS(MUTEX_MAX_WAIT_MS)) == pdTRUE)
+            PlaySongEventNotificationData playSongNotificationData;
+            if (CircularBuffer_PopFrontN(&this->songQueue, &playSongNotificationData, 1) == 1)
             {
-                if (this->songQueue.count > 0)
-                {
-                    PlaySongEventNotificationData playSongNotificationData;
-                    CircularBuffer_PopFront(&this->songQueue, &playSongNotificationData);
-                    ESP_LOGI(TAG, "Popped song %d off song queue. %d songs left in queue", playSongNotificationData.song, this->songQueue.count);
-                    SynthMode_PlaySong(this, playSongNotificationData.song);
-                }
-                // if (xSemaphoreGive(this->queueMutex) != pdTRUE)
-                // {
-                //     ESP_LOGE(TAG, "Failed to give badge queueMutex in %s", __FUNCTION__);
-                // }
+                ESP_LOGI(TAG, "Popped song %d off song queue. %d songs left in queue", playSongNotificationData.song, CircularBuffer_Count(&this->songQueue));
+                SynthMode_PlaySong(this, playSongNotificationData.song);
             }
-            vTaskDelay(pdMS_TO_TICKS(50));
         }
     }
 }
 
+// Sequencer callbacks, run in the esp_timer task
+static void SynthMode_SequencerTone(void *pContext, NoteName note)
+{
+    SynthMode *this = (SynthMode *)pContext;
+    assert(this);
+    if (note == NOTE_REST)
+    {
+        SynthMode_StopTone(this, SYNTH_SONG_VOICE, 0);
+    }
+    else
+    {
+        SynthMode_PlayTone(this, SYNTH_SONG_VOICE, note, 0);
+    }
+}
+
+static void SynthMode_SequencerDone(void *pContext)
+{
+    SynthMode *this = (SynthMode *)pContext;
+    assert(this);
+    this->songFinished = true;
+    xTaskNotifyGive(this->taskHandle);
+}
+
 
+#if !CONFIG_SYNTH_POLYPHONIC
 static esp_err_t SynthMode_ConfigurePWM(SynthMode *this)
 {
     esp_err_t ret = ESP_FAIL;
@@ -230,6 +236,7 @@ static esp_err_t SynthMode_ConfigurePWM(SynthMode *this)
 
     return ret;
 }
+#endif
 
 
 static esp_err_t SynthMode_PlaySong(SynthMode* this, Song song)
@@ -243,6 +250,11 @@ static esp_err_t SynthMode_PlaySong(SynthMode* this, Song song)
         {
             ESP_LOGI(TAG, "Interrupting Song %d", this->selectedSong);
         }
+        else
+        {
+            // Released by the task once the sequencer reports the song finished
+            PowerManager_Acquire(POWER_LOCK_SYNTH);
+        }
         SongNoteChangeEventNotificationData data;
         data.song = song;
         data.action = SONG_NOTE_CHANGE_TYPE_SONG_START;
@@ -251,15 +263,14 @@ static esp_err_t SynthMode_PlaySong(SynthMode* this, Song song)
 
         ESP_LOGD(TAG, "Settings song to Song %d", song);
         this->selectedSong = song;
-        this->currentNoteIdx = 0;
-        this->nextNotePlayTime = TimeUtils_GetFutureTimeTicks(0);
-        ret = ESP_OK;
+        this->songFinished = false;
+        ret = SongSequencer_Start(&this->sequencer, GetSong(song));
     }
     return ret;
 }
 
 
-static esp_err_t SynthMode_PlayTone(SynthMode* this, NoteName note)
+static esp_err_t SynthMode_PlayTone(SynthMode* this, int voice, NoteName note, uint32_t notifyWaitMs)
 {
     assert(this);
     esp_err_t ret = ESP_FAIL;
@@ -268,17 +279,19 @@ static esp_err_t SynthMode_PlayTone(SynthMode* this, NoteName note)
     {
         if (this->pUserSettings->settings.soundEnabled)
         {
-            float frequency = GetNoteFrequency(note);
+            uint32_t frequency = GetNoteFrequency(note);
             SongNoteChangeEventNotificationData data;
             data.song = this->selectedSong;
             data.action = SONG_NOTE_CHANGE_TYPE_TONE_START;
             data.note = note;
-            NotificationDispatcher_NotifyEvent(this->pNotificationDispatcher, NOTIFICATION_EVENTS_SONG_NOTE_ACTION, &data, sizeof(data), DEFAULT_NOTIFY_WAIT_DURATION);
+            NotificationDispatcher_NotifyEvent(this->pNotificationDispatcher, NOTIFICATION_EVENTS_SONG_NOTE_ACTION, &data, sizeof(data), notifyWaitMs);
 
             // if (xSemaphoreTake(this->toneMutex, pdMS_TO_TICKS(MUTEX_MAX_WAIT_MS)) == pdTRUE)
             {
-                ESP_LOGD(TAG, "Starting tone at %f", frequency);
-#if DISABLE_SOUND
+                ESP_LOGD(TAG, "Starting tone at %lu on voice %d", frequency, voice);
+#if CONFIG_SYNTH_POLYPHONIC
+                PolySynth_NoteOn(&this->polySynth, voice, frequency, POLY_SYNTH_WAVEFORM_SQUARE);
+#elif DISABLE_SOUND
                 ledc_set_freq(DEFAULT_LEDC_SPEED_MODE, DEFAULT_LEDC_TIMER, frequency);
                 ledc_set_duty(DEFAULT_LEDC_SPEED_MODE, DEFAULT_LEDC_CHANNEL, DEFAULT_LEDC_DUTY_ON);
                 ledc_update_duty(DEFAULT_LEDC_SPEED_MODE, DEFAULT_LEDC_CHANNEL);
@@ -302,7 +315,7 @@ static esp_err_t SynthMode_PlayTone(SynthMode* this, NoteName note)
 }
 
 
-static esp_err_t SynthMode_StopTone(SynthMode* this)
+static esp_err_t SynthMode_StopTone(SynthMode* this, int voice, uint32_t notifyWaitMs)
 {
     assert(this);
     esp_err_t ret = ESP_FAIL;
@@ -315,10 +328,21 @@ static esp_err_t SynthMode_StopTone(SynthMode* this)
             data.song = this->selectedSong;
             data.note = SONG_NONE;
             data.action = SONG_NOTE_CHANGE_TYPE_TONE_STOP;
-            NotificationDispatcher_NotifyEvent(this->pNotificationDispatcher, NOTIFICATION_EVENTS_SONG_NOTE_ACTION, &data, sizeof(data), DEFAULT_NOTIFY_WAIT_DURATION);
+            NotificationDispatcher_NotifyEvent(this->pNotificationDispatcher, NOTIFICATION_EVENTS_SONG_NOTE_ACTION, &data, sizeof(data), notifyWaitMs);
 
+#if CONFIG_SYNTH_POLYPHONIC
+            if (voice == SYNTH_ALL_VOICES)
+            {
+                PolySynth_AllNotesOff(&this->polySynth);
+            }
+            else
+            {
+                PolySynth_NoteOff(&this->polySynth, voice);
+            }
+#else
             ledc_set_duty(DEFAULT_LEDC_SPEED_MODE, DEFAULT_LEDC_CHANNEL, DEFAULT_LEDC_DUTY_OFF);
             ledc_update_duty(DEFAULT_LEDC_SPEED_MODE, DEFAULT_LEDC_CHANNEL);
+#endif
 
             // if (xSemaphoreGive(this->toneMutex) != pdTRUE)
             // {
@@ -340,6 +364,15 @@ esp_err_t SynthMode_SetTouchSoundEnabled(SynthMode *this, bool enabled, int octa
     if (this->initialized)
     {
         ESP_LOGD(TAG, "Setting touch sound enabled to %s", enabled ? "true" : "false");
+        // Touch tones have to start without waiting for the clock to ramp up
+        if (enabled && !this->touchSoundEnabled)
+        {
+            PowerManager_Acquire(POWER_LOCK_SYNTH);
+        }
+        else if (!enabled && this->touchSoundEnabled)
+        {
+            PowerManager_Release(POWER_LOCK_SYNTH);
+        }
         this->touchSoundEnabled = enabled;
         this->octaveShift = octaveShift;
         ret = ESP_OK;
@@ -367,13 +400,13 @@ static void SynthMode_TouchSensorNotificationHandler(void *pObj, esp_event_base_
     {
         if (touchNotificationData.touchSensorEvent == TOUCH_SENSOR_EVENT_RELEASED)
         {
-            SynthMode_StopTone(this);
+            SynthMode_StopTone(this, SYNTH_TOUCH_VOICE(touchNotificationData.touchSensorIdx), DEFAULT_NOTIFY_WAIT_DURATION);
         }
         else
         {
             if (this->touchSoundEnabled)
             {
-                SynthMode_PlayTone(this, touchFrequencyMapping[touchNotificationData.touchSensorIdx] + (this->octaveShift * NOTE_ENUMS_PER_OCTAVE));
+                SynthMode_PlayTone(this, SYNTH_TOUCH_VOICE(touchNotificationData.touchSensorIdx), touchFrequencyMapping[touchNotificationData.touchSensorIdx] + (this->octaveShift * NOTE_ENUMS_PER_OCTAVE), DEFAULT_NOTIFY_WAIT_DURATION);
             }
         }
     }
@@ -395,16 +428,10 @@ static void SynthMode_PlaySongNotificationHandler(void *pObj, esp_event_base_t e
         return;
     }
 
-    // if (xSemaphoreTake(this->queueMutex, pdMS_TO_TICKS(MUTEX_MAX_WAIT_MS)) == pdTRUE)
+    if (CircularBuffer_PushBack(&this->songQueue, &playSongNotificationData) != ESP_OK)
     {
-        if (CircularBuffer_PushBack(&this->songQueue, &playSongNotificationData) != ESP_OK)
-        {
-            ESP_LOGE(TAG, "Failed to push song to queue");
-            return;
-        }
-        // if (xSemaphoreGive(this->queueMutex) != pdTRUE)
-        // {
-        //     ESP_LOGE(TAG, "Failed to give badge queueMutex in %s", __FUNCTION__);
-        // }
+        ESP_LOGE(TAG, "Failed to push song to queue");
+        return;
     }
+    xTaskNotifyGive(this->taskHandle);
 }
@@ -8,19 +8,25 @@
 #include "esp_log.h"
 #include "esp_random.h"
 #include "esp_system.h"
+#include "esp_timer.h"
 #include "mbedtls/base64.h"
 
 #include "BadgeStats.h"
 #include "BleControl.h"
 #include "BleControl_Service.h"
 #include "BleControl_ServiceChar_FileTransfer.h"
+#include "BootProfile.h"
 #include "Console.h"
+#include "console_notifications.h"
 #include "DiskUtilities.h"
+#include "InitGraph.h"
 #include "LedModing.h"
 #include "LedSequences.h"
+#include "MemTrack.h"
 #include "NotificationDispatcher.h"
 #include "Ocarina.h"
 #include "OtaUpdate.h"
+#include "PowerManager.h"
 #include "SynthMode.h"
 #include "SystemState.h"
 #include "TaskPriorities.h"
@@ -92,10 +98,48 @@ static void SystemState_PeerHeartbeatNotificationHandler(void *pObj, esp_event_b
 static void SystemState_InteractiveGameNotificationHandler(void *pObj, esp_event_base_t eventBase, int32_t notificationEvent, void *notificationData);
 
 static void SystemStateTask(void *pvParameters);
+static TimerHandle_t SystemState_CreateTimer(const char *name, uint32_t periodMsec, TimerCallbackFunction_t callback);
+static esp_err_t SystemState_RunInitStep(void *pContext, int step);
+#if CONFIG_BOOT_PARALLEL_INIT
+static void SystemStateInitTask(void *pvParameters);
+#endif
+static esp_err_t SystemState_InitBattery(SystemState *this);
+static esp_err_t SystemState_InitUserSettings(SystemState *this);
+static esp_err_t SystemState_InitLedSequences(SystemState *this);
+static esp_err_t SystemState_InitBadgeStats(SystemState *this);
+static esp_err_t SystemState_InitGameState(SystemState *this);
+static esp_err_t SystemState_InitBle(SystemState *this);
+static esp_err_t SystemState_InitGpio(SystemState *this);
+static esp_err_t SystemState_InitTouch(SystemState *this);
+static esp_err_t SystemState_InitLedControl(SystemState *this);
+static esp_err_t SystemState_InitWifi(SystemState *this);
+static esp_err_t SystemState_InitSynth(SystemState *this);
+static esp_err_t SystemState_InitOta(SystemState *this);
+static esp_err_t SystemState_InitHttp(SystemState *this);
+static void *SystemState_JsonMalloc(size_t size);
+static void SystemState_JsonFree(void *pMemory);
 
 // Internal Constants
 static const char * TAG = "SYS";
 
+// Dependencies are in SystemStateInitSteps.c
+static esp_err_t (* const INIT_STEP_FUNCTIONS[INIT_STEP_COUNT])(SystemState *this) =
+{
+    [INIT_STEP_BATTERY]       = SystemState_InitBattery,
+    [INIT_STEP_USER_SETTINGS] = SystemState_InitUserSettings,
+    [INIT_STEP_LED_SEQUENCES] = SystemState_InitLedSequences,
+    [INIT_STEP_BADGE_STATS]   = SystemState_InitBadgeStats,
+    [INIT_STEP_GAME_STATE]    = SystemState_InitGameState,
+    [INIT_STEP_BLE]           = SystemState_InitBle,
+    [INIT_STEP_GPIO]          = SystemState_InitGpio,
+    [INIT_STEP_TOUCH]         = SystemState_InitTouch,
+    [INIT_STEP_LED_CONTROL]   = SystemState_InitLedControl,
+    [INIT_STEP_WIFI]          = SystemState_InitWifi,
+    [INIT_STEP_SYNTH]         = SystemState_InitSynth,
+    [INIT_STEP_OTA]           = SystemState_InitOta,
+    [INIT_STEP_HTTP]          = SystemState_InitHttp,
+};
+
 // Internal Variables
 static SystemState *pSystemState = NULL;
 
@@ -114,6 +158,8 @@ esp_err_t SystemState_Init(SystemState *this)
     esp_err_t ret= ESP_OK;
     assert(this);
     memset(this, 0, sizeof(*this));
+    portMUX_INITIALIZE(&this->peerSongLock);
+    portMUX_INITIALIZE(&this->menuLock);
 
     // Initialize ESP Timers
     esp_timer_init(); // JER: Something seems to be initializing the esp timers somewhere else, this prints an error message
@@ -143,110 +189,73 @@ esp_err_t SystemState_Init(SystemState *this)
             break;
     }
 
-    this->touchActiveTimer = xTimerCreate("TouchActiveTimer", pdMS_TO_TICKS(TOUCH_ACTIVE_TIMEOUT_DURATION_MSEC), pdFALSE, 0, SystemState_TouchActiveTimerCallback);
-    if (this->touchActiveTimer == NULL)
-    {
-        ESP_LOGE(TAG, "Failed to create touch active timer");
-        ret = ESP_FAIL;
-    }
-
-    this->drawBatteryIndicatorActiveTimer = xTimerCreate("BatteryIndicatorActiveTimer", 
-                                                         pdMS_TO_TICKS(BATTERY_SEQUENCE_DRAW_DURATION_MSEC+BATTERY_SEQUENCE_HOLD_DURATION_MSEC),
-                                                         pdFALSE, 0, SystemState_BatteryIndicatorActiveTimerCallback);
-    if (this->drawBatteryIndicatorActiveTimer == NULL)
-    {
-        ESP_LOGE(TAG, "Failed to create battery indicator active timer");
-        ret = ESP_FAIL;
-    }
-
-    this->drawNetworkTestTimer = xTimerCreate("NetworkTestActiveTimer", 
-                                                  pdMS_TO_TICKS(NETWORK_TEST_DRAW_DURATION_MSEC),
-                                                  pdFALSE, 0, SystemState_NetworkTestActiveTimerCallback);
-    if (this->drawNetworkTestTimer == NULL)
-    {
-        ESP_LOGE(TAG, "Failed to create network test active timer");
-        ret = ESP_FAIL;
-    }
-
-    this->drawNetworkTestSuccessTimer = xTimerCreate("NetworkTestSuccessTimer", 
-                                                  pdMS_TO_TICKS(NETWORK_TEST_SUCCESS_DRAW_DURATION_MSEC),
-                                                  pdFALSE, 0, SystemState_NetworkTestActiveTimerCallback);
-    if (this->drawNetworkTestSuccessTimer == NULL)
-    {
-        ESP_LOGE(TAG, "Failed to create network test success timer");
-        ret = ESP_FAIL;
-    }
-
-    this->ledSequencePreviewTimer = xTimerCreate("LedPreviewActiveTimer", 
-                                                 pdMS_TO_TICKS(LED_PREVIEW_DRAW_DURATION_MSEC),
-                                                 pdFALSE, 0, SystemState_LedSequencePreviewActiveTimerCallback);
-    if (this->ledSequencePreviewTimer == NULL)
+    this->touchActiveTimer = SystemState_CreateTimer("TouchActiveTimer", TOUCH_ACTIVE_TIMEOUT_DURATION_MSEC, SystemState_TouchActiveTimerCallback);
+    this->drawBatteryIndicatorActiveTimer = SystemState_CreateTimer("BatteryIndicatorActiveTimer", BATTERY_SEQUENCE_DRAW_DURATION_MSEC + BATTERY_SEQUENCE_HOLD_DURATION_MSEC,
+                                                                    SystemState_BatteryIndicatorActiveTimerCallback);
+    this->drawNetworkTestTimer = SystemState_CreateTimer("NetworkTestActiveTimer", NETWORK_TEST_DRAW_DURATION_MSEC, SystemState_NetworkTestActiveTimerCallback);
+    this->drawNetworkTestSuccessTimer = SystemState_CreateTimer("NetworkTestSuccessTimer", NETWORK_TEST_SUCCESS_DRAW_DURATION_MSEC, SystemState_NetworkTestActiveTimerCallback);
+    this->ledSequencePreviewTimer = SystemState_CreateTimer("LedPreviewActiveTimer", LED_PREVIEW_DRAW_DURATION_MSEC, SystemState_LedSequencePreviewActiveTimerCallback);
+    this->ledGameStatusToggleTimer = SystemState_CreateTimer("LedGameStatusToggleTimer", LED_GAME_STATUS_TOGGLE_DURATION_MSEC, SystemState_LedGameStatusToggleTimerCallback);
+    this->peerSongCooldownTimer = SystemState_CreateTimer("PeerSongCooldownTimer", PEER_SONG_COOLDOWN_DURATION_MSEC, SystemState_PeerSongCooldownTimerCallback);
+    if (this->touchActiveTimer == NULL || this->drawBatteryIndicatorActiveTimer == NULL || this->drawNetworkTestTimer == NULL ||
+        this->drawNetworkTestSuccessTimer == NULL || this->ledSequencePreviewTimer == NULL || this->ledGameStatusToggleTimer == NULL ||
+        this->peerSongCooldownTimer == NULL)
     {
-        ESP_LOGE(TAG, "Failed to create led sequence preview timer");
-        ret = ESP_FAIL;
-    }
-
-    this->ledGameStatusToggleTimer = xTimerCreate("LedGameStatusToggleTimer", 
-                                                 pdMS_TO_TICKS(LED_GAME_STATUS_TOGGLE_DURATION_MSEC),
-                                                 pdFALSE, 0, SystemState_LedGameStatusToggleTimerCallback);
-    if (this->ledSequencePreviewTimer == NULL)
-    {
-        ESP_LOGE(TAG, "Failed to create led sequence preview timer");
-        ret = ESP_FAIL;
-    }
-
-    this->peerSongCooldownTimer = xTimerCreate("PeerSongCooldownTimer", 
-                                                 pdMS_TO_TICKS(PEER_SONG_COOLDOWN_DURATION_MSEC),
-                                                 pdFALSE, 0, SystemState_PeerSongCooldownTimerCallback);
-    if (this->peerSongCooldownTimer == NULL)
-    {
-        ESP_LOGE(TAG, "Failed to create led sequence preview timer");
         ret = ESP_FAIL;
     }
 
     // Initialize flash fat filesystem
+    int64_t stepStartUs = esp_timer_get_time();
     ret = DiskUtilities_InitNvs();
     if (ret != ESP_OK)
     {
         ESP_LOGE(TAG, "Failed to initialize NVS. error code = %s", esp_err_to_name(ret));
     }
+    BootProfile_RecordStep("nvs", stepStartUs);
+
+    stepStartUs = esp_timer_get_time();
     ret = DiskUtilities_InitFs();
     bool fsInitialized = ret == ESP_OK;
     if (ret != ESP_OK)
     {
         ESP_LOGE(TAG, "Failed to initialize FATFS. error code = %s", esp_err_to_name(ret));
     }
+    BootProfile_RecordStep("fs", stepStartUs);
 
     // Initialize cJSON before any library uses it
+    stepStartUs = esp_timer_get_time();
     cJSON_Hooks memoryHook;
-    memoryHook.malloc_fn = &malloc;
-    memoryHook.free_fn = &free;
+    memoryHook.malloc_fn = &SystemState_JsonMalloc;
+    memoryHook.free_fn = &SystemState_JsonFree;
     cJSON_InitHooks(&memoryHook);
+    BootProfile_RecordStep("cjson_hooks", stepStartUs);
 
+    stepStartUs = esp_timer_get_time();
     ESP_ERROR_CHECK(Console_Init());
+    BootProfile_RecordStep("console", stepStartUs);
+
+    stepStartUs = esp_timer_get_time();
+    ESP_ERROR_CHECK(PowerManager_Init());
+    BootProfile_RecordStep("power", stepStartUs);
+
+    stepStartUs = esp_timer_get_time();
     ESP_ERROR_CHECK(NotificationDispatcher_Init(&this->notificationDispatcher));
-    ESP_ERROR_CHECK(BatterySensor_Init(&this->batterySensor, &this->notificationDispatcher));
-    ESP_ERROR_CHECK(BadgeStats_Init(&this->badgeStats));
-    ESP_ERROR_CHECK(GpioControl_Init(&this->gpioControl));
-    ESP_ERROR_CHECK(UserSettings_Init(&this->userSettings, &this->batterySensor)); // uses bootloader random enable logic
-
-    ESP_ERROR_CHECK(LedSequences_Init(&this->batterySensor));
-    ESP_ERROR_CHECK(BadgeStats_RegisterBatterySensor(&this->badgeStats, &this->batterySensor));
-    ESP_ERROR_CHECK(GameState_Init(&this->gameState, &this->notificationDispatcher, &this->badgeStats, &this->userSettings, &this->batterySensor));
-    ESP_ERROR_CHECK(LedControl_Init(&this->ledControl, &this->notificationDispatcher, &this->userSettings, &this->batterySensor, &this->gameState, BATTERY_SEQUENCE_HOLD_DURATION_MSEC));
-    ESP_ERROR_CHECK(LedModing_Init(&this->ledModing, &this->ledControl));
-    if (this->appConfig.buzzerPresent)
-    {
-        ESP_ERROR_CHECK(SynthMode_Init(&this->synthMode, &this->notificationDispatcher, &this->userSettings));
-        ESP_ERROR_CHECK(Ocarina_Init(&this->ocarina, &this->notificationDispatcher));
-    }
+#if CONFIG_DEBUG_FEATURES
+    register_notification_commands(&this->notificationDispatcher);
+#endif
+    BootProfile_RecordStep("notifications", stepStartUs);
 
-    ESP_ERROR_CHECK(TouchSensor_Init(&this->touchSensor, &this->notificationDispatcher));
-    ESP_ERROR_CHECK(TouchActions_Init(&this->touchActions, &this->notificationDispatcher));
-    ESP_ERROR_CHECK(BleControl_Init(&this->bleControl, &this->notificationDispatcher, &this->userSettings, &this->gameState));
-    ESP_ERROR_CHECK(WifiClient_Init(&this->wifiClient, &this->notificationDispatcher, &this->userSettings));
-    ESP_ERROR_CHECK(OtaUpdate_Init(&this->otaUpdate, &this->wifiClient, &this->notificationDispatcher));
-    ESP_ERROR_CHECK(HTTPGameClient_Init(&this->httpGameClient, &this->wifiClient, &this->notificationDispatcher, &this->batterySensor));
+    // Subsystems come up on both cores as soon as the steps they depend on are done
+    InitGraph initGraph;
+    ESP_ERROR_CHECK(InitGraph_Init(&initGraph, SystemStateInitSteps, INIT_STEP_COUNT, SystemState_RunInitStep, this));
+#if CONFIG_BOOT_PARALLEL_INIT
+    assert(xTaskCreatePinnedToCore(SystemStateInitTask, "SystemStateInit", CONFIG_ESP_MAIN_TASK_STACK_SIZE, &initGraph, uxTaskPriorityGet(NULL), NULL, 1 - xPortGetCoreID()) == pdPASS);
+#endif
+    InitGraph_Run(&initGraph);
+#if CONFIG_BOOT_PARALLEL_INIT
+    InitGraph_WaitHelperDone(&initGraph);
+#endif
+    InitGraph_Deinit(&initGraph);
 
     ESP_ERROR_CHECK(NotificationDispatcher_RegisterNotificationEventHandler(&this->notificationDispatcher, NOTIFICATION_EVENTS_TOUCH_ACTION_CMD,                 &SystemState_TouchActionNotificationHandler,    this));
     ESP_ERROR_CHECK(NotificationDispatcher_RegisterNotificationEventHandler(&this->notificationDispatcher, NOTIFICATION_EVENTS_TOUCH_SENSE_ACTION,               &SystemState_TouchSensorNotificationHandler,    this));
@@ -280,7 +289,10 @@ esp_err_t SystemState_Init(SystemState *this)
         GpioControl_Control(&this->gpioControl, GPIO_FEATURE_RIGHT_EYE, true, 0);
     }
 
-    assert(xTaskCreatePinnedToCore(SystemStateTask, "SystemStateTask", configMINIMAL_STACK_SIZE * 2, this, SYSTEM_STATE_TASK_PRIORITY, NULL, APP_CPU_NUM) == pdPASS);
+    // Heartbeats and game events are posted from this task, start it once every handler is registered
+    ESP_ERROR_CHECK(GameState_Start(&this->gameState));
+
+    assert(xTaskCreatePinnedToCore(SystemStateTask, "SystemStateTask", configMINIMAL_STACK_SIZE * 2, this, SYSTEM_STATE_TASK_PRIORITY, NULL, SYSTEM_STATE_TASK_CORE) == pdPASS);
     bool firstBoot = false;
     if (fsInitialized) {
         ESP_LOGI(TAG, "Checking for first boot file %s", FIRSTBOOT_FILE_NAME);
@@ -344,9 +356,131 @@ esp_err_t SystemState_Init(SystemState *this)
         }
     }
 
+    BootProfile_Milestone(BOOT_MILESTONE_INIT_DONE);
     return ret;
 }
 
+static TimerHandle_t SystemState_CreateTimer(const char *name, uint32_t periodMsec, TimerCallbackFunction_t callback)
+{
+    int64_t startUs = esp_timer_get_time();
+    TimerHandle_t timer = xTimerCreate(name, pdMS_TO_TICKS(periodMsec), pdFALSE, 0, callback);
+    if (timer == NULL)
+    {
+        ESP_LOGE(TAG, "Failed to create %s", name);
+    }
+    BootProfile_RecordStep(name, startUs);
+    return timer;
+}
+
+static esp_err_t SystemState_RunInitStep(void *pContext, int step)
+{
+    int64_t startUs = esp_timer_get_time();
+    ESP_ERROR_CHECK(INIT_STEP_FUNCTIONS[step]((SystemState *)pContext));
+    BootProfile_RecordStep(SystemStateInitSteps[step].name, startUs);
+    return ESP_OK;
+}
+
+#if CONFIG_BOOT_PARALLEL_INIT
+static void SystemStateInitTask(void *pvParameters)
+{
+    InitGraph *pGraph = (InitGraph *)pvParameters;
+    assert(pGraph);
+    InitGraph_Run(pGraph);
+    InitGraph_HelperDone(pGraph);
+    vTaskDelete(NULL);
+}
+#endif
+
+static esp_err_t SystemState_InitBattery(SystemState *this)
+{
+    return BatterySensor_Init(&this->batterySensor, &this->notificationDispatcher);
+}
+
+// Uses bootloader random enable logic
+static esp_err_t SystemState_InitUserSettings(SystemState *this)
+{
+    return UserSettings_Init(&this->userSettings, &this->batterySensor);
+}
+
+static esp_err_t SystemState_InitLedSequences(SystemState *this)
+{
+    return LedSequences_Init(&this->batterySensor);
+}
+
+static esp_err_t SystemState_InitBadgeStats(SystemState *this)
+{
+    esp_err_t ret = BadgeStats_Init(&this->badgeStats);
+    if (ret == ESP_OK)
+    {
+        ret = BadgeStats_RegisterBatterySensor(&this->badgeStats, &this->batterySensor);
+    }
+    return ret;
+}
+
+static esp_err_t SystemState_InitGameState(SystemState *this)
+{
+    return GameState_Init(&this->gameState, &this->notificationDispatcher, &this->badgeStats, &this->userSettings, &this->batterySensor);
+}
+
+static esp_err_t SystemState_InitBle(SystemState *this)
+{
+    return BleControl_Init(&this->bleControl, &this->notificationDispatcher, &this->userSettings, &this->gameState);
+}
+
+static esp_err_t SystemState_InitGpio(SystemState *this)
+{
+    return GpioControl_Init(&this->gpioControl);
+}
+
+static esp_err_t SystemState_InitTouch(SystemState *this)
+{
+    esp_err_t ret = TouchSensor_Init(&this->touchSensor, &this->notificationDispatcher);
+    if (ret == ESP_OK)
+    {
+        ret = TouchActions_Init(&this->touchActions, &this->notificationDispatcher);
+    }
+    return ret;
+}
+
+static esp_err_t SystemState_InitLedControl(SystemState *this)
+{
+    esp_err_t ret = LedControl_Init(&this->ledControl, &this->notificationDispatcher, &this->userSettings, &this->batterySensor, &this->gameState, BATTERY_SEQUENCE_HOLD_DURATION_MSEC);
+    if (ret == ESP_OK)
+    {
+        ret = LedModing_Init(&this->ledModing, &this->ledControl);
+    }
+    return ret;
+}
+
+static esp_err_t SystemState_InitWifi(SystemState *this)
+{
+    return WifiClient_Init(&this->wifiClient, &this->notificationDispatcher, &this->userSettings);
+}
+
+static esp_err_t SystemState_InitSynth(SystemState *this)
+{
+    esp_err_t ret = ESP_OK;
+    if (this->appConfig.buzzerPresent)
+    {
+        ret = SynthMode_Init(&this->synthMode, &this->notificationDispatcher, &this->userSettings);
+        if (ret == ESP_OK)
+        {
+            ret = Ocarina_Init(&this->ocarina, &this->notificationDispatcher);
+        }
+    }
+    return ret;
+}
+
+static esp_err_t SystemState_InitOta(SystemState *this)
+{
+    return OtaUpdate_Init(&this->otaUpdate, &this->wifiClient, &this->notificationDispatcher);
+}
+
+static esp_err_t SystemState_InitHttp(SystemState *this)
+{
+    return HTTPGameClient_Init(&this->httpGameClient, &this->wifiClient, &this->notificationDispatcher, &this->batterySensor);
+}
+
 static void SystemStateTask(void *pvParameters)
 {
     SystemState * this = (SystemState *)pvParameters;
@@ -370,15 +504,29 @@ static bool SystemState_ProcessTouchModeEnabledModeCmd(SystemState *this, TouchA
     switch(touchCmd)
     {
         case TOUCH_ACTIONS_CMD_ENABLE_TOUCH:
+        {
+            taskENTER_CRITICAL(&this->menuLock);
+            bool enabled = !this->touchActive;
+            if (enabled)
+            {
+                this->touchActionCmdClearRequired = true;
+                this->touchActive = true;
+            }
+            taskEXIT_CRITICAL(&this->menuLock);
+            if (!enabled)
+            {
+                // Enabled since the caller's snapshot
+                break;
+            }
             ESP_LOGI(TAG, "Touch Enabled. Clear Required");
-            this->touchActionCmdClearRequired = true;
-            this->touchActive = true;
             NotificationDispatcher_NotifyEvent(&this->notificationDispatcher, NOTIFICATION_EVENTS_TOUCH_ENABLED, NULL, 0, DEFAULT_NOTIFY_WAIT_DURATION);
             SystemState_ResetTouchActiveTimer(this);
             GpioControl_Control(&this->gpioControl, GPIO_FEATURE_VIBRATION, true, 500); // TODO: Make these components use the notification dispatcher instead of these functions
             LedModing_SetTouchActive(&this->ledModing, true);      // TODO: Make these components use the notification dispatcher instead of these functions
             TouchSensor_SetTouchEnabled(&this->touchSensor, true); // TODO: Make these components use the notification dispatcher instead of these functions
             cmdProcessed = true;
+            break;
+        }
         default:
             break;
     }
@@ -413,10 +561,17 @@ static bool SystemState_ProcessMenuCmd(SystemState *this, TouchActionsCmd touchC
     switch(touchCmd)
     {
         case TOUCH_ACTIONS_CMD_DISABLE_TOUCH:
-            if (this->appConfig.touchActionCommandEnabled && this->touchActive)
+        {
+            taskENTER_CRITICAL(&this->menuLock);
+            bool disabled = this->appConfig.touchActionCommandEnabled && this->touchActive;
+            if (disabled)
             {
-                ESP_LOGI(TAG, "Touch Disabled");
                 this->touchActive = false;
+            }
+            taskEXIT_CRITICAL(&this->menuLock);
+            if (disabled)
+            {
+                ESP_LOGI(TAG, "Touch Disabled");
                 NotificationDispatcher_NotifyEvent(&this->notificationDispatcher, NOTIFICATION_EVENTS_TOUCH_DISABLED, NULL, 0, DEFAULT_NOTIFY_WAIT_DURATION);
                 SystemState_StopTouchActiveTimer(this);
                 GpioControl_Control(&this->gpioControl, GPIO_FEATURE_VIBRATION, true, 500); // TODO: Make these components use the notification dispatcher instead of these functions
@@ -430,6 +585,7 @@ static bool SystemState_ProcessMenuCmd(SystemState *this, TouchActionsCmd touchC
                 cmdProcessed = true;
             }
             break;
+        }
         case TOUCH_ACTIONS_CMD_NEXT_LED_SEQUENCE:
             ESP_LOGI(TAG, "Next LED Sequence");
             GpioControl_Control(&this->gpioControl, GPIO_FEATURE_VIBRATION, true, 500); // TODO: Make these components use the notification dispatcher instead of these functions
@@ -450,12 +606,14 @@ static bool SystemState_ProcessMenuCmd(SystemState *this, TouchActionsCmd touchC
             break;
         case TOUCH_ACTIONS_CMD_DISPLAY_VOLTAGE_METER:
             ESP_LOGI(TAG, "Displaying Voltage Meter");
+            taskENTER_CRITICAL(&this->menuLock);
+            this->batteryIndicatorActive = true;
+            taskEXIT_CRITICAL(&this->menuLock);
             GpioControl_Control(&this->gpioControl, GPIO_FEATURE_VIBRATION, true, 500);
             LedModing_SetBatteryIndicatorActive(&this->ledModing, true);
             SystemState_ResetBatteryIndicatorActiveTimer(this);
             BadgeStats_IncrementNumBatteryChecks(&this->badgeStats);
             cmdProcessed = true;
-            this->batteryIndicatorActive = true;
             break;
         case TOUCH_ACTIONS_CMD_ENABLE_BLE_PAIRING:
             ESP_LOGI(TAG, "Enabling BLE Service");
@@ -530,27 +688,38 @@ static void SystemState_ProcessTouchActionCmd(SystemState *this, TouchActionsCmd
 
     assert(this);
     bool cmdProcessed = false;
-    
-    if ((this->touchActionCmdClearRequired) && (touchCmd == TOUCH_ACTIONS_CMD_CLEAR))
+
+    // Snapshot the menu state, the command is acted on outside the lock
+    taskENTER_CRITICAL(&this->menuLock);
+    bool cleared = this->touchActionCmdClearRequired && (touchCmd == TOUCH_ACTIONS_CMD_CLEAR);
+    if (cleared)
     {
         this->touchActionCmdClearRequired = false;
+    }
+    bool clearRequired = this->touchActionCmdClearRequired;
+    bool interactiveGameActive = this->interactiveGameTouchSensorsToLightBits.s.active;
+    bool touchActive = this->touchActive;
+    taskEXIT_CRITICAL(&this->menuLock);
+
+    if (cleared)
+    {
         ESP_LOGI(TAG, "Touch Cleared");
     }
 
-    if (this->interactiveGameTouchSensorsToLightBits.s.active)
+    if (interactiveGameActive)
     {
         ESP_LOGI(TAG, "Interactive Game in progress, ignoring touch command %d", touchCmd);
         return;
     }
 
-    if (this->touchActionCmdClearRequired)
+    if (clearRequired)
     {
         ESP_LOGI(TAG, "Touch Action Cmd Clear is required, ignoring touch command %d", touchCmd);
         return;
     }
 
     // Process touch command
-    if (this->appConfig.touchActionCommandEnabled && !this->touchActive)
+    if (this->appConfig.touchActionCommandEnabled && !touchActive)
     {
         cmdProcessed = SystemState_ProcessTouchModeEnabledModeCmd(this, touchCmd);
     }
@@ -569,6 +738,16 @@ static void SystemState_ProcessTouchActionCmd(SystemState *this, TouchActionsCmd
     }
 }
 
+static void *SystemState_JsonMalloc(size_t size)
+{
+    return MemTrack_Malloc(MEM_TAG_CJSON, size);
+}
+
+static void SystemState_JsonFree(void *pMemory)
+{
+    MemTrack_Free(pMemory);
+}
+
 static void SystemState_TouchSensorNotificationHandler(void *pObj, esp_event_base_t eventBase, int32_t notificationEvent, void *notificationData)
 {
     ESP_LOGD(TAG, "Handling Touch Sensor Notification");
@@ -799,7 +978,9 @@ static esp_err_t SystemState_NetworkTestInactiveTimerExpired(SystemState *this)
 {
     assert(this);
     ESP_LOGI(TAG, "Network Test Inactive Timer Expired");
+    taskENTER_CRITICAL(&this->menuLock);
     this->networkTestActive = false;
+    taskEXIT_CRITICAL(&this->menuLock);
     return LedModing_SetNetworkTestActive(&this->ledModing, false);
 }
 
@@ -820,7 +1001,9 @@ static esp_err_t SystemState_ResetNetworkTestActiveTimer(SystemState *this)
     assert(this);
     assert(this->drawNetworkTestTimer);
     esp_err_t ret = ESP_FAIL;
+    taskENTER_CRITICAL(&this->menuLock);
     this->networkTestActive = true;
+    taskEXIT_CRITICAL(&this->menuLock);
     if (xTimerReset(this->drawNetworkTestTimer, 0) == pdPASS)
     {
         ret = ESP_OK;
@@ -862,7 +1045,9 @@ static void SystemState_NetworkTestActiveTimerCallback(TimerHandle_t xTimer)
 static esp_err_t SystemState_TouchInactiveTimerExpired(SystemState *this)
 {
     assert(this);
+    taskENTER_CRITICAL(&this->menuLock);
     this->touchActive = false;
+    taskEXIT_CRITICAL(&this->menuLock);
     ESP_LOGI(TAG, "Touch Disabled");
     LedModing_SetTouchActive(&this->ledModing, false);
     TouchSensor_SetTouchEnabled(&this->touchSensor, false);
@@ -910,7 +1095,9 @@ static esp_err_t SystemState_BatteryIndicatorInactiveTimerExpired(SystemState *t
 {
     assert(this);
     ESP_LOGI(TAG, "Battery Indicator Inactive Timer Expired");
+    taskENTER_CRITICAL(&this->menuLock);
     this->batteryIndicatorActive = false;
+    taskEXIT_CRITICAL(&this->menuLock);
     return LedModing_SetBatteryIndicatorActive(&this->ledModing, false);
 }
 
@@ -994,7 +1181,9 @@ static void SystemState_LedGameStatusToggleTimerCallback(TimerHandle_t xTimer)
 static void SystemState_PeerSongCooldownTimerCallback(TimerHandle_t xTimer)
 {
     SystemState* systemState = SystemState_GetInstance();
+    taskENTER_CRITICAL(&systemState->peerSongLock);
     systemState->peerSongWaitingCooldown = false;
+    taskEXIT_CRITICAL(&systemState->peerSongLock);
 }
 
 static void SystemState_NetworkTestNotificationHandler(void *pObj, esp_event_base_t eventBase, int32_t notificationEvent, void *notificationData)
@@ -1024,10 +1213,16 @@ static void SystemState_SongNoteChangeNotificationHandler(void *pObj, esp_event_
         case SONG_NOTE_CHANGE_TYPE_SONG_STOP:
             ESP_LOGI(TAG, "Song Stop Notification Received");
             LedModing_SetSongActiveStatusActive(&this->ledModing, false);
-            if (this->peerSongPlaying)
+            taskENTER_CRITICAL(&this->peerSongLock);
+            bool peerSongEnded = this->peerSongPlaying;
+            if (peerSongEnded)
             {
                 this->peerSongPlaying = false;
                 this->peerSongWaitingCooldown = true;
+            }
+            taskEXIT_CRITICAL(&this->peerSongLock);
+            if (peerSongEnded)
+            {
                 if (SystemState_ResetPeerSongCooldownTimer(this) != ESP_OK)
                 {
                     ESP_LOGE(TAG, "Failed to reset peer song cooldown timer");
@@ -1054,17 +1249,21 @@ static void SystemState_InteractiveGameNotificationHandler(void *pObj, esp_event
     SystemState *this = (SystemState *)pObj;
     assert(this);
     InteractiveGameData touchSensorsToLightBits = *((InteractiveGameData *) notificationData);
-    if (this->interactiveGameTouchSensorsToLightBits.s.active == false && touchSensorsToLightBits.s.active)
+    taskENTER_CRITICAL(&this->menuLock);
+    bool wasActive = this->interactiveGameTouchSensorsToLightBits.s.active;
+    this->interactiveGameTouchSensorsToLightBits.u = touchSensorsToLightBits.u;
+    taskEXIT_CRITICAL(&this->menuLock);
+
+    if (wasActive == false && touchSensorsToLightBits.s.active)
     {
         LedModing_SetInteractiveGameActive(&this->ledModing, true);
         SynthMode_SetTouchSoundEnabled(&this->synthMode, true, 2);
     }
-    else if (this->interactiveGameTouchSensorsToLightBits.s.active && touchSensorsToLightBits.s.active == false)
+    else if (wasActive && touchSensorsToLightBits.s.active == false)
     {
         LedModing_SetInteractiveGameActive(&this->ledModing, false);
         SynthMode_SetTouchSoundEnabled(&this->synthMode, false, 0);
     }
-    this->interactiveGameTouchSensorsToLightBits.u = touchSensorsToLightBits.u;
 }
 
 static void SystemState_PeerHeartbeatNotificationHandler(void *pObj, esp_event_base_t eventBase, int32_t notificationEvent, void *notificationData)
@@ -1083,16 +1282,10 @@ static void SystemState_PeerHeartbeatNotificationHandler(void *pObj, esp_event_b
                     break;
                 }
 
-                bool *pSeen = hashmap_get(&this->httpGameClient.siblingMap, peerReport.badgeIdB64);
-                if (pSeen != NULL)
+                if (HTTPGameClient_MarkSiblingSeen(&this->httpGameClient, peerReport.badgeIdB64))
                 {
-                    if (*pSeen)
-                    {
-                        ESP_LOGD(TAG, "Subling already seen, skipping song play");
-                        break;
-                    }
-
-                    *pSeen = true;
+                    ESP_LOGD(TAG, "Subling already seen, skipping song play");
+                    break;
                 }
 
                 int rssiThreshold = -60;
@@ -1120,15 +1313,24 @@ static void SystemState_PeerHeartbeatNotificationHandler(void *pObj, esp_event_b
                         break;
                 }
 
-                if (this->peerSongPlaying == false && peerReport.peakRssi > rssiThreshold && this->peerSongWaitingCooldown == false)
+                if (peerReport.peakRssi > rssiThreshold)
                 {
-                    if (peerReport.badgeType != BADGE_TYPE_UNKNOWN)
+                    // Song stop clears peerSongPlaying on the high lane, so test and set under the lock
+                    bool playPeerSong = false;
+                    taskENTER_CRITICAL(&this->peerSongLock);
+                    if (this->peerSongPlaying == false && this->peerSongWaitingCooldown == false && peerReport.badgeType != BADGE_TYPE_UNKNOWN)
                     {
-                        ESP_LOGI(TAG, "Playing Peer Song for badge type %d", peerReport.badgeType);
                         this->peerSongPlaying = true;
+                        playPeerSong = true;
+                    }
+                    taskEXIT_CRITICAL(&this->peerSongLock);
+
+                    if (playPeerSong)
+                    {
+                        ESP_LOGI(TAG, "Playing Peer Song for badge type %d", peerReport.badgeType);
                         NotificationDispatcher_NotifyEvent(&this->notificationDispatcher, NOTIFICATION_EVENTS_PLAY_SONG, &successPlaySongNotificationData, sizeof(successPlaySongNotificationData), DEFAULT_NOTIFY_WAIT_DURATION);
                     }
-                    else
+                    else if (peerReport.badgeType == BADGE_TYPE_UNKNOWN)
                     {
                         ESP_LOGI(TAG, "Peer Badge type unknown, skipping song play");
                     }
@@ -0,0 +1,98 @@
+#include "InitGraph.h"
+#include "NotificationDispatcher.h"
+
+#define STEP(step)      INIT_GRAPH_STEP_BIT(INIT_STEP_##step)
+#define EVENT(event)    INIT_GRAPH_EVENT_BIT(NOTIFICATION_EVENTS_##event)
+
+// LedControl waits on LedSequences because the selected sequence may be a custom one read from disk.
+// BleControl reads the badge id from UserSettings and FileTransfer keeps a pointer into GameState.
+// WiFi waits for BLE because concurrent radio, coexistence and PHY init is not documented as safe.
+// The rest of the dependencies put every handler of an event before the steps that post it.
+// SystemState registers its own handlers after the graph, so they are not listed. The GameState
+// task is started after them too, and its handlers only reply to OCARINA_SONG_MATCHED and
+// WIFI_HEARTBEAT_RESPONSE_RECV, whose posters already wait for every handler of those replies
+const InitGraphStep SystemStateInitSteps[INIT_STEP_COUNT] =
+{
+    [INIT_STEP_BATTERY] =
+    {
+        .name = "battery",
+    },
+    [INIT_STEP_USER_SETTINGS] =
+    {
+        .name = "user_settings",
+        .dependsOn = STEP(BATTERY),
+    },
+    [INIT_STEP_LED_SEQUENCES] =
+    {
+        .name = "led_sequences",
+        .dependsOn = STEP(BATTERY),
+    },
+    [INIT_STEP_BADGE_STATS] =
+    {
+        .name = "badge_stats",
+        .dependsOn = STEP(BATTERY),
+    },
+    [INIT_STEP_GAME_STATE] =
+    {
+        .name = "game_state",
+        .dependsOn = STEP(BADGE_STATS) | STEP(USER_SETTINGS),
+        .handlesEvents = EVENT(BLE_PEER_HEARTBEAT_DETECTED) | EVENT(WIFI_HEARTBEAT_RESPONSE_RECV) | EVENT(SEND_HEARTBEAT) | EVENT(OCARINA_SONG_MATCHED),
+    },
+    [INIT_STEP_BLE] =
+    {
+        .name = "ble",
+        .dependsOn = STEP(USER_SETTINGS) | STEP(GAME_STATE) | STEP(LED_CONTROL),
+        .postsEvents = EVENT(BLE_PEER_HEARTBEAT_DETECTED) | EVENT(BLE_SERVICE_ENABLED) | EVENT(BLE_SERVICE_DISABLED) |
+                       EVENT(BLE_SERVICE_CONNECTED) | EVENT(BLE_SERVICE_DISCONNECTED) | EVENT(BLE_DROPPED) |
+                       EVENT(BLE_FILE_SERVICE_PERCENT_CHANGED) | EVENT(BLE_FILE_COMPLETE) | EVENT(BLE_FILE_FAILED) |
+                       EVENT(BLE_FILE_SETTINGS_RECVD) | EVENT(BLE_FILE_LEDJSON_RECVD) | EVENT(BLE_NEW_PAIR_RECV) |
+                       EVENT(INTERACTIVE_GAME_ACTION),
+    },
+    [INIT_STEP_GPIO] =
+    {
+        .name = "gpio",
+    },
+    [INIT_STEP_TOUCH] =
+    {
+        .name = "touch",
+        .dependsOn = STEP(SYNTH),
+        .handlesEvents = EVENT(TOUCH_SENSE_ACTION),
+        .postsEvents = EVENT(TOUCH_SENSE_ACTION) | EVENT(TOUCH_ACTION_CMD),
+    },
+    [INIT_STEP_LED_CONTROL] =
+    {
+        .name = "led_control",
+        .dependsOn = STEP(LED_SEQUENCES) | STEP(GAME_STATE),
+        .handlesEvents = EVENT(TOUCH_SENSE_ACTION) | EVENT(SONG_NOTE_ACTION) | EVENT(GAME_EVENT_JOINED) |
+                         EVENT(BLE_FILE_SERVICE_PERCENT_CHANGED) | EVENT(INTERACTIVE_GAME_ACTION),
+    },
+    [INIT_STEP_WIFI] =
+    {
+        .name = "wifi",
+        .dependsOn = STEP(USER_SETTINGS) | STEP(BLE),
+        .postsEvents = EVENT(NETWORK_TEST_COMPLETE),
+    },
+    [INIT_STEP_SYNTH] =
+    {
+        .name = "synth",
+        .dependsOn = STEP(USER_SETTINGS) | STEP(LED_CONTROL) | STEP(GAME_STATE),
+        .handlesEvents = EVENT(PLAY_SONG) | EVENT(TOUCH_SENSE_ACTION),
+        .postsEvents = EVENT(SONG_NOTE_ACTION) | EVENT(PLAY_SONG) | EVENT(OCARINA_SONG_MATCHED),
+    },
+    [INIT_STEP_OTA] =
+    {
+        .name = "ota",
+        .dependsOn = STEP(WIFI),
+        .postsEvents = EVENT(OTA_REQUIRED) | EVENT(OTA_DOWNLOAD_INITIATED) | EVENT(OTA_DOWNLOAD_COMPLETE),
+    },
+    [INIT_STEP_HTTP] =
+    {
+        .name = "http",
+        .dependsOn = STEP(WIFI) | STEP(SYNTH),
+        .handlesEvents = EVENT(WIFI_HEARTBEAT_READY_TO_SEND),
+        .postsEvents = EVENT(PLAY_SONG) | EVENT(WIFI_HEARTBEAT_RESPONSE_RECV),
+    },
+};
+
+_Static_assert(INIT_STEP_COUNT <= INIT_GRAPH_MAX_STEPS, "Too many init steps for the event group");
+_Static_assert(NOTIFICATION_EVENTS_COUNT <= 64, "Notification events no longer fit the step event masks");
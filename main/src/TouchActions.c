@@ -5,14 +5,300 @@
 #include "TouchActions.h"
 #include "NotificationDispatcher.h"
 
+#define TOUCH_PAD_BIT(pad) (1 << (pad))
+
+// Pads in padMask must be held at pressClass or later, every other pad released.
+// Pads also in exactPadMask must be held at exactly pressClass
+typedef struct TouchGesture_t
+{
+    uint16_t padMask;
+    uint16_t exactPadMask;
+    TouchSensorEvent pressClass;
+    TouchActionsCmd cmd;
+} TouchGesture;
+
 // Internal Function Declarations
 static esp_err_t CommandDetected(TouchActions *this, TouchActionsCmd touchActionCmd);
 static void TouchSensorNotificationHandler(void *pObj, esp_event_base_t eventBase, int32_t notificationEvent, void *notificationData);
 static void ReportTouchActionCommands(TouchActions *this);
+static void TouchActions_BuildGestureLookup(TouchActions *this);
+static bool TouchActions_GestureMatches(TouchActions *this, const TouchGesture *pGesture);
 
 // Internal Constants
 static const char * TAG = "ACT";
 
+#if defined(TRON_BADGE)
+static const TouchGesture TOUCH_GESTURES[] =
+{
+    {
+        .padMask      = 0,
+        .exactPadMask = 0,
+        .pressClass   = TOUCH_SENSOR_EVENT_RELEASED,
+        .cmd          = TOUCH_ACTIONS_CMD_CLEAR,
+    },
+    {
+        .padMask      = TOUCH_PAD_BIT(TOUCH_SENSOR_8_OCLOCK) |
+                        TOUCH_PAD_BIT(TOUCH_SENSOR_11_OCLOCK),
+        .exactPadMask = 0,
+        .pressClass   = TOUCH_SENSOR_EVENT_TOUCHED,
+        .cmd          = TOUCH_ACTIONS_CMD_DISPLAY_VOLTAGE_METER,
+    },
+    {
+        .padMask      = TOUCH_PAD_BIT(TOUCH_SENSOR_12_OCLOCK) |
+                        TOUCH_PAD_BIT(TOUCH_SENSOR_8_OCLOCK),
+        .exactPadMask = 0,
+        .pressClass   = TOUCH_SENSOR_EVENT_TOUCHED,
+        .cmd          = TOUCH_ACTIONS_CMD_ENABLE_BLE_PAIRING,
+    },
+    {
+        .padMask      = TOUCH_PAD_BIT(TOUCH_SENSOR_12_OCLOCK) |
+                        TOUCH_PAD_BIT(TOUCH_SENSOR_11_OCLOCK),
+        .exactPadMask = 0,
+        .pressClass   = TOUCH_SENSOR_EVENT_TOUCHED,
+        .cmd          = TOUCH_ACTIONS_CMD_DISABLE_BLE_PAIRING,
+    },
+    {
+        .padMask      = TOUCH_PAD_BIT(TOUCH_SENSOR_2_OCLOCK) |
+                        TOUCH_PAD_BIT(TOUCH_SENSOR_7_OCLOCK),
+        .exactPadMask = 0,
+        .pressClass   = TOUCH_SENSOR_EVENT_TOUCHED,
+        .cmd          = TOUCH_ACTIONS_CMD_NEXT_LED_SEQUENCE,
+    },
+};
+#elif defined(REACTOR_BADGE)
+static const TouchGesture TOUCH_GESTURES[] =
+{
+    {
+        .padMask      = 0,
+        .exactPadMask = 0,
+        .pressClass   = TOUCH_SENSOR_EVENT_RELEASED,
+        .cmd          = TOUCH_ACTIONS_CMD_CLEAR,
+    },
+    {
+        .padMask      = TOUCH_PAD_BIT(TOUCH_SENSOR_2_OCLOCK) |
+                        TOUCH_PAD_BIT(TOUCH_SENSOR_4_OCLOCK) |
+                        TOUCH_PAD_BIT(TOUCH_SENSOR_8_OCLOCK) |
+                        TOUCH_PAD_BIT(TOUCH_SENSOR_10_OCLOCK),
+        .exactPadMask = 0,
+        .pressClass   = TOUCH_SENSOR_EVENT_SHORT_PRESSED,
+        .cmd          = TOUCH_ACTIONS_CMD_ENABLE_TOUCH,
+    },
+    {
+        .padMask      = TOUCH_PAD_BIT(TOUCH_SENSOR_1_OCLOCK) |
+                        TOUCH_PAD_BIT(TOUCH_SENSOR_11_OCLOCK),
+        .exactPadMask = TOUCH_PAD_BIT(TOUCH_SENSOR_1_OCLOCK) |
+                        TOUCH_PAD_BIT(TOUCH_SENSOR_11_OCLOCK),
+        .pressClass   = TOUCH_SENSOR_EVENT_TOUCHED,
+        .cmd          = TOUCH_ACTIONS_CMD_DISPLAY_VOLTAGE_METER,
+    },
+    {
+        .padMask      = TOUCH_PAD_BIT(TOUCH_SENSOR_2_OCLOCK) |
+                        TOUCH_PAD_BIT(TOUCH_SENSOR_10_OCLOCK),
+        .exactPadMask = TOUCH_PAD_BIT(TOUCH_SENSOR_2_OCLOCK),
+        .pressClass   = TOUCH_SENSOR_EVENT_TOUCHED,
+        .cmd          = TOUCH_ACTIONS_CMD_NEXT_LED_SEQUENCE,
+    },
+    {
+        .padMask      = TOUCH_PAD_BIT(TOUCH_SENSOR_4_OCLOCK) |
+                        TOUCH_PAD_BIT(TOUCH_SENSOR_10_OCLOCK),
+        .exactPadMask = TOUCH_PAD_BIT(TOUCH_SENSOR_4_OCLOCK),
+        .pressClass   = TOUCH_SENSOR_EVENT_TOUCHED,
+        .cmd          = TOUCH_ACTIONS_CMD_PREV_LED_SEQUENCE,
+    },
+    {
+        .padMask      = TOUCH_PAD_BIT(TOUCH_SENSOR_2_OCLOCK) |
+                        TOUCH_PAD_BIT(TOUCH_SENSOR_8_OCLOCK),
+        .exactPadMask = TOUCH_PAD_BIT(TOUCH_SENSOR_2_OCLOCK),
+        .pressClass   = TOUCH_SENSOR_EVENT_TOUCHED,
+        .cmd          = TOUCH_ACTIONS_CMD_ENABLE_BLE_PAIRING,
+    },
+    {
+        .padMask      = TOUCH_PAD_BIT(TOUCH_SENSOR_4_OCLOCK) |
+                        TOUCH_PAD_BIT(TOUCH_SENSOR_8_OCLOCK),
+        .exactPadMask = TOUCH_PAD_BIT(TOUCH_SENSOR_4_OCLOCK),
+        .pressClass   = TOUCH_SENSOR_EVENT_TOUCHED,
+        .cmd          = TOUCH_ACTIONS_CMD_DISABLE_BLE_PAIRING,
+    },
+    {
+        .padMask      = TOUCH_PAD_BIT(TOUCH_SENSOR_4_OCLOCK) |
+                        TOUCH_PAD_BIT(TOUCH_SENSOR_5_OCLOCK) |
+                        TOUCH_PAD_BIT(TOUCH_SENSOR_7_OCLOCK) |
+                        TOUCH_PAD_BIT(TOUCH_SENSOR_8_OCLOCK),
+        .exactPadMask = TOUCH_PAD_BIT(TOUCH_SENSOR_4_OCLOCK) |
+                        TOUCH_PAD_BIT(TOUCH_SENSOR_5_OCLOCK) |
+                        TOUCH_PAD_BIT(TOUCH_SENSOR_7_OCLOCK),
+        .pressClass   = TOUCH_SENSOR_EVENT_TOUCHED,
+        .cmd          = TOUCH_ACTIONS_CMD_TOGGLE_SYNTH_MODE_ENABLE,
+    },
+    {
+        .padMask      = TOUCH_PAD_BIT(TOUCH_SENSOR_5_OCLOCK) |
+                        TOUCH_PAD_BIT(TOUCH_SENSOR_7_OCLOCK),
+        .exactPadMask = TOUCH_PAD_BIT(TOUCH_SENSOR_5_OCLOCK) |
+                        TOUCH_PAD_BIT(TOUCH_SENSOR_7_OCLOCK),
+        .pressClass   = TOUCH_SENSOR_EVENT_TOUCHED,
+        .cmd          = TOUCH_ACTIONS_CMD_NETWORK_TEST,
+    },
+};
+#elif defined(CREST_BADGE)
+static const TouchGesture TOUCH_GESTURES[] =
+{
+    {
+        .padMask      = 0,
+        .exactPadMask = 0,
+        .pressClass   = TOUCH_SENSOR_EVENT_RELEASED,
+        .cmd          = TOUCH_ACTIONS_CMD_CLEAR,
+    },
+    {
+        .padMask      = TOUCH_PAD_BIT(TOUCH_SENSOR_TAIL_FEATHER),
+        .exactPadMask = 0,
+        .pressClass   = TOUCH_SENSOR_EVENT_SHORT_PRESSED,
+        .cmd          = TOUCH_ACTIONS_CMD_ENABLE_TOUCH,
+    },
+    {
+        .padMask      = TOUCH_PAD_BIT(TOUCH_SENSOR_RIGHT_WING_FEATHER_3) |
+                        TOUCH_PAD_BIT(TOUCH_SENSOR_RIGHT_WING_FEATHER_2) |
+                        TOUCH_PAD_BIT(TOUCH_SENSOR_RIGHT_WING_FEATHER_1),
+        .exactPadMask = 0,
+        .pressClass   = TOUCH_SENSOR_EVENT_SHORT_PRESSED,
+        .cmd          = TOUCH_ACTIONS_CMD_DISABLE_TOUCH,
+    },
+    {
+        .padMask      = TOUCH_PAD_BIT(TOUCH_SENSOR_TAIL_FEATHER) |
+                        TOUCH_PAD_BIT(TOUCH_SENSOR_RIGHT_WING_FEATHER_1),
+        .exactPadMask = 0,
+        .pressClass   = TOUCH_SENSOR_EVENT_TOUCHED,
+        .cmd          = TOUCH_ACTIONS_CMD_DISPLAY_VOLTAGE_METER,
+    },
+    {
+        .padMask      = TOUCH_PAD_BIT(TOUCH_SENSOR_LEFT_WING_FEATHER_1) |
+                        TOUCH_PAD_BIT(TOUCH_SENSOR_RIGHT_WING_FEATHER_1),
+        .exactPadMask = TOUCH_PAD_BIT(TOUCH_SENSOR_LEFT_WING_FEATHER_1),
+        .pressClass   = TOUCH_SENSOR_EVENT_TOUCHED,
+        .cmd          = TOUCH_ACTIONS_CMD_NEXT_LED_SEQUENCE,
+    },
+    {
+        .padMask      = TOUCH_PAD_BIT(TOUCH_SENSOR_LEFT_WING_FEATHER_2) |
+                        TOUCH_PAD_BIT(TOUCH_SENSOR_RIGHT_WING_FEATHER_1),
+        .exactPadMask = TOUCH_PAD_BIT(TOUCH_SENSOR_LEFT_WING_FEATHER_2),
+        .pressClass   = TOUCH_SENSOR_EVENT_TOUCHED,
+        .cmd          = TOUCH_ACTIONS_CMD_PREV_LED_SEQUENCE,
+    },
+    {
+        .padMask      = TOUCH_PAD_BIT(TOUCH_SENSOR_LEFT_WING_FEATHER_1) |
+                        TOUCH_PAD_BIT(TOUCH_SENSOR_TAIL_FEATHER),
+        .exactPadMask = 0,
+        .pressClass   = TOUCH_SENSOR_EVENT_TOUCHED,
+        .cmd          = TOUCH_ACTIONS_CMD_ENABLE_BLE_PAIRING,
+    },
+    {
+        .padMask      = TOUCH_PAD_BIT(TOUCH_SENSOR_LEFT_WING_FEATHER_2) |
+                        TOUCH_PAD_BIT(TOUCH_SENSOR_TAIL_FEATHER),
+        .exactPadMask = 0,
+        .pressClass   = TOUCH_SENSOR_EVENT_TOUCHED,
+        .cmd          = TOUCH_ACTIONS_CMD_DISABLE_BLE_PAIRING,
+    },
+    {
+        .padMask      = TOUCH_PAD_BIT(TOUCH_SENSOR_LEFT_WING_FEATHER_4) |
+                        TOUCH_PAD_BIT(TOUCH_SENSOR_RIGHT_WING_FEATHER_4),
+        .exactPadMask = 0,
+        .pressClass   = TOUCH_SENSOR_EVENT_TOUCHED,
+        .cmd          = TOUCH_ACTIONS_CMD_TOGGLE_SYNTH_MODE_ENABLE,
+    },
+    {
+        .padMask      = TOUCH_PAD_BIT(TOUCH_SENSOR_LEFT_WING_FEATHER_4) |
+                        TOUCH_PAD_BIT(TOUCH_SENSOR_TAIL_FEATHER) |
+                        TOUCH_PAD_BIT(TOUCH_SENSOR_RIGHT_WING_FEATHER_4),
+        .exactPadMask = 0,
+        .pressClass   = TOUCH_SENSOR_EVENT_TOUCHED,
+        .cmd          = TOUCH_ACTIONS_CMD_NETWORK_TEST,
+    },
+};
+#elif defined(FMAN25_BADGE)
+static const TouchGesture TOUCH_GESTURES[] =
+{
+    {
+        .padMask      = 0,
+        .exactPadMask = 0,
+        .pressClass   = TOUCH_SENSOR_EVENT_RELEASED,
+        .cmd          = TOUCH_ACTIONS_CMD_CLEAR,
+    },
+    {
+        .padMask      = TOUCH_PAD_BIT(TOUCH_SENSOR_CENTER_TOUCH),
+        .exactPadMask = 0,
+        .pressClass   = TOUCH_SENSOR_EVENT_SHORT_PRESSED,
+        .cmd          = TOUCH_ACTIONS_CMD_ENABLE_TOUCH,
+    },
+    {
+        .padMask      = TOUCH_PAD_BIT(TOUCH_SENSOR_LEFT_TOUCH_4) |
+                        TOUCH_PAD_BIT(TOUCH_SENSOR_CENTER_TOUCH) |
+                        TOUCH_PAD_BIT(TOUCH_SENSOR_RIGHT_TOUCH_4),
+        .exactPadMask = TOUCH_PAD_BIT(TOUCH_SENSOR_LEFT_TOUCH_4) |
+                        TOUCH_PAD_BIT(TOUCH_SENSOR_CENTER_TOUCH) |
+                        TOUCH_PAD_BIT(TOUCH_SENSOR_RIGHT_TOUCH_4),
+        .pressClass   = TOUCH_SENSOR_EVENT_SHORT_PRESSED,
+        .cmd          = TOUCH_ACTIONS_CMD_DISABLE_TOUCH,
+    },
+    {
+        .padMask      = TOUCH_PAD_BIT(TOUCH_SENSOR_CENTER_TOUCH) |
+                        TOUCH_PAD_BIT(TOUCH_SENSOR_RIGHT_TOUCH_2),
+        .exactPadMask = TOUCH_PAD_BIT(TOUCH_SENSOR_RIGHT_TOUCH_2),
+        .pressClass   = TOUCH_SENSOR_EVENT_TOUCHED,
+        .cmd          = TOUCH_ACTIONS_CMD_DISPLAY_VOLTAGE_METER,
+    },
+    {
+        .padMask      = TOUCH_PAD_BIT(TOUCH_SENSOR_CENTER_TOUCH) |
+                        TOUCH_PAD_BIT(TOUCH_SENSOR_RIGHT_TOUCH_1),
+        .exactPadMask = 0,
+        .pressClass   = TOUCH_SENSOR_EVENT_TOUCHED,
+        .cmd          = TOUCH_ACTIONS_CMD_NEXT_LED_SEQUENCE,
+    },
+    {
+        .padMask      = TOUCH_PAD_BIT(TOUCH_SENSOR_LEFT_TOUCH_1) |
+                        TOUCH_PAD_BIT(TOUCH_SENSOR_CENTER_TOUCH),
+        .exactPadMask = TOUCH_PAD_BIT(TOUCH_SENSOR_LEFT_TOUCH_1),
+        .pressClass   = TOUCH_SENSOR_EVENT_TOUCHED,
+        .cmd          = TOUCH_ACTIONS_CMD_PREV_LED_SEQUENCE,
+    },
+    {
+        .padMask      = TOUCH_PAD_BIT(TOUCH_SENSOR_CENTER_TOUCH) |
+                        TOUCH_PAD_BIT(TOUCH_SENSOR_RIGHT_TOUCH_3),
+        .exactPadMask = TOUCH_PAD_BIT(TOUCH_SENSOR_RIGHT_TOUCH_3),
+        .pressClass   = TOUCH_SENSOR_EVENT_TOUCHED,
+        .cmd          = TOUCH_ACTIONS_CMD_ENABLE_BLE_PAIRING,
+    },
+    {
+        .padMask      = TOUCH_PAD_BIT(TOUCH_SENSOR_LEFT_TOUCH_3) |
+                        TOUCH_PAD_BIT(TOUCH_SENSOR_CENTER_TOUCH),
+        .exactPadMask = TOUCH_PAD_BIT(TOUCH_SENSOR_LEFT_TOUCH_3),
+        .pressClass   = TOUCH_SENSOR_EVENT_TOUCHED,
+        .cmd          = TOUCH_ACTIONS_CMD_DISABLE_BLE_PAIRING,
+    },
+    {
+        .padMask      = TOUCH_PAD_BIT(TOUCH_SENSOR_LEFT_TOUCH_1) |
+                        TOUCH_PAD_BIT(TOUCH_SENSOR_RIGHT_TOUCH_1),
+        .exactPadMask = TOUCH_PAD_BIT(TOUCH_SENSOR_LEFT_TOUCH_1) |
+                        TOUCH_PAD_BIT(TOUCH_SENSOR_RIGHT_TOUCH_1),
+        .pressClass   = TOUCH_SENSOR_EVENT_TOUCHED,
+        .cmd          = TOUCH_ACTIONS_CMD_TOGGLE_SYNTH_MODE_ENABLE,
+    },
+    {
+        .padMask      = TOUCH_PAD_BIT(TOUCH_SENSOR_LEFT_TOUCH_2) |
+                        TOUCH_PAD_BIT(TOUCH_SENSOR_CENTER_TOUCH),
+        .exactPadMask = TOUCH_PAD_BIT(TOUCH_SENSOR_LEFT_TOUCH_2),
+        .pressClass   = TOUCH_SENSOR_EVENT_TOUCHED,
+        .cmd          = TOUCH_ACTIONS_CMD_NETWORK_TEST,
+    },
+};
+#endif
+
+#define NUM_TOUCH_GESTURES ((int)(sizeof(TOUCH_GESTURES) / sizeof(TOUCH_GESTURES[0])))
+_Static_assert(NUM_TOUCH_GESTURES < TOUCH_ACTIONS_GESTURE_SLOTS / 2, "Gesture lookup needs to stay at most half full");
+_Static_assert(TOUCH_SENSOR_NUM_BUTTONS <= 16, "Pad masks are 16 bits");
+
+static inline int GestureSlot(uint16_t padMask)
+{
+    return (padMask ^ (padMask >> 5)) & (TOUCH_ACTIONS_GESTURE_SLOTS - 1);
+}
 
 esp_err_t TouchActions_Init(TouchActions *this, NotificationDispatcher *pNotificationDispatcher)
 {
@@ -23,10 +309,25 @@ esp_err_t TouchActions_Init(TouchActions *this, NotificationDispatcher *pNotific
     {
         this->touchSensorValue[i] = TOUCH_SENSOR_EVENT_RELEASED;
     }
+    TouchActions_BuildGestureLookup(this);
 
     return NotificationDispatcher_RegisterNotificationEventHandler(this->pNotificationDispatcher, NOTIFICATION_EVENTS_TOUCH_SENSE_ACTION, &TouchSensorNotificationHandler, this);
 }
 
+// Open addressed by pad mask. Slots hold the gesture index plus one so zero means empty
+static void TouchActions_BuildGestureLookup(TouchActions *this)
+{
+    for (int i = 0; i < NUM_TOUCH_GESTURES; i++)
+    {
+        int slot = GestureSlot(TOUCH_GESTURES[i].padMask);
+        while (this->gestureSlots[slot] != 0)
+        {
+            slot = (slot + 1) & (TOUCH_ACTIONS_GESTURE_SLOTS - 1);
+        }
+        this->gestureSlots[slot] = i + 1;
+    }
+}
+
 static esp_err_t CommandDetected(TouchActions *this, TouchActionsCmd touchActionCmd)
 {
     ESP_LOGD(TAG, "Command Detected: %d", touchActionCmd);
@@ -35,423 +336,32 @@ static esp_err_t CommandDetected(TouchActions *this, TouchActionsCmd touchAction
     return ret;
 }
 
+static bool TouchActions_GestureMatches(TouchActions *this, const TouchGesture *pGesture)
+{
+    uint16_t pads = pGesture->padMask;
+    while (pads != 0)
+    {
+        int pad = __builtin_ctz(pads);
+        pads &= pads - 1;
+        bool exact = (pGesture->exactPadMask & TOUCH_PAD_BIT(pad)) != 0;
+        if (exact ? (this->touchSensorValue[pad] != pGesture->pressClass) : (this->touchSensorValue[pad] < pGesture->pressClass))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 static void ReportTouchActionCommands(TouchActions *this)
 {
-#if defined(TRON_BADGE)
-    if ((this->touchSensorValue[TOUCH_SENSOR_12_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED)  &&
-        (this->touchSensorValue[TOUCH_SENSOR_1_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)  &&
-        (this->touchSensorValue[TOUCH_SENSOR_2_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)  &&
-        (this->touchSensorValue[TOUCH_SENSOR_4_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)  &&
-        (this->touchSensorValue[TOUCH_SENSOR_5_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)  &&
-        (this->touchSensorValue[TOUCH_SENSOR_7_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)  &&
-        (this->touchSensorValue[TOUCH_SENSOR_8_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)  &&
-        (this->touchSensorValue[TOUCH_SENSOR_10_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED)  &&
-        (this->touchSensorValue[TOUCH_SENSOR_11_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED))
-    {
-        CommandDetected(this, TOUCH_ACTIONS_CMD_CLEAR);
-    }
-    if ((this->touchSensorValue[TOUCH_SENSOR_12_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_1_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_2_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_4_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_5_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_7_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_8_OCLOCK]  >= TOUCH_SENSOR_EVENT_TOUCHED)        &&
-        (this->touchSensorValue[TOUCH_SENSOR_10_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_11_OCLOCK] >= TOUCH_SENSOR_EVENT_TOUCHED))
-    {
-        CommandDetected(this, TOUCH_ACTIONS_CMD_DISPLAY_VOLTAGE_METER);
-    }
-    if ((this->touchSensorValue[TOUCH_SENSOR_12_OCLOCK] >= TOUCH_SENSOR_EVENT_TOUCHED)        &&
-        (this->touchSensorValue[TOUCH_SENSOR_1_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_2_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_4_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_5_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_7_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_8_OCLOCK]  >= TOUCH_SENSOR_EVENT_TOUCHED)        &&
-        (this->touchSensorValue[TOUCH_SENSOR_10_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_11_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED))
-    {
-        CommandDetected(this, TOUCH_ACTIONS_CMD_ENABLE_BLE_PAIRING);
-    }
-    if ((this->touchSensorValue[TOUCH_SENSOR_12_OCLOCK] >= TOUCH_SENSOR_EVENT_TOUCHED)        &&
-        (this->touchSensorValue[TOUCH_SENSOR_1_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_2_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_4_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_5_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_7_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_8_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_10_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_11_OCLOCK] >= TOUCH_SENSOR_EVENT_TOUCHED))
-    {
-        CommandDetected(this, TOUCH_ACTIONS_CMD_DISABLE_BLE_PAIRING);
-    }
-    if ((this->touchSensorValue[TOUCH_SENSOR_12_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_1_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_2_OCLOCK]  >= TOUCH_SENSOR_EVENT_TOUCHED)        && 
-        (this->touchSensorValue[TOUCH_SENSOR_4_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_5_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_7_OCLOCK]  >= TOUCH_SENSOR_EVENT_TOUCHED)        &&
-        (this->touchSensorValue[TOUCH_SENSOR_8_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_10_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_11_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED))
-    {
-        CommandDetected(this, TOUCH_ACTIONS_CMD_NEXT_LED_SEQUENCE);
-    }
-#elif defined(REACTOR_BADGE)
-    if ((this->touchSensorValue[TOUCH_SENSOR_12_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED)  &&
-        (this->touchSensorValue[TOUCH_SENSOR_1_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)  &&
-        (this->touchSensorValue[TOUCH_SENSOR_2_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)  &&
-        (this->touchSensorValue[TOUCH_SENSOR_4_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)  &&
-        (this->touchSensorValue[TOUCH_SENSOR_5_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)  &&
-        (this->touchSensorValue[TOUCH_SENSOR_7_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)  &&
-        (this->touchSensorValue[TOUCH_SENSOR_8_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)  &&
-        (this->touchSensorValue[TOUCH_SENSOR_10_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED)  &&
-        (this->touchSensorValue[TOUCH_SENSOR_11_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED))
-    {
-        CommandDetected(this, TOUCH_ACTIONS_CMD_CLEAR);
-    }
-    if ((this->touchSensorValue[TOUCH_SENSOR_12_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED)      &&
-        (this->touchSensorValue[TOUCH_SENSOR_1_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)      &&
-        (this->touchSensorValue[TOUCH_SENSOR_2_OCLOCK]  >= TOUCH_SENSOR_EVENT_SHORT_PRESSED) &&
-        (this->touchSensorValue[TOUCH_SENSOR_4_OCLOCK]  >= TOUCH_SENSOR_EVENT_SHORT_PRESSED) &&
-        (this->touchSensorValue[TOUCH_SENSOR_5_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)      &&
-        (this->touchSensorValue[TOUCH_SENSOR_7_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)      &&
-        (this->touchSensorValue[TOUCH_SENSOR_8_OCLOCK]  >= TOUCH_SENSOR_EVENT_SHORT_PRESSED) &&
-        (this->touchSensorValue[TOUCH_SENSOR_10_OCLOCK] >= TOUCH_SENSOR_EVENT_SHORT_PRESSED) &&
-        (this->touchSensorValue[TOUCH_SENSOR_11_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED))
-    {
-        CommandDetected(this, TOUCH_ACTIONS_CMD_ENABLE_TOUCH);
-    }
-    if ((this->touchSensorValue[TOUCH_SENSOR_12_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_1_OCLOCK]  == TOUCH_SENSOR_EVENT_TOUCHED)        &&
-        (this->touchSensorValue[TOUCH_SENSOR_2_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_4_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_5_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_7_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_8_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_10_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_11_OCLOCK] == TOUCH_SENSOR_EVENT_TOUCHED))
-    {
-        CommandDetected(this, TOUCH_ACTIONS_CMD_DISPLAY_VOLTAGE_METER);
-    }
-    if ((this->touchSensorValue[TOUCH_SENSOR_12_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_1_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_2_OCLOCK]  == TOUCH_SENSOR_EVENT_TOUCHED)        && 
-        (this->touchSensorValue[TOUCH_SENSOR_4_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_5_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_7_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_8_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_10_OCLOCK] >= TOUCH_SENSOR_EVENT_TOUCHED)        &&
-        (this->touchSensorValue[TOUCH_SENSOR_11_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED))
-    {
-        CommandDetected(this, TOUCH_ACTIONS_CMD_NEXT_LED_SEQUENCE);
-    }
-    if ((this->touchSensorValue[TOUCH_SENSOR_12_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_1_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_2_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_4_OCLOCK]  == TOUCH_SENSOR_EVENT_TOUCHED)        &&
-        (this->touchSensorValue[TOUCH_SENSOR_5_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_7_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_8_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_10_OCLOCK] >= TOUCH_SENSOR_EVENT_TOUCHED)        &&
-        (this->touchSensorValue[TOUCH_SENSOR_11_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED))
-    {
-        CommandDetected(this, TOUCH_ACTIONS_CMD_PREV_LED_SEQUENCE);
-    }
-    if ((this->touchSensorValue[TOUCH_SENSOR_12_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_1_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_2_OCLOCK]  == TOUCH_SENSOR_EVENT_TOUCHED)        &&
-        (this->touchSensorValue[TOUCH_SENSOR_4_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_5_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_7_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_8_OCLOCK]  >= TOUCH_SENSOR_EVENT_TOUCHED)        &&
-        (this->touchSensorValue[TOUCH_SENSOR_10_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_11_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED))
-    {
-        CommandDetected(this, TOUCH_ACTIONS_CMD_ENABLE_BLE_PAIRING);
-    }
-    if ((this->touchSensorValue[TOUCH_SENSOR_12_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_1_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_2_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_4_OCLOCK]  == TOUCH_SENSOR_EVENT_TOUCHED)        &&
-        (this->touchSensorValue[TOUCH_SENSOR_5_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_7_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_8_OCLOCK]  >= TOUCH_SENSOR_EVENT_TOUCHED)        &&
-        (this->touchSensorValue[TOUCH_SENSOR_10_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_11_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED))
-    {
-        CommandDetected(this, TOUCH_ACTIONS_CMD_DISABLE_BLE_PAIRING);
-    }
-    if ((this->touchSensorValue[TOUCH_SENSOR_12_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_1_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_2_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_4_OCLOCK]  == TOUCH_SENSOR_EVENT_TOUCHED)        &&
-        (this->touchSensorValue[TOUCH_SENSOR_5_OCLOCK]  == TOUCH_SENSOR_EVENT_TOUCHED)        &&
-        (this->touchSensorValue[TOUCH_SENSOR_7_OCLOCK]  == TOUCH_SENSOR_EVENT_TOUCHED)        &&
-        (this->touchSensorValue[TOUCH_SENSOR_8_OCLOCK]  >= TOUCH_SENSOR_EVENT_TOUCHED)        &&
-        (this->touchSensorValue[TOUCH_SENSOR_10_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_11_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED))
-    {
-        CommandDetected(this, TOUCH_ACTIONS_CMD_TOGGLE_SYNTH_MODE_ENABLE);
-    }
-    if ((this->touchSensorValue[TOUCH_SENSOR_12_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_1_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_2_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_4_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_5_OCLOCK]  == TOUCH_SENSOR_EVENT_TOUCHED)        &&
-        (this->touchSensorValue[TOUCH_SENSOR_7_OCLOCK]  == TOUCH_SENSOR_EVENT_TOUCHED)        &&
-        (this->touchSensorValue[TOUCH_SENSOR_8_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_10_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_11_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED))
-    {
-        CommandDetected(this, TOUCH_ACTIONS_CMD_NETWORK_TEST);
-    }
-#elif defined(CREST_BADGE)
-    if ((this->touchSensorValue[TOUCH_SENSOR_LEFT_WING_FEATHER_1]  == TOUCH_SENSOR_EVENT_RELEASED)  &&
-        (this->touchSensorValue[TOUCH_SENSOR_LEFT_WING_FEATHER_2]  == TOUCH_SENSOR_EVENT_RELEASED)  &&
-        (this->touchSensorValue[TOUCH_SENSOR_LEFT_WING_FEATHER_3]  == TOUCH_SENSOR_EVENT_RELEASED)  &&
-        (this->touchSensorValue[TOUCH_SENSOR_LEFT_WING_FEATHER_4]  == TOUCH_SENSOR_EVENT_RELEASED)  &&
-        (this->touchSensorValue[TOUCH_SENSOR_TAIL_FEATHER]         == TOUCH_SENSOR_EVENT_RELEASED)  &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_WING_FEATHER_4] == TOUCH_SENSOR_EVENT_RELEASED)  &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_WING_FEATHER_3] == TOUCH_SENSOR_EVENT_RELEASED)  &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_WING_FEATHER_2] == TOUCH_SENSOR_EVENT_RELEASED)  &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_WING_FEATHER_1] == TOUCH_SENSOR_EVENT_RELEASED))
-    {
-        CommandDetected(this, TOUCH_ACTIONS_CMD_CLEAR);
-    }
-    if ((this->touchSensorValue[TOUCH_SENSOR_LEFT_WING_FEATHER_1]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_LEFT_WING_FEATHER_2]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_LEFT_WING_FEATHER_3]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_LEFT_WING_FEATHER_4]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_TAIL_FEATHER]         >= TOUCH_SENSOR_EVENT_SHORT_PRESSED)  &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_WING_FEATHER_4] == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_WING_FEATHER_3] == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_WING_FEATHER_2] == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_WING_FEATHER_1] == TOUCH_SENSOR_EVENT_RELEASED))
-    {
-        CommandDetected(this, TOUCH_ACTIONS_CMD_ENABLE_TOUCH);
-    }
-    if ((this->touchSensorValue[TOUCH_SENSOR_LEFT_WING_FEATHER_1]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_LEFT_WING_FEATHER_2]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_LEFT_WING_FEATHER_3]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_LEFT_WING_FEATHER_4]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_TAIL_FEATHER]         == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_WING_FEATHER_4] == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_WING_FEATHER_3] >= TOUCH_SENSOR_EVENT_SHORT_PRESSED)  &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_WING_FEATHER_2] >= TOUCH_SENSOR_EVENT_SHORT_PRESSED)  &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_WING_FEATHER_1] >= TOUCH_SENSOR_EVENT_SHORT_PRESSED))
-    {
-        CommandDetected(this, TOUCH_ACTIONS_CMD_DISABLE_TOUCH);
-    }
-    if ((this->touchSensorValue[TOUCH_SENSOR_LEFT_WING_FEATHER_1]  == TOUCH_SENSOR_EVENT_RELEASED)       && 
-        (this->touchSensorValue[TOUCH_SENSOR_LEFT_WING_FEATHER_2]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_LEFT_WING_FEATHER_3]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_LEFT_WING_FEATHER_4]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_TAIL_FEATHER]         >= TOUCH_SENSOR_EVENT_TOUCHED)        &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_WING_FEATHER_4] == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_WING_FEATHER_3] == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_WING_FEATHER_2] == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_WING_FEATHER_1] >= TOUCH_SENSOR_EVENT_TOUCHED))
-    {
-        CommandDetected(this, TOUCH_ACTIONS_CMD_DISPLAY_VOLTAGE_METER);
-    }
-    if ((this->touchSensorValue[TOUCH_SENSOR_LEFT_WING_FEATHER_1]  == TOUCH_SENSOR_EVENT_TOUCHED)        && 
-        (this->touchSensorValue[TOUCH_SENSOR_LEFT_WING_FEATHER_2]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_LEFT_WING_FEATHER_3]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_LEFT_WING_FEATHER_4]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_TAIL_FEATHER]         == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_WING_FEATHER_4] == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_WING_FEATHER_3] == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_WING_FEATHER_2] == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_WING_FEATHER_1] >= TOUCH_SENSOR_EVENT_TOUCHED))
-    {
-        CommandDetected(this, TOUCH_ACTIONS_CMD_NEXT_LED_SEQUENCE);
-    }
-    if ((this->touchSensorValue[TOUCH_SENSOR_LEFT_WING_FEATHER_1]  == TOUCH_SENSOR_EVENT_RELEASED)       && 
-        (this->touchSensorValue[TOUCH_SENSOR_LEFT_WING_FEATHER_2]  == TOUCH_SENSOR_EVENT_TOUCHED)        &&
-        (this->touchSensorValue[TOUCH_SENSOR_LEFT_WING_FEATHER_3]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_LEFT_WING_FEATHER_4]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_TAIL_FEATHER]         == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_WING_FEATHER_4] == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_WING_FEATHER_3] == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_WING_FEATHER_2] == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_WING_FEATHER_1] >= TOUCH_SENSOR_EVENT_TOUCHED))
-    {
-        CommandDetected(this, TOUCH_ACTIONS_CMD_PREV_LED_SEQUENCE);
-    }
-    if ((this->touchSensorValue[TOUCH_SENSOR_LEFT_WING_FEATHER_1]  >= TOUCH_SENSOR_EVENT_TOUCHED)        && 
-        (this->touchSensorValue[TOUCH_SENSOR_LEFT_WING_FEATHER_2]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_LEFT_WING_FEATHER_3]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_LEFT_WING_FEATHER_4]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_TAIL_FEATHER]         >= TOUCH_SENSOR_EVENT_TOUCHED)        &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_WING_FEATHER_4] == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_WING_FEATHER_3] == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_WING_FEATHER_2] == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_WING_FEATHER_1] == TOUCH_SENSOR_EVENT_RELEASED))
-    {
-        CommandDetected(this, TOUCH_ACTIONS_CMD_ENABLE_BLE_PAIRING);
-    }
-    if ((this->touchSensorValue[TOUCH_SENSOR_LEFT_WING_FEATHER_1]  == TOUCH_SENSOR_EVENT_RELEASED)       && 
-        (this->touchSensorValue[TOUCH_SENSOR_LEFT_WING_FEATHER_2]  >= TOUCH_SENSOR_EVENT_TOUCHED)        &&
-        (this->touchSensorValue[TOUCH_SENSOR_LEFT_WING_FEATHER_3]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_LEFT_WING_FEATHER_4]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_TAIL_FEATHER]         >= TOUCH_SENSOR_EVENT_TOUCHED)        &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_WING_FEATHER_4] == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_WING_FEATHER_3] == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_WING_FEATHER_2] == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_WING_FEATHER_1] == TOUCH_SENSOR_EVENT_RELEASED))
-    {
-        CommandDetected(this, TOUCH_ACTIONS_CMD_DISABLE_BLE_PAIRING);
-    }
-    if ((this->touchSensorValue[TOUCH_SENSOR_LEFT_WING_FEATHER_1]  == TOUCH_SENSOR_EVENT_RELEASED)      && 
-        (this->touchSensorValue[TOUCH_SENSOR_LEFT_WING_FEATHER_2]  == TOUCH_SENSOR_EVENT_RELEASED)      &&
-        (this->touchSensorValue[TOUCH_SENSOR_LEFT_WING_FEATHER_3]  == TOUCH_SENSOR_EVENT_RELEASED)      &&
-        (this->touchSensorValue[TOUCH_SENSOR_LEFT_WING_FEATHER_4]  >= TOUCH_SENSOR_EVENT_TOUCHED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_TAIL_FEATHER]         == TOUCH_SENSOR_EVENT_RELEASED)      &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_WING_FEATHER_4] >= TOUCH_SENSOR_EVENT_TOUCHED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_WING_FEATHER_3] == TOUCH_SENSOR_EVENT_RELEASED)      &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_WING_FEATHER_2] == TOUCH_SENSOR_EVENT_RELEASED)      &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_WING_FEATHER_1] == TOUCH_SENSOR_EVENT_RELEASED)
-        )
-    {
-        CommandDetected(this, TOUCH_ACTIONS_CMD_TOGGLE_SYNTH_MODE_ENABLE);
-    }
-    if ((this->touchSensorValue[TOUCH_SENSOR_LEFT_WING_FEATHER_1]  == TOUCH_SENSOR_EVENT_RELEASED)       && 
-        (this->touchSensorValue[TOUCH_SENSOR_LEFT_WING_FEATHER_2]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_LEFT_WING_FEATHER_3]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_LEFT_WING_FEATHER_4]  >= TOUCH_SENSOR_EVENT_TOUCHED)        &&
-        (this->touchSensorValue[TOUCH_SENSOR_TAIL_FEATHER]         >= TOUCH_SENSOR_EVENT_TOUCHED)        &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_WING_FEATHER_4] >= TOUCH_SENSOR_EVENT_TOUCHED)        &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_WING_FEATHER_3] == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_WING_FEATHER_2] == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_WING_FEATHER_1] == TOUCH_SENSOR_EVENT_RELEASED))
-    {
-        CommandDetected(this, TOUCH_ACTIONS_CMD_NETWORK_TEST);
-    }
-#elif defined(FMAN25_BADGE)
-    if ((this->touchSensorValue[TOUCH_SENSOR_LEFT_TOUCH_1]  == TOUCH_SENSOR_EVENT_RELEASED)  &&
-        (this->touchSensorValue[TOUCH_SENSOR_LEFT_TOUCH_2]  == TOUCH_SENSOR_EVENT_RELEASED)  &&
-        (this->touchSensorValue[TOUCH_SENSOR_LEFT_TOUCH_3]  == TOUCH_SENSOR_EVENT_RELEASED)  &&
-        (this->touchSensorValue[TOUCH_SENSOR_LEFT_TOUCH_4]  == TOUCH_SENSOR_EVENT_RELEASED)  &&
-        (this->touchSensorValue[TOUCH_SENSOR_CENTER_TOUCH]  == TOUCH_SENSOR_EVENT_RELEASED)  &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_TOUCH_4] == TOUCH_SENSOR_EVENT_RELEASED)  &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_TOUCH_3] == TOUCH_SENSOR_EVENT_RELEASED)  &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_TOUCH_2] == TOUCH_SENSOR_EVENT_RELEASED)  &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_TOUCH_1] == TOUCH_SENSOR_EVENT_RELEASED))
-    {
-        CommandDetected(this, TOUCH_ACTIONS_CMD_CLEAR);
-    }
-    if ((this->touchSensorValue[TOUCH_SENSOR_LEFT_TOUCH_1]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_LEFT_TOUCH_2]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_LEFT_TOUCH_3]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_LEFT_TOUCH_4]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_CENTER_TOUCH]  >= TOUCH_SENSOR_EVENT_SHORT_PRESSED)  &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_TOUCH_4] == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_TOUCH_3] == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_TOUCH_2] == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_TOUCH_1] == TOUCH_SENSOR_EVENT_RELEASED))
-    {
-        CommandDetected(this, TOUCH_ACTIONS_CMD_ENABLE_TOUCH);
-    }
-    if ((this->touchSensorValue[TOUCH_SENSOR_LEFT_TOUCH_1]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_LEFT_TOUCH_2]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_LEFT_TOUCH_3]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_LEFT_TOUCH_4]  == TOUCH_SENSOR_EVENT_SHORT_PRESSED)  &&
-        (this->touchSensorValue[TOUCH_SENSOR_CENTER_TOUCH]  == TOUCH_SENSOR_EVENT_SHORT_PRESSED)  &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_TOUCH_4] == TOUCH_SENSOR_EVENT_SHORT_PRESSED)  &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_TOUCH_3] == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_TOUCH_2] == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_TOUCH_1] == TOUCH_SENSOR_EVENT_RELEASED))
-    {
-        CommandDetected(this, TOUCH_ACTIONS_CMD_DISABLE_TOUCH);
-    }
-    if ((this->touchSensorValue[TOUCH_SENSOR_LEFT_TOUCH_1]  == TOUCH_SENSOR_EVENT_RELEASED)       && 
-        (this->touchSensorValue[TOUCH_SENSOR_LEFT_TOUCH_2]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_LEFT_TOUCH_3]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_LEFT_TOUCH_4]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_CENTER_TOUCH]  >= TOUCH_SENSOR_EVENT_TOUCHED)        &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_TOUCH_4] == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_TOUCH_3] == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_TOUCH_2] == TOUCH_SENSOR_EVENT_TOUCHED)        &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_TOUCH_1] == TOUCH_SENSOR_EVENT_RELEASED))
-    {
-        CommandDetected(this, TOUCH_ACTIONS_CMD_DISPLAY_VOLTAGE_METER);
-    }
-    if ((this->touchSensorValue[TOUCH_SENSOR_LEFT_TOUCH_1]  == TOUCH_SENSOR_EVENT_RELEASED)       && 
-        (this->touchSensorValue[TOUCH_SENSOR_LEFT_TOUCH_2]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_LEFT_TOUCH_3]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_LEFT_TOUCH_4]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_CENTER_TOUCH]  >= TOUCH_SENSOR_EVENT_TOUCHED)        &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_TOUCH_4] == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_TOUCH_3] == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_TOUCH_2] == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_TOUCH_1] >= TOUCH_SENSOR_EVENT_TOUCHED))
-    {
-        CommandDetected(this, TOUCH_ACTIONS_CMD_NEXT_LED_SEQUENCE);
-    }
-    if ((this->touchSensorValue[TOUCH_SENSOR_LEFT_TOUCH_1]  == TOUCH_SENSOR_EVENT_TOUCHED)        && 
-        (this->touchSensorValue[TOUCH_SENSOR_LEFT_TOUCH_2]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_LEFT_TOUCH_3]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_LEFT_TOUCH_4]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_CENTER_TOUCH]  >= TOUCH_SENSOR_EVENT_TOUCHED)        &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_TOUCH_4] == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_TOUCH_3] == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_TOUCH_2] == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_TOUCH_1] == TOUCH_SENSOR_EVENT_RELEASED))
-    {
-        CommandDetected(this, TOUCH_ACTIONS_CMD_PREV_LED_SEQUENCE);
-    }
-    if ((this->touchSensorValue[TOUCH_SENSOR_LEFT_TOUCH_1]  == TOUCH_SENSOR_EVENT_RELEASED)       && 
-        (this->touchSensorValue[TOUCH_SENSOR_LEFT_TOUCH_2]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_LEFT_TOUCH_3]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_LEFT_TOUCH_4]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_CENTER_TOUCH]  >= TOUCH_SENSOR_EVENT_TOUCHED)        &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_TOUCH_4] == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_TOUCH_3] == TOUCH_SENSOR_EVENT_TOUCHED)        &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_TOUCH_2] == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_TOUCH_1] == TOUCH_SENSOR_EVENT_RELEASED))
-    {
-        CommandDetected(this, TOUCH_ACTIONS_CMD_ENABLE_BLE_PAIRING);
-    }
-    if ((this->touchSensorValue[TOUCH_SENSOR_LEFT_TOUCH_1]  == TOUCH_SENSOR_EVENT_RELEASED)       && 
-        (this->touchSensorValue[TOUCH_SENSOR_LEFT_TOUCH_2]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_LEFT_TOUCH_3]  == TOUCH_SENSOR_EVENT_TOUCHED)        &&
-        (this->touchSensorValue[TOUCH_SENSOR_LEFT_TOUCH_4]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_CENTER_TOUCH]  >= TOUCH_SENSOR_EVENT_TOUCHED)        &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_TOUCH_4] == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_TOUCH_3] == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_TOUCH_2] == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_TOUCH_1] == TOUCH_SENSOR_EVENT_RELEASED))
-    {
-        CommandDetected(this, TOUCH_ACTIONS_CMD_DISABLE_BLE_PAIRING);
-    }
-    if ((this->touchSensorValue[TOUCH_SENSOR_LEFT_TOUCH_1]  == TOUCH_SENSOR_EVENT_TOUCHED)       && 
-        (this->touchSensorValue[TOUCH_SENSOR_LEFT_TOUCH_2]  == TOUCH_SENSOR_EVENT_RELEASED)      &&
-        (this->touchSensorValue[TOUCH_SENSOR_LEFT_TOUCH_3]  == TOUCH_SENSOR_EVENT_RELEASED)      &&
-        (this->touchSensorValue[TOUCH_SENSOR_LEFT_TOUCH_4]  == TOUCH_SENSOR_EVENT_RELEASED)      &&
-        (this->touchSensorValue[TOUCH_SENSOR_CENTER_TOUCH]  == TOUCH_SENSOR_EVENT_RELEASED)      &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_TOUCH_4] == TOUCH_SENSOR_EVENT_RELEASED)      &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_TOUCH_3] == TOUCH_SENSOR_EVENT_RELEASED)      &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_TOUCH_2] == TOUCH_SENSOR_EVENT_RELEASED)      &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_TOUCH_1] == TOUCH_SENSOR_EVENT_TOUCHED)
-        )
-    {
-        CommandDetected(this, TOUCH_ACTIONS_CMD_TOGGLE_SYNTH_MODE_ENABLE);
-    }
-    if ((this->touchSensorValue[TOUCH_SENSOR_LEFT_TOUCH_1]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_LEFT_TOUCH_2]  == TOUCH_SENSOR_EVENT_TOUCHED)        &&
-        (this->touchSensorValue[TOUCH_SENSOR_LEFT_TOUCH_3]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_LEFT_TOUCH_4]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_CENTER_TOUCH]  >= TOUCH_SENSOR_EVENT_TOUCHED)        &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_TOUCH_4] == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_TOUCH_3] == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_TOUCH_2] == TOUCH_SENSOR_EVENT_RELEASED)       &&
-        (this->touchSensorValue[TOUCH_SENSOR_RIGHT_TOUCH_1] == TOUCH_SENSOR_EVENT_RELEASED))
-    {
-        CommandDetected(this, TOUCH_ACTIONS_CMD_NETWORK_TEST);
+    for (int slot = GestureSlot(this->pressedPadMask); this->gestureSlots[slot] != 0; slot = (slot + 1) & (TOUCH_ACTIONS_GESTURE_SLOTS - 1))
+    {
+        const TouchGesture *pGesture = &TOUCH_GESTURES[this->gestureSlots[slot] - 1];
+        if (pGesture->padMask == this->pressedPadMask && TouchActions_GestureMatches(this, pGesture))
+        {
+            CommandDetected(this, pGesture->cmd);
+        }
     }
-#endif
 }
 
 static void TouchSensorNotificationHandler(void *pObj, esp_event_base_t eventBase, int32_t notificationEvent, void *notificationData)
@@ -463,6 +373,14 @@ static void TouchSensorNotificationHandler(void *pObj, esp_event_base_t eventBas
     TouchSensorEventNotificationData touchNotificationData = *(TouchSensorEventNotificationData *)notificationData;
     
     this->touchSensorValue[touchNotificationData.touchSensorIdx] = touchNotificationData.touchSensorEvent;
+    if (touchNotificationData.touchSensorEvent == TOUCH_SENSOR_EVENT_RELEASED)
+    {
+        this->pressedPadMask &= ~TOUCH_PAD_BIT(touchNotificationData.touchSensorIdx);
+    }
+    else
+    {
+        this->pressedPadMask |= TOUCH_PAD_BIT(touchNotificationData.touchSensorIdx);
+    }
     ESP_LOGD(TAG, "Touch Sensor Notification. %d: %d", touchNotificationData.touchSensorIdx, touchNotificationData.touchSensorEvent);
 
     ReportTouchActionCommands(this);
@@ -0,0 +1,97 @@
+#include <assert.h>
+#include <stdlib.h>
+
+#include "TouchPadFilter.h"
+#include "Utilities.h"
+
+#define TOUCH_MIN_ACTIVE_DELTA               (60)   // Smallest drop below the baseline that counts as a touch
+#define TOUCH_ACTIVE_BASELINE_SHIFT          (3)    // Touch delta is at least 1/8 of the baseline
+#define TOUCH_NOISE_MARGIN                   (4)    // Touch delta is at least this many times the average noise
+#define TOUCH_BASELINE_SHIFT                 (4)    // Baseline EMA weight of 1/16
+#define TOUCH_BASELINE_MAX_FALL_Q4           (16)   // Downward drift is limited to one count per sample
+#define TOUCH_NOISE_SHIFT                    (3)    // Noise EMA weight of 1/8
+
+// Internal Function Declarations
+static void TouchPadFilter_UpdateThresholds(TouchPadFilter *this);
+
+void TouchPadFilter_Reset(TouchPadFilter *this, uint16_t value)
+{
+    assert(this);
+    this->baselineQ4 = (uint32_t)value << 4;
+    this->noiseQ4 = 0;
+    this->lastValue = value;
+    this->historyIdx = 0;
+    for (int i = 0; i < TOUCH_PAD_FILTER_HISTORY_SIZE; i++)
+    {
+        this->history[i] = value;
+    }
+    TouchPadFilter_UpdateThresholds(this);
+}
+
+// Median of the last three samples, which drops single sample spikes for one sample of delay
+uint16_t TouchPadFilter_FilterSample(TouchPadFilter *this, uint16_t value)
+{
+    assert(this);
+    this->history[this->historyIdx] = value;
+    this->historyIdx = (this->historyIdx + 1) % TOUCH_PAD_FILTER_HISTORY_SIZE;
+
+    uint16_t a = this->history[0];
+    uint16_t b = this->history[1];
+    uint16_t c = this->history[2];
+    return MAX(MIN(a, b), MIN(MAX(a, b), c));
+}
+
+// Touches only ever pull the value down, so falls are slew limited while rises are followed freely
+void TouchPadFilter_TrackBaseline(TouchPadFilter *this, uint16_t value)
+{
+    assert(this);
+    int32_t valueQ4 = (int32_t)value << 4;
+    int32_t step = (valueQ4 - (int32_t)this->baselineQ4) / (1 << TOUCH_BASELINE_SHIFT);
+    this->baselineQ4 += MAX(step, -TOUCH_BASELINE_MAX_FALL_Q4);
+
+    // Noise is the change between tracked samples. Measured against the baseline, a slow approach
+    // that outruns the fall limit reads as noise and pushes the touch threshold out of reach
+    int32_t deviationQ4 = abs(valueQ4 - ((int32_t)this->lastValue << 4));
+    this->noiseQ4 += (deviationQ4 - (int32_t)this->noiseQ4) / (1 << TOUCH_NOISE_SHIFT);
+    this->lastValue = value;
+
+    TouchPadFilter_UpdateThresholds(this);
+}
+
+bool TouchPadFilter_Update(TouchPadFilter *this, uint16_t rawValue, bool touched, uint16_t *pFilteredValue)
+{
+    assert(this);
+    uint16_t filteredValue = TouchPadFilter_FilterSample(this, rawValue);
+    if (pFilteredValue)
+    {
+        *pFilteredValue = filteredValue;
+    }
+
+    // Below the touch threshold means touch, back above the release threshold means release
+    if (!touched && filteredValue < this->touchThreshold)
+    {
+        return true;
+    }
+    if (!touched)
+    {
+        // Samples in the hysteresis band may be a finger on its way in, keep them out of the baseline
+        if (filteredValue >= this->releaseThreshold)
+        {
+            TouchPadFilter_TrackBaseline(this, filteredValue);
+        }
+        return false;
+    }
+    return filteredValue <= this->releaseThreshold;
+}
+
+// Touch delta scales with the baseline and the measured noise. Release sits halfway back for hysteresis
+static void TouchPadFilter_UpdateThresholds(TouchPadFilter *this)
+{
+    uint32_t baseline = this->baselineQ4 >> 4;
+    uint32_t touchDelta = MAX((uint32_t)TOUCH_MIN_ACTIVE_DELTA, baseline >> TOUCH_ACTIVE_BASELINE_SHIFT);
+    touchDelta = MAX(touchDelta, (this->noiseQ4 * TOUCH_NOISE_MARGIN) >> 4);
+    touchDelta = MIN(touchDelta, baseline);
+
+    this->touchThreshold = baseline - touchDelta;
+    this->releaseThreshold = baseline - touchDelta / 2;
+}
@@ -5,6 +5,7 @@
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "esp_log.h"
+#include "esp_timer.h"
 #include "driver/touch_sensor.h"
 #include "TimeUtils.h"
 
@@ -17,10 +18,11 @@
 #define TOUCH_THRESHOLD_NONE 0
 #define TOUCH_FILTER_MODE_EN 1
 #define TOUCH_FILTER_PERIOD_MS 50                   // Changing to meet CPU0 watchdog
+#define TOUCH_FILTER_SETTLE_MS (TOUCH_FILTER_PERIOD_MS * 4)
 
 // Touch sensor settings
-#define TOUCH_ACTIVE_DELTA_THRESHOLD         (150)
-#define TOUCH_SAMPLE_PERIOD_MS               (100)
+#define TOUCH_ACTIVE_SAMPLE_PERIOD_MS        (20)
+#define TOUCH_IDLE_SAMPLE_PERIOD_MS          (1000) // Idle wakeups let the baseline follow drift
 #define TOUCH_SHORT_PRESS_THRESHOLD          (1000)
 #define TOUCH_LONG_PRESS_THRESHOLD           (3000)
 #define TOUCH_SUPER_LONG_PRESS_THRESHOLD     (5000)
@@ -28,7 +30,12 @@
 
 // Internal Function Declarations
 static void TouchSensorTask(void *pvParameters);
-static esp_err_t MonitorTouchSensors(TouchSensor *this);
+static void TouchSensor_InterruptHandler(void *arg);
+static esp_err_t TouchSensor_Calibrate(TouchSensor *this);
+static void TouchSensor_ResetPadFilter(TouchSensor *this, int touchSensorIdx, uint16_t value);
+static void TouchSensor_ApplyThreshold(TouchSensor *this, int touchSensorIdx);
+static bool MonitorTouchSensors(TouchSensor *this);
+static esp_err_t TouchSensor_Notify(TouchSensor *this, int touchSensorIdx, TouchSensorEvent touchSensorEvent);
 
 // Internal Constants
 static const char * TOUCH_TAG = "TCH";
@@ -53,10 +60,13 @@ esp_err_t TouchSensor_Init(TouchSensor *this, NotificationDispatcher *pNotificat
 
     this->pNotificationDispatcher = pNotificationDispatcher;
 
-    // Defaults to software trigger mode
     ret = touch_pad_init();
     ESP_ERROR_CHECK(ret);
 
+    // The hardware measures every pad on its own timer so thresholds can raise an interrupt
+    ret = touch_pad_set_fsm_mode(TOUCH_FSM_MODE_TIMER);
+    ESP_ERROR_CHECK(ret);
+
     // Set reference voltage for charging/discharging
     // High will be 2.7V
     // Low will be 0.5V
@@ -76,18 +86,96 @@ esp_err_t TouchSensor_Init(TouchSensor *this, NotificationDispatcher *pNotificat
     ret = touch_pad_filter_start(TOUCH_FILTER_PERIOD_MS);
     ESP_ERROR_CHECK(ret);
 
-    assert(xTaskCreatePinnedToCore(TouchSensorTask, "TouchSensorTask", configMINIMAL_STACK_SIZE * 2, this, TOUCH_SENSOR_TASK_PRIORITY, NULL, APP_CPU_NUM) == pdPASS);
+    ret = touch_pad_set_trigger_mode(TOUCH_TRIGGER_BELOW);
+    ESP_ERROR_CHECK(ret);
+    ret = touch_pad_set_trigger_source(TOUCH_TRIGGER_SOURCE_SET1);
+    ESP_ERROR_CHECK(ret);
+    ret = touch_pad_isr_register(TouchSensor_InterruptHandler, this);
+    ESP_ERROR_CHECK(ret);
+
+    assert(xTaskCreatePinnedToCore(TouchSensorTask, "TouchSensorTask", configMINIMAL_STACK_SIZE * 2, this, TOUCH_SENSOR_TASK_PRIORITY, &this->taskHandle, TOUCH_SENSOR_TASK_CORE) == pdPASS);
     return ret;
 }
 
+// Sleeps until a pad crosses its threshold, then samples quickly until every pad is released.
+// An idle timeout also samples now and then so baselines keep up with drift
 static void TouchSensorTask(void *pvParameters)
 {
     TouchSensor *this = (TouchSensor *)pvParameters;
     assert(this);
+
+    ESP_ERROR_CHECK(TouchSensor_Calibrate(this));
+    bool anyActive = false;
     while (true)
     {
-        MonitorTouchSensors(this);
-        vTaskDelay(pdMS_TO_TICKS(TOUCH_SAMPLE_PERIOD_MS));
+        if (anyActive)
+        {
+            vTaskDelay(pdMS_TO_TICKS(TOUCH_ACTIVE_SAMPLE_PERIOD_MS));
+        }
+        else
+        {
+            this->interruptTimeUs = 0;
+            touch_pad_intr_enable();
+            ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(TOUCH_IDLE_SAMPLE_PERIOD_MS));
+        }
+        anyActive = MonitorTouchSensors(this);
+    }
+}
+
+// The interrupt repeats every measurement while a pad is held, so it stays off until the task goes idle again
+static void IRAM_ATTR TouchSensor_InterruptHandler(void *arg)
+{
+    TouchSensor *this = (TouchSensor *)arg;
+    BaseType_t higherPriorityTaskWoken = pdFALSE;
+
+    touch_pad_clear_status();
+    touch_pad_intr_disable();
+    this->interruptTimeUs = esp_timer_get_time();
+    vTaskNotifyGiveFromISR(this->taskHandle, &higherPriorityTaskWoken);
+    if (higherPriorityTaskWoken)
+    {
+        portYIELD_FROM_ISR();
+    }
+}
+
+// Seeds each pad's baseline from its settled filtered value
+static esp_err_t TouchSensor_Calibrate(TouchSensor *this)
+{
+    esp_err_t ret = ESP_OK;
+    vTaskDelay(pdMS_TO_TICKS(TOUCH_FILTER_SETTLE_MS));
+
+    for (int i = 0; i < TOUCH_SENSOR_NUM_BUTTONS && ret == ESP_OK; i++)
+    {
+        uint16_t filteredValue = 0;
+        ret = touch_pad_read_filtered(TOUCH_BUTTON_MAP[i], &filteredValue);
+        if (ret == ESP_OK)
+        {
+            TouchSensor_ResetPadFilter(this, i, filteredValue);
+            ESP_LOGI(TOUCH_TAG, "Touch %d baseline %d threshold %d", i, filteredValue, this->padFilter[i].touchThreshold);
+        }
+    }
+
+    if (ret != ESP_OK)
+    {
+        ESP_LOGE(TOUCH_TAG, "Touch calibration failed. error code = %s", esp_err_to_name(ret));
+    }
+    return ret;
+}
+
+static void TouchSensor_ResetPadFilter(TouchSensor *this, int touchSensorIdx, uint16_t value)
+{
+    TouchPadFilter_Reset(&this->padFilter[touchSensorIdx], value);
+    TouchSensor_ApplyThreshold(this, touchSensorIdx);
+}
+
+// The filter moves its thresholds as the baseline tracks, only touch the hardware when it changes
+static void TouchSensor_ApplyThreshold(TouchSensor *this, int touchSensorIdx)
+{
+    uint16_t touchThreshold = this->padFilter[touchSensorIdx].touchThreshold;
+    if (touchThreshold != this->padThreshold[touchSensorIdx])
+    {
+        this->padThreshold[touchSensorIdx] = touchThreshold;
+        touch_pad_set_thresh(TOUCH_BUTTON_MAP[touchSensorIdx], touchThreshold);
     }
 }
 
@@ -98,153 +186,121 @@ esp_err_t TouchSensor_SetTouchEnabled(TouchSensor *this, bool enabled)
     return ESP_OK;
 }
 
-static esp_err_t MonitorTouchSensors(TouchSensor *this)
+void TouchSensor_GetLatencyStats(TouchSensor *this, TouchSensorLatencyStats *pStats)
+{
+    assert(this);
+    assert(pStats);
+    *pStats = this->latencyStats;
+}
+
+// Returns true while any pad is still active
+static bool MonitorTouchSensors(TouchSensor *this)
 {
     esp_err_t ret = ESP_OK;
     uint16_t touchSensorValue = 0;
-    uint16_t touchFilterValue = 0;
+    bool anyActive = false;
 
     assert(this);
 
     for (int i = 0; i < TOUCH_SENSOR_NUM_BUTTONS; i++)
     {
-        // reach touch pad raw and filtered values for mapped touch pad index
+        // read touch pad raw value for mapped touch pad index
         uint16_t mappedTouchButtonIndex = TOUCH_BUTTON_MAP[i];
         ret = touch_pad_read_raw_data(mappedTouchButtonIndex, &touchSensorValue);
         if (ret != ESP_OK)
         {
             ESP_LOGE(TOUCH_TAG, "touch_pad_read_raw_data error %s", esp_err_to_name(ret));
+            continue;
         }
-        ret = touch_pad_read_filtered(mappedTouchButtonIndex, &touchFilterValue);
-        if (ret != ESP_OK)
-        {
-            ESP_LOGE(TOUCH_TAG, "touch_pad_read_filtered error %s", esp_err_to_name(ret));
-        }
 
-        // compute and store delta value for the current index
-        int delta = 0;
-        if (this->prevTouchValue[i] > 0)
+        TickType_t curTime = xTaskGetTickCount();
+        TouchPadFilter *pFilter = &this->padFilter[i];
+        bool wasTouched = this->touchSensorActive[i] != TOUCH_SENSOR_EVENT_RELEASED;
+        uint16_t touchThreshold = pFilter->touchThreshold;
+        uint16_t filteredValue = 0;
+        bool touched = TouchPadFilter_Update(pFilter, touchSensorValue, wasTouched, &filteredValue);
+        TouchSensor_ApplyThreshold(this, i);
+
+        if (!wasTouched && touched)
         {
-            delta = touchSensorValue - this->prevTouchValue[i];
-        }
-        this->prevDeltaValues[i][this->prevDeltaValueCtr[i]] = delta;
-        this->prevDeltaValueCtr[i] = ((this->prevDeltaValueCtr[i] + 1) % DELTA_VALUE_HISTORY_SIZE);
+            ESP_LOGD(TOUCH_TAG, "Touch %d Pressed, value %d threshold %d", i, filteredValue, touchThreshold);
+            this->touchSensorActive[i] = TOUCH_SENSOR_EVENT_TOUCHED;
+            this->touchSensorActiveTimeStamp[i] = curTime;
+            TouchSensor_Notify(this, i, TOUCH_SENSOR_EVENT_TOUCHED);
 
-        // Sum all the previous values for the current index
-        int curTouchSensorValuesSum = 0;
-        for (int prev_delta_values_idx = 0; prev_delta_values_idx < DELTA_VALUE_HISTORY_SIZE; prev_delta_values_idx++)
+            if (this->interruptTimeUs != 0)
+            {
+                uint32_t latencyUs = (uint32_t)(esp_timer_get_time() - this->interruptTimeUs);
+                this->latencyStats.count++;
+                this->latencyStats.lastUs = latencyUs;
+                this->latencyStats.maxUs = MAX(this->latencyStats.maxUs, latencyUs);
+                this->latencyStats.totalUs += latencyUs;
+            }
+        }
+        else if (wasTouched && !touched)
         {
-            curTouchSensorValuesSum += this->prevDeltaValues[i][prev_delta_values_idx];
+            ESP_LOGD(TOUCH_TAG, "Touch %d Released, value %d threshold %d", i, filteredValue, pFilter->releaseThreshold);
+            this->touchSensorActive[i] = TOUCH_SENSOR_EVENT_RELEASED;
+            this->touchSensorActiveTimeStamp[i] = curTime;
+            TouchSensor_Notify(this, i, TOUCH_SENSOR_EVENT_RELEASED);
         }
-
-        // compute absolute value of the 
-        int absDeltaSum = abs(curTouchSensorValuesSum);
-
-        TickType_t curTime = xTaskGetTickCount();
-
-        // if the absolute value of the sum of the previous delta values is greater than the threshold, then it is considered a touch action (either touch or release)
-        if (absDeltaSum > TOUCH_ACTIVE_DELTA_THRESHOLD)
+        // if no touch action has been detected, check for short or long press on active touch pads
+        else if (touched)
         {
-            // negative delta means touch
-            if (delta < 0)
+            long elapsed_time_msec = TimeUtils_GetElapsedTimeMSec(this->touchSensorActiveTimeStamp[i]);
+            // if the touchpad has been aftive for longer than the short press threshold, then it is considered a short press
+            if (this->touchSensorActive[i] == TOUCH_SENSOR_EVENT_TOUCHED && 
+                elapsed_time_msec > TOUCH_SHORT_PRESS_THRESHOLD)
             {
-                if (this->touchSensorActive[i] == TOUCH_SENSOR_EVENT_RELEASED)
-                {
-                    ESP_LOGD(TOUCH_TAG, "Touch %d Pressed", i);
-                    this->touchSensorActive[i] = TOUCH_SENSOR_EVENT_TOUCHED;
-                    this->touchSensorActiveTimeStamp[i] = curTime;
-
-                    TouchSensorEventNotificationData notificationData = { .touchSensorIdx = i, .touchSensorEvent = TOUCH_SENSOR_EVENT_TOUCHED };
-                    ret = NotificationDispatcher_NotifyEvent(this->pNotificationDispatcher, NOTIFICATION_EVENTS_TOUCH_SENSE_ACTION, &notificationData, sizeof(notificationData), DEFAULT_NOTIFY_WAIT_DURATION);
-                    if (ret != ESP_OK)
-                    {
-                        ESP_LOGE(TOUCH_TAG, "NotificationDispatcher_NotifyEvent for TOUCH_SENSOR_EVENT_TOUCHED event error %d", ret);
-                    }
-                }
+                ESP_LOGD(TOUCH_TAG, "Touch %d Short Pressed", i);
+                this->touchSensorActive[i] = TOUCH_SENSOR_EVENT_SHORT_PRESSED;
+                TouchSensor_Notify(this, i, TOUCH_SENSOR_EVENT_SHORT_PRESSED);
             }
-            // positive delta means release
-            else
+            // if the touch pad has been active for longer than the long press threshold, then it is considered a long press
+            else if (this->touchSensorActive[i] == TOUCH_SENSOR_EVENT_SHORT_PRESSED && 
+                     elapsed_time_msec > TOUCH_LONG_PRESS_THRESHOLD)
             {
-                if (this->touchSensorActive[i] != TOUCH_SENSOR_EVENT_RELEASED)
-                {
-                    ESP_LOGD(TOUCH_TAG, "Touch %d Released", i);
-                    this->touchSensorActive[i] = TOUCH_SENSOR_EVENT_RELEASED;
-                    this->touchSensorActiveTimeStamp[i] = curTime;
-
-                    TouchSensorEventNotificationData notificationData = { .touchSensorIdx = i, .touchSensorEvent = TOUCH_SENSOR_EVENT_RELEASED };
-                    ret = NotificationDispatcher_NotifyEvent(this->pNotificationDispatcher, NOTIFICATION_EVENTS_TOUCH_SENSE_ACTION, &notificationData, sizeof(notificationData), DEFAULT_NOTIFY_WAIT_DURATION);
-                    if (ret != ESP_OK)
-                    {
-                        ESP_LOGE(TOUCH_TAG, "NotificationDispatcher_NotifyEvent for TOUCH_SENSOR_EVENT_RELEASED event error %d", ret);
-                    }
-                }
+                ESP_LOGD(TOUCH_TAG, "Touch %d Long Pressed", i);
+                this->touchSensorActive[i] = TOUCH_SENSOR_EVENT_LONG_PRESSED;
+                TouchSensor_Notify(this, i, TOUCH_SENSOR_EVENT_LONG_PRESSED);
+            }// if the touch pad has been active for longer than the super long press threshold, then it is considered a super long press
+            else if (this->touchSensorActive[i] == TOUCH_SENSOR_EVENT_LONG_PRESSED && 
+                     elapsed_time_msec > TOUCH_SUPER_LONG_PRESS_THRESHOLD)
+            {
+                ESP_LOGD(TOUCH_TAG, "Touch %d Super Long Pressed", i);
+                this->touchSensorActive[i] = TOUCH_SENSOR_EVENT_VERY_LONG_PRESSED;
+                TouchSensor_Notify(this, i, TOUCH_SENSOR_EVENT_VERY_LONG_PRESSED);
             }
-            ESP_LOGD(TOUCH_TAG, "Abs Delta: %d, Delta: %d, touchSensorValue: %d, touch_value_filtered: %d, sum: %d", absDeltaSum, delta, touchSensorValue, touchFilterValue, curTouchSensorValuesSum);
-        }
-        // if no touch action has been detected, check for short or long press on active touch pads
-        else
-        {
-            // if the touch pad is active, check for long press
-            if (this->touchSensorActive[i] != TOUCH_SENSOR_EVENT_RELEASED)
+            else if (this->touchSensorActive[i] == TOUCH_SENSOR_EVENT_VERY_LONG_PRESSED && 
+                     elapsed_time_msec > TOUCH_STUCK_RELEASE_THRESHOLD &&
+                     this->touchEnabled == false)
             {
-                long elapsed_time_msec = TimeUtils_GetElapsedTimeMSec(this->touchSensorActiveTimeStamp[i]);
-                // if the touchpad has been aftive for longer than the short press threshold, then it is considered a short press
-                if (this->touchSensorActive[i] == TOUCH_SENSOR_EVENT_TOUCHED && 
-                    elapsed_time_msec > TOUCH_SHORT_PRESS_THRESHOLD)
-                {
-                    ESP_LOGD(TOUCH_TAG, "Touch %d Short Pressed", i);
-                    this->touchSensorActive[i] = TOUCH_SENSOR_EVENT_SHORT_PRESSED;
-                    TouchSensorEventNotificationData notificationData = { .touchSensorIdx = i, .touchSensorEvent = TOUCH_SENSOR_EVENT_SHORT_PRESSED };
-                    ret = NotificationDispatcher_NotifyEvent(this->pNotificationDispatcher, NOTIFICATION_EVENTS_TOUCH_SENSE_ACTION, &notificationData, sizeof(notificationData), DEFAULT_NOTIFY_WAIT_DURATION);
-                    if (ret != ESP_OK)
-                    {
-                        ESP_LOGE(TOUCH_TAG, "NotificationDispatcher_NotifyEvent for TOUCH_SENSOR_EVENT_SHORT_PRESSED event error %d", ret);
-                    }
-                }
-                // if the touch pad has been active for longer than the long press threshold, then it is considered a long press
-                else if (this->touchSensorActive[i] == TOUCH_SENSOR_EVENT_SHORT_PRESSED && 
-                         elapsed_time_msec > TOUCH_LONG_PRESS_THRESHOLD)
-                {
-                    ESP_LOGD(TOUCH_TAG, "Touch %d Long Pressed", i);
-                    this->touchSensorActive[i] = TOUCH_SENSOR_EVENT_LONG_PRESSED;
-                    TouchSensorEventNotificationData notificationData = { .touchSensorIdx = i, .touchSensorEvent = TOUCH_SENSOR_EVENT_LONG_PRESSED };
-                    ret = NotificationDispatcher_NotifyEvent(this->pNotificationDispatcher, NOTIFICATION_EVENTS_TOUCH_SENSE_ACTION, &notificationData, sizeof(notificationData), DEFAULT_NOTIFY_WAIT_DURATION);
-                    if (ret != ESP_OK)
-                    {
-                        ESP_LOGE(TOUCH_TAG, "NotificationDispatcher_NotifyEvent for NOTIFICATION_EVENTS_BUTTON_LONG_PRESSED event error %d", ret);
-                    }
-                }// if the touch pad has been active for longer than the super long press threshold, then it is considered a super long press
-                else if (this->touchSensorActive[i] == TOUCH_SENSOR_EVENT_LONG_PRESSED && 
-                         elapsed_time_msec > TOUCH_SUPER_LONG_PRESS_THRESHOLD)
-                {
-                    ESP_LOGD(TOUCH_TAG, "Touch %d Super Long Pressed", i);
-                    this->touchSensorActive[i] = TOUCH_SENSOR_EVENT_VERY_LONG_PRESSED;
-                    TouchSensorEventNotificationData notificationData = { .touchSensorIdx = i, .touchSensorEvent = TOUCH_SENSOR_EVENT_VERY_LONG_PRESSED };
-                    NotificationDispatcher_NotifyEvent(this->pNotificationDispatcher, NOTIFICATION_EVENTS_TOUCH_SENSE_ACTION, &notificationData, sizeof(notificationData), DEFAULT_NOTIFY_WAIT_DURATION);
-                    if (ret != ESP_OK)
-                    {
-                        ESP_LOGE(TOUCH_TAG, "NotificationDispatcher_NotifyEvent for TOUCH_SENSOR_EVENT_VERY_LONG_PRESSED event error %d", ret);
-                    }
-                }
-                else if (this->touchSensorActive[i] == TOUCH_SENSOR_EVENT_VERY_LONG_PRESSED && 
-                         elapsed_time_msec > TOUCH_STUCK_RELEASE_THRESHOLD &&
-                         this->touchEnabled == false)
-                {
-                    ESP_LOGD(TOUCH_TAG, "Touch %d Released Unstuck", i);
-                    this->touchSensorActive[i] = TOUCH_SENSOR_EVENT_RELEASED;
-                    this->touchSensorActiveTimeStamp[i] = curTime;
-
-                    TouchSensorEventNotificationData notificationData = { .touchSensorIdx = i, .touchSensorEvent = TOUCH_SENSOR_EVENT_RELEASED };
-                    ret = NotificationDispatcher_NotifyEvent(this->pNotificationDispatcher, NOTIFICATION_EVENTS_TOUCH_SENSE_ACTION, &notificationData, sizeof(notificationData), DEFAULT_NOTIFY_WAIT_DURATION);
-                    if (ret != ESP_OK)
-                    {
-                        ESP_LOGE(TOUCH_TAG, "NotificationDispatcher_NotifyEvent for TOUCH_SENSOR_EVENT_RELEASED event error %d", ret);
-                    }
-                }
+                // A pad this stuck has most likely drifted, so start its baseline over from here
+                ESP_LOGD(TOUCH_TAG, "Touch %d Released Unstuck", i);
+                TouchSensor_ResetPadFilter(this, i, filteredValue);
+                this->touchSensorActive[i] = TOUCH_SENSOR_EVENT_RELEASED;
+                this->touchSensorActiveTimeStamp[i] = curTime;
+                TouchSensor_Notify(this, i, TOUCH_SENSOR_EVENT_RELEASED);
             }
         }
 
-        this->prevTouchValue[i] = touchSensorValue;
+        // A pad still under its threshold keeps sampling going so the interrupt can't refire on it straight away
+        if (this->touchSensorActive[i] != TOUCH_SENSOR_EVENT_RELEASED ||
+            touchSensorValue < pFilter->touchThreshold || filteredValue < pFilter->touchThreshold)
+        {
+            anyActive = true;
+        }
+    }
+    return anyActive;
+}
+
+static esp_err_t TouchSensor_Notify(TouchSensor *this, int touchSensorIdx, TouchSensorEvent touchSensorEvent)
+{
+    TouchSensorEventNotificationData notificationData = { .touchSensorIdx = touchSensorIdx, .touchSensorEvent = touchSensorEvent };
+    esp_err_t ret = NotificationDispatcher_NotifyEvent(this->pNotificationDispatcher, NOTIFICATION_EVENTS_TOUCH_SENSE_ACTION, &notificationData, sizeof(notificationData), DEFAULT_NOTIFY_WAIT_DURATION);
+    if (ret != ESP_OK)
+    {
+        ESP_LOGE(TOUCH_TAG, "NotificationDispatcher_NotifyEvent for touch event %d error %d", touchSensorEvent, ret);
     }
     return ret;
 }
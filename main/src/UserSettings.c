@@ -67,7 +67,7 @@ esp_err_t UserSettings_Init(UserSettings *this, BatterySensor * pBatterySensor)
         UserSettings_WriteUserSettingsFileToDisk(this);
     }
 
-    assert(xTaskCreatePinnedToCore(UserSettings_Task, "UserSettingsTask", configMINIMAL_STACK_SIZE * 2, this, USER_SETTINGS_TASK_PRIORITY, NULL, APP_CPU_NUM) == pdPASS);
+    assert(xTaskCreatePinnedToCore(UserSettings_Task, "UserSettingsTask", configMINIMAL_STACK_SIZE * 2, this, USER_SETTINGS_TASK_PRIORITY, NULL, USER_SETTINGS_TASK_CORE) == pdPASS);
     return ESP_OK;
 }
 
@@ -2,9 +2,12 @@
 #include <string.h>
 
 #include "esp_log.h"
+#include "esp_timer.h"
+#include "nvs.h"
 
 #include "WifiClient.h"
 #include "NotificationDispatcher.h"
+#include "PowerManager.h"
 #include "UserSettings.h"
 #include "TaskPriorities.h"
 #include "TimeUtils.h"
@@ -13,21 +16,43 @@
 // Define events for wifi
 #define WIFI_CONNECTED          BIT0
 #define WIFI_DISCONNECTED       BIT1
+#define WIFI_TASK_WAKE          BIT2    // Client request changed state or deadline
+#define WIFI_TASK_SCAN_FALLBACK BIT3    // Cached connect failed, rescan from the task
+#define WIFI_TASK_SAVE_AP_CACHE BIT4    // Cached AP changed, write it to NVS
+#define WIFI_TASK_LINGER_EXPIRED BIT5   // Idle linger elapsed, stop wifi if still unused
+#define WIFI_TASK_EVENTS        (WIFI_TASK_WAKE | WIFI_TASK_SCAN_FALLBACK | WIFI_TASK_SAVE_AP_CACHE | WIFI_TASK_LINGER_EXPIRED)
 #define WIFI_MUTEX_TIMEOUT_MS   5000
 
 // Define wifi scan settings
 #define WIFI_SCAN_LIST_SIZE     CONFIG_WIFI_PROV_SCAN_MAX_ENTRIES      // Number of APs to scan for
 #define WIFI_SCAN_RSSI_MINIMUM  -127
 
+// Define fast reconnect cache storage
+#define WIFI_AP_CACHE_NVS_NAMESPACE "wifi_client"
+#define WIFI_AP_CACHE_NVS_KEY       "ap_cache"
+
 // Internal Function Declarations
 static void WifiIpEventHandler(void * arg, esp_event_base_t event_base, int32_t event_id, void * event_data);
 
 // Internal Constants
 static const char * TAG = "wifi_client";
+static const uint32_t LATENCY_BUCKET_BOUNDS_MS[WIFI_CLIENT_NUM_LATENCY_BUCKETS - 1] = WIFI_CLIENT_LATENCY_BUCKET_BOUNDS_MS;
+static const char * CONNECT_PATH_NAMES[WIFI_CLIENT_NUM_CONNECT_PATHS] = { "cached", "scan" };
 
 // Internal Function Declarations
 static void _WifiTask(void *pvParameters);
+static TickType_t _WifiClient_GetTaskWaitTicks(WifiClient *this);
+static void _WifiClient_Stop(WifiClient *this);
+static void _WifiClient_LingerTimerCallback(TimerHandle_t xTimer);
 void _WifiClient_Enable(WifiClient *this);
+static bool _WifiClient_GetCredentialsForSsid(WifiClient *this, const uint8_t *ssid, WifiSettings *pWifiSettings);
+static bool _WifiClient_ScanForAp(WifiClient *this);
+static void _WifiClient_ScanFallback(WifiClient *this);
+static bool _WifiClient_IsApGoneReason(uint8_t reason);
+static void _WifiClient_RecordEnableToIpLatency(WifiClient *this);
+static void _WifiClient_UpdateApCache(WifiClient *this);
+static esp_err_t _WifiClient_LoadApCache(WifiClient *this);
+static esp_err_t _WifiClient_SaveApCache(WifiClient *this);
 
 // static void _WifiClient_Print_Authmode(int authmode)
 // {
@@ -85,6 +110,10 @@ esp_err_t WifiClient_Init(WifiClient *this, NotificationDispatcher *pNotificatio
     // Create event group
     this->wifiEventGroup = xEventGroupCreate();
 
+    // Keeps wifi up for a short while after the last client leaves
+    this->lingerTimer = xTimerCreate("WifiLingerTimer", pdMS_TO_TICKS(MAX(CONFIG_WIFI_IDLE_LINGER_MS, 1)), pdFALSE, this, _WifiClient_LingerTimerCallback);
+    assert(this->lingerTimer);
+
     // Initialize TCP/IP Stack
     ESP_ERROR_CHECK(esp_netif_init());
 
@@ -121,11 +150,16 @@ esp_err_t WifiClient_Init(WifiClient *this, NotificationDispatcher *pNotificatio
         // Change the power saving mode to WiFi power saving
         esp_wifi_set_ps(WIFI_PS_MIN_MODEM);
 
+        if (_WifiClient_LoadApCache(this) == ESP_OK)
+        {
+            ESP_LOGI(TAG, "Loaded cached AP (%s) on channel %d", this->apCache.ssid, this->apCache.channel);
+        }
+
         ESP_LOGI(TAG, "Initialize finished!");
         retVal = ESP_OK;
     }
 
-    assert(xTaskCreatePinnedToCore(_WifiTask, "WifiClientTask", configMINIMAL_STACK_SIZE * 2, this, WIFI_CONTROL_TASK_PRIORITY, NULL, APP_CPU_NUM) == pdPASS);
+    assert(xTaskCreatePinnedToCore(_WifiTask, "WifiClientTask", configMINIMAL_STACK_SIZE * 2, this, WIFI_CONTROL_TASK_PRIORITY, NULL, WIFI_CONTROL_TASK_CORE) == pdPASS);
 
     return retVal;
 }
@@ -140,19 +174,51 @@ void _WifiClient_Enable(WifiClient *this)
         // Needed stop or else subsequent starts may not work
         ESP_ERROR_CHECK(esp_wifi_stop());
 
+        if (!this->powerLockHeld)
+        {
+            PowerManager_Acquire(POWER_LOCK_WIFI);
+            this->powerLockHeld = true;
+        }
+
         memset((char*)this->wifiConfig.sta.ssid, 0, sizeof(this->wifiConfig.sta.ssid));
         memset((char*)this->wifiConfig.sta.password, 0, sizeof(this->wifiConfig.sta.password));
+        this->wifiConfig.sta.bssid_set = false;
+        this->wifiConfig.sta.channel = 0;
+        this->wifiConfig.sta.scan_method = WIFI_ALL_CHANNEL_SCAN;
         this->wifiConfig.sta.sort_method = WIFI_CONNECT_AP_BY_SIGNAL;
         this->wifiConfig.sta.threshold.rssi = WIFI_SCAN_RSSI_MINIMUM;
         this->wifiConfig.sta.threshold.authmode = WIFI_AUTH_OPEN;        // we accept all APs
-        
-        ESP_ERROR_CHECK(esp_wifi_set_config(WIFI_IF_STA, &this->wifiConfig));
 
-        // Scan for strongest AP, compare AP names to list stored
-        wifi_ap_record_t * ap_info = calloc(WIFI_SCAN_LIST_SIZE, sizeof(wifi_ap_record_t));
-        assert(ap_info != NULL);
-        uint16_t ap_scan_count = WIFI_SCAN_LIST_SIZE;   // this will get updated by api later
+        this->enableStartTimeUs = esp_timer_get_time();
+        this->attemptDeadline = TimeUtils_GetFutureTimeTicks(CONFIG_WIFI_CONNECT_TIMEOUT_MS);
+        xEventGroupClearBits(this->wifiEventGroup, WIFI_TASK_SCAN_FALLBACK);
+
+#if CONFIG_WIFI_FAST_RECONNECT
+        WifiSettings cachedWifiSettings;
+        if (this->apCache.valid &&
+            _WifiClient_GetCredentialsForSsid(this, this->apCache.ssid, &cachedWifiSettings))
+        {
+            // Directed connect to the last AP we got an IP from. Only the cached channel is probed
+            ESP_LOGI(TAG, "Cached AP Found (%s) on channel %d", cachedWifiSettings.ssid, this->apCache.channel);
+            strncpy((char*)this->wifiConfig.sta.ssid, (char*)cachedWifiSettings.ssid, sizeof(this->wifiConfig.sta.ssid));
+            strncpy((char*)this->wifiConfig.sta.password, (char*)cachedWifiSettings.password, sizeof(this->wifiConfig.sta.password));
+            memcpy(this->wifiConfig.sta.bssid, this->apCache.bssid, sizeof(this->wifiConfig.sta.bssid));
+            this->wifiConfig.sta.bssid_set = true;
+            this->wifiConfig.sta.channel = this->apCache.channel;
+            this->wifiConfig.sta.scan_method = WIFI_FAST_SCAN;
+            this->wifiConfig.sta.threshold.authmode = (wifi_auth_mode_t)this->apCache.authmode;
+            this->connectPath = WIFI_CLIENT_CONNECT_PATH_CACHED;
+            ++this->stats.cachedConnectAttempts;
+        }
+        else
+#endif // CONFIG_WIFI_FAST_RECONNECT
+        {
+            this->connectPath = WIFI_CLIENT_CONNECT_PATH_SCAN;
+        }
+
+        ESP_ERROR_CHECK(esp_wifi_set_config(WIFI_IF_STA, &this->wifiConfig));
 
+        // The start event handler issues the connect
         esp_err_t ret = esp_wifi_start();
         if (ret == ESP_OK)
         {
@@ -163,11 +229,56 @@ void _WifiClient_Enable(WifiClient *this)
             ESP_LOGE(TAG, "Failed to start WiFi. error code = %s", esp_err_to_name(ret));
         }
 
-        WifiSettings customWifiSettings;
-        strncpy((char*)customWifiSettings.ssid, (char*)this->pUserSettings->settings.wifiSettings.ssid, sizeof(customWifiSettings.ssid));
-        strncpy((char*)customWifiSettings.password,(char*)this->pUserSettings->settings.wifiSettings.password, sizeof(customWifiSettings.password));
+        if (this->connectPath == WIFI_CLIENT_CONNECT_PATH_SCAN)
+        {
+            _WifiClient_ScanForAp(this);
+        }
+        this->state = WIFI_CLIENT_STATE_ATTEMPTING;
+    }
+}
+
+// Looks up the password for a known SSID. Custom user network takes precedence over the defcon network
+// Assumes the mutex is already taken
+static bool _WifiClient_GetCredentialsForSsid(WifiClient *this, const uint8_t *ssid, WifiSettings *pWifiSettings)
+{
+    bool found = false;
+    WifiSettings customWifiSettings;
+    strncpy((char*)customWifiSettings.ssid, (char*)this->pUserSettings->settings.wifiSettings.ssid, sizeof(customWifiSettings.ssid));
+    strncpy((char*)customWifiSettings.password,(char*)this->pUserSettings->settings.wifiSettings.password, sizeof(customWifiSettings.password));
+
+    if(customWifiSettings.ssid[0] != 0 &&
+       strncmp((char*)ssid, (char*)customWifiSettings.ssid, sizeof(customWifiSettings.ssid)) == 0)
+    {
+        *pWifiSettings = customWifiSettings;
+        found = true;
+    }
+    else if(strncmp((char*)ssid, (char*)this->defconWifiSettings.ssid, sizeof(this->defconWifiSettings.ssid)) == 0)
+    {
+        *pWifiSettings = this->defconWifiSettings;
+        found = true;
+    }
+    return found;
+}
+
+// Blocking all-channel scan. Configures the station for the first known AP found
+// Assumes the mutex is already taken and wifi is started
+static bool _WifiClient_ScanForAp(WifiClient *this)
+{
+    bool found = false;
 
-        ESP_ERROR_CHECK(esp_wifi_scan_start(NULL, true));
+    // Scan for strongest AP, compare AP names to list stored
+    wifi_ap_record_t * ap_info = calloc(WIFI_SCAN_LIST_SIZE, sizeof(wifi_ap_record_t));
+    assert(ap_info != NULL);
+    uint16_t ap_scan_count = WIFI_SCAN_LIST_SIZE;   // this will get updated by api later
+
+    WifiSettings customWifiSettings;
+    strncpy((char*)customWifiSettings.ssid, (char*)this->pUserSettings->settings.wifiSettings.ssid, sizeof(customWifiSettings.ssid));
+    strncpy((char*)customWifiSettings.password,(char*)this->pUserSettings->settings.wifiSettings.password, sizeof(customWifiSettings.password));
+
+    ++this->stats.scans;
+    esp_err_t ret = esp_wifi_scan_start(NULL, true);
+    if (ret == ESP_OK)
+    {
         ESP_ERROR_CHECK(esp_wifi_scan_get_ap_records(&ap_scan_count, ap_info));  // esp_wifi_scan_get_ap_records clears memory allocated from scan_start
         ESP_LOGI(TAG, "Total APIs scanned: %d", ap_scan_count);
 
@@ -181,6 +292,7 @@ void _WifiClient_Enable(WifiClient *this)
                 strncpy((char*)this->wifiConfig.sta.password, (char*)customWifiSettings.password, sizeof(this->wifiConfig.sta.password));
                 ESP_ERROR_CHECK(esp_wifi_set_config(WIFI_IF_STA, &this->wifiConfig));
                 ESP_ERROR_CHECK(esp_wifi_start());
+                found = true;
                 break;
             }
             else if(strncmp((char*)ap_info[i].ssid, (char*)this->defconWifiSettings.ssid, sizeof(ap_info[i].ssid)) == 0)
@@ -190,22 +302,207 @@ void _WifiClient_Enable(WifiClient *this)
                 strncpy((char*)this->wifiConfig.sta.password, (char*)this->defconWifiSettings.password, sizeof(this->wifiConfig.sta.password));
                 ESP_ERROR_CHECK(esp_wifi_set_config(WIFI_IF_STA, &this->wifiConfig));
                 ESP_ERROR_CHECK(esp_wifi_start());
+                found = true;
                 break;
             }
         }
-        free(ap_info);
-        this->state = WIFI_CLIENT_STATE_ATTEMPTING;
     }
+    else
+    {
+        ESP_LOGE(TAG, "Failed to start scan. error code = %s", esp_err_to_name(ret));
+    }
+    free(ap_info);
+    return found;
+}
+
+// Cached directed connect failed. Fall back to the full scan
+// Assumes the mutex is already taken
+static void _WifiClient_ScanFallback(WifiClient *this)
+{
+    if((this->state == WIFI_CLIENT_STATE_ATTEMPTING ||
+        this->state == WIFI_CLIENT_STATE_CONNECTING) &&
+        this->numClients > 0)
+    {
+        ESP_LOGI(TAG, "Cached connect failed, falling back to scan");
+        memset((char*)this->wifiConfig.sta.ssid, 0, sizeof(this->wifiConfig.sta.ssid));
+        memset((char*)this->wifiConfig.sta.password, 0, sizeof(this->wifiConfig.sta.password));
+        this->wifiConfig.sta.bssid_set = false;
+        this->wifiConfig.sta.channel = 0;
+        this->wifiConfig.sta.scan_method = WIFI_ALL_CHANNEL_SCAN;
+        this->wifiConfig.sta.threshold.authmode = WIFI_AUTH_OPEN;
+        this->connectPath = WIFI_CLIENT_CONNECT_PATH_SCAN;
+
+        if(_WifiClient_ScanForAp(this))
+        {
+            this->retryCount = 0;
+            this->attemptDeadline = TimeUtils_GetFutureTimeTicks(CONFIG_WIFI_CONNECT_TIMEOUT_MS);
+            this->state = WIFI_CLIENT_STATE_CONNECTING;
+            esp_wifi_connect();
+        }
+        else
+        {
+            ESP_LOGI(TAG, "No known AP found");
+            this->state = WIFI_CLIENT_STATE_FAILED;
+            xEventGroupSetBits(this->wifiEventGroup, WIFI_DISCONNECTED);
+        }
+    }
+}
+
+// Reasons that mean the cached AP moved, went away or no longer takes our credentials.
+// Anything else, like the leave from our own restart, can be transient
+static bool _WifiClient_IsApGoneReason(uint8_t reason)
+{
+    return reason == WIFI_REASON_NO_AP_FOUND ||
+           reason == WIFI_REASON_AUTH_FAIL ||
+           reason == WIFI_REASON_BEACON_TIMEOUT;
+}
+
+// Assumes the mutex is already taken
+static void _WifiClient_RecordEnableToIpLatency(WifiClient *this)
+{
+    if(this->enableStartTimeUs != 0)
+    {
+        uint32_t latencyMs = (uint32_t)((esp_timer_get_time() - this->enableStartTimeUs) / 1000);
+        WifiClient_LatencyHistogram *pHistogram = &this->stats.enableToIp[this->connectPath];
+        uint32_t bucket = 0;
+        while(bucket < WIFI_CLIENT_NUM_LATENCY_BUCKETS - 1 && latencyMs >= LATENCY_BUCKET_BOUNDS_MS[bucket])
+        {
+            ++bucket;
+        }
+        ++pHistogram->buckets[bucket];
+        pHistogram->minMs = (pHistogram->count == 0) ? latencyMs : MIN(pHistogram->minMs, latencyMs);
+        pHistogram->maxMs = MAX(pHistogram->maxMs, latencyMs);
+        pHistogram->totalMs += latencyMs;
+        ++pHistogram->count;
+        this->enableStartTimeUs = 0;
+
+        ESP_LOGI(TAG, "Enable to IP %lu ms via %s path (avg %lu ms over %lu)",
+                 latencyMs, CONNECT_PATH_NAMES[this->connectPath],
+                 (uint32_t)(pHistogram->totalMs / pHistogram->count), pHistogram->count);
+    }
+}
+
+// Refreshes the cached AP from the current association. Written to NVS by the task
+// Assumes the mutex is already taken
+static void _WifiClient_UpdateApCache(WifiClient *this)
+{
+    wifi_ap_record_t apInfo;
+    if(esp_wifi_sta_get_ap_info(&apInfo) == ESP_OK)
+    {
+        WifiClient_ApCache newApCache;
+        memset(&newApCache, 0, sizeof(newApCache));
+        memcpy(newApCache.ssid, apInfo.ssid, sizeof(newApCache.ssid));
+        memcpy(newApCache.bssid, apInfo.bssid, sizeof(newApCache.bssid));
+        newApCache.channel = apInfo.primary;
+        newApCache.authmode = apInfo.authmode;
+        newApCache.pairwiseCipher = apInfo.pairwise_cipher;
+        newApCache.groupCipher = apInfo.group_cipher;
+        newApCache.valid = true;
+
+        if(memcmp(&newApCache, &this->apCache, sizeof(newApCache)) != 0)
+        {
+            this->apCache = newApCache;
+            xEventGroupSetBits(this->wifiEventGroup, WIFI_TASK_SAVE_AP_CACHE);
+        }
+    }
+}
+
+static esp_err_t _WifiClient_LoadApCache(WifiClient *this)
+{
+    nvs_handle_t nvsHandle;
+    esp_err_t ret = nvs_open(WIFI_AP_CACHE_NVS_NAMESPACE, NVS_READONLY, &nvsHandle);
+    if(ret == ESP_OK)
+    {
+        size_t length = sizeof(this->apCache);
+        ret = nvs_get_blob(nvsHandle, WIFI_AP_CACHE_NVS_KEY, &this->apCache, &length);
+        if(ret != ESP_OK || length != sizeof(this->apCache))
+        {
+            memset(&this->apCache, 0, sizeof(this->apCache));
+            ret = ESP_ERR_NOT_FOUND;
+        }
+        nvs_close(nvsHandle);
+    }
+    return ret;
+}
+
+// Assumes the mutex is already taken
+static esp_err_t _WifiClient_SaveApCache(WifiClient *this)
+{
+    nvs_handle_t nvsHandle;
+    esp_err_t ret = nvs_open(WIFI_AP_CACHE_NVS_NAMESPACE, NVS_READWRITE, &nvsHandle);
+    if(ret == ESP_OK)
+    {
+        if(this->apCache.valid)
+        {
+            ret = nvs_set_blob(nvsHandle, WIFI_AP_CACHE_NVS_KEY, &this->apCache, sizeof(this->apCache));
+        }
+        else
+        {
+            ret = nvs_erase_key(nvsHandle, WIFI_AP_CACHE_NVS_KEY);
+            if(ret == ESP_ERR_NVS_NOT_FOUND)
+            {
+                ret = ESP_OK;
+            }
+        }
+
+        if(ret == ESP_OK)
+        {
+            ret = nvs_commit(nvsHandle);
+        }
+        nvs_close(nvsHandle);
+    }
+
+    if(ret != ESP_OK)
+    {
+        ESP_LOGE(TAG, "Failed to save AP cache. error code = %s", esp_err_to_name(ret));
+    }
+    return ret;
+}
+
+// Returns how long the task can block before the next deadline is due
+// Assumes the mutex is already taken
+static TickType_t _WifiClient_GetTaskWaitTicks(WifiClient *this)
+{
+    TickType_t waitTicks = portMAX_DELAY;
+    TickType_t deadline = 0;
+    bool deadlineSet = false;
+
+    if(this->state == WIFI_CLIENT_STATE_WAITING)
+    {
+        deadline = this->desiredStartTime;
+        deadlineSet = true;
+    }
+    else if(this->state == WIFI_CLIENT_STATE_ATTEMPTING ||
+            this->state == WIFI_CLIENT_STATE_CONNECTING)
+    {
+        deadline = this->attemptDeadline;
+        deadlineSet = true;
+    }
+
+    if(deadlineSet)
+    {
+        int remainingTicks = (int)(deadline - xTaskGetTickCount());
+        waitTicks = (remainingTicks > 0) ? (TickType_t)remainingTicks : 0;
+    }
+    return waitTicks;
 }
 
+// Sleeps until a wifi/ip event handler, a client request, or a deadline needs attention
 static void _WifiTask(void *pvParameters)
 {
     WifiClient *this = (WifiClient *)pvParameters;
     assert(this);
     assert(this->clientMutex);
 
+    TickType_t waitTicks = portMAX_DELAY;
     while (true)
     {
+        EventBits_t bits = xEventGroupWaitBits(this->wifiEventGroup,
+                                               WIFI_TASK_EVENTS,
+                                               pdTRUE,          // ClearOnExit
+                                               pdFALSE,         // WaitForAllBits
+                                               waitTicks);
+
         if(xSemaphoreTake(this->clientMutex, WIFI_MUTEX_TIMEOUT_MS) == pdTRUE)
         {
             // Do we need to start?
@@ -215,14 +512,86 @@ static void _WifiTask(void *pvParameters)
                 _WifiClient_Enable(this);
             }
 
+            // Scanning blocks so it is kept out of the event handler
+            if(bits & WIFI_TASK_SCAN_FALLBACK)
+            {
+                _WifiClient_ScanFallback(this);
+            }
+
+            // Associated but never got an IP (auth failure, DHCP timeout, etc)
+            if((this->state == WIFI_CLIENT_STATE_ATTEMPTING ||
+                this->state == WIFI_CLIENT_STATE_CONNECTING) &&
+               TimeUtils_IsTimeExpired(this->attemptDeadline))
+            {
+                ESP_LOGW(TAG, "Connect attempt timed out(%d)", this->state);
+                ++this->stats.connectTimeouts;
+                this->retryCount = CONFIG_WIFI_MAX_RETRY;
+                this->state = WIFI_CLIENT_STATE_FAILED;
+                xEventGroupSetBits(this->wifiEventGroup, WIFI_DISCONNECTED);
+                esp_wifi_disconnect();
+            }
+
+            if(bits & WIFI_TASK_SAVE_AP_CACHE)
+            {
+                _WifiClient_SaveApCache(this);
+            }
+
+            // Only tear down if no client came back during the linger period
+            if((bits & WIFI_TASK_LINGER_EXPIRED) && this->numClients <= 0)
+            {
+                _WifiClient_Stop(this);
+            }
+
+            waitTicks = _WifiClient_GetTaskWaitTicks(this);
             xSemaphoreGive(this->clientMutex);
         }
         else
         {
             ESP_LOGE(TAG, "Failed to take wifi client mutex");
+            waitTicks = pdMS_TO_TICKS(WIFI_MUTEX_TIMEOUT_MS);
+        }
+    }
+}
+
+// Assumes the mutex is already taken
+static void _WifiClient_Stop(WifiClient *this)
+{
+    if(this->state == WIFI_CLIENT_STATE_ATTEMPTING ||
+       this->state == WIFI_CLIENT_STATE_CONNECTING ||
+       this->state == WIFI_CLIENT_STATE_CONNECTED ||
+       this->state == WIFI_CLIENT_STATE_FAILED)
+    {
+        // STA_STOP arrives later. Until then a new client must not see the old association
+        this->retryCount = CONFIG_WIFI_MAX_RETRY;
+        this->state = WIFI_CLIENT_STATE_DISCONNECTED;
+        xEventGroupClearBits(this->wifiEventGroup, WIFI_CONNECTED);
+        xEventGroupSetBits(this->wifiEventGroup, WIFI_DISCONNECTED);
+
+        // Tear down wifi
+        esp_err_t ret = esp_wifi_stop();
+        if (ret == ESP_OK)
+        {
+            ESP_LOGI(TAG, "Disconnecting from AP(%s)", this->wifiConfig.sta.ssid);
         }
-        vTaskDelay(pdMS_TO_TICKS(10));
+        else
+        {
+            ESP_LOGE(TAG, "Failed to disconnect from AP(%s). error code = %s", this->wifiConfig.sta.ssid, esp_err_to_name(ret));
+        }
+
     }
+    if (this->powerLockHeld)
+    {
+        PowerManager_Release(POWER_LOCK_WIFI);
+        this->powerLockHeld = false;
+    }
+    xEventGroupClearBits(this->wifiEventGroup, WIFI_TASK_SCAN_FALLBACK);
+}
+
+static void _WifiClient_LingerTimerCallback(TimerHandle_t xTimer)
+{
+    WifiClient *this = (WifiClient *)pvTimerGetTimerID(xTimer);
+    assert(this);
+    xEventGroupSetBits(this->wifiEventGroup, WIFI_TASK_LINGER_EXPIRED);
 }
 
 // TODO: SH Test the immediate code with game logic later on
@@ -234,6 +603,7 @@ WifiClient_State WifiClient_Enable(WifiClient *this)
     if(xSemaphoreTake(this->clientMutex, WIFI_MUTEX_TIMEOUT_MS) == pdTRUE)
     {
         _WifiClient_Enable(this);
+        xEventGroupSetBits(this->wifiEventGroup, WIFI_TASK_WAKE);
 
         // TODO: Change this to DEBUG
         ESP_LOGI(TAG, "WifiClient_Enable");
@@ -256,6 +626,10 @@ WifiClient_State WifiClient_RequestConnect(WifiClient *this, uint32_t waitTimeMS
     {
         ++this->numClients;
 
+        // A new lease cancels any pending idle teardown
+        xTimerStop(this->lingerTimer, 0);
+        xEventGroupClearBits(this->wifiEventGroup, WIFI_TASK_LINGER_EXPIRED);
+
         // Only process if we aren't connected or in the process of connecting
         if(this->state != WIFI_CLIENT_STATE_ATTEMPTING && 
            this->state != WIFI_CLIENT_STATE_CONNECTING &&
@@ -295,6 +669,13 @@ WifiClient_State WifiClient_RequestConnect(WifiClient *this, uint32_t waitTimeMS
                 // TODO: Change this to DEBUG
                 ESP_LOGI(TAG, "WifiClient_RequestConnect: pending request shortened: %lu", waitTimeMS);
             }
+
+            // Let the task pick up the new deadline
+            xEventGroupSetBits(this->wifiEventGroup, WIFI_TASK_WAKE);
+        }
+        else if(this->state == WIFI_CLIENT_STATE_CONNECTED)
+        {
+            ++this->stats.sharedAssociations;
         }
 
         // TODO: Change this to DEBUG
@@ -313,9 +694,11 @@ esp_err_t WifiClient_WaitForConnected(WifiClient *this)
 {
     esp_err_t ret = ESP_FAIL;
     assert(this);
+
+    // Connected is held while associated so clients sharing an association return immediately
     EventBits_t bits = xEventGroupWaitBits(this->wifiEventGroup,
                                            WIFI_CONNECTED | WIFI_DISCONNECTED,
-                                           pdTRUE,          // ClearOnExit
+                                           pdFALSE,         // ClearOnExit
                                            pdFALSE,         // WaitForAllBits
                                            portMAX_DELAY);
     if(bits & WIFI_CONNECTED)
@@ -364,6 +747,26 @@ void WifiClient_TestConnect(WifiClient *this)
     WifiClient_Disconnect(this);
 }
 
+esp_err_t WifiClient_GetStats(WifiClient *this, WifiClient_Stats *pStats)
+{
+    esp_err_t ret = ESP_FAIL;
+    assert(this);
+    assert(this->clientMutex);
+    assert(pStats);
+
+    if(xSemaphoreTake(this->clientMutex, WIFI_MUTEX_TIMEOUT_MS) == pdTRUE)
+    {
+        *pStats = this->stats;
+        ret = ESP_OK;
+        xSemaphoreGive(this->clientMutex);
+    }
+    else
+    {
+        ESP_LOGE(TAG, "Failed to obtain mutex");
+    }
+    return ret;
+}
+
 esp_err_t WifiClient_Disconnect(WifiClient *this)
 {
     esp_err_t ret = ESP_FAIL;
@@ -372,29 +775,39 @@ esp_err_t WifiClient_Disconnect(WifiClient *this)
 
     if(xSemaphoreTake(this->clientMutex, WIFI_MUTEX_TIMEOUT_MS) == pdTRUE)
     {
+        if(this->numClients <= 0)
+        {
+            ESP_LOGW(TAG, "WifiClient_Disconnect called without an active client");
+        }
+
         // Only tear down wifi when there are no more active clients
         if(--this->numClients <= 0)
         {
-            if(this->state == WIFI_CLIENT_STATE_ATTEMPTING ||
-               this->state == WIFI_CLIENT_STATE_CONNECTING ||
-               this->state == WIFI_CLIENT_STATE_CONNECTED)
-            {
-                // Tear down wifi
-                ret = esp_wifi_stop();
-                if (ret == ESP_OK)
-                {
-                    ESP_LOGI(TAG, "Disconnecting from AP(%s)", this->wifiConfig.sta.ssid);
-                }
-                else
-                {
-                    ESP_LOGE(TAG, "Failed to disconnect from AP(%s). error code = %s", this->wifiConfig.sta.ssid, esp_err_to_name(ret));
-                }
+            this->numClients = 0; // Paranoia set just in case
 
-                // The handler will handle changing wifi state to the final state
+            if(this->state == WIFI_CLIENT_STATE_WAITING)
+            {
+                // Never started, nothing to tear down
+                this->state = WIFI_CLIENT_STATE_DISCONNECTED;
+                xEventGroupSetBits(this->wifiEventGroup, WIFI_DISCONNECTED);
+                xEventGroupSetBits(this->wifiEventGroup, WIFI_TASK_WAKE);
+            }
+            else if(CONFIG_WIFI_IDLE_LINGER_MS > 0 &&
+                    (this->state == WIFI_CLIENT_STATE_ATTEMPTING ||
+                     this->state == WIFI_CLIENT_STATE_CONNECTING ||
+                     this->state == WIFI_CLIENT_STATE_CONNECTED ||
+                     this->state == WIFI_CLIENT_STATE_FAILED))
+            {
+                // Keep the association around briefly so back-to-back clients can share it
+                ESP_LOGI(TAG, "No more clients, lingering for %d ms", CONFIG_WIFI_IDLE_LINGER_MS);
+                xTimerReset(this->lingerTimer, 0);
+            }
+            else
+            {
+                _WifiClient_Stop(this);
             }
-
-            this->numClients = 0; // Paranoia set just in case
         }
+        ret = ESP_OK;
 
         xSemaphoreGive(this->clientMutex);
     }
@@ -423,23 +836,53 @@ static void WifiIpEventHandler(void * arg, esp_event_base_t event_base, int32_t
         }
         else if(event_base == WIFI_EVENT && event_id == WIFI_EVENT_STA_STOP)
         {
-            // Set the retry to max to prevent further retry attempts
-            this->retryCount = CONFIG_WIFI_MAX_RETRY;
-            this->state = WIFI_CLIENT_STATE_DISCONNECTED;
-            xEventGroupSetBits(this->wifiEventGroup, WIFI_DISCONNECTED);
-            ESP_LOGI(TAG, "stop commanded");
+            // Stop issued by _WifiClient_Enable before restarting, not a teardown
+            if (this->state == WIFI_CLIENT_STATE_ATTEMPTING && this->numClients > 0)
+            {
+                ESP_LOGD(TAG, "restart stop ignored");
+            }
+            else
+            {
+                // Set the retry to max to prevent further retry attempts
+                this->retryCount = CONFIG_WIFI_MAX_RETRY;
+                this->state = WIFI_CLIENT_STATE_DISCONNECTED;
+                xEventGroupClearBits(this->wifiEventGroup, WIFI_CONNECTED | WIFI_TASK_SCAN_FALLBACK);
+                xEventGroupSetBits(this->wifiEventGroup, WIFI_DISCONNECTED);
+                ESP_LOGI(TAG, "stop commanded");
+            }
         }
         else if (event_base == WIFI_EVENT && event_id == WIFI_EVENT_STA_DISCONNECTED)
         {
+            xEventGroupClearBits(this->wifiEventGroup, WIFI_CONNECTED);
+
+            // Cached connect failed. Only forget the AP when the reason says it is gone or changed,
+            // other failures retry it and then rescan while keeping it for the next enable
+            wifi_event_sta_disconnected_t* event = (wifi_event_sta_disconnected_t*) event_data;
+            bool apGone = _WifiClient_IsApGoneReason(event->reason);
+            if (this->connectPath == WIFI_CLIENT_CONNECT_PATH_CACHED &&
+                this->state != WIFI_CLIENT_STATE_CONNECTED &&
+                this->numClients > 0 &&
+                (apGone || this->retryCount >= CONFIG_WIFI_MAX_RETRY))
+            {
+                ESP_LOGI(TAG, "cached connect failed, reason %d", event->reason);
+                if (apGone)
+                {
+                    this->apCache.valid = false;
+                    xEventGroupSetBits(this->wifiEventGroup, WIFI_TASK_SAVE_AP_CACHE);
+                }
+                this->connectPath = WIFI_CLIENT_CONNECT_PATH_SCAN;
+                ++this->stats.cachedConnectFallbacks;
+                xEventGroupSetBits(this->wifiEventGroup, WIFI_TASK_SCAN_FALLBACK);
+            }
             // Attempt to reconnect if we disconnect or it fails
-            if (this->retryCount < CONFIG_WIFI_MAX_RETRY) 
+            else if (this->retryCount < CONFIG_WIFI_MAX_RETRY) 
             {
                 ++this->retryCount;
                 this->state = WIFI_CLIENT_STATE_CONNECTING;
                 esp_wifi_connect();
                 ESP_LOGI(TAG, "retry(%d) connect to AP", this->retryCount);
             }
-            else
+            else if (this->state != WIFI_CLIENT_STATE_DISCONNECTED)
             {
                 this->state = WIFI_CLIENT_STATE_FAILED;
                 xEventGroupSetBits(this->wifiEventGroup, WIFI_DISCONNECTED);
@@ -451,7 +894,10 @@ static void WifiIpEventHandler(void * arg, esp_event_base_t event_base, int32_t
             ip_event_got_ip_t* event = (ip_event_got_ip_t*) event_data;
             ESP_LOGI(TAG, "IP:" IPSTR, IP2STR(&event->ip_info.ip));
             this->retryCount = 0;
+            _WifiClient_RecordEnableToIpLatency(this);
+            _WifiClient_UpdateApCache(this);
 
+            xEventGroupClearBits(this->wifiEventGroup, WIFI_DISCONNECTED);
             xEventGroupSetBits(this->wifiEventGroup, WIFI_CONNECTED);
             this->state = WIFI_CLIENT_STATE_CONNECTED;
         }
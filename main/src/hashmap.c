@@ -91,11 +91,11 @@ static struct hashmap_entry *hashmap_entry_get_populated(const struct hashmap_ba
  * Returns NULL if the entire table has been searched without finding a match.
  */
 static struct hashmap_entry *hashmap_entry_find(const struct hashmap_base *hb,
-    const void *key, bool find_empty)
+    const void *key, bool find_empty, size_t *probes)
 {
     size_t i;
     size_t index;
-    struct hashmap_entry *entry;
+    struct hashmap_entry *entry = NULL;
 
     index = hashmap_calc_index(hb, key);
 
@@ -103,19 +103,72 @@ static struct hashmap_entry *hashmap_entry_find(const struct hashmap_base *hb,
     for (i = 0; i < hb->table_size; ++i) {
         entry = &hb->table[index];
         if (!entry->key) {
-            if (find_empty) {
-                return entry;
-            }
-            return NULL;
+            break;
         }
         if (hb->compare(key, entry->key) == 0) {
+            if (probes) {
+                *probes = i;
+            }
             return entry;
         }
         index = HASHMAP_PROBE_NEXT(hb, index);
     }
+    if (probes) {
+        *probes = i;
+    }
+    if (i < hb->table_size && find_empty) {
+        return entry;
+    }
     return NULL;
 }
 
+/*
+ * Update the running counters after a lookup. The counters are bookkeeping
+ * only, so they are updated through const lookups too.
+ */
+static void hashmap_stats_record(const struct hashmap_base *hb, size_t probes)
+{
+    struct hashmap_stats *stats = (struct hashmap_stats *)&hb->stats;
+
+    ++stats->lookups;
+    stats->probes += probes;
+    if (probes > stats->max_probe) {
+        stats->max_probe = probes;
+    }
+}
+
+/*
+ * Rebuild the arena key free list with every slot unused.
+ */
+static void hashmap_arena_reset_keys(struct hashmap_base *hb)
+{
+    char *slot;
+    size_t i;
+
+    hb->key_free_list = NULL;
+    if (!hb->key_slot_size) {
+        return;
+    }
+    for (i = hb->capacity; i > 0; --i) {
+        slot = (char *)hb->key_slots + (i - 1) * hb->key_slot_size;
+        *(void **)slot = hb->key_free_list;
+        hb->key_free_list = slot;
+    }
+}
+
+/*
+ * Release a key, either back to the arena free list or through key_free.
+ */
+static void hashmap_key_release(struct hashmap_base *hb, void *key)
+{
+    if (hb->key_slot_size) {
+        *(void **)key = hb->key_free_list;
+        hb->key_free_list = key;
+    } else if (hb->key_free) {
+        hb->key_free(key);
+    }
+}
+
 /*
  * Removes the specified entry and processes the following entries to
  * keep the chain contiguous. This is a required step for hash maps
@@ -130,9 +183,7 @@ static void hashmap_entry_remove(struct hashmap_base *hb, struct hashmap_entry *
     struct hashmap_entry *entry;
 
     /* Free the key */
-    if (hb->key_free) {
-        hb->key_free(removed_entry->key);
-    }
+    hashmap_key_release(hb, removed_entry->key);
     --hb->size;
 
     /* Fill the free slot in the chain */
@@ -172,6 +223,8 @@ static int hashmap_rehash(struct hashmap_base *hb, size_t table_size)
 
     assert((table_size & (table_size - 1)) == 0);
     assert(table_size >= hb->size);
+    /* Arena tables are fixed */
+    assert(hb->capacity == 0);
 
     new_table = (struct hashmap_entry *)calloc(table_size, sizeof(struct hashmap_entry));
     if (!new_table) {
@@ -191,7 +244,7 @@ static int hashmap_rehash(struct hashmap_base *hb, size_t table_size)
         if (!entry->key) {
             continue;
         }
-        new_entry = hashmap_entry_find(hb, entry->key, true);
+        new_entry = hashmap_entry_find(hb, entry->key, true, NULL);
         /* Failure indicates an algorithm bug */
         assert(new_entry != NULL);
 
@@ -199,6 +252,7 @@ static int hashmap_rehash(struct hashmap_base *hb, size_t table_size)
         *new_entry = *entry;
     }
     free(old_table);
+    ++hb->stats.rehashes;
     return 0;
 }
 
@@ -209,6 +263,10 @@ static void hashmap_free_keys(struct hashmap_base *hb)
 {
     struct hashmap_entry *entry;
 
+    if (hb->capacity) {
+        hashmap_arena_reset_keys(hb);
+        return;
+    }
     if (!hb->key_free || hb->size == 0) {
         return;
     }
@@ -240,6 +298,45 @@ void hashmap_base_init(struct hashmap_base *hb,
     hb->compare = compare_func;
 }
 
+/*
+ * Initialize an empty hashmap with a fixed capacity. The table and, if
+ * key_size is non-zero, a slot per key are carved out of the caller's arena,
+ * which must be pointer aligned and at least HASHMAP_ARENA_SIZE(capacity, key_size)
+ * bytes. The map never allocates or rehashes, and puts fail with -ENOSPC
+ * once it holds capacity entries.
+ *
+ * With key_size non-zero, put copies each key into a slot with key_copy_func,
+ * or memcpy of key_size bytes if it is NULL. With key_size zero, keys are
+ * owned by the caller as with the default mode.
+ *
+ * Returns 0 on success, or -EINVAL if the arena is too small or misaligned.
+ */
+int hashmap_base_init_arena(struct hashmap_base *hb,
+        size_t (*hash_func)(const void *), int (*compare_func)(const void *, const void *),
+        void *arena, size_t arena_size, size_t capacity,
+        size_t key_size, int (*key_copy_func)(void *, const void *, size_t))
+{
+    size_t table_size = HASHMAP_ARENA_TABLE_SIZE(capacity);
+
+    hashmap_base_init(hb, hash_func, compare_func);
+    if (!arena || capacity == 0 || ((uintptr_t)arena % sizeof(void *)) != 0 ||
+            arena_size < HASHMAP_ARENA_SIZE(capacity, key_size)) {
+        return -EINVAL;
+    }
+
+    hb->table_size_init = table_size;
+    hb->table_size = table_size;
+    hb->table = (struct hashmap_entry *)arena;
+    memset(hb->table, 0, table_size * sizeof(struct hashmap_entry));
+    hb->capacity = capacity;
+    hb->key_size = key_size;
+    hb->key_slot_size = key_size ? HASHMAP_ARENA_KEY_SLOT_SIZE(key_size) : 0;
+    hb->key_slots = &hb->table[table_size];
+    hb->key_copy = key_copy_func;
+    hashmap_arena_reset_keys(hb);
+    return 0;
+}
+
 /*
  * Free the hashmap and all associated memory.
  */
@@ -249,7 +346,9 @@ void hashmap_base_cleanup(struct hashmap_base *hb)
         return;
     }
     hashmap_free_keys(hb);
-    free(hb->table);
+    if (!hb->capacity) {
+        free(hb->table);
+    }
     memset(hb, 0, sizeof(*hb));
 }
 
@@ -274,6 +373,10 @@ int hashmap_base_reserve(struct hashmap_base *hb, size_t capacity)
     size_t old_size_init;
     int r = 0;
 
+    if (hb->capacity) {
+        return capacity <= hb->capacity ? 0 : -ENOSPC;
+    }
+
     /* Backup original init size in case of failure */
     old_size_init = hb->table_size_init;
 
@@ -299,6 +402,7 @@ int hashmap_base_put(struct hashmap_base *hb, const void *key, void *data)
 {
     struct hashmap_entry *entry;
     size_t table_size;
+    size_t probes;
     int r = 0;
 
     if (!key || !data) {
@@ -306,13 +410,16 @@ int hashmap_base_put(struct hashmap_base *hb, const void *key, void *data)
     }
 
     /* Preemptively rehash with 2x capacity if load factor is approaching 0.75 */
-    table_size = hashmap_calc_table_size(hb, hb->size);
-    if (table_size > hb->table_size) {
-        r = hashmap_rehash(hb, table_size);
+    if (!hb->capacity) {
+        table_size = hashmap_calc_table_size(hb, hb->size);
+        if (table_size > hb->table_size) {
+            r = hashmap_rehash(hb, table_size);
+        }
     }
 
     /* Get the entry for this key */
-    entry = hashmap_entry_find(hb, key, true);
+    entry = hashmap_entry_find(hb, key, true, &probes);
+    hashmap_stats_record(hb, probes);
     if (!entry) {
         /*
          * Cannot find an empty slot. Either out of memory,
@@ -330,7 +437,29 @@ int hashmap_base_put(struct hashmap_base *hb, const void *key, void *data)
         return -EEXIST;
     }
 
-    if (hb->key_dup) {
+    if (hb->capacity && hb->size >= hb->capacity) {
+        ++hb->stats.full;
+        return -ENOSPC;
+    }
+
+    if (hb->key_slot_size) {
+        /* Copy the key into a free arena slot */
+        void *slot = hb->key_free_list;
+        assert(slot != NULL);
+        hb->key_free_list = *(void **)slot;
+        if (hb->key_copy) {
+            r = hb->key_copy(slot, key, hb->key_slot_size);
+        } else {
+            /* The slot is rounded up; copy only the caller's key and zero the padding */
+            memcpy(slot, key, hb->key_size);
+            memset((char *)slot + hb->key_size, 0, hb->key_slot_size - hb->key_size);
+        }
+        if (r < 0) {
+            hashmap_key_release(hb, slot);
+            return r;
+        }
+        entry->key = slot;
+    } else if (hb->key_dup) {
         /* Allocate copy of key to simplify memory management */
         entry->key = hb->key_dup(key);
         if (!entry->key) {
@@ -350,12 +479,14 @@ int hashmap_base_put(struct hashmap_base *hb, const void *key, void *data)
 void *hashmap_base_get(const struct hashmap_base *hb, const void *key)
 {
     struct hashmap_entry *entry;
+    size_t probes;
 
     if (!key) {
         return NULL;
     }
 
-    entry = hashmap_entry_find(hb, key, false);
+    entry = hashmap_entry_find(hb, key, false, &probes);
+    hashmap_stats_record(hb, probes);
     if (!entry) {
         return NULL;
     }
@@ -369,13 +500,15 @@ void *hashmap_base_get(const struct hashmap_base *hb, const void *key)
 void *hashmap_base_remove(struct hashmap_base *hb, const void *key)
 {
     struct hashmap_entry *entry;
+    size_t probes;
     void *data;
 
     if (!key) {
         return NULL;
     }
 
-    entry = hashmap_entry_find(hb, key, false);
+    entry = hashmap_entry_find(hb, key, false, &probes);
+    hashmap_stats_record(hb, probes);
     if (!entry) {
         return NULL;
     }
@@ -404,7 +537,7 @@ void hashmap_base_reset(struct hashmap_base *hb)
 
     hashmap_free_keys(hb);
     hb->size = 0;
-    if (hb->table_size != hb->table_size_init) {
+    if (!hb->capacity && hb->table_size != hb->table_size_init) {
         new_table = (struct hashmap_entry *)realloc(hb->table,
                 sizeof(struct hashmap_entry) * hb->table_size_init);
         if (new_table) {
@@ -595,6 +728,22 @@ double hashmap_base_collisions_variance(const struct hashmap_base *hb)
     return total_variance / hb->size;
 }
 
+/*
+ * Copy the running lookup counters.
+ */
+void hashmap_base_stats(const struct hashmap_base *hb, struct hashmap_stats *stats)
+{
+    *stats = hb->stats;
+}
+
+/*
+ * Zero the running lookup counters.
+ */
+void hashmap_base_stats_reset(struct hashmap_base *hb)
+{
+    memset(&hb->stats, 0, sizeof(hb->stats));
+}
+
 /*
  * Recommended hash function for data keys.
  *
@@ -654,4 +803,19 @@ size_t hashmap_hash_string_i(const char *key)
     hash ^= (hash >> 11);
     hash += (hash << 15);
     return hash;
+}
+
+/*
+ * Key copy function for arena maps with string keys.
+ * Returns 0 on success, or -E2BIG if the string does not fit in the slot.
+ */
+int hashmap_key_copy_string(char *dst, const char *src, size_t size)
+{
+    size_t len = strnlen(src, size);
+
+    if (len >= size) {
+        return -E2BIG;
+    }
+    memcpy(dst, src, len + 1);
+    return 0;
 }
\ No newline at end of file
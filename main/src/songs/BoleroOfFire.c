@@ -1,80 +1,83 @@
 
 #include "Song.h"
 
-const SongNotes BoleroOfFire = {
-  "Bolero of Fire",
-  62,  // Tempo
-  55,   // Number of Notes
-  {
-    {NOTE_F3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_D3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_D3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_A3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_A3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F3, NOTE_TYPE_SIXTEENTH, 1},
-    {NOTE_F3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_REST, NOTE_TYPE_EIGHTH, 0},
+static const uint8_t BoleroOfFireEvents[] = {
+    SONG_NOTE_TIMED(NOTE_F3, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_D3),
+    SONG_NOTE(NOTE_F3),
+    SONG_NOTE(NOTE_D3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_F3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE_TIMED(NOTE_F3, SIXTEENTH, 1),
+    SONG_NOTE_TIMED(NOTE_F3, EIGHTH, 0),
+    SONG_NOTE(NOTE_REST),
 
     //--
 
-    {NOTE_F4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_D4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_D4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_A4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_A4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F4, NOTE_TYPE_SIXTEENTH, 1},
-    {NOTE_F4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_REST, NOTE_TYPE_EIGHTH, 0},
+    SONG_NOTE_TIMED(NOTE_F4, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_D4),
+    SONG_NOTE(NOTE_F4),
+    SONG_NOTE(NOTE_D4),
+    SONG_NOTE(NOTE_A4),
+    SONG_NOTE(NOTE_F4),
+    SONG_NOTE(NOTE_A4),
+    SONG_NOTE_TIMED(NOTE_F4, SIXTEENTH, 1),
+    SONG_NOTE_TIMED(NOTE_F4, EIGHTH, 0),
+    SONG_NOTE(NOTE_REST),
 
     //--
 
-    {NOTE_G3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_E3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_G3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_E3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_BF3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_G3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_BF3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_G3, NOTE_TYPE_SIXTEENTH, 1},
-    {NOTE_G3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_REST, NOTE_TYPE_EIGHTH, 0},
+    SONG_NOTE_TIMED(NOTE_G3, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_E3),
+    SONG_NOTE(NOTE_G3),
+    SONG_NOTE(NOTE_E3),
+    SONG_NOTE(NOTE_BF3),
+    SONG_NOTE(NOTE_G3),
+    SONG_NOTE(NOTE_BF3),
+    SONG_NOTE_TIMED(NOTE_G3, SIXTEENTH, 1),
+    SONG_NOTE_TIMED(NOTE_G3, EIGHTH, 0),
+    SONG_NOTE(NOTE_REST),
 
     //--
 
-    {NOTE_A3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_A3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_D4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_A3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_D4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_A3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_D4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_D4, NOTE_TYPE_SIXTEENTH, 0},
+    SONG_NOTE_TIMED(NOTE_A3, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_F3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_F3),
+    SONG_NOTE(NOTE_D4),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_D4),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_F4),
+    SONG_NOTE(NOTE_D4),
+    SONG_NOTE(NOTE_F4),
+    SONG_NOTE(NOTE_D4),
 
     //--
 
-    {NOTE_A4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_E4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_A4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_E4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_G4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_CS4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_G4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_CS4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_A3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_E3, NOTE_TYPE_SIXTEENTH, 0},
+    SONG_NOTE(NOTE_A4),
+    SONG_NOTE(NOTE_E4),
+    SONG_NOTE(NOTE_A4),
+    SONG_NOTE(NOTE_E4),
+    SONG_NOTE(NOTE_G4),
+    SONG_NOTE(NOTE_CS4),
+    SONG_NOTE(NOTE_G4),
+    SONG_NOTE(NOTE_CS4),
+    SONG_NOTE(NOTE_F4),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_F3),
+    SONG_NOTE(NOTE_E3),
 
     //--
 
-    {NOTE_D3, NOTE_TYPE_HALF_DOT, 0},
-  }
+    SONG_NOTE_TIMED(NOTE_D3, HALF_DOT, 0),
+};
+
+const SongNotes BoleroOfFire = {
+  "Bolero of Fire",
+  62,  // Tempo
+  55,   // Number of Notes
+  sizeof(BoleroOfFireEvents),
+  BoleroOfFireEvents
 };
@@ -1,227 +1,230 @@
 
 #include "Song.h"
 
-const SongNotes Bonus = {
-  "Bonus",
-  118,  // Tempo
-  140,   // Number of Notes
-  {
-    {NOTE_REST, NOTE_TYPE_QUARTER, 0},
-    {NOTE_REST, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_CS5, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_B4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_CS5, NOTE_TYPE_QUARTER, 0},
-    {NOTE_FS4, NOTE_TYPE_QUARTER, 1},
+static const uint8_t BonusEvents[] = {
+    SONG_NOTE_TIMED(NOTE_REST, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_REST, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_CS5, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_B4),
+    SONG_NOTE_TIMED(NOTE_CS5, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_FS4, QUARTER, 1),
 
     //--
 
-    {NOTE_FS4, NOTE_TYPE_QUARTER_DOT, 0},
-    {NOTE_D5, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_CS5, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_D5, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_CS5, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_B4, NOTE_TYPE_QUARTER, 1},
+    SONG_NOTE_TIMED(NOTE_FS4, QUARTER_DOT, 0),
+    SONG_NOTE_TIMED(NOTE_D5, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_CS5),
+    SONG_NOTE_TIMED(NOTE_D5, EIGHTH, 0),
+    SONG_NOTE(NOTE_CS5),
+    SONG_NOTE_TIMED(NOTE_B4, QUARTER, 1),
 
     //--
 
-    {NOTE_B4, NOTE_TYPE_QUARTER_DOT, 0},
-    {NOTE_D5, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_CS5, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_D5, NOTE_TYPE_QUARTER, 0},
-    {NOTE_FS4, NOTE_TYPE_QUARTER, 1},
+    SONG_NOTE_TIMED(NOTE_B4, QUARTER_DOT, 0),
+    SONG_NOTE_TIMED(NOTE_D5, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_CS5),
+    SONG_NOTE_TIMED(NOTE_D5, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_FS4, QUARTER, 1),
 
     //--
 
-    {NOTE_FS4, NOTE_TYPE_QUARTER_DOT, 0},
-    {NOTE_B4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_A4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_B4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_A4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_GS4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_B4, NOTE_TYPE_EIGHTH, 0},
+    SONG_NOTE_TIMED(NOTE_FS4, QUARTER_DOT, 0),
+    SONG_NOTE_TIMED(NOTE_B4, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_A4),
+    SONG_NOTE_TIMED(NOTE_B4, EIGHTH, 0),
+    SONG_NOTE(NOTE_A4),
+    SONG_NOTE(NOTE_GS4),
+    SONG_NOTE(NOTE_B4),
 
     //--
 
-    {NOTE_A4, NOTE_TYPE_QUARTER_DOT, 0},
-    {NOTE_CS5, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_B4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_CS5, NOTE_TYPE_QUARTER, 0},
-    {NOTE_FS4, NOTE_TYPE_QUARTER, 1},
+    SONG_NOTE_TIMED(NOTE_A4, QUARTER_DOT, 0),
+    SONG_NOTE_TIMED(NOTE_CS5, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_B4),
+    SONG_NOTE_TIMED(NOTE_CS5, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_FS4, QUARTER, 1),
 
     //--
 
-    {NOTE_FS4, NOTE_TYPE_QUARTER_DOT, 0},
-    {NOTE_D5, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_CS5, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_D5, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_CS5, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_B4, NOTE_TYPE_QUARTER, 1},
+    SONG_NOTE_TIMED(NOTE_FS4, QUARTER_DOT, 0),
+    SONG_NOTE_TIMED(NOTE_D5, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_CS5),
+    SONG_NOTE_TIMED(NOTE_D5, EIGHTH, 0),
+    SONG_NOTE(NOTE_CS5),
+    SONG_NOTE_TIMED(NOTE_B4, QUARTER, 1),
 
     //--
 
-    {NOTE_B4, NOTE_TYPE_QUARTER_DOT, 0},
-    {NOTE_D5, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_CS5, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_D5, NOTE_TYPE_QUARTER, 0},
-    {NOTE_FS4, NOTE_TYPE_QUARTER, 1},
+    SONG_NOTE_TIMED(NOTE_B4, QUARTER_DOT, 0),
+    SONG_NOTE_TIMED(NOTE_D5, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_CS5),
+    SONG_NOTE_TIMED(NOTE_D5, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_FS4, QUARTER, 1),
 
     //--
 
-    {NOTE_FS4, NOTE_TYPE_QUARTER_DOT, 0},
-    {NOTE_B4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_A4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_B4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_A4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_GS4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_B4, NOTE_TYPE_EIGHTH, 0},
+    SONG_NOTE_TIMED(NOTE_FS4, QUARTER_DOT, 0),
+    SONG_NOTE_TIMED(NOTE_B4, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_A4),
+    SONG_NOTE_TIMED(NOTE_B4, EIGHTH, 0),
+    SONG_NOTE(NOTE_A4),
+    SONG_NOTE(NOTE_GS4),
+    SONG_NOTE(NOTE_B4),
 
     //--
 
-    {NOTE_A4, NOTE_TYPE_QUARTER_DOT, 0},
-    {NOTE_GS4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_A4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_B4, NOTE_TYPE_QUARTER_DOT, 0},
-    {NOTE_A4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_B4, NOTE_TYPE_SIXTEENTH, 0},
+    SONG_NOTE_TIMED(NOTE_A4, QUARTER_DOT, 0),
+    SONG_NOTE_TIMED(NOTE_GS4, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_A4),
+    SONG_NOTE_TIMED(NOTE_B4, QUARTER_DOT, 0),
+    SONG_NOTE_TIMED(NOTE_A4, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_B4),
 
     //--
 
-    {NOTE_CS5, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_B4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_A4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_GS4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_FS4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_D5, NOTE_TYPE_QUARTER, 0},
+    SONG_NOTE_TIMED(NOTE_CS5, EIGHTH, 0),
+    SONG_NOTE(NOTE_B4),
+    SONG_NOTE(NOTE_A4),
+    SONG_NOTE(NOTE_GS4),
+    SONG_NOTE_TIMED(NOTE_FS4, QUARTER, 0),
+    SONG_NOTE(NOTE_D5),
 
     //--
 
-    {NOTE_CS5, NOTE_TYPE_HALF, 0},
-    {NOTE_CS5, NOTE_TYPE_QUARTER, 0},
-    {NOTE_D5, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_CS5, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_B4, NOTE_TYPE_SIXTEENTH, 0},
+    SONG_NOTE_TIMED(NOTE_CS5, HALF, 0),
+    SONG_NOTE_TIMED(NOTE_CS5, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_D5, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_CS5, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_B4),
 
     //--
 
-    {NOTE_CS5, NOTE_TYPE_WHOLE, 0},
+    SONG_NOTE_TIMED(NOTE_CS5, WHOLE, 0),
 
     //--
 
-    {NOTE_REST, NOTE_TYPE_QUARTER, 0},
-    {NOTE_REST, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_CS5, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_B4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_CS5, NOTE_TYPE_QUARTER, 0},
-    {NOTE_FS4, NOTE_TYPE_QUARTER, 1},
+    SONG_NOTE_TIMED(NOTE_REST, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_REST, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_CS5, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_B4),
+    SONG_NOTE_TIMED(NOTE_CS5, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_FS4, QUARTER, 1),
 
     //--
 
-    {NOTE_FS4, NOTE_TYPE_QUARTER_DOT, 0},
-    {NOTE_D5, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_CS5, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_D5, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_CS5, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_B4, NOTE_TYPE_QUARTER, 1},
+    SONG_NOTE_TIMED(NOTE_FS4, QUARTER_DOT, 0),
+    SONG_NOTE_TIMED(NOTE_D5, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_CS5),
+    SONG_NOTE_TIMED(NOTE_D5, EIGHTH, 0),
+    SONG_NOTE(NOTE_CS5),
+    SONG_NOTE_TIMED(NOTE_B4, QUARTER, 1),
 
     //--
 
-    {NOTE_B4, NOTE_TYPE_QUARTER_DOT, 0},
-    {NOTE_D5, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_CS5, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_D5, NOTE_TYPE_QUARTER, 0},
-    {NOTE_FS4, NOTE_TYPE_QUARTER, 1},
+    SONG_NOTE_TIMED(NOTE_B4, QUARTER_DOT, 0),
+    SONG_NOTE_TIMED(NOTE_D5, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_CS5),
+    SONG_NOTE_TIMED(NOTE_D5, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_FS4, QUARTER, 1),
 
     //--
 
-    {NOTE_FS4, NOTE_TYPE_QUARTER_DOT, 0},
-    {NOTE_B4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_A4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_B4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_A4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_GS4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_B4, NOTE_TYPE_EIGHTH, 0},
+    SONG_NOTE_TIMED(NOTE_FS4, QUARTER_DOT, 0),
+    SONG_NOTE_TIMED(NOTE_B4, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_A4),
+    SONG_NOTE_TIMED(NOTE_B4, EIGHTH, 0),
+    SONG_NOTE(NOTE_A4),
+    SONG_NOTE(NOTE_GS4),
+    SONG_NOTE(NOTE_B4),
 
     //--
 
-    {NOTE_A4, NOTE_TYPE_QUARTER_DOT, 0},
-    {NOTE_CS5, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_B4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_CS5, NOTE_TYPE_QUARTER, 0},
-    {NOTE_FS4, NOTE_TYPE_QUARTER, 1},
+    SONG_NOTE_TIMED(NOTE_A4, QUARTER_DOT, 0),
+    SONG_NOTE_TIMED(NOTE_CS5, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_B4),
+    SONG_NOTE_TIMED(NOTE_CS5, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_FS4, QUARTER, 1),
 
     //--
 
-    {NOTE_FS4, NOTE_TYPE_QUARTER_DOT, 0},
-    {NOTE_D5, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_CS5, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_D5, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_CS5, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_B4, NOTE_TYPE_QUARTER, 1},
+    SONG_NOTE_TIMED(NOTE_FS4, QUARTER_DOT, 0),
+    SONG_NOTE_TIMED(NOTE_D5, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_CS5),
+    SONG_NOTE_TIMED(NOTE_D5, EIGHTH, 0),
+    SONG_NOTE(NOTE_CS5),
+    SONG_NOTE_TIMED(NOTE_B4, QUARTER, 1),
 
     //--
 
-    {NOTE_B4, NOTE_TYPE_QUARTER_DOT, 0},
-    {NOTE_D5, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_CS5, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_D5, NOTE_TYPE_QUARTER, 0},
-    {NOTE_FS4, NOTE_TYPE_QUARTER, 1},
+    SONG_NOTE_TIMED(NOTE_B4, QUARTER_DOT, 0),
+    SONG_NOTE_TIMED(NOTE_D5, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_CS5),
+    SONG_NOTE_TIMED(NOTE_D5, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_FS4, QUARTER, 1),
 
     //--
 
-    {NOTE_FS4, NOTE_TYPE_QUARTER_DOT, 0},
-    {NOTE_B4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_A4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_B4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_A4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_GS4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_B4, NOTE_TYPE_EIGHTH, 0},
+    SONG_NOTE_TIMED(NOTE_FS4, QUARTER_DOT, 0),
+    SONG_NOTE_TIMED(NOTE_B4, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_A4),
+    SONG_NOTE_TIMED(NOTE_B4, EIGHTH, 0),
+    SONG_NOTE(NOTE_A4),
+    SONG_NOTE(NOTE_GS4),
+    SONG_NOTE(NOTE_B4),
 
     //--
 
-    {NOTE_A4, NOTE_TYPE_QUARTER_DOT, 0},
-    {NOTE_GS4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_A4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_B4, NOTE_TYPE_QUARTER_DOT, 0},
-    {NOTE_A4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_B4, NOTE_TYPE_SIXTEENTH, 0},
+    SONG_NOTE_TIMED(NOTE_A4, QUARTER_DOT, 0),
+    SONG_NOTE_TIMED(NOTE_GS4, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_A4),
+    SONG_NOTE_TIMED(NOTE_B4, QUARTER_DOT, 0),
+    SONG_NOTE_TIMED(NOTE_A4, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_B4),
 
     //--
 
-    {NOTE_CS5, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_B4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_A4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_GS4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_FS4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_D5, NOTE_TYPE_QUARTER, 0},
+    SONG_NOTE_TIMED(NOTE_CS5, EIGHTH, 0),
+    SONG_NOTE(NOTE_B4),
+    SONG_NOTE(NOTE_A4),
+    SONG_NOTE(NOTE_GS4),
+    SONG_NOTE_TIMED(NOTE_FS4, QUARTER, 0),
+    SONG_NOTE(NOTE_D5),
 
     //--
 
-    {NOTE_CS5, NOTE_TYPE_HALF, 0},
-    {NOTE_CS5, NOTE_TYPE_QUARTER_TRIPLET_DOUBLE, 0},
-    {NOTE_D5, NOTE_TYPE_QUARTER_TRIPLET_DOUBLE, 0},
-    {NOTE_CS5, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_B4, NOTE_TYPE_QUARTER_TRIPLET, 0},
+    SONG_NOTE_TIMED(NOTE_CS5, HALF, 0),
+    SONG_NOTE_TIMED(NOTE_CS5, QUARTER_TRIPLET_DOUBLE, 0),
+    SONG_NOTE(NOTE_D5),
+    SONG_NOTE_TIMED(NOTE_CS5, QUARTER_TRIPLET, 0),
+    SONG_NOTE(NOTE_B4),
 
     //--
 
-    {NOTE_CS5, NOTE_TYPE_HALF, 0},
-    {NOTE_REST, NOTE_TYPE_QUARTER, 0},
-    {NOTE_CS5, NOTE_TYPE_QUARTER, 0},
+    SONG_NOTE_TIMED(NOTE_CS5, HALF, 0),
+    SONG_NOTE_TIMED(NOTE_REST, QUARTER, 0),
+    SONG_NOTE(NOTE_CS5),
 
     //--
 
-    {NOTE_FS4, NOTE_TYPE_HALF_DOT, 0},
-    {NOTE_E4, NOTE_TYPE_QUARTER, 0},
+    SONG_NOTE_TIMED(NOTE_FS4, HALF_DOT, 0),
+    SONG_NOTE_TIMED(NOTE_E4, QUARTER, 0),
 
     //--
 
-    {NOTE_FS4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_A4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_CS4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_E4, NOTE_TYPE_QUARTER, 0},
+    SONG_NOTE(NOTE_FS4),
+    SONG_NOTE(NOTE_A4),
+    SONG_NOTE(NOTE_CS4),
+    SONG_NOTE(NOTE_E4),
 
     //--
 
-    {NOTE_FS4, NOTE_TYPE_WHOLE, 0},
-  }
+    SONG_NOTE_TIMED(NOTE_FS4, WHOLE, 0),
+};
+
+const SongNotes Bonus = {
+  "Bonus",
+  118,  // Tempo
+  139,   // Number of Notes
+  sizeof(BonusEvents),
+  BonusEvents
 };
@@ -1,99 +1,102 @@
 
 #include "Song.h"
 
-const SongNotes BonusBonus = {
-  "Bonus Bonus",
-  114,  // Tempo
-  65,   // Number of Notes
-  {
-    {NOTE_C4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_D4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_D4, NOTE_TYPE_SIXTEENTH, 0},
+static const uint8_t BonusBonusEvents[] = {
+    SONG_NOTE_TIMED(NOTE_C4, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_D4),
+    SONG_NOTE(NOTE_F4),
+    SONG_NOTE(NOTE_D4),
 
     //--
 
-    {NOTE_A4, NOTE_TYPE_EIGHTH_DOT, 0},
-    {NOTE_A4, NOTE_TYPE_SIXTEENTH, 1},
-    {NOTE_A4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_G4, NOTE_TYPE_EIGHTH, 1},
-    {NOTE_G4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_C4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_D4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_D4, NOTE_TYPE_SIXTEENTH, 0},
+    SONG_NOTE_TIMED(NOTE_A4, EIGHTH_DOT, 0),
+    SONG_NOTE_TIMED(NOTE_A4, SIXTEENTH, 1),
+    SONG_NOTE_TIMED(NOTE_A4, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_G4, EIGHTH, 1),
+    SONG_NOTE_TIMED(NOTE_G4, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_C4, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_D4),
+    SONG_NOTE(NOTE_F4),
+    SONG_NOTE(NOTE_D4),
 
     //--
 
-    {NOTE_G4, NOTE_TYPE_EIGHTH_DOT, 0},
-    {NOTE_G4, NOTE_TYPE_SIXTEENTH, 1},
-    {NOTE_G4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_F4, NOTE_TYPE_EIGHTH, 1},
-    {NOTE_F4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_E4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_D4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_C4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_D4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_D4, NOTE_TYPE_SIXTEENTH, 0},
+    SONG_NOTE_TIMED(NOTE_G4, EIGHTH_DOT, 0),
+    SONG_NOTE_TIMED(NOTE_G4, SIXTEENTH, 1),
+    SONG_NOTE_TIMED(NOTE_G4, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_F4, EIGHTH, 1),
+    SONG_NOTE_TIMED(NOTE_F4, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_E4),
+    SONG_NOTE_TIMED(NOTE_D4, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_C4, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_D4),
+    SONG_NOTE(NOTE_F4),
+    SONG_NOTE(NOTE_D4),
 
     //--
 
-    {NOTE_F4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_G4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_E4, NOTE_TYPE_EIGHTH, 1},
-    {NOTE_E4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_D4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_C4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_C4, NOTE_TYPE_EIGHTH, 0},
+    SONG_NOTE_TIMED(NOTE_F4, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_G4, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_E4, EIGHTH, 1),
+    SONG_NOTE_TIMED(NOTE_E4, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_D4),
+    SONG_NOTE_TIMED(NOTE_C4, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_C4, EIGHTH, 0),
 
     //--
 
-    {NOTE_G4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_F4, NOTE_TYPE_HALF, 0},
-    {NOTE_C4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_D4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_D4, NOTE_TYPE_SIXTEENTH, 0},
+    SONG_NOTE_TIMED(NOTE_G4, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_F4, HALF, 0),
+    SONG_NOTE_TIMED(NOTE_C4, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_D4),
+    SONG_NOTE(NOTE_F4),
+    SONG_NOTE(NOTE_D4),
 
     //--
 
-    {NOTE_A4, NOTE_TYPE_EIGHTH_DOT, 0},
-    {NOTE_A4, NOTE_TYPE_SIXTEENTH, 1},
-    {NOTE_A4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_G4, NOTE_TYPE_EIGHTH, 1},
-    {NOTE_G4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_C4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_D4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_D4, NOTE_TYPE_SIXTEENTH, 0},
+    SONG_NOTE_TIMED(NOTE_A4, EIGHTH_DOT, 0),
+    SONG_NOTE_TIMED(NOTE_A4, SIXTEENTH, 1),
+    SONG_NOTE_TIMED(NOTE_A4, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_G4, EIGHTH, 1),
+    SONG_NOTE_TIMED(NOTE_G4, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_C4, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_D4),
+    SONG_NOTE(NOTE_F4),
+    SONG_NOTE(NOTE_D4),
 
     //--
 
-    {NOTE_C5, NOTE_TYPE_QUARTER, 0},
-    {NOTE_E4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_F4, NOTE_TYPE_EIGHTH, 1},
-    {NOTE_F4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_E4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_D4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_C4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_D4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_D4, NOTE_TYPE_SIXTEENTH, 0},
+    SONG_NOTE_TIMED(NOTE_C5, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_E4, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_F4, EIGHTH, 1),
+    SONG_NOTE_TIMED(NOTE_F4, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_E4),
+    SONG_NOTE_TIMED(NOTE_D4, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_C4, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_D4),
+    SONG_NOTE(NOTE_F4),
+    SONG_NOTE(NOTE_D4),
 
     //--
 
-    {NOTE_F4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_G4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_E4, NOTE_TYPE_EIGHTH, 1},
-    {NOTE_E4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_D4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_C4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_C4, NOTE_TYPE_EIGHTH, 0},
+    SONG_NOTE_TIMED(NOTE_F4, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_G4, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_E4, EIGHTH, 1),
+    SONG_NOTE_TIMED(NOTE_E4, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_D4),
+    SONG_NOTE_TIMED(NOTE_C4, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_C4, EIGHTH, 0),
 
     //--
 
-    {NOTE_G4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_F4, NOTE_TYPE_HALF, 0},
-  }
+    SONG_NOTE_TIMED(NOTE_G4, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_F4, HALF, 0),
+};
+
+const SongNotes BonusBonus = {
+  "Bonus Bonus",
+  114,  // Tempo
+  65,   // Number of Notes
+  sizeof(BonusBonusEvents),
+  BonusBonusEvents
 };
\ No newline at end of file
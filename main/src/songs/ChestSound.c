@@ -1,13 +1,16 @@
 #include "Song.h"
 
+static const uint8_t ChestSoundEvents[] = {
+    SONG_NOTE_TIMED(NOTE_A4, QUARTER_TRIPLET, 1),
+    SONG_NOTE(NOTE_AS4),
+    SONG_NOTE(NOTE_B4),
+    SONG_NOTE_TIMED(NOTE_C5, QUARTER, 1),
+};
+
 const SongNotes ChestSound = {
   "Chest Sound",
-  80,   // Tempo
+  80,  // Tempo
   4,   // Number of Notes
-  {
-    {NOTE_A4, NOTE_TYPE_QUARTER_TRIPLET, 1},
-    {NOTE_AS4, NOTE_TYPE_QUARTER_TRIPLET, 1},
-    {NOTE_B4, NOTE_TYPE_QUARTER_TRIPLET, 1},
-    {NOTE_C5, NOTE_TYPE_QUARTER, 1}
-  }
+  sizeof(ChestSoundEvents),
+  ChestSoundEvents
 };
@@ -1,84 +1,87 @@
 
 #include "Song.h"
 
-const SongNotes EponasSong = {
-  "Epona's Song",
-  100,  // Tempo
-  42,   // Number of Notes
-  {
-    {NOTE_D4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_B3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_A3, NOTE_TYPE_HALF, 1},
-    {NOTE_A3, NOTE_TYPE_SIXTEENTH, 0},
+static const uint8_t EponasSongEvents[] = {
+    SONG_NOTE_TIMED(NOTE_D4, EIGHTH, 0),
+    SONG_NOTE(NOTE_B3),
+    SONG_NOTE_TIMED(NOTE_A3, HALF, 1),
+    SONG_NOTE_TIMED(NOTE_A3, SIXTEENTH, 0),
 
     // --
 
-    {NOTE_D4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_B3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_A3, NOTE_TYPE_HALF, 1},
-    {NOTE_A3, NOTE_TYPE_SIXTEENTH, 0},
+    SONG_NOTE_TIMED(NOTE_D4, EIGHTH, 0),
+    SONG_NOTE(NOTE_B3),
+    SONG_NOTE_TIMED(NOTE_A3, HALF, 1),
+    SONG_NOTE_TIMED(NOTE_A3, SIXTEENTH, 0),
 
     // --
 
-    {NOTE_D4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_B3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER, 1},
+    SONG_NOTE_TIMED(NOTE_D4, EIGHTH, 0),
+    SONG_NOTE(NOTE_B3),
+    SONG_NOTE_TIMED(NOTE_A3, QUARTER, 1),
 
     // --
 
-    {NOTE_B3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_A3, NOTE_TYPE_HALF, 1},
-    {NOTE_A3, NOTE_TYPE_SIXTEENTH, 0},
+    SONG_NOTE_TIMED(NOTE_B3, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_A3, HALF, 1),
+    SONG_NOTE_TIMED(NOTE_A3, SIXTEENTH, 0),
 
     // --
 
-    {NOTE_REST, NOTE_TYPE_QUARTER, 0},
-    {NOTE_FS3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_F3, NOTE_TYPE_QUARTER, 0},
+    SONG_NOTE_TIMED(NOTE_REST, QUARTER, 0),
+    SONG_NOTE(NOTE_FS3),
+    SONG_NOTE(NOTE_F3),
 
     // --
-    {NOTE_FS3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_CS4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_D4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_B3, NOTE_TYPE_HALF, 1},
-    {NOTE_B3, NOTE_TYPE_SIXTEENTH, 0},
+    SONG_NOTE(NOTE_FS3),
+    SONG_NOTE_TIMED(NOTE_CS4, EIGHTH, 0),
+    SONG_NOTE(NOTE_D4),
+    SONG_NOTE_TIMED(NOTE_B3, HALF, 1),
+    SONG_NOTE_TIMED(NOTE_B3, SIXTEENTH, 0),
 
     // --
 
-    {NOTE_D4, NOTE_TYPE_HALF, 0},
-    {NOTE_D4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_CS4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_B3, NOTE_TYPE_EIGHTH, 0},
+    SONG_NOTE_TIMED(NOTE_D4, HALF, 0),
+    SONG_NOTE_TIMED(NOTE_D4, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_CS4, EIGHTH, 0),
+    SONG_NOTE(NOTE_B3),
 
     // --
 
-    {NOTE_A3, NOTE_TYPE_HALF, 1},
-    {NOTE_A3, NOTE_TYPE_SIXTEENTH, 0},
+    SONG_NOTE_TIMED(NOTE_A3, HALF, 1),
+    SONG_NOTE_TIMED(NOTE_A3, SIXTEENTH, 0),
 
     // --
 
-    {NOTE_D4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_B3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_A3, NOTE_TYPE_HALF, 1},
-    {NOTE_A3, NOTE_TYPE_SIXTEENTH, 0},
+    SONG_NOTE_TIMED(NOTE_D4, EIGHTH, 0),
+    SONG_NOTE(NOTE_B3),
+    SONG_NOTE_TIMED(NOTE_A3, HALF, 1),
+    SONG_NOTE_TIMED(NOTE_A3, SIXTEENTH, 0),
 
     // +++
 
-    {NOTE_D4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_B3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_A3, NOTE_TYPE_HALF, 1},
-    {NOTE_A3, NOTE_TYPE_SIXTEENTH, 0},
+    SONG_NOTE_TIMED(NOTE_D4, EIGHTH, 0),
+    SONG_NOTE(NOTE_B3),
+    SONG_NOTE_TIMED(NOTE_A3, HALF, 1),
+    SONG_NOTE_TIMED(NOTE_A3, SIXTEENTH, 0),
 
     // --
 
-    {NOTE_D4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_B3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER, 1},
+    SONG_NOTE_TIMED(NOTE_D4, EIGHTH, 0),
+    SONG_NOTE(NOTE_B3),
+    SONG_NOTE_TIMED(NOTE_A3, QUARTER, 1),
 
     // --
 
-    {NOTE_B3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_A3, NOTE_TYPE_HALF, 1},
-    {NOTE_A3, NOTE_TYPE_SIXTEENTH, 0},
-  }
+    SONG_NOTE_TIMED(NOTE_B3, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_A3, HALF, 1),
+    SONG_NOTE_TIMED(NOTE_A3, SIXTEENTH, 0),
+};
+
+const SongNotes EponasSong = {
+  "Epona's Song",
+  100,  // Tempo
+  42,   // Number of Notes
+  sizeof(EponasSongEvents),
+  EponasSongEvents
 };
@@ -1,142 +1,145 @@
 
 #include "Song.h"
 
-const SongNotes Fanfare = {
-  "Fanfare",
-  144,  // Tempo
-  81,   // Number of Notes
-  {
-    {NOTE_D5, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_D5, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_D5, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_D5, NOTE_TYPE_QUARTER, 0},
-    {NOTE_AS4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_C5, NOTE_TYPE_QUARTER, 0},
+static const uint8_t FanfareEvents[] = {
+    SONG_NOTE_TIMED(NOTE_D5, QUARTER_TRIPLET, 0),
+    SONG_NOTE(NOTE_D5),
+    SONG_NOTE(NOTE_D5),
+    SONG_NOTE_TIMED(NOTE_D5, QUARTER, 0),
+    SONG_NOTE(NOTE_AS4),
+    SONG_NOTE(NOTE_C5),
 
     //--
 
-    {NOTE_D5, NOTE_TYPE_QUARTER_TRIPLET_DOUBLE, 0},
-    {NOTE_C5, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_D5, NOTE_TYPE_HALF_DOT, 0},
+    SONG_NOTE_TIMED(NOTE_D5, QUARTER_TRIPLET_DOUBLE, 0),
+    SONG_NOTE_TIMED(NOTE_C5, QUARTER_TRIPLET, 0),
+    SONG_NOTE_TIMED(NOTE_D5, HALF_DOT, 0),
 
     //--
 
-    {NOTE_A4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_G4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_A4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_G4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_C5, NOTE_TYPE_EIGHTH, 1},
+    SONG_NOTE_TIMED(NOTE_A4, QUARTER, 0),
+    SONG_NOTE(NOTE_G4),
+    SONG_NOTE(NOTE_A4),
+    SONG_NOTE_TIMED(NOTE_G4, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_C5, EIGHTH, 1),
 
     //--
 
-    {NOTE_C5, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_C5, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_B4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_C5, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_B4, NOTE_TYPE_EIGHTH, 1},
-    {NOTE_B4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_B4, NOTE_TYPE_EIGHTH, 0},
+    SONG_NOTE_TIMED(NOTE_C5, EIGHTH, 0),
+    SONG_NOTE(NOTE_C5),
+    SONG_NOTE_TIMED(NOTE_B4, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_C5, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_B4, EIGHTH, 1),
+    SONG_NOTE_TIMED(NOTE_B4, EIGHTH, 0),
+    SONG_NOTE(NOTE_B4),
 
     //--
 
-    {NOTE_A4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_G4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_FS4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_G4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_E4, NOTE_TYPE_EIGHTH, 1},
+    SONG_NOTE_TIMED(NOTE_A4, QUARTER, 0),
+    SONG_NOTE(NOTE_G4),
+    SONG_NOTE(NOTE_FS4),
+    SONG_NOTE_TIMED(NOTE_G4, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_E4, EIGHTH, 1),
 
     //--
 
-    {NOTE_E4, NOTE_TYPE_WHOLE, 0},
+    SONG_NOTE_TIMED(NOTE_E4, WHOLE, 0),
 
     //--
 
-    {NOTE_A4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_G4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_A4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_G4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_C5, NOTE_TYPE_EIGHTH, 1},
+    SONG_NOTE_TIMED(NOTE_A4, QUARTER, 0),
+    SONG_NOTE(NOTE_G4),
+    SONG_NOTE(NOTE_A4),
+    SONG_NOTE_TIMED(NOTE_G4, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_C5, EIGHTH, 1),
 
     //--
 
-    {NOTE_C5, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_C5, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_B4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_C5, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_B4, NOTE_TYPE_EIGHTH, 1},
-    {NOTE_B4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_B4, NOTE_TYPE_EIGHTH, 0},
+    SONG_NOTE_TIMED(NOTE_C5, EIGHTH, 0),
+    SONG_NOTE(NOTE_C5),
+    SONG_NOTE_TIMED(NOTE_B4, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_C5, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_B4, EIGHTH, 1),
+    SONG_NOTE_TIMED(NOTE_B4, EIGHTH, 0),
+    SONG_NOTE(NOTE_B4),
 
     //--
 
-    {NOTE_A4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_G4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_A4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_C5, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_D5, NOTE_TYPE_EIGHTH, 1},
+    SONG_NOTE_TIMED(NOTE_A4, QUARTER, 0),
+    SONG_NOTE(NOTE_G4),
+    SONG_NOTE(NOTE_A4),
+    SONG_NOTE_TIMED(NOTE_C5, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_D5, EIGHTH, 1),
 
     //--
 
-    {NOTE_D5, NOTE_TYPE_WHOLE, 0},
+    SONG_NOTE_TIMED(NOTE_D5, WHOLE, 0),
 
     //--
 
-    {NOTE_A4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_G4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_A4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_G4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_C5, NOTE_TYPE_EIGHTH, 1},
+    SONG_NOTE_TIMED(NOTE_A4, QUARTER, 0),
+    SONG_NOTE(NOTE_G4),
+    SONG_NOTE(NOTE_A4),
+    SONG_NOTE_TIMED(NOTE_G4, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_C5, EIGHTH, 1),
 
     //--
 
-    {NOTE_C5, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_C5, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_B4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_C5, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_B4, NOTE_TYPE_EIGHTH, 1},
-    {NOTE_B4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_B4, NOTE_TYPE_EIGHTH, 0},
+    SONG_NOTE_TIMED(NOTE_C5, EIGHTH, 0),
+    SONG_NOTE(NOTE_C5),
+    SONG_NOTE_TIMED(NOTE_B4, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_C5, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_B4, EIGHTH, 1),
+    SONG_NOTE_TIMED(NOTE_B4, EIGHTH, 0),
+    SONG_NOTE(NOTE_B4),
 
     //--
 
-    {NOTE_A4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_G4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_FS4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_G4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_E4, NOTE_TYPE_EIGHTH, 1},
+    SONG_NOTE_TIMED(NOTE_A4, QUARTER, 0),
+    SONG_NOTE(NOTE_G4),
+    SONG_NOTE(NOTE_FS4),
+    SONG_NOTE_TIMED(NOTE_G4, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_E4, EIGHTH, 1),
 
     //--
 
-    {NOTE_E4, NOTE_TYPE_WHOLE, 0},
+    SONG_NOTE_TIMED(NOTE_E4, WHOLE, 0),
 
     //--
 
-    {NOTE_A4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_G4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_A4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_G4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_C5, NOTE_TYPE_EIGHTH, 1},
+    SONG_NOTE_TIMED(NOTE_A4, QUARTER, 0),
+    SONG_NOTE(NOTE_G4),
+    SONG_NOTE(NOTE_A4),
+    SONG_NOTE_TIMED(NOTE_G4, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_C5, EIGHTH, 1),
 
     //--
 
-    {NOTE_C5, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_C5, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_B4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_C5, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_B4, NOTE_TYPE_EIGHTH, 1},
-    {NOTE_B4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_B4, NOTE_TYPE_EIGHTH, 0},
+    SONG_NOTE_TIMED(NOTE_C5, EIGHTH, 0),
+    SONG_NOTE(NOTE_C5),
+    SONG_NOTE_TIMED(NOTE_B4, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_C5, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_B4, EIGHTH, 1),
+    SONG_NOTE_TIMED(NOTE_B4, EIGHTH, 0),
+    SONG_NOTE(NOTE_B4),
 
     //--
 
-    {NOTE_A4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_G4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_A4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_C5, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_D5, NOTE_TYPE_EIGHTH, 1},
+    SONG_NOTE_TIMED(NOTE_A4, QUARTER, 0),
+    SONG_NOTE(NOTE_G4),
+    SONG_NOTE(NOTE_A4),
+    SONG_NOTE_TIMED(NOTE_C5, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_D5, EIGHTH, 1),
 
     //--
 
-    {NOTE_D5, NOTE_TYPE_WHOLE, 0},
-  }
+    SONG_NOTE_TIMED(NOTE_D5, WHOLE, 0),
+};
+
+const SongNotes Fanfare = {
+  "Fanfare",
+  144,  // Tempo
+  81,   // Number of Notes
+  sizeof(FanfareEvents),
+  FanfareEvents
 };
@@ -1,275 +1,278 @@
 
 #include "Song.h"
 
-const SongNotes Margaritaville = {
-  "Margaritaville",
-  125,  // Tempo
-  163,   // Number of Notes
-  {
-    {NOTE_A3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_A3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_A3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_G3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_DOT, 0},
+static const uint8_t MargaritavilleEvents[] = {
+    SONG_NOTE_TIMED(NOTE_A3, EIGHTH, 0),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE_TIMED(NOTE_G3, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_A3, QUARTER_DOT, 0),
 
     //--
 
-    {NOTE_A3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_A3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_A3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_G3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_DOT, 0},
+    SONG_NOTE_TIMED(NOTE_A3, EIGHTH, 0),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE_TIMED(NOTE_G3, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_A3, QUARTER_DOT, 0),
 
     //--
 
-    {NOTE_B3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_B3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_B3, NOTE_TYPE_EIGHTH, 1},
-    {NOTE_B3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_A3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_G3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_FS3, NOTE_TYPE_EIGHTH, 1},
+    SONG_NOTE_TIMED(NOTE_B3, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_B3, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_B3, EIGHTH, 1),
+    SONG_NOTE_TIMED(NOTE_B3, EIGHTH, 0),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_G3),
+    SONG_NOTE_TIMED(NOTE_FS3, EIGHTH, 1),
 
     //--
 
-    {NOTE_FS3, NOTE_TYPE_HALF, 0},
-    {NOTE_E3, NOTE_TYPE_HALF, 0},
+    SONG_NOTE_TIMED(NOTE_FS3, HALF, 0),
+    SONG_NOTE(NOTE_E3),
 
     //--
 
-    {NOTE_D3, NOTE_TYPE_HALF, 0},
-    {NOTE_A3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_A3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_A3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_G3, NOTE_TYPE_EIGHTH, 1},
+    SONG_NOTE(NOTE_D3),
+    SONG_NOTE_TIMED(NOTE_A3, EIGHTH, 0),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE_TIMED(NOTE_G3, EIGHTH, 1),
 
     //--
 
-    {NOTE_G3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_A3, NOTE_TYPE_EIGHTH, 1},
-    {NOTE_A3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_A2, NOTE_TYPE_QUARTER, 0},
-    {NOTE_CS3, NOTE_TYPE_QUARTER, 0},
+    SONG_NOTE_TIMED(NOTE_G3, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_A3, EIGHTH, 1),
+    SONG_NOTE_TIMED(NOTE_A3, QUARTER, 0),
+    SONG_NOTE(NOTE_A2),
+    SONG_NOTE(NOTE_CS3),
 
     //--
 
-    {NOTE_D3, NOTE_TYPE_HALF, 0},
-    {NOTE_A3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_A3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_A3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_G3, NOTE_TYPE_EIGHTH, 1},
+    SONG_NOTE_TIMED(NOTE_D3, HALF, 0),
+    SONG_NOTE_TIMED(NOTE_A3, EIGHTH, 0),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE_TIMED(NOTE_G3, EIGHTH, 1),
 
     //--
 
-    {NOTE_G3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_FS3, NOTE_TYPE_EIGHTH, 1},
-    {NOTE_FS3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_FS3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_E3, NOTE_TYPE_QUARTER, 0},
+    SONG_NOTE_TIMED(NOTE_G3, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_FS3, EIGHTH, 1),
+    SONG_NOTE_TIMED(NOTE_FS3, QUARTER, 0),
+    SONG_NOTE(NOTE_FS3),
+    SONG_NOTE(NOTE_E3),
 
     //--
 
-    {NOTE_D3, NOTE_TYPE_HALF, 0},
-    {NOTE_A3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_A3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_A3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_B3, NOTE_TYPE_EIGHTH, 1},
+    SONG_NOTE_TIMED(NOTE_D3, HALF, 0),
+    SONG_NOTE_TIMED(NOTE_A3, EIGHTH, 0),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE_TIMED(NOTE_B3, EIGHTH, 1),
 
     //--
 
-    {NOTE_B3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_A3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_G3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_FS3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_A3, NOTE_TYPE_EIGHTH, 1},
-    
+    SONG_NOTE_TIMED(NOTE_B3, QUARTER, 0),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE_TIMED(NOTE_A3, EIGHTH, 0),
+    SONG_NOTE(NOTE_G3),
+    SONG_NOTE(NOTE_FS3),
+    SONG_NOTE_TIMED(NOTE_A3, EIGHTH, 1),
+
     //--
 
-    {NOTE_A3, NOTE_TYPE_HALF, 0},
-    {NOTE_E3, NOTE_TYPE_HALF, 1},
+    SONG_NOTE_TIMED(NOTE_A3, HALF, 0),
+    SONG_NOTE_TIMED(NOTE_E3, HALF, 1),
 
     //--
 
-    {NOTE_E3, NOTE_TYPE_HALF, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_FS3, NOTE_TYPE_QUARTER, 0},
+    SONG_NOTE_TIMED(NOTE_E3, HALF, 0),
+    SONG_NOTE_TIMED(NOTE_A3, QUARTER, 0),
+    SONG_NOTE(NOTE_FS3),
 
     //--
 
-    {NOTE_G3, NOTE_TYPE_HALF, 0},
-    {NOTE_G3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_G3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_G3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_FS3, NOTE_TYPE_EIGHTH, 1},
+    SONG_NOTE_TIMED(NOTE_G3, HALF, 0),
+    SONG_NOTE_TIMED(NOTE_G3, EIGHTH, 0),
+    SONG_NOTE(NOTE_G3),
+    SONG_NOTE(NOTE_G3),
+    SONG_NOTE_TIMED(NOTE_FS3, EIGHTH, 1),
 
     //--
 
-    {NOTE_FS3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_G3, NOTE_TYPE_EIGHTH, 1},
-    {NOTE_G3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_E3, NOTE_TYPE_HALF, 0},
+    SONG_NOTE_TIMED(NOTE_FS3, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_G3, EIGHTH, 1),
+    SONG_NOTE_TIMED(NOTE_G3, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_E3, HALF, 0),
 
     //--
 
-    {NOTE_G3, NOTE_TYPE_HALF, 0},
-    {NOTE_G3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_G3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_G3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_FS3, NOTE_TYPE_EIGHTH, 1},
+    SONG_NOTE(NOTE_G3),
+    SONG_NOTE_TIMED(NOTE_G3, EIGHTH, 0),
+    SONG_NOTE(NOTE_G3),
+    SONG_NOTE(NOTE_G3),
+    SONG_NOTE_TIMED(NOTE_FS3, EIGHTH, 1),
 
     //--
 
-    {NOTE_FS3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_G3, NOTE_TYPE_EIGHTH, 1},
-    {NOTE_G3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_E3, NOTE_TYPE_HALF, 0},
+    SONG_NOTE_TIMED(NOTE_FS3, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_G3, EIGHTH, 1),
+    SONG_NOTE_TIMED(NOTE_G3, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_E3, HALF, 0),
 
     //--
 
-    {NOTE_A3, NOTE_TYPE_HALF, 0},
-    {NOTE_A3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_A3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_A3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_B3, NOTE_TYPE_EIGHTH, 1},
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE_TIMED(NOTE_A3, EIGHTH, 0),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE_TIMED(NOTE_B3, EIGHTH, 1),
 
     //--
 
-    {NOTE_B3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_A3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_G3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_G3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_G3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_G3, NOTE_TYPE_EIGHTH, 1},
+    SONG_NOTE_TIMED(NOTE_B3, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_A3, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_A3, EIGHTH, 0),
+    SONG_NOTE(NOTE_G3),
+    SONG_NOTE(NOTE_G3),
+    SONG_NOTE(NOTE_G3),
+    SONG_NOTE_TIMED(NOTE_G3, EIGHTH, 1),
 
     //--
 
-    {NOTE_G3, NOTE_TYPE_EIGHTH, 1},
-    {NOTE_FS3, NOTE_TYPE_EIGHTH, 1},
-    {NOTE_D3, NOTE_TYPE_HALF_DOT, 0},
+    SONG_NOTE(NOTE_G3),
+    SONG_NOTE(NOTE_FS3),
+    SONG_NOTE_TIMED(NOTE_D3, HALF_DOT, 0),
 
     //--
 
-    {NOTE_FS3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_FS3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_G3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_DOT, 1},
+    SONG_NOTE_TIMED(NOTE_FS3, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_FS3, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_G3, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_A3, QUARTER_DOT, 1),
 
     //--
 
-    {NOTE_B3, NOTE_TYPE_QUARTER_DOT, 0},
-    {NOTE_B3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_REST, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_B3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_A3, NOTE_TYPE_EIGHTH, 0},
+    SONG_NOTE_TIMED(NOTE_B3, QUARTER_DOT, 0),
+    SONG_NOTE_TIMED(NOTE_B3, EIGHTH, 0),
+    SONG_NOTE(NOTE_REST),
+    SONG_NOTE_TIMED(NOTE_B3, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_A3, EIGHTH, 0),
 
     //--
 
-    {NOTE_A3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_G3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_G3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_FS3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_G3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_FS3, NOTE_TYPE_EIGHTH, 0},
+    SONG_NOTE_TIMED(NOTE_A3, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_G3, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_G3, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_FS3, EIGHTH, 0),
+    SONG_NOTE(NOTE_G3),
+    SONG_NOTE(NOTE_FS3),
 
     //--
 
-    {NOTE_G3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_FS3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_D3, NOTE_TYPE_QUARTER_DOT, 0},
-    {NOTE_FS3, NOTE_TYPE_QUARTER_DOT, 0},
+    SONG_NOTE(NOTE_G3),
+    SONG_NOTE(NOTE_FS3),
+    SONG_NOTE_TIMED(NOTE_D3, QUARTER_DOT, 0),
+    SONG_NOTE(NOTE_FS3),
 
     //--
 
-    {NOTE_FS3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_FS3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_G3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_DOT, 1},
-    
+    SONG_NOTE_TIMED(NOTE_FS3, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_FS3, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_G3, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_A3, QUARTER_DOT, 1),
+
     //--
 
-    {NOTE_G3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_B3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_B3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_B3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_B3, NOTE_TYPE_QUARTER, 1},
+    SONG_NOTE_TIMED(NOTE_G3, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_B3, EIGHTH, 0),
+    SONG_NOTE(NOTE_B3),
+    SONG_NOTE_TIMED(NOTE_B3, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_B3, QUARTER, 1),
 
     //--
 
-    {NOTE_A3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_A3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_B3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_A3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_A3, NOTE_TYPE_EIGHTH, 1},
-    
+    SONG_NOTE_TIMED(NOTE_A3, QUARTER, 0),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE_TIMED(NOTE_A3, EIGHTH, 0),
+    SONG_NOTE(NOTE_B3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE_TIMED(NOTE_A3, EIGHTH, 1),
+
     //--
 
-    {NOTE_FS3, NOTE_TYPE_QUARTER_DOT, 0},
-    {NOTE_D3, NOTE_TYPE_EIGHTH, 1},
-    {NOTE_D3, NOTE_TYPE_HALF, 0},
+    SONG_NOTE_TIMED(NOTE_FS3, QUARTER_DOT, 0),
+    SONG_NOTE_TIMED(NOTE_D3, EIGHTH, 1),
+    SONG_NOTE_TIMED(NOTE_D3, HALF, 0),
 
     //--
 
-    {NOTE_FS3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_FS3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_G3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_DOT, 1},
+    SONG_NOTE_TIMED(NOTE_FS3, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_FS3, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_G3, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_A3, QUARTER_DOT, 1),
 
     //--
 
-    {NOTE_B3, NOTE_TYPE_QUARTER, 1},
-    {NOTE_B3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_B3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_B3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_B3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_CS4, NOTE_TYPE_EIGHTH, 1},
+    SONG_NOTE_TIMED(NOTE_B3, QUARTER, 1),
+    SONG_NOTE_TIMED(NOTE_B3, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_B3, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_B3, EIGHTH, 0),
+    SONG_NOTE(NOTE_B3),
+    SONG_NOTE_TIMED(NOTE_CS4, EIGHTH, 1),
 
     //--
 
-    {NOTE_CS4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_A3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_B3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_CS4, NOTE_TYPE_QUARTER_DOT, 0},
+    SONG_NOTE_TIMED(NOTE_CS4, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_A3, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_B3, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_CS4, QUARTER_DOT, 0),
 
     //--
 
-    {NOTE_D4, NOTE_TYPE_HALF, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_FS3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_G3, NOTE_TYPE_EIGHTH, 1},
+    SONG_NOTE_TIMED(NOTE_D4, HALF, 0),
+    SONG_NOTE_TIMED(NOTE_A3, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_FS3, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_G3, EIGHTH, 1),
 
     //--
 
-    {NOTE_G3, NOTE_TYPE_HALF, 1},
-    {NOTE_G3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_G3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_G3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_E3, NOTE_TYPE_EIGHTH, 1},
+    SONG_NOTE_TIMED(NOTE_G3, HALF, 1),
+    SONG_NOTE_TIMED(NOTE_G3, EIGHTH, 0),
+    SONG_NOTE(NOTE_G3),
+    SONG_NOTE(NOTE_G3),
+    SONG_NOTE_TIMED(NOTE_E3, EIGHTH, 1),
 
     //--
 
-    {NOTE_E3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_B3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_B3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_B3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_G3, NOTE_TYPE_EIGHTH, 1},
+    SONG_NOTE_TIMED(NOTE_E3, EIGHTH, 0),
+    SONG_NOTE(NOTE_B3),
+    SONG_NOTE(NOTE_B3),
+    SONG_NOTE_TIMED(NOTE_B3, QUARTER, 0),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE_TIMED(NOTE_G3, EIGHTH, 1),
 
     //--
 
-    {NOTE_G3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_G3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_G3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_G3, NOTE_TYPE_EIGHTH, 1},
-    {NOTE_G3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_FS3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_D3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_D3, NOTE_TYPE_EIGHTH, 1},
+    SONG_NOTE_TIMED(NOTE_G3, EIGHTH, 0),
+    SONG_NOTE(NOTE_G3),
+    SONG_NOTE(NOTE_G3),
+    SONG_NOTE_TIMED(NOTE_G3, EIGHTH, 1),
+    SONG_NOTE_TIMED(NOTE_G3, EIGHTH, 0),
+    SONG_NOTE(NOTE_FS3),
+    SONG_NOTE(NOTE_D3),
+    SONG_NOTE_TIMED(NOTE_D3, EIGHTH, 1),
 
     //--
 
-    {NOTE_D3, NOTE_TYPE_QUARTER, 0}
-  }
+    SONG_NOTE_TIMED(NOTE_D3, QUARTER, 0),
+};
+
+const SongNotes Margaritaville = {
+  "Margaritaville",
+  125,  // Tempo
+  163,   // Number of Notes
+  sizeof(MargaritavilleEvents),
+  MargaritavilleEvents
 };
\ No newline at end of file
@@ -1,49 +1,52 @@
 
 #include "Song.h"
 
-const SongNotes MinuetOfForest = {
-  "Minuet of Forest",
-  92,  // Tempo
-  21,   // Number of Notes
-  {
-    {NOTE_D3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_D4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_B3, NOTE_TYPE_HALF, 0},
+static const uint8_t MinuetOfForestEvents[] = {
+    SONG_NOTE_TIMED(NOTE_D3, EIGHTH, 0),
+    SONG_NOTE(NOTE_D4),
+    SONG_NOTE_TIMED(NOTE_B3, HALF, 0),
 
     //--
 
-    {NOTE_A3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_B3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_A3, NOTE_TYPE_HALF, 0},
+    SONG_NOTE_TIMED(NOTE_A3, EIGHTH, 0),
+    SONG_NOTE(NOTE_B3),
+    SONG_NOTE_TIMED(NOTE_A3, HALF, 0),
 
     //--
 
-    {NOTE_D3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_D4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_B3, NOTE_TYPE_HALF, 0},
+    SONG_NOTE_TIMED(NOTE_D3, EIGHTH, 0),
+    SONG_NOTE(NOTE_D4),
+    SONG_NOTE_TIMED(NOTE_B3, HALF, 0),
 
     //--
 
-    {NOTE_A3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_B3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_A3, NOTE_TYPE_HALF, 0},
+    SONG_NOTE_TIMED(NOTE_A3, EIGHTH, 0),
+    SONG_NOTE(NOTE_B3),
+    SONG_NOTE_TIMED(NOTE_A3, HALF, 0),
 
     //--
 
-    {NOTE_E3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_A3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_G3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER, 0},
+    SONG_NOTE_TIMED(NOTE_E3, EIGHTH, 0),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE_TIMED(NOTE_G3, QUARTER, 0),
+    SONG_NOTE(NOTE_A3),
 
     //--
 
-    {NOTE_G3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_G3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_FS3, NOTE_TYPE_HALF, 0},
+    SONG_NOTE_TIMED(NOTE_G3, QUARTER_TRIPLET, 0),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_G3),
+    SONG_NOTE_TIMED(NOTE_FS3, HALF, 0),
 
     //--
 
-    {NOTE_E3, NOTE_TYPE_HALF_DOT, 0},
-  }
+    SONG_NOTE_TIMED(NOTE_E3, HALF_DOT, 0),
+};
+
+const SongNotes MinuetOfForest = {
+  "Minuet of Forest",
+  92,  // Tempo
+  21,   // Number of Notes
+  sizeof(MinuetOfForestEvents),
+  MinuetOfForestEvents
 };
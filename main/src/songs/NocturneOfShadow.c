@@ -1,56 +1,59 @@
 
 #include "Song.h"
 
-const SongNotes NocturneOfShadow = {
-  "Nocturne of Shadow",
-  90,  // Tempo
-  28,   // Number of Notes
-  {
-    {NOTE_B3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_A3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_D3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_B3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_A3, NOTE_TYPE_EIGHTH, 0},
+static const uint8_t NocturneOfShadowEvents[] = {
+    SONG_NOTE_TIMED(NOTE_B3, QUARTER, 0),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE_TIMED(NOTE_A3, EIGHTH, 0),
+    SONG_NOTE(NOTE_D3),
+    SONG_NOTE(NOTE_B3),
+    SONG_NOTE(NOTE_A3),
 
     //--
 
-    {NOTE_F3, NOTE_TYPE_WHOLE, 0},
+    SONG_NOTE_TIMED(NOTE_F3, WHOLE, 0),
 
     //--
 
-    {NOTE_B4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_A4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_A4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_D4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_B4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_A4, NOTE_TYPE_EIGHTH, 0},
+    SONG_NOTE_TIMED(NOTE_B4, QUARTER, 0),
+    SONG_NOTE(NOTE_A4),
+    SONG_NOTE_TIMED(NOTE_A4, EIGHTH, 0),
+    SONG_NOTE(NOTE_D4),
+    SONG_NOTE(NOTE_B4),
+    SONG_NOTE(NOTE_A4),
 
     //--
 
-    {NOTE_F4, NOTE_TYPE_WHOLE, 0},
+    SONG_NOTE_TIMED(NOTE_F4, WHOLE, 0),
 
     //--
 
-    {NOTE_G4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_F4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_F4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_C4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_G4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_F4, NOTE_TYPE_EIGHTH, 0},
+    SONG_NOTE_TIMED(NOTE_G4, QUARTER, 0),
+    SONG_NOTE(NOTE_F4),
+    SONG_NOTE_TIMED(NOTE_F4, EIGHTH, 0),
+    SONG_NOTE(NOTE_C4),
+    SONG_NOTE(NOTE_G4),
+    SONG_NOTE(NOTE_F4),
 
     //--
 
-    {NOTE_GS4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_FS4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_FS4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_CS4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_GS4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_FS4, NOTE_TYPE_EIGHTH, 0},
+    SONG_NOTE_TIMED(NOTE_GS4, QUARTER, 0),
+    SONG_NOTE(NOTE_FS4),
+    SONG_NOTE_TIMED(NOTE_FS4, EIGHTH, 0),
+    SONG_NOTE(NOTE_CS4),
+    SONG_NOTE(NOTE_GS4),
+    SONG_NOTE(NOTE_FS4),
 
     //--
 
-    {NOTE_F4, NOTE_TYPE_WHOLE, 1},
-    {NOTE_F4, NOTE_TYPE_QUARTER, 0},
-  }
+    SONG_NOTE_TIMED(NOTE_F4, WHOLE, 1),
+    SONG_NOTE_TIMED(NOTE_F4, QUARTER, 0),
+};
+
+const SongNotes NocturneOfShadow = {
+  "Nocturne of Shadow",
+  90,  // Tempo
+  28,   // Number of Notes
+  sizeof(NocturneOfShadowEvents),
+  NocturneOfShadowEvents
 };
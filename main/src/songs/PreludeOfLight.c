@@ -1,46 +1,49 @@
 
 #include "Song.h"
 
-const SongNotes PreludeOfLight = {
-  "Prelude of Light",
-  116,  // Tempo
-  18,   // Number of Notes
-  {
-    {NOTE_D5, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_A4, NOTE_TYPE_QUARTER_DOT, 0},
-    {NOTE_D5, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_A4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_B4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_D5, NOTE_TYPE_EIGHTH, 1},
+static const uint8_t PreludeOfLightEvents[] = {
+    SONG_NOTE_TIMED(NOTE_D5, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_A4, QUARTER_DOT, 0),
+    SONG_NOTE_TIMED(NOTE_D5, EIGHTH, 0),
+    SONG_NOTE(NOTE_A4),
+    SONG_NOTE(NOTE_B4),
+    SONG_NOTE_TIMED(NOTE_D5, EIGHTH, 1),
 
     //--
 
-    {NOTE_D5, NOTE_TYPE_WHOLE, 0},
+    SONG_NOTE_TIMED(NOTE_D5, WHOLE, 0),
 
     //--
 
-    {NOTE_D4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_DOT, 0},
-    {NOTE_D4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_A3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_B3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_D4, NOTE_TYPE_EIGHTH, 1},
+    SONG_NOTE_TIMED(NOTE_D4, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_A3, QUARTER_DOT, 0),
+    SONG_NOTE_TIMED(NOTE_D4, EIGHTH, 0),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_B3),
+    SONG_NOTE_TIMED(NOTE_D4, EIGHTH, 1),
 
     //--
 
-    {NOTE_D4, NOTE_TYPE_WHOLE, 0},
+    SONG_NOTE_TIMED(NOTE_D4, WHOLE, 0),
 
     //--
 
-    {NOTE_D4, NOTE_TYPE_WHOLE, 0},
+    SONG_NOTE(NOTE_D4),
 
     //--
 
-    {NOTE_D4, NOTE_TYPE_WHOLE, 0},
+    SONG_NOTE(NOTE_D4),
 
     //--
 
-    {NOTE_CS4, NOTE_TYPE_WHOLE, 1},
-    {NOTE_CS4, NOTE_TYPE_QUARTER, 0},
-  }
+    SONG_NOTE_TIMED(NOTE_CS4, WHOLE, 1),
+    SONG_NOTE_TIMED(NOTE_CS4, QUARTER, 0),
+};
+
+const SongNotes PreludeOfLight = {
+  "Prelude of Light",
+  116,  // Tempo
+  18,   // Number of Notes
+  sizeof(PreludeOfLightEvents),
+  PreludeOfLightEvents
 };
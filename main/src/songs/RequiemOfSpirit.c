@@ -1,48 +1,51 @@
 
 #include "Song.h"
 
-const SongNotes RequiemOfSpirit = {
-  "Requiem of Spirit",
-  80,  // Tempo
-  20,   // Number of Notes
-  {
-    {NOTE_D4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_F4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_D4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_A4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_F4, NOTE_TYPE_QUARTER, 0},
+static const uint8_t RequiemOfSpiritEvents[] = {
+    SONG_NOTE_TIMED(NOTE_D4, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_F4, EIGHTH, 0),
+    SONG_NOTE(NOTE_D4),
+    SONG_NOTE_TIMED(NOTE_A4, QUARTER, 0),
+    SONG_NOTE(NOTE_F4),
 
     //--
 
-    {NOTE_D4, NOTE_TYPE_WHOLE, 0},
+    SONG_NOTE_TIMED(NOTE_D4, WHOLE, 0),
 
     //--
 
-    {NOTE_D3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_F3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_D3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_F3, NOTE_TYPE_QUARTER, 0},
+    SONG_NOTE_TIMED(NOTE_D3, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_F3, EIGHTH, 0),
+    SONG_NOTE(NOTE_D3),
+    SONG_NOTE_TIMED(NOTE_A3, QUARTER, 0),
+    SONG_NOTE(NOTE_F3),
 
     //--
 
-    {NOTE_D3, NOTE_TYPE_WHOLE, 0},
+    SONG_NOTE_TIMED(NOTE_D3, WHOLE, 0),
 
     //--
 
-    {NOTE_D4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_F4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_D4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_A4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_F4, NOTE_TYPE_QUARTER, 0},
+    SONG_NOTE_TIMED(NOTE_D4, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_F4, EIGHTH, 0),
+    SONG_NOTE(NOTE_D4),
+    SONG_NOTE_TIMED(NOTE_A4, QUARTER, 0),
+    SONG_NOTE(NOTE_F4),
 
     //--
 
-    {NOTE_D4, NOTE_TYPE_HALF, 0},
-    {NOTE_A3, NOTE_TYPE_HALF, 0},
+    SONG_NOTE_TIMED(NOTE_D4, HALF, 0),
+    SONG_NOTE(NOTE_A3),
 
     //--
 
-    {NOTE_D3, NOTE_TYPE_WHOLE, 0},
-  }
+    SONG_NOTE_TIMED(NOTE_D3, WHOLE, 0),
+};
+
+const SongNotes RequiemOfSpirit = {
+  "Requiem of Spirit",
+  80,  // Tempo
+  20,   // Number of Notes
+  sizeof(RequiemOfSpiritEvents),
+  RequiemOfSpiritEvents
 };
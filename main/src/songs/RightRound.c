@@ -1,171 +1,174 @@
 
 #include "Song.h"
 
-const SongNotes RightRound = {
-  "RightRound",
-  125,  // Tempo
-  116,   // Number of Notes
-  {
-    {NOTE_REST, NOTE_TYPE_QUARTER, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER, 0},
+static const uint8_t RightRoundEvents[] = {
+    SONG_NOTE_TIMED(NOTE_REST, QUARTER, 0),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
 
     //--
 
-    {NOTE_C4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_C4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_G3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_D4, NOTE_TYPE_QUARTER, 0},
+    SONG_NOTE(NOTE_C4),
+    SONG_NOTE(NOTE_C4),
+    SONG_NOTE(NOTE_G3),
+    SONG_NOTE(NOTE_D4),
 
     //--
 
-    {NOTE_A3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_A3, NOTE_TYPE_EIGHTH_DOT, 0},
-    {NOTE_A3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_D4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER, 0},
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE_TIMED(NOTE_A3, EIGHTH_DOT, 0),
+    SONG_NOTE_TIMED(NOTE_A3, SIXTEENTH, 0),
+    SONG_NOTE_TIMED(NOTE_D4, QUARTER, 0),
+    SONG_NOTE(NOTE_A3),
 
     //--
 
-    {NOTE_G3, NOTE_TYPE_EIGHTH_DOT, 0},
-    {NOTE_G3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_D4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER, 0},
+    SONG_NOTE_TIMED(NOTE_G3, EIGHTH_DOT, 0),
+    SONG_NOTE_TIMED(NOTE_G3, SIXTEENTH, 0),
+    SONG_NOTE_TIMED(NOTE_A3, QUARTER, 0),
+    SONG_NOTE(NOTE_D4),
+    SONG_NOTE(NOTE_A3),
 
     //--
 
-    {NOTE_REST, NOTE_TYPE_QUARTER, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER, 0},
+    SONG_NOTE(NOTE_REST),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
 
     //--
 
-    {NOTE_C4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_C4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_G3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_D4, NOTE_TYPE_QUARTER, 0},
+    SONG_NOTE(NOTE_C4),
+    SONG_NOTE(NOTE_C4),
+    SONG_NOTE(NOTE_G3),
+    SONG_NOTE(NOTE_D4),
 
     //--
 
-    {NOTE_A3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_A3, NOTE_TYPE_EIGHTH_DOT, 0},
-    {NOTE_A3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_D4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER, 0},
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE_TIMED(NOTE_A3, EIGHTH_DOT, 0),
+    SONG_NOTE_TIMED(NOTE_A3, SIXTEENTH, 0),
+    SONG_NOTE_TIMED(NOTE_D4, QUARTER, 0),
+    SONG_NOTE(NOTE_A3),
 
     //--
 
-    {NOTE_G3, NOTE_TYPE_EIGHTH_DOT, 0},
-    {NOTE_G3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_D4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER, 0},
+    SONG_NOTE_TIMED(NOTE_G3, EIGHTH_DOT, 0),
+    SONG_NOTE_TIMED(NOTE_G3, SIXTEENTH, 0),
+    SONG_NOTE_TIMED(NOTE_A3, QUARTER, 0),
+    SONG_NOTE(NOTE_D4),
+    SONG_NOTE(NOTE_A3),
 
     //--
 
-    {NOTE_A3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE_TIMED(NOTE_A3, QUARTER_TRIPLET, 0),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
 
     //--
 
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_C4, NOTE_TYPE_QUARTER, 0},
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE_TIMED(NOTE_C4, QUARTER, 0),
 
     //--
 
-    {NOTE_REST, NOTE_TYPE_QUARTER, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
+    SONG_NOTE(NOTE_REST),
+    SONG_NOTE_TIMED(NOTE_A3, QUARTER_TRIPLET, 0),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
 
     //--
 
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_C4, NOTE_TYPE_QUARTER, 0},
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE_TIMED(NOTE_C4, QUARTER, 0),
 
     //--
 
-    {NOTE_REST, NOTE_TYPE_QUARTER, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
+    SONG_NOTE(NOTE_REST),
+    SONG_NOTE_TIMED(NOTE_A3, QUARTER_TRIPLET, 0),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
 
     //--
 
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_C4, NOTE_TYPE_QUARTER, 0},
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE_TIMED(NOTE_C4, QUARTER, 0),
 
     //--
 
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_C3, NOTE_TYPE_QUARTER, 0},
+    SONG_NOTE_TIMED(NOTE_A3, QUARTER_TRIPLET, 0),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE_TIMED(NOTE_C3, QUARTER, 0),
 
     //--
 
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_C3, NOTE_TYPE_QUARTER, 0}
-  }
+    SONG_NOTE_TIMED(NOTE_A3, QUARTER_TRIPLET, 0),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE_TIMED(NOTE_C3, QUARTER, 0),
+};
+
+const SongNotes RightRound = {
+  "RightRound",
+  125,  // Tempo
+  116,   // Number of Notes
+  sizeof(RightRoundEvents),
+  RightRoundEvents
 };
@@ -1,149 +1,152 @@
 
 #include "Song.h"
 
-const SongNotes SariasSong = {
-  "Saria's Song",
-  150,  // Tempo
-  88,   // Number of Notes
-  {
-    {NOTE_F3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_A3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_B3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_F3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_A3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_B3, NOTE_TYPE_QUARTER, 0},
+static const uint8_t SariasSongEvents[] = {
+    SONG_NOTE_TIMED(NOTE_F3, EIGHTH, 0),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE_TIMED(NOTE_B3, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_F3, EIGHTH, 0),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE_TIMED(NOTE_B3, QUARTER, 0),
 
     // --
 
-    {NOTE_F3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_A3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_B3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_E4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_D4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_B3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_C4, NOTE_TYPE_EIGHTH, 0},
+    SONG_NOTE_TIMED(NOTE_F3, EIGHTH, 0),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_B3),
+    SONG_NOTE(NOTE_E4),
+    SONG_NOTE_TIMED(NOTE_D4, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_B3, EIGHTH, 0),
+    SONG_NOTE(NOTE_C4),
 
     // --
 
-    {NOTE_B3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_G3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_E3, NOTE_TYPE_QUARTER, 1},
-    {NOTE_E3, NOTE_TYPE_QUARTER_DOT, 0},
-    {NOTE_D3, NOTE_TYPE_EIGHTH, 0},
+    SONG_NOTE(NOTE_B3),
+    SONG_NOTE(NOTE_G3),
+    SONG_NOTE_TIMED(NOTE_E3, QUARTER, 1),
+    SONG_NOTE_TIMED(NOTE_E3, QUARTER_DOT, 0),
+    SONG_NOTE_TIMED(NOTE_D3, EIGHTH, 0),
 
     // --
 
-    {NOTE_E3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_G3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_E3, NOTE_TYPE_HALF_DOT, 0},
+    SONG_NOTE(NOTE_E3),
+    SONG_NOTE(NOTE_G3),
+    SONG_NOTE_TIMED(NOTE_E3, HALF_DOT, 0),
 
     // --
 
-    {NOTE_F3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_A3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_B3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_F3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_A3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_B3, NOTE_TYPE_QUARTER, 0},
+    SONG_NOTE_TIMED(NOTE_F3, EIGHTH, 0),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE_TIMED(NOTE_B3, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_F3, EIGHTH, 0),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE_TIMED(NOTE_B3, QUARTER, 0),
 
     // --
 
-    {NOTE_F3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_A3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_B3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_E4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_D4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_B3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_C4, NOTE_TYPE_EIGHTH, 0},
+    SONG_NOTE_TIMED(NOTE_F3, EIGHTH, 0),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_B3),
+    SONG_NOTE(NOTE_E4),
+    SONG_NOTE_TIMED(NOTE_D4, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_B3, EIGHTH, 0),
+    SONG_NOTE(NOTE_C4),
 
     // --
 
-    {NOTE_E4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_C4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_G3, NOTE_TYPE_QUARTER, 1},
-    {NOTE_G3, NOTE_TYPE_QUARTER_DOT, 0},
-    {NOTE_B3, NOTE_TYPE_EIGHTH, 0},
+    SONG_NOTE(NOTE_E4),
+    SONG_NOTE(NOTE_C4),
+    SONG_NOTE_TIMED(NOTE_G3, QUARTER, 1),
+    SONG_NOTE_TIMED(NOTE_G3, QUARTER_DOT, 0),
+    SONG_NOTE_TIMED(NOTE_B3, EIGHTH, 0),
 
     // --
 
-    {NOTE_G3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_D3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_E3, NOTE_TYPE_HALF_DOT, 0},
+    SONG_NOTE(NOTE_G3),
+    SONG_NOTE(NOTE_D3),
+    SONG_NOTE_TIMED(NOTE_E3, HALF_DOT, 0),
 
     // --
 
-    {NOTE_D3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_E3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_F3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_G3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_A3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_B3, NOTE_TYPE_QUARTER, 0},
+    SONG_NOTE_TIMED(NOTE_D3, EIGHTH, 0),
+    SONG_NOTE(NOTE_E3),
+    SONG_NOTE_TIMED(NOTE_F3, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_G3, EIGHTH, 0),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE_TIMED(NOTE_B3, QUARTER, 0),
 
     // --
 
-    {NOTE_C4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_B3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_E3, NOTE_TYPE_HALF_DOT, 0},
+    SONG_NOTE_TIMED(NOTE_C4, EIGHTH, 0),
+    SONG_NOTE(NOTE_B3),
+    SONG_NOTE_TIMED(NOTE_E3, HALF_DOT, 0),
 
     // --
 
-    {NOTE_F3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_G3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_B3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_C4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_D4, NOTE_TYPE_QUARTER, 0},
+    SONG_NOTE_TIMED(NOTE_F3, EIGHTH, 0),
+    SONG_NOTE(NOTE_G3),
+    SONG_NOTE_TIMED(NOTE_A3, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_B3, EIGHTH, 0),
+    SONG_NOTE(NOTE_C4),
+    SONG_NOTE_TIMED(NOTE_D4, QUARTER, 0),
 
     // --
 
-    {NOTE_E4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_F4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_G4, NOTE_TYPE_HALF_DOT, 0},
+    SONG_NOTE_TIMED(NOTE_E4, EIGHTH, 0),
+    SONG_NOTE(NOTE_F4),
+    SONG_NOTE_TIMED(NOTE_G4, HALF_DOT, 0),
 
     // --
 
-    {NOTE_D3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_E3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_F3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_G3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_A3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_B3, NOTE_TYPE_QUARTER, 0},
+    SONG_NOTE_TIMED(NOTE_D3, EIGHTH, 0),
+    SONG_NOTE(NOTE_E3),
+    SONG_NOTE_TIMED(NOTE_F3, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_G3, EIGHTH, 0),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE_TIMED(NOTE_B3, QUARTER, 0),
 
     // --
 
-    {NOTE_C4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_B3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_E3, NOTE_TYPE_HALF_DOT, 0},
+    SONG_NOTE_TIMED(NOTE_C4, EIGHTH, 0),
+    SONG_NOTE(NOTE_B3),
+    SONG_NOTE_TIMED(NOTE_E3, HALF_DOT, 0),
 
     // --
 
-    {NOTE_F3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_E3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_G3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_F3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_A3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_G3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_B3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_A3, NOTE_TYPE_EIGHTH, 0},
+    SONG_NOTE_TIMED(NOTE_F3, EIGHTH, 0),
+    SONG_NOTE(NOTE_E3),
+    SONG_NOTE(NOTE_G3),
+    SONG_NOTE(NOTE_F3),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_G3),
+    SONG_NOTE(NOTE_B3),
+    SONG_NOTE(NOTE_A3),
 
     // --
 
-    {NOTE_C4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_B3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_D4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_C4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_E4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_D4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_E4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_D4, NOTE_TYPE_SIXTEENTH, 0},
+    SONG_NOTE(NOTE_C4),
+    SONG_NOTE(NOTE_B3),
+    SONG_NOTE(NOTE_D4),
+    SONG_NOTE(NOTE_C4),
+    SONG_NOTE(NOTE_E4),
+    SONG_NOTE(NOTE_D4),
+    SONG_NOTE_TIMED(NOTE_E4, SIXTEENTH, 0),
+    SONG_NOTE_TIMED(NOTE_F4, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_D4, SIXTEENTH, 0),
 
     // --
 
-    {NOTE_E4, NOTE_TYPE_WHOLE, 1},
+    SONG_NOTE_TIMED(NOTE_E4, WHOLE, 1),
 
     // --
 
-    {NOTE_E4, NOTE_TYPE_HALF, 0},
-  }
+    SONG_NOTE_TIMED(NOTE_E4, HALF, 0),
+};
+
+const SongNotes SariasSong = {
+  "Saria's Song",
+  150,  // Tempo
+  88,   // Number of Notes
+  sizeof(SariasSongEvents),
+  SariasSongEvents
 };
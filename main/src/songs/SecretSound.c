@@ -1,19 +1,22 @@
 
 #include "Song.h"
 
+static const uint8_t SecretSoundEvents[] = {
+    SONG_NOTE_TIMED(NOTE_GF6, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_F6),
+    SONG_NOTE(NOTE_D6),
+    SONG_NOTE(NOTE_AF5),
+
+    SONG_NOTE(NOTE_G5),
+    SONG_NOTE(NOTE_EF6),
+    SONG_NOTE(NOTE_G6),
+    SONG_NOTE(NOTE_B6),
+};
+
 const SongNotes SecretSound = {
   "Secret Sound",
   120,  // Tempo
   8,   // Number of Notes
-  {
-    {NOTE_GF6, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F6, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_D6, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_AF5, NOTE_TYPE_SIXTEENTH, 0},
-
-    {NOTE_G5, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_EF6, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_G6, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_B6, NOTE_TYPE_SIXTEENTH, 0},
-  }
+  sizeof(SecretSoundEvents),
+  SecretSoundEvents
 };
\ No newline at end of file
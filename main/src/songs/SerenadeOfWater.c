@@ -1,48 +1,51 @@
 
 #include "Song.h"
 
-const SongNotes SerenadeOfWater = {
-  "Serenade of Water",
-  85,  // Tempo
-  20,   // Number of Notes
-  {
-    {NOTE_D3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_F3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_A3, NOTE_TYPE_QUARTER, 0},
+static const uint8_t SerenadeOfWaterEvents[] = {
+    SONG_NOTE_TIMED(NOTE_D3, QUARTER, 0),
+    SONG_NOTE(NOTE_F3),
+    SONG_NOTE(NOTE_A3),
 
     //--
 
-    {NOTE_A3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_B3, NOTE_TYPE_HALF, 0},
-    {NOTE_REST, NOTE_TYPE_THIRTY_SECOND, 0},
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE_TIMED(NOTE_B3, HALF, 0),
+    SONG_NOTE_TIMED(NOTE_REST, THIRTY_SECOND, 0),
 
     //--
 
-    {NOTE_D4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_F4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_A4, NOTE_TYPE_QUARTER, 0},
+    SONG_NOTE_TIMED(NOTE_D4, QUARTER, 0),
+    SONG_NOTE(NOTE_F4),
+    SONG_NOTE(NOTE_A4),
 
     //--
 
-    {NOTE_A4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_B4, NOTE_TYPE_HALF, 0},
-    {NOTE_REST, NOTE_TYPE_THIRTY_SECOND, 0},
+    SONG_NOTE(NOTE_A4),
+    SONG_NOTE_TIMED(NOTE_B4, HALF, 0),
+    SONG_NOTE_TIMED(NOTE_REST, THIRTY_SECOND, 0),
 
     //--
 
-    {NOTE_A4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_D4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_F4, NOTE_TYPE_QUARTER, 0},
+    SONG_NOTE_TIMED(NOTE_A4, QUARTER, 0),
+    SONG_NOTE(NOTE_D4),
+    SONG_NOTE(NOTE_F4),
 
     //--
 
-    {NOTE_G4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_F4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_E4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_G4, NOTE_TYPE_QUARTER, 0},
+    SONG_NOTE_TIMED(NOTE_G4, EIGHTH, 0),
+    SONG_NOTE(NOTE_F4),
+    SONG_NOTE_TIMED(NOTE_E4, QUARTER, 0),
+    SONG_NOTE(NOTE_G4),
 
     //--
 
-    {NOTE_FS4, NOTE_TYPE_HALF_DOT, 0},
-  }
+    SONG_NOTE_TIMED(NOTE_FS4, HALF_DOT, 0),
+};
+
+const SongNotes SerenadeOfWater = {
+  "Serenade of Water",
+  85,  // Tempo
+  20,   // Number of Notes
+  sizeof(SerenadeOfWaterEvents),
+  SerenadeOfWaterEvents
 };
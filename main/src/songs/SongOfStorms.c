@@ -1,70 +1,73 @@
 
 #include "Song.h"
 
-const SongNotes SongOfStorms = {
-  "Song of Storms",
-  180,  // Tempo
-  43,   // Number of Notes
-  {
-    {NOTE_D3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_F3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_D4, NOTE_TYPE_HALF, 0},
+static const uint8_t SongOfStormsEvents[] = {
+    SONG_NOTE_TIMED(NOTE_D3, EIGHTH, 0),
+    SONG_NOTE(NOTE_F3),
+    SONG_NOTE_TIMED(NOTE_D4, HALF, 0),
 
-    {NOTE_D3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_F3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_D4, NOTE_TYPE_HALF, 0},
+    SONG_NOTE_TIMED(NOTE_D3, EIGHTH, 0),
+    SONG_NOTE(NOTE_F3),
+    SONG_NOTE_TIMED(NOTE_D4, HALF, 0),
 
-    {NOTE_E4, NOTE_TYPE_QUARTER_DOT, 0},
-    {NOTE_F4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_E4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_F4, NOTE_TYPE_EIGHTH, 0},
+    SONG_NOTE_TIMED(NOTE_E4, QUARTER_DOT, 0),
+    SONG_NOTE_TIMED(NOTE_F4, EIGHTH, 0),
+    SONG_NOTE(NOTE_E4),
+    SONG_NOTE(NOTE_F4),
 
-    {NOTE_E4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_C4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_A3, NOTE_TYPE_HALF, 0},
+    SONG_NOTE(NOTE_E4),
+    SONG_NOTE(NOTE_C4),
+    SONG_NOTE_TIMED(NOTE_A3, HALF, 0),
 
     // --
 
-    {NOTE_A3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_D3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_F3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_G3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_A3, NOTE_TYPE_HALF_DOT, 0},
+    SONG_NOTE_TIMED(NOTE_A3, QUARTER, 0),
+    SONG_NOTE(NOTE_D3),
+    SONG_NOTE_TIMED(NOTE_F3, EIGHTH, 0),
+    SONG_NOTE(NOTE_G3),
+    SONG_NOTE_TIMED(NOTE_A3, HALF_DOT, 0),
 
-    {NOTE_A3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_D3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_F3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_G3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_E3, NOTE_TYPE_HALF_DOT, 0},
+    SONG_NOTE_TIMED(NOTE_A3, QUARTER, 0),
+    SONG_NOTE(NOTE_D3),
+    SONG_NOTE_TIMED(NOTE_F3, EIGHTH, 0),
+    SONG_NOTE(NOTE_G3),
+    SONG_NOTE_TIMED(NOTE_E3, HALF_DOT, 0),
 
     // --
 
-    {NOTE_D3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_F3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_D4, NOTE_TYPE_HALF, 0},
-    
-    {NOTE_D3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_F3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_D4, NOTE_TYPE_HALF, 0},
+    SONG_NOTE_TIMED(NOTE_D3, EIGHTH, 0),
+    SONG_NOTE(NOTE_F3),
+    SONG_NOTE_TIMED(NOTE_D4, HALF, 0),
+
+    SONG_NOTE_TIMED(NOTE_D3, EIGHTH, 0),
+    SONG_NOTE(NOTE_F3),
+    SONG_NOTE_TIMED(NOTE_D4, HALF, 0),
 
-    {NOTE_E4, NOTE_TYPE_QUARTER_DOT, 0},
-    {NOTE_F4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_E4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_F4, NOTE_TYPE_EIGHTH, 0},
+    SONG_NOTE_TIMED(NOTE_E4, QUARTER_DOT, 0),
+    SONG_NOTE_TIMED(NOTE_F4, EIGHTH, 0),
+    SONG_NOTE(NOTE_E4),
+    SONG_NOTE(NOTE_F4),
 
-    {NOTE_E4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_C4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_A3, NOTE_TYPE_HALF, 0},
+    SONG_NOTE(NOTE_E4),
+    SONG_NOTE(NOTE_C4),
+    SONG_NOTE_TIMED(NOTE_A3, HALF, 0),
 
     // --
 
-    {NOTE_A3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_D3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_F3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_G3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_A3, NOTE_TYPE_HALF, 0},
+    SONG_NOTE_TIMED(NOTE_A3, QUARTER, 0),
+    SONG_NOTE(NOTE_D3),
+    SONG_NOTE_TIMED(NOTE_F3, EIGHTH, 0),
+    SONG_NOTE(NOTE_G3),
+    SONG_NOTE_TIMED(NOTE_A3, HALF, 0),
 
-    {NOTE_A3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_D3, NOTE_TYPE_HALF_DOT, 0},
-  }
+    SONG_NOTE_TIMED(NOTE_A3, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_D3, HALF_DOT, 0),
+};
+
+const SongNotes SongOfStorms = {
+  "Song of Storms",
+  180,  // Tempo
+  43,   // Number of Notes
+  sizeof(SongOfStormsEvents),
+  SongOfStormsEvents
 };
@@ -1,40 +1,43 @@
 
 #include "Song.h"
 
-const SongNotes SongOfTime = {
-  "Song of Time",
-  104,  // Tempo
-  18,   // Number of Notes
-  {
-    {NOTE_A4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_D4, NOTE_TYPE_HALF, 0},
-    {NOTE_F4, NOTE_TYPE_QUARTER, 0},
+static const uint8_t SongOfTimeEvents[] = {
+    SONG_NOTE_TIMED(NOTE_A4, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_D4, HALF, 0),
+    SONG_NOTE_TIMED(NOTE_F4, QUARTER, 0),
 
     // --
 
-    {NOTE_A4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_D4, NOTE_TYPE_HALF, 0},
-    {NOTE_F4, NOTE_TYPE_QUARTER, 0},
+    SONG_NOTE(NOTE_A4),
+    SONG_NOTE_TIMED(NOTE_D4, HALF, 0),
+    SONG_NOTE_TIMED(NOTE_F4, QUARTER, 0),
 
     // --
 
-    {NOTE_A4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_C5, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_B4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_G4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_F4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_G4, NOTE_TYPE_EIGHTH, 0},
+    SONG_NOTE_TIMED(NOTE_A4, EIGHTH, 0),
+    SONG_NOTE(NOTE_C5),
+    SONG_NOTE_TIMED(NOTE_B4, QUARTER, 0),
+    SONG_NOTE(NOTE_G4),
+    SONG_NOTE_TIMED(NOTE_F4, EIGHTH, 0),
+    SONG_NOTE(NOTE_G4),
 
     // --
 
-    {NOTE_A4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_D4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_C4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_E4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_D4, NOTE_TYPE_QUARTER, 1},
+    SONG_NOTE_TIMED(NOTE_A4, QUARTER, 0),
+    SONG_NOTE(NOTE_D4),
+    SONG_NOTE_TIMED(NOTE_C4, EIGHTH, 0),
+    SONG_NOTE(NOTE_E4),
+    SONG_NOTE_TIMED(NOTE_D4, QUARTER, 1),
 
     //--
 
-    {NOTE_D4, NOTE_TYPE_HALF, 0},
-  }
+    SONG_NOTE_TIMED(NOTE_D4, HALF, 0),
+};
+
+const SongNotes SongOfTime = {
+  "Song of Time",
+  104,  // Tempo
+  18,   // Number of Notes
+  sizeof(SongOfTimeEvents),
+  SongOfTimeEvents
 };
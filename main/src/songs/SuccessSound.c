@@ -1,16 +1,19 @@
 
 #include "Song.h"
 
+static const uint8_t SuccessSoundEvents[] = {
+    SONG_NOTE_TIMED(NOTE_A5, EIGHTH, 1),
+    SONG_NOTE(NOTE_B5),
+    SONG_NOTE(NOTE_D6),
+    SONG_NOTE(NOTE_E6),
+    SONG_NOTE_TIMED(NOTE_A6, QUARTER, 1),
+    SONG_NOTE(NOTE_REST),
+};
+
 const SongNotes SuccessSound = {
   "Success Sound",
-  240,   // Tempo
+  240,  // Tempo
   6,   // Number of Notes
-  {
-    {NOTE_A5, NOTE_TYPE_EIGHTH, 1},
-    {NOTE_B5, NOTE_TYPE_EIGHTH, 1},
-    {NOTE_D6, NOTE_TYPE_EIGHTH, 1},
-    {NOTE_E6, NOTE_TYPE_EIGHTH, 1},
-    {NOTE_A6, NOTE_TYPE_QUARTER, 1},
-    {NOTE_REST, NOTE_TYPE_QUARTER, 1}
-  }
+  sizeof(SuccessSoundEvents),
+  SuccessSoundEvents
 };
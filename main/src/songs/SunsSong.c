@@ -1,33 +1,36 @@
 
 #include "Song.h"
 
-const SongNotes SunsSong = {
-  "Sun's Song",
-  150,  // Tempo
-  16,   // Number of Notes
-  {
-    {NOTE_A3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_F3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_D4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_REST, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_A3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_F3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_D4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_REST, NOTE_TYPE_EIGHTH, 0},
+static const uint8_t SunsSongEvents[] = {
+    SONG_NOTE_TIMED(NOTE_A3, EIGHTH, 0),
+    SONG_NOTE(NOTE_F3),
+    SONG_NOTE_TIMED(NOTE_D4, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_REST, EIGHTH, 0),
+    SONG_NOTE(NOTE_A3),
+    SONG_NOTE(NOTE_F3),
+    SONG_NOTE_TIMED(NOTE_D4, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_REST, EIGHTH, 0),
 
     // --
 
-    {NOTE_A3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_B3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_C4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_D4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_E4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_G4, NOTE_TYPE_SIXTEENTH, 1},
-    {NOTE_G4, NOTE_TYPE_HALF_DOT, 1},
+    SONG_NOTE_TIMED(NOTE_A3, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_B3),
+    SONG_NOTE(NOTE_C4),
+    SONG_NOTE(NOTE_D4),
+    SONG_NOTE(NOTE_E4),
+    SONG_NOTE(NOTE_F4),
+    SONG_NOTE_TIMED(NOTE_G4, SIXTEENTH, 1),
+    SONG_NOTE_TIMED(NOTE_G4, HALF_DOT, 1),
 
     // --
-    
-    {NOTE_G4, NOTE_TYPE_HALF_DOT, 0},
-  }
+
+    SONG_NOTE_TIMED(NOTE_G4, HALF_DOT, 0),
+};
+
+const SongNotes SunsSong = {
+  "Sun's Song",
+  150,  // Tempo
+  17,   // Number of Notes
+  sizeof(SunsSongEvents),
+  SunsSongEvents
 };
\ No newline at end of file
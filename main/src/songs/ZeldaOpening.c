@@ -1,329 +1,332 @@
 
 #include "Song.h"
 
-const SongNotes ZeldaOpening = {
-  "Legend of Zelda Opening",
-  90,   // Tempo
-  232,   // Number of Notes
-  {
-    {NOTE_AS3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_AS2, NOTE_TYPE_QUARTER, 0},
-    {NOTE_F3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_F3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_F3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_AS3, NOTE_TYPE_EIGHTH, 0},
+static const uint8_t ZeldaOpeningEvents[] = {
+    SONG_NOTE_TIMED(NOTE_AS3, QUARTER, 0),
+    SONG_NOTE(NOTE_AS2),
+    SONG_NOTE_TIMED(NOTE_F3, EIGHTH, 0),
+    SONG_NOTE(NOTE_F3),
+    SONG_NOTE(NOTE_F3),
+    SONG_NOTE(NOTE_AS3),
+
+    // --
+
+    SONG_NOTE_TIMED(NOTE_GS3, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_FS3),
+    SONG_NOTE_TIMED(NOTE_GS3, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_DS3, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_GS3, HALF, 0),
 
     // --
 
-    {NOTE_GS3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_FS3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_GS3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_DS3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_GS3, NOTE_TYPE_HALF, 0},
+    SONG_NOTE_TIMED(NOTE_AS3, QUARTER, 0),
+    SONG_NOTE(NOTE_AS2),
+    SONG_NOTE_TIMED(NOTE_FS3, EIGHTH, 0),
+    SONG_NOTE(NOTE_FS3),
+    SONG_NOTE(NOTE_FS3),
+    SONG_NOTE(NOTE_AS3),
 
     // --
 
-    {NOTE_AS3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_AS2, NOTE_TYPE_QUARTER, 0},
-    {NOTE_FS3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_FS3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_FS3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_AS3, NOTE_TYPE_EIGHTH, 0},
+    SONG_NOTE_TIMED(NOTE_A3, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_G3),
+    SONG_NOTE_TIMED(NOTE_A3, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_F3, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_A3, HALF, 0),
 
     // --
 
-    {NOTE_A3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_G3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_A3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_F3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_A3, NOTE_TYPE_HALF, 0},
-    
+    SONG_NOTE_TIMED(NOTE_CS3, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_CS3, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_AS2),
+    SONG_NOTE_TIMED(NOTE_F3, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_F3, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_AS2),
+    SONG_NOTE_TIMED(NOTE_F3, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_F3, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_AS2),
+    SONG_NOTE(NOTE_F3),
+    SONG_NOTE(NOTE_AS2),
+    SONG_NOTE(NOTE_F3),
+    SONG_NOTE(NOTE_AS2),
+
+    // --
+
+    SONG_NOTE_TIMED(NOTE_CS3, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_CS3, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_AS2),
+    SONG_NOTE_TIMED(NOTE_F3, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_F3, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_AS2),
+    SONG_NOTE_TIMED(NOTE_F3, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_F3, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_AS2),
+    SONG_NOTE(NOTE_F3),
+    SONG_NOTE(NOTE_AS2),
+    SONG_NOTE(NOTE_F3),
+    SONG_NOTE(NOTE_AS2),
+
     // --
 
-    {NOTE_CS3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_CS3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_AS2, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_F3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_AS2, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_F3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_AS2, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_AS2, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_AS2, NOTE_TYPE_SIXTEENTH, 0},
+    SONG_NOTE_TIMED(NOTE_AS3, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_F3, QUARTER_DOT, 0),
+    SONG_NOTE_TIMED(NOTE_AS3, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_AS3, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_C4),
+    SONG_NOTE(NOTE_D4),
+    SONG_NOTE(NOTE_DS4),
 
     // --
 
-    {NOTE_CS3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_CS3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_AS2, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_F3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_AS2, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_F3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_AS2, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_AS2, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_AS2, NOTE_TYPE_SIXTEENTH, 0},
+    SONG_NOTE_TIMED(NOTE_F4, EIGHTH, 0),
+    SONG_NOTE(NOTE_AS2),
+    SONG_NOTE_TIMED(NOTE_AS2, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_C3),
+    SONG_NOTE(NOTE_D3),
+    SONG_NOTE(NOTE_DS3),
+    SONG_NOTE_TIMED(NOTE_F3, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_DS3, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_GS2),
+    SONG_NOTE(NOTE_DS3),
+    SONG_NOTE(NOTE_GS2),
+    SONG_NOTE(NOTE_DS3),
+    SONG_NOTE(NOTE_GS2),
 
     // --
 
-    {NOTE_AS3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_F3, NOTE_TYPE_QUARTER_DOT, 0},
-    {NOTE_AS3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_AS3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_C4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_D4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_DS4, NOTE_TYPE_SIXTEENTH, 0},
+    SONG_NOTE_TIMED(NOTE_AS3, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_F3, QUARTER_DOT, 0),
+    SONG_NOTE_TIMED(NOTE_AS3, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_AS3, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_C4),
+    SONG_NOTE(NOTE_D4),
+    SONG_NOTE(NOTE_DS4),
 
     // --
 
-    {NOTE_F4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_AS2, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_AS2, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_C3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_D3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_DS3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_DS3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_GS2, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_DS3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_GS2, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_DS3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_GS2, NOTE_TYPE_SIXTEENTH, 0},
+    SONG_NOTE_TIMED(NOTE_F4, EIGHTH, 0),
+    SONG_NOTE(NOTE_AS2),
+    SONG_NOTE_TIMED(NOTE_AS2, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_C3),
+    SONG_NOTE(NOTE_D3),
+    SONG_NOTE(NOTE_DS3),
+    SONG_NOTE_TIMED(NOTE_F3, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_C3, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_F2),
+    SONG_NOTE(NOTE_C3),
+    SONG_NOTE(NOTE_F2),
+    SONG_NOTE(NOTE_C3),
+    SONG_NOTE(NOTE_F2),
 
     // --
 
-    {NOTE_AS3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_F3, NOTE_TYPE_QUARTER_DOT, 0},
-    {NOTE_AS3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_AS3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_C4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_D4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_DS4, NOTE_TYPE_SIXTEENTH, 0},
+    SONG_NOTE_TIMED(NOTE_AS3, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_F3, QUARTER_DOT, 0),
+    SONG_NOTE_TIMED(NOTE_AS3, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_AS3, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_C4),
+    SONG_NOTE(NOTE_D4),
+    SONG_NOTE(NOTE_DS4),
 
     // --
 
-    {NOTE_F4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_AS2, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_AS2, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_C3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_D3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_DS3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_C3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F2, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_C3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F2, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_C3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F2, NOTE_TYPE_SIXTEENTH, 0},
+    SONG_NOTE_TIMED(NOTE_F4, EIGHTH, 0),
+    SONG_NOTE(NOTE_AS3),
+    SONG_NOTE_TIMED(NOTE_AS3, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_C4),
+    SONG_NOTE(NOTE_D4),
+    SONG_NOTE(NOTE_DS4),
+    SONG_NOTE_TIMED(NOTE_F4, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_F4, QUARTER_TRIPLET, 0),
+    SONG_NOTE(NOTE_FS4),
+    SONG_NOTE(NOTE_GS4),
 
     // --
 
-    {NOTE_AS3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_F3, NOTE_TYPE_QUARTER_DOT, 0},
-    {NOTE_AS3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_AS3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_C4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_D4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_DS4, NOTE_TYPE_SIXTEENTH, 0},
+    SONG_NOTE_TIMED(NOTE_AS4, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_FS3, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_GS3),
+    SONG_NOTE(NOTE_AS3),
+    SONG_NOTE(NOTE_C4),
+    SONG_NOTE_TIMED(NOTE_CS4, QUARTER_TRIPLET_DOUBLE, 0),
+    SONG_NOTE_TIMED(NOTE_AS4, QUARTER_TRIPLET, 0),
+    SONG_NOTE(NOTE_AS4),
+    SONG_NOTE(NOTE_GS4),
+    SONG_NOTE(NOTE_FS4),
 
     // --
 
-    {NOTE_F4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_AS3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_AS3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_C4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_D4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_DS4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_F4, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_FS4, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_GS4, NOTE_TYPE_QUARTER_TRIPLET, 0},
+    SONG_NOTE_TIMED(NOTE_GS4, EIGHTH_DOT, 0),
+    SONG_NOTE_TIMED(NOTE_FS4, SIXTEENTH, 0),
+    SONG_NOTE_TIMED(NOTE_F4, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_F4, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_DS4),
+    SONG_NOTE_TIMED(NOTE_F4, QUARTER, 0),
+    SONG_NOTE(NOTE_F4),
 
     // --
 
-    {NOTE_AS4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_FS3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_GS3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_AS3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_C4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_CS4, NOTE_TYPE_QUARTER_TRIPLET_DOUBLE, 0},
-    {NOTE_AS4, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_AS4, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_GS4, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_FS4, NOTE_TYPE_QUARTER_TRIPLET, 0},
+    SONG_NOTE_TIMED(NOTE_DS4, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_DS4, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_F4),
+    SONG_NOTE_TIMED(NOTE_FS4, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_DS4, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_F4),
+    SONG_NOTE_TIMED(NOTE_FS4, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_F4, EIGHTH, 0),
+    SONG_NOTE(NOTE_DS4),
 
     // --
 
-    {NOTE_GS4, NOTE_TYPE_EIGHTH_DOT, 0},
-    {NOTE_FS4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_F4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_DS4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_F4, NOTE_TYPE_QUARTER, 0},
-
-    // -- 
-
-    {NOTE_DS4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_DS4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_FS4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_DS4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_FS4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_F4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_DS4, NOTE_TYPE_EIGHTH, 0},
-
-    // -- 
-
-    {NOTE_CS4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_CS4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_DS4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_CS4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_DS4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_DS4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_CS4, NOTE_TYPE_EIGHTH, 0},
+    SONG_NOTE(NOTE_CS4),
+    SONG_NOTE_TIMED(NOTE_CS4, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_DS4),
+    SONG_NOTE_TIMED(NOTE_F4, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_CS4, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_DS4),
+    SONG_NOTE_TIMED(NOTE_F4, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_DS4, EIGHTH, 0),
+    SONG_NOTE(NOTE_CS4),
 
     // --
 
-    {NOTE_C4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_C4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_D4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_E4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_C4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_D4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_E4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_F4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_G4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_C5, NOTE_TYPE_EIGHTH, 0},
+    SONG_NOTE(NOTE_C4),
+    SONG_NOTE_TIMED(NOTE_C4, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_D4),
+    SONG_NOTE_TIMED(NOTE_E4, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_C4, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_D4),
+    SONG_NOTE_TIMED(NOTE_E4, EIGHTH, 0),
+    SONG_NOTE(NOTE_F4),
+    SONG_NOTE(NOTE_G4),
+    SONG_NOTE(NOTE_C5),
 
     // --
 
-    {NOTE_F4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_F3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_F3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_F3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_F3, NOTE_TYPE_EIGHTH, 0},
+    SONG_NOTE(NOTE_F4),
+    SONG_NOTE_TIMED(NOTE_F3, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_F3),
+    SONG_NOTE_TIMED(NOTE_F3, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_F3, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_F3),
+    SONG_NOTE_TIMED(NOTE_F3, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_F3, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_F3),
+    SONG_NOTE_TIMED(NOTE_F3, EIGHTH, 0),
+    SONG_NOTE(NOTE_F3),
 
     // --
 
-    {NOTE_AS3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_F3, NOTE_TYPE_QUARTER_DOT, 0},
-    {NOTE_AS3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_AS3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_C4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_D4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_DS4, NOTE_TYPE_SIXTEENTH, 0},
-
-    // -- 
-
-    {NOTE_F4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_AS3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_AS3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_C4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_D4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_DS4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F4, NOTE_TYPE_QUARTER_TRIPLET_DOUBLE, 0},
-    {NOTE_F4, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_F4, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_FS4, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_GS4, NOTE_TYPE_QUARTER_TRIPLET, 0},
+    SONG_NOTE_TIMED(NOTE_AS3, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_F3, QUARTER_DOT, 0),
+    SONG_NOTE_TIMED(NOTE_AS3, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_AS3, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_C4),
+    SONG_NOTE(NOTE_D4),
+    SONG_NOTE(NOTE_DS4),
 
     // --
 
-    {NOTE_AS4, NOTE_TYPE_HALF_DOT, 0},
-    {NOTE_CS5, NOTE_TYPE_QUARTER, 0},
+    SONG_NOTE_TIMED(NOTE_F4, EIGHTH, 0),
+    SONG_NOTE(NOTE_AS3),
+    SONG_NOTE_TIMED(NOTE_AS3, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_C4),
+    SONG_NOTE(NOTE_D4),
+    SONG_NOTE(NOTE_DS4),
+    SONG_NOTE_TIMED(NOTE_F4, QUARTER_TRIPLET_DOUBLE, 0),
+    SONG_NOTE_TIMED(NOTE_F4, QUARTER_TRIPLET, 0),
+    SONG_NOTE(NOTE_F4),
+    SONG_NOTE(NOTE_FS4),
+    SONG_NOTE(NOTE_GS4),
 
     // --
 
-    {NOTE_C5, NOTE_TYPE_QUARTER, 0},
-    {NOTE_A4, NOTE_TYPE_HALF, 0},
-    {NOTE_F4, NOTE_TYPE_QUARTER, 0},
+    SONG_NOTE_TIMED(NOTE_AS4, HALF_DOT, 0),
+    SONG_NOTE_TIMED(NOTE_CS5, QUARTER, 0),
 
     // --
 
-    {NOTE_FS4, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_AS2, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_CS3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_E3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_AS3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_CS4, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_E4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_AS4, NOTE_TYPE_QUARTER, 0},
+    SONG_NOTE(NOTE_C5),
+    SONG_NOTE_TIMED(NOTE_A4, HALF, 0),
+    SONG_NOTE_TIMED(NOTE_F4, QUARTER, 0),
 
     // --
 
-    {NOTE_A4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_F4, NOTE_TYPE_HALF, 0},
-    {NOTE_F4, NOTE_TYPE_QUARTER, 0},
+    SONG_NOTE_TIMED(NOTE_FS4, QUARTER_TRIPLET, 0),
+    SONG_NOTE(NOTE_AS2),
+    SONG_NOTE(NOTE_CS3),
+    SONG_NOTE(NOTE_E3),
+    SONG_NOTE(NOTE_AS3),
+    SONG_NOTE(NOTE_CS4),
+    SONG_NOTE_TIMED(NOTE_E4, QUARTER, 0),
+    SONG_NOTE(NOTE_AS4),
+
+    // --
+
+    SONG_NOTE(NOTE_A4),
+    SONG_NOTE_TIMED(NOTE_F4, HALF, 0),
+    SONG_NOTE_TIMED(NOTE_F4, QUARTER, 0),
 
     // +++
 
-    {NOTE_FS4, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_AS2, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_CS3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_E3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_AS3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_CS4, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_E4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_AS4, NOTE_TYPE_QUARTER, 0},
+    SONG_NOTE_TIMED(NOTE_FS4, QUARTER_TRIPLET, 0),
+    SONG_NOTE(NOTE_AS2),
+    SONG_NOTE(NOTE_CS3),
+    SONG_NOTE(NOTE_E3),
+    SONG_NOTE(NOTE_AS3),
+    SONG_NOTE(NOTE_CS4),
+    SONG_NOTE_TIMED(NOTE_E4, QUARTER, 0),
+    SONG_NOTE(NOTE_AS4),
 
     // --
 
-    {NOTE_A4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_F4, NOTE_TYPE_HALF, 0},
-    {NOTE_D4, NOTE_TYPE_QUARTER, 0},
+    SONG_NOTE(NOTE_A4),
+    SONG_NOTE_TIMED(NOTE_F4, HALF, 0),
+    SONG_NOTE_TIMED(NOTE_D4, QUARTER, 0),
 
     // --
 
-    {NOTE_DS4, NOTE_TYPE_HALF_DOT, 0},
-    {NOTE_FS4, NOTE_TYPE_QUARTER, 0},
+    SONG_NOTE_TIMED(NOTE_DS4, HALF_DOT, 0),
+    SONG_NOTE_TIMED(NOTE_FS4, QUARTER, 0),
 
     // --
 
-    {NOTE_F4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_CS4, NOTE_TYPE_HALF, 0},
-    {NOTE_AS3, NOTE_TYPE_QUARTER, 0},
+    SONG_NOTE(NOTE_F4),
+    SONG_NOTE_TIMED(NOTE_CS4, HALF, 0),
+    SONG_NOTE_TIMED(NOTE_AS3, QUARTER, 0),
 
-    // -- 
+    // --
 
-    {NOTE_C4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_C4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_D4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_E4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_C4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_D4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_E4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_F4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_G4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_C5, NOTE_TYPE_EIGHTH, 0},
+    SONG_NOTE_TIMED(NOTE_C4, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_C4, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_D4),
+    SONG_NOTE_TIMED(NOTE_E4, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_C4, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_D4),
+    SONG_NOTE_TIMED(NOTE_E4, EIGHTH, 0),
+    SONG_NOTE(NOTE_F4),
+    SONG_NOTE(NOTE_G4),
+    SONG_NOTE(NOTE_C5),
 
     // --
 
-    {NOTE_F4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_F3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_F3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_F3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_F3, NOTE_TYPE_EIGHTH, 0},
-  }
+    SONG_NOTE(NOTE_F4),
+    SONG_NOTE_TIMED(NOTE_F3, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_F3),
+    SONG_NOTE_TIMED(NOTE_F3, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_F3, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_F3),
+    SONG_NOTE_TIMED(NOTE_F3, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_F3, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_F3),
+    SONG_NOTE_TIMED(NOTE_F3, EIGHTH, 0),
+    SONG_NOTE(NOTE_F3),
+};
+
+const SongNotes ZeldaOpening = {
+  "Legend of Zelda Opening",
+  90,  // Tempo
+  232,   // Number of Notes
+  sizeof(ZeldaOpeningEvents),
+  ZeldaOpeningEvents
 };
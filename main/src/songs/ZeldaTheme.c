@@ -4,218 +4,221 @@
 // Sheet music
 //  https://musescore.com/user/20360426/scores/4880846
 
-const SongNotes ZeldaTheme = {
-  "Zelda Theme",
-  136,   // Tempo
-  139,   // Number of Notes
-  {
-    {NOTE_AS3, NOTE_TYPE_HALF, 0},
-    {NOTE_REST, NOTE_TYPE_QUARTER_TRIPLET_DOUBLE, 0},
-    {NOTE_AS3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_AS3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_AS3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_AS3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-
-    // --
-
-    {NOTE_AS3, NOTE_TYPE_QUARTER_TRIPLET_DOUBLE, 0},
-    {NOTE_GS3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_AS3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_REST, NOTE_TYPE_QUARTER_TRIPLET_DOUBLE, 0},
-    {NOTE_AS3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_AS3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_AS3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_AS3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-
-    // --
-
-    {NOTE_AS3, NOTE_TYPE_QUARTER_TRIPLET_DOUBLE, 0},
-    {NOTE_GS3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_AS3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_REST, NOTE_TYPE_QUARTER_TRIPLET_DOUBLE, 0},
-    {NOTE_AS3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_AS3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_AS3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_AS3, NOTE_TYPE_QUARTER_TRIPLET, 0},
-
-    // --
-
-    {NOTE_AS3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_F3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_F3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_F3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_F3, NOTE_TYPE_EIGHTH, 0},
-    
-    // --
-
-    {NOTE_AS3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_F3, NOTE_TYPE_QUARTER_DOT, 0},
-    {NOTE_AS3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_AS3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_C4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_D4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_DS4, NOTE_TYPE_SIXTEENTH, 0},
+static const uint8_t ZeldaThemeEvents[] = {
+    SONG_NOTE_TIMED(NOTE_AS3, HALF, 0),
+    SONG_NOTE_TIMED(NOTE_REST, QUARTER_TRIPLET_DOUBLE, 0),
+    SONG_NOTE_TIMED(NOTE_AS3, QUARTER_TRIPLET, 0),
+    SONG_NOTE(NOTE_AS3),
+    SONG_NOTE(NOTE_AS3),
+    SONG_NOTE(NOTE_AS3),
+
+    // --
+
+    SONG_NOTE_TIMED(NOTE_AS3, QUARTER_TRIPLET_DOUBLE, 0),
+    SONG_NOTE_TIMED(NOTE_GS3, QUARTER_TRIPLET, 0),
+    SONG_NOTE_TIMED(NOTE_AS3, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_REST, QUARTER_TRIPLET_DOUBLE, 0),
+    SONG_NOTE_TIMED(NOTE_AS3, QUARTER_TRIPLET, 0),
+    SONG_NOTE(NOTE_AS3),
+    SONG_NOTE(NOTE_AS3),
+    SONG_NOTE(NOTE_AS3),
+
+    // --
+
+    SONG_NOTE_TIMED(NOTE_AS3, QUARTER_TRIPLET_DOUBLE, 0),
+    SONG_NOTE_TIMED(NOTE_GS3, QUARTER_TRIPLET, 0),
+    SONG_NOTE_TIMED(NOTE_AS3, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_REST, QUARTER_TRIPLET_DOUBLE, 0),
+    SONG_NOTE_TIMED(NOTE_AS3, QUARTER_TRIPLET, 0),
+    SONG_NOTE(NOTE_AS3),
+    SONG_NOTE(NOTE_AS3),
+    SONG_NOTE(NOTE_AS3),
+
+    // --
+
+    SONG_NOTE_TIMED(NOTE_AS3, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_F3, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_F3),
+    SONG_NOTE_TIMED(NOTE_F3, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_F3, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_F3),
+    SONG_NOTE_TIMED(NOTE_F3, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_F3, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_F3),
+    SONG_NOTE_TIMED(NOTE_F3, EIGHTH, 0),
+    SONG_NOTE(NOTE_F3),
+
+    // --
+
+    SONG_NOTE_TIMED(NOTE_AS3, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_F3, QUARTER_DOT, 0),
+    SONG_NOTE_TIMED(NOTE_AS3, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_AS3, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_C4),
+    SONG_NOTE(NOTE_D4),
+    SONG_NOTE(NOTE_DS4),
 
     // +++
 
-    {NOTE_F4, NOTE_TYPE_HALF, 0},
-    {NOTE_REST, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_F4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_F4, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_FS4, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_GS4, NOTE_TYPE_QUARTER_TRIPLET, 0},
+    SONG_NOTE_TIMED(NOTE_F4, HALF, 0),
+    SONG_NOTE_TIMED(NOTE_REST, EIGHTH, 0),
+    SONG_NOTE(NOTE_F4),
+    SONG_NOTE_TIMED(NOTE_F4, QUARTER_TRIPLET, 0),
+    SONG_NOTE(NOTE_FS4),
+    SONG_NOTE(NOTE_GS4),
 
-    // -- 
+    // --
 
-    {NOTE_AS4, NOTE_TYPE_HALF, 0},
-    {NOTE_REST, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_AS4, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_AS4, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_AS4, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_GS4, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_FS4, NOTE_TYPE_QUARTER_TRIPLET, 0},
+    SONG_NOTE_TIMED(NOTE_AS4, HALF, 0),
+    SONG_NOTE_TIMED(NOTE_REST, QUARTER_TRIPLET, 0),
+    SONG_NOTE(NOTE_AS4),
+    SONG_NOTE(NOTE_AS4),
+    SONG_NOTE(NOTE_AS4),
+    SONG_NOTE(NOTE_GS4),
+    SONG_NOTE(NOTE_FS4),
 
     // --
 
-    {NOTE_GS4, NOTE_TYPE_EIGHTH_DOT, 0},
-    {NOTE_FS4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F4, NOTE_TYPE_HALF, 0},
-    {NOTE_F4, NOTE_TYPE_QUARTER, 0},
+    SONG_NOTE_TIMED(NOTE_GS4, EIGHTH_DOT, 0),
+    SONG_NOTE_TIMED(NOTE_FS4, SIXTEENTH, 0),
+    SONG_NOTE_TIMED(NOTE_F4, HALF, 0),
+    SONG_NOTE_TIMED(NOTE_F4, QUARTER, 0),
 
-    // -- 
+    // --
 
-    {NOTE_DS4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_DS4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_FS4, NOTE_TYPE_HALF, 0},
-    {NOTE_F4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_DS4, NOTE_TYPE_EIGHTH, 0},
+    SONG_NOTE_TIMED(NOTE_DS4, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_DS4, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_F4),
+    SONG_NOTE_TIMED(NOTE_FS4, HALF, 0),
+    SONG_NOTE_TIMED(NOTE_F4, EIGHTH, 0),
+    SONG_NOTE(NOTE_DS4),
 
-    // -- 
+    // --
 
-    {NOTE_CS4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_CS4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_DS4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F4, NOTE_TYPE_HALF, 0},
-    {NOTE_DS4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_CS4, NOTE_TYPE_EIGHTH, 0},
+    SONG_NOTE(NOTE_CS4),
+    SONG_NOTE_TIMED(NOTE_CS4, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_DS4),
+    SONG_NOTE_TIMED(NOTE_F4, HALF, 0),
+    SONG_NOTE_TIMED(NOTE_DS4, EIGHTH, 0),
+    SONG_NOTE(NOTE_CS4),
 
     // --
 
-    {NOTE_C4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_C4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_D4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_E4, NOTE_TYPE_HALF, 0},
-    {NOTE_G4, NOTE_TYPE_QUARTER, 0},
+    SONG_NOTE(NOTE_C4),
+    SONG_NOTE_TIMED(NOTE_C4, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_D4),
+    SONG_NOTE_TIMED(NOTE_E4, HALF, 0),
+    SONG_NOTE_TIMED(NOTE_G4, QUARTER, 0),
 
     // +++
 
-    {NOTE_F4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_F3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_F3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_F3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_F3, NOTE_TYPE_EIGHTH, 0},
+    SONG_NOTE_TIMED(NOTE_F4, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_F3, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_F3),
+    SONG_NOTE_TIMED(NOTE_F3, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_F3, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_F3),
+    SONG_NOTE_TIMED(NOTE_F3, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_F3, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_F3),
+    SONG_NOTE_TIMED(NOTE_F3, EIGHTH, 0),
+    SONG_NOTE(NOTE_F3),
 
     // --
 
-    {NOTE_AS3, NOTE_TYPE_QUARTER, 0},
-    {NOTE_F3, NOTE_TYPE_QUARTER_DOT, 0},
-    {NOTE_AS3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_AS3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_C4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_D4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_DS4, NOTE_TYPE_SIXTEENTH, 0},
+    SONG_NOTE_TIMED(NOTE_AS3, QUARTER, 0),
+    SONG_NOTE_TIMED(NOTE_F3, QUARTER_DOT, 0),
+    SONG_NOTE_TIMED(NOTE_AS3, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_AS3, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_C4),
+    SONG_NOTE(NOTE_D4),
+    SONG_NOTE(NOTE_DS4),
 
-    // -- 
+    // --
 
-    {NOTE_F4, NOTE_TYPE_HALF, 0},
-    {NOTE_REST, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_F4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_F4, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_FS4, NOTE_TYPE_QUARTER_TRIPLET, 0},
-    {NOTE_GS4, NOTE_TYPE_QUARTER_TRIPLET, 0},
+    SONG_NOTE_TIMED(NOTE_F4, HALF, 0),
+    SONG_NOTE_TIMED(NOTE_REST, EIGHTH, 0),
+    SONG_NOTE(NOTE_F4),
+    SONG_NOTE_TIMED(NOTE_F4, QUARTER_TRIPLET, 0),
+    SONG_NOTE(NOTE_FS4),
+    SONG_NOTE(NOTE_GS4),
 
     // --
 
-    {NOTE_AS4, NOTE_TYPE_HALF, 0},
-    {NOTE_REST, NOTE_TYPE_QUARTER, 0},
-    {NOTE_CS5, NOTE_TYPE_QUARTER, 0},
+    SONG_NOTE_TIMED(NOTE_AS4, HALF, 0),
+    SONG_NOTE_TIMED(NOTE_REST, QUARTER, 0),
+    SONG_NOTE(NOTE_CS5),
 
     // --
 
-    {NOTE_C5, NOTE_TYPE_QUARTER, 0},
-    {NOTE_A4, NOTE_TYPE_HALF, 0},
-    {NOTE_F4, NOTE_TYPE_QUARTER, 0},
+    SONG_NOTE(NOTE_C5),
+    SONG_NOTE_TIMED(NOTE_A4, HALF, 0),
+    SONG_NOTE_TIMED(NOTE_F4, QUARTER, 0),
 
     // --
 
-    {NOTE_FS4, NOTE_TYPE_HALF, 0},
-    {NOTE_REST, NOTE_TYPE_QUARTER, 0},
-    {NOTE_AS4, NOTE_TYPE_QUARTER, 0},
+    SONG_NOTE_TIMED(NOTE_FS4, HALF, 0),
+    SONG_NOTE_TIMED(NOTE_REST, QUARTER, 0),
+    SONG_NOTE(NOTE_AS4),
 
     // --
 
-    {NOTE_A4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_F4, NOTE_TYPE_HALF, 0},
-    {NOTE_F4, NOTE_TYPE_QUARTER, 0},
+    SONG_NOTE(NOTE_A4),
+    SONG_NOTE_TIMED(NOTE_F4, HALF, 0),
+    SONG_NOTE_TIMED(NOTE_F4, QUARTER, 0),
 
     // +++
 
-    {NOTE_FS4, NOTE_TYPE_HALF, 0},
-    {NOTE_REST, NOTE_TYPE_QUARTER, 0},
-    {NOTE_AS4, NOTE_TYPE_QUARTER, 0},
+    SONG_NOTE_TIMED(NOTE_FS4, HALF, 0),
+    SONG_NOTE_TIMED(NOTE_REST, QUARTER, 0),
+    SONG_NOTE(NOTE_AS4),
 
     // --
 
-    {NOTE_A4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_F4, NOTE_TYPE_HALF, 0},
-    {NOTE_D4, NOTE_TYPE_QUARTER, 0},
+    SONG_NOTE(NOTE_A4),
+    SONG_NOTE_TIMED(NOTE_F4, HALF, 0),
+    SONG_NOTE_TIMED(NOTE_D4, QUARTER, 0),
 
     // --
 
-    {NOTE_DS4, NOTE_TYPE_HALF, 0},
-    {NOTE_REST, NOTE_TYPE_QUARTER, 0},
-    {NOTE_FS4, NOTE_TYPE_QUARTER, 0},
+    SONG_NOTE_TIMED(NOTE_DS4, HALF, 0),
+    SONG_NOTE_TIMED(NOTE_REST, QUARTER, 0),
+    SONG_NOTE(NOTE_FS4),
 
     // --
 
-    {NOTE_F4, NOTE_TYPE_QUARTER, 0},
-    {NOTE_CS4, NOTE_TYPE_HALF, 0},
-    {NOTE_AS3, NOTE_TYPE_QUARTER, 0},
+    SONG_NOTE(NOTE_F4),
+    SONG_NOTE_TIMED(NOTE_CS4, HALF, 0),
+    SONG_NOTE_TIMED(NOTE_AS3, QUARTER, 0),
 
-    // -- 
+    // --
 
-    {NOTE_C4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_C4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_D4, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_E4, NOTE_TYPE_HALF, 0},
-    {NOTE_G4, NOTE_TYPE_QUARTER, 0},
+    SONG_NOTE_TIMED(NOTE_C4, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_C4, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_D4),
+    SONG_NOTE_TIMED(NOTE_E4, HALF, 0),
+    SONG_NOTE_TIMED(NOTE_G4, QUARTER, 0),
 
     // --
 
-    {NOTE_F4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_F3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_F3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_F3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F3, NOTE_TYPE_SIXTEENTH, 0},
-    {NOTE_F3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_F3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_AS3, NOTE_TYPE_EIGHTH, 0},
-  }
+    SONG_NOTE_TIMED(NOTE_F4, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_F3, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_F3),
+    SONG_NOTE_TIMED(NOTE_F3, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_F3, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_F3),
+    SONG_NOTE_TIMED(NOTE_F3, EIGHTH, 0),
+    SONG_NOTE_TIMED(NOTE_F3, SIXTEENTH, 0),
+    SONG_NOTE(NOTE_F3),
+    SONG_NOTE_TIMED(NOTE_F3, EIGHTH, 0),
+    SONG_NOTE(NOTE_F3),
+    SONG_NOTE(NOTE_AS3),
+};
+
+const SongNotes ZeldaTheme = {
+  "Zelda Theme",
+  136,  // Tempo
+  139,   // Number of Notes
+  sizeof(ZeldaThemeEvents),
+  ZeldaThemeEvents
 };
@@ -1,83 +1,86 @@
 
 #include "Song.h"
 
-const SongNotes ZeldasLullaby = {
-  "Zelda's Lullaby",
-  104,  // Tempo
-  28,   // Number of Notes
-  {
-    {NOTE_B3, NOTE_TYPE_HALF, 0},
-    {NOTE_D4, NOTE_TYPE_QUARTER, 0},
+static const uint8_t ZeldasLullabyEvents[] = {
+    SONG_NOTE_TIMED(NOTE_B3, HALF, 0),
+    SONG_NOTE_TIMED(NOTE_D4, QUARTER, 0),
 
     // --
 
-    {NOTE_A3, NOTE_TYPE_HALF_DOT, 0},
+    SONG_NOTE_TIMED(NOTE_A3, HALF_DOT, 0),
 
     // --
 
-    {NOTE_B3, NOTE_TYPE_HALF, 0},
-    {NOTE_D4, NOTE_TYPE_QUARTER, 0},
+    SONG_NOTE_TIMED(NOTE_B3, HALF, 0),
+    SONG_NOTE_TIMED(NOTE_D4, QUARTER, 0),
 
     // --
 
-    {NOTE_A3, NOTE_TYPE_HALF_DOT, 0},
+    SONG_NOTE_TIMED(NOTE_A3, HALF_DOT, 0),
 
     // --
 
-    {NOTE_B3, NOTE_TYPE_HALF, 0},
-    {NOTE_D4, NOTE_TYPE_QUARTER, 0},
+    SONG_NOTE_TIMED(NOTE_B3, HALF, 0),
+    SONG_NOTE_TIMED(NOTE_D4, QUARTER, 0),
 
     // --
 
-    {NOTE_A4, NOTE_TYPE_HALF, 0},
-    {NOTE_G4, NOTE_TYPE_QUARTER, 0},
+    SONG_NOTE_TIMED(NOTE_A4, HALF, 0),
+    SONG_NOTE_TIMED(NOTE_G4, QUARTER, 0),
 
     // --
 
-    {NOTE_D4, NOTE_TYPE_HALF, 0},
-    {NOTE_C4, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_B3, NOTE_TYPE_EIGHTH, 0},
+    SONG_NOTE_TIMED(NOTE_D4, HALF, 0),
+    SONG_NOTE_TIMED(NOTE_C4, EIGHTH, 0),
+    SONG_NOTE(NOTE_B3),
 
     // --
 
-    {NOTE_A3, NOTE_TYPE_HALF, 0},
-    {NOTE_G3, NOTE_TYPE_EIGHTH, 0},
-    {NOTE_A3, NOTE_TYPE_EIGHTH, 0},
+    SONG_NOTE_TIMED(NOTE_A3, HALF, 0),
+    SONG_NOTE_TIMED(NOTE_G3, EIGHTH, 0),
+    SONG_NOTE(NOTE_A3),
 
     // --
 
-    {NOTE_B3, NOTE_TYPE_HALF, 0},
-    {NOTE_D4, NOTE_TYPE_QUARTER, 0},
+    SONG_NOTE_TIMED(NOTE_B3, HALF, 0),
+    SONG_NOTE_TIMED(NOTE_D4, QUARTER, 0),
 
     // --
 
-    {NOTE_A3, NOTE_TYPE_HALF_DOT, 0},
+    SONG_NOTE_TIMED(NOTE_A3, HALF_DOT, 0),
 
     // --
 
-    {NOTE_B3, NOTE_TYPE_HALF, 0},
-    {NOTE_D4, NOTE_TYPE_QUARTER, 0},
+    SONG_NOTE_TIMED(NOTE_B3, HALF, 0),
+    SONG_NOTE_TIMED(NOTE_D4, QUARTER, 0),
 
     // --
 
-    {NOTE_A3, NOTE_TYPE_HALF_DOT, 0},
+    SONG_NOTE_TIMED(NOTE_A3, HALF_DOT, 0),
 
     // --
 
-    {NOTE_B3, NOTE_TYPE_HALF, 0},
-    {NOTE_D4, NOTE_TYPE_QUARTER, 0},
+    SONG_NOTE_TIMED(NOTE_B3, HALF, 0),
+    SONG_NOTE_TIMED(NOTE_D4, QUARTER, 0),
 
     // --
 
-    {NOTE_A4, NOTE_TYPE_HALF, 0},
-    {NOTE_G4, NOTE_TYPE_QUARTER, 0},
+    SONG_NOTE_TIMED(NOTE_A4, HALF, 0),
+    SONG_NOTE_TIMED(NOTE_G4, QUARTER, 0),
 
     // --
 
-    {NOTE_D5, NOTE_TYPE_HALF_DOT, 1},
+    SONG_NOTE_TIMED(NOTE_D5, HALF_DOT, 1),
 
     // --
 
-    {NOTE_D5, NOTE_TYPE_HALF, 0},
-  }
+    SONG_NOTE_TIMED(NOTE_D5, HALF, 0),
+};
+
+const SongNotes ZeldasLullaby = {
+  "Zelda's Lullaby",
+  104,  // Tempo
+  28,   // Number of Notes
+  sizeof(ZeldasLullabyEvents),
+  ZeldasLullabyEvents
 };
@@ -0,0 +1,120 @@
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "CircularBuffer.h"
+
+#define NUM_ITEMS  (1 << 24)
+#define BATCH      32
+
+static double NowNs(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1e9 + now.tv_nsec;
+}
+
+// Fills and drains BATCH items at a time on one thread, one item per call or one call per batch
+static double SingleThreadItemsPerSecond(bool lockFree, bool bulk)
+{
+    CircularBuffer cb;
+    uint32_t items[BATCH];
+    uint32_t sum = 0;
+    if ((lockFree ? CircularBuffer_InitLockFree(&cb, 64, sizeof(uint32_t)) : CircularBuffer_Init(&cb, 64, sizeof(uint32_t))) != ESP_OK)
+    {
+        return 0;
+    }
+
+    double start = NowNs();
+    for (uint32_t n = 0; n < NUM_ITEMS; n += BATCH)
+    {
+        for (uint32_t i = 0; i < BATCH; i++)
+        {
+            items[i] = n + i;
+        }
+        if (bulk)
+        {
+            CircularBuffer_PushBackN(&cb, items, BATCH);
+            CircularBuffer_PopFrontN(&cb, items, BATCH);
+        }
+        else
+        {
+            for (uint32_t i = 0; i < BATCH; i++)
+            {
+                CircularBuffer_PushBack(&cb, &items[i]);
+            }
+            for (uint32_t i = 0; i < BATCH; i++)
+            {
+                CircularBuffer_PopFront(&cb, &items[i]);
+            }
+        }
+        sum += items[BATCH - 1];
+    }
+    double elapsed = NowNs() - start;
+    CircularBuffer_Free(&cb);
+    return (sum == 0) ? 0 : NUM_ITEMS / elapsed * 1e9;
+}
+
+static CircularBuffer spscBuffer;
+
+static void *Producer(void *pArg)
+{
+    uint32_t items[BATCH];
+    uint32_t next = 0;
+    (void)pArg;
+    while (next < NUM_ITEMS)
+    {
+        for (uint32_t i = 0; i < BATCH; i++)
+        {
+            items[i] = next + i;
+        }
+        size_t numPushed = CircularBuffer_PushBackN(&spscBuffer, items, BATCH);
+        if (numPushed < BATCH)
+        {
+            // Full, the next batch starts at the first item that did not fit
+            sched_yield();
+        }
+        next += numPushed;
+    }
+    return NULL;
+}
+
+// Lock-free producer and consumer threads moving bulk batches
+static double SpscItemsPerSecond(void)
+{
+    uint32_t items[BATCH];
+    uint32_t received = 0;
+    pthread_t producer;
+    if (CircularBuffer_InitLockFree(&spscBuffer, 1024, sizeof(uint32_t)) != ESP_OK)
+    {
+        return 0;
+    }
+
+    double start = NowNs();
+    pthread_create(&producer, NULL, Producer, NULL);
+    while (received < NUM_ITEMS)
+    {
+        size_t numPopped = CircularBuffer_PopFrontN(&spscBuffer, items, BATCH);
+        if (numPopped == 0)
+        {
+            sched_yield();
+        }
+        received += numPopped;
+    }
+    pthread_join(producer, NULL);
+    double elapsed = NowNs() - start;
+    CircularBuffer_Free(&spscBuffer);
+    return NUM_ITEMS / elapsed * 1e9;
+}
+
+// Not a ctest test, run it by hand
+int main(void)
+{
+    printf("default, single items:    %6.1f M items/s\n", SingleThreadItemsPerSecond(false, false) / 1e6);
+    printf("default, bulk:            %6.1f M items/s\n", SingleThreadItemsPerSecond(false, true) / 1e6);
+    printf("lock-free, single items:  %6.1f M items/s\n", SingleThreadItemsPerSecond(true, false) / 1e6);
+    printf("lock-free, bulk:          %6.1f M items/s\n", SingleThreadItemsPerSecond(true, true) / 1e6);
+    printf("lock-free, SPSC threads:  %6.1f M items/s\n", SpscItemsPerSecond() / 1e6);
+    return 0;
+}
@@ -0,0 +1,119 @@
+#include <malloc.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "hashmap.h"
+
+#define CAPACITY    256
+#define KEY_SIZE    24
+#define NUM_ROUNDS  2000
+#define NUM_LOOKUPS 8
+
+typedef HASHMAP(char, int) StringMap;
+
+static char keys[CAPACITY][KEY_SIZE];
+static int data[CAPACITY];
+
+typedef struct Timings_t
+{
+    double putNs;
+    double getNs;
+    double removeNs;
+    size_t heapBytes;
+} Timings;
+
+static double NowNs(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1e9 + now.tv_nsec;
+}
+
+static char *KeyDup(const char *pKey)
+{
+    return strdup(pKey);
+}
+
+static void KeyFree(char *pKey)
+{
+    free(pKey);
+}
+
+// Fills the map to capacity, looks every key up several times and empties it again, per round
+static Timings Run(StringMap *pMap)
+{
+    Timings timings = {0};
+    int found = 0;
+    for (int round = 0; round < NUM_ROUNDS; round++)
+    {
+        double start = NowNs();
+        for (int i = 0; i < CAPACITY; i++)
+        {
+            hashmap_put(pMap, keys[i], &data[i]);
+        }
+        double put = NowNs();
+        if (round == 0)
+        {
+            timings.heapBytes = mallinfo2().uordblks;
+        }
+        for (int n = 0; n < NUM_LOOKUPS; n++)
+        {
+            for (int i = 0; i < CAPACITY; i++)
+            {
+                found += hashmap_get(pMap, keys[i]) != NULL;
+            }
+        }
+        double get = NowNs();
+        for (int i = 0; i < CAPACITY; i++)
+        {
+            hashmap_remove(pMap, keys[i]);
+        }
+        double removed = NowNs();
+        timings.putNs += put - start;
+        timings.getNs += get - put;
+        timings.removeNs += removed - get;
+    }
+    timings.putNs /= (double)NUM_ROUNDS * CAPACITY;
+    timings.getNs /= (double)NUM_ROUNDS * CAPACITY * NUM_LOOKUPS;
+    timings.removeNs /= (double)NUM_ROUNDS * CAPACITY;
+    return (found == NUM_ROUNDS * CAPACITY * NUM_LOOKUPS) ? timings : (Timings){0};
+}
+
+static void Print(const char *pName, const Timings *pTimings, size_t heapBytes)
+{
+    printf("%-8s put %6.1f ns, get %6.1f ns, remove %6.1f ns, %6zu heap bytes at capacity\n",
+           pName, pTimings->putNs, pTimings->getNs, pTimings->removeNs, heapBytes);
+}
+
+// Heap-backed map with copied keys against an arena map of the same capacity. Not a ctest test, run it by hand
+int main(void)
+{
+    for (int i = 0; i < CAPACITY; i++)
+    {
+        snprintf(keys[i], KEY_SIZE, "badge-%08x", (unsigned)(i * 2654435761u));
+    }
+
+    StringMap heapMap;
+    size_t baseline = mallinfo2().uordblks;
+    hashmap_init(&heapMap, hashmap_hash_string, strcmp);
+    hashmap_set_key_alloc_funcs(&heapMap, KeyDup, KeyFree);
+    Timings heap = Run(&heapMap);
+    Print("heap", &heap, heap.heapBytes - baseline);
+    hashmap_cleanup(&heapMap);
+
+    static void *arena[HASHMAP_ARENA_SIZE(CAPACITY, KEY_SIZE) / sizeof(void *)];
+    StringMap arenaMap;
+    baseline = mallinfo2().uordblks;
+    hashmap_init_arena(&arenaMap, hashmap_hash_string, strcmp, arena, sizeof(arena), CAPACITY, KEY_SIZE, hashmap_key_copy_string);
+    Timings arenaTimings = Run(&arenaMap);
+    Print("arena", &arenaTimings, arenaTimings.heapBytes - baseline);
+    printf("arena slab %zu bytes\n", sizeof(arena));
+
+    struct hashmap_stats stats;
+    hashmap_stats(&arenaMap, &stats);
+    printf("arena probes per lookup %.2f, longest %zu\n", (double)stats.probes / stats.lookups, stats.max_probe);
+    return 0;
+}
@@ -0,0 +1,64 @@
+#include <stdio.h>
+#include <time.h>
+
+#include "OcarinaMatcher.h"
+#include "ocarina_linear_matcher.h"
+
+#define NUM_KEYS   (1 << 20)
+#define NUM_PASSES 10
+
+static OcarinaKey keys[NUM_KEYS];
+
+static double NowNs(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1e9 + now.tv_nsec;
+}
+
+// Key presses per matcher on the current song table. Not a ctest test, run it by hand
+int main(void)
+{
+    uint32_t random = 0x2024BAD6;
+    for (int i = 0; i < NUM_KEYS; i++)
+    {
+        // xorshift32 over the five song keys
+        static const OcarinaKey songKeys[] = { OCARINA_KEY_L, OCARINA_KEY_R, OCARINA_KEY_Y, OCARINA_KEY_X, OCARINA_KEY_A };
+        random ^= random << 13;
+        random ^= random >> 17;
+        random ^= random << 5;
+        keys[i] = songKeys[random % 5];
+    }
+
+    LinearMatcher linear = {0};
+    int linearMatches = 0;
+    double start = NowNs();
+    for (int pass = 0; pass < NUM_PASSES; pass++)
+    {
+        for (int i = 0; i < NUM_KEYS; i++)
+        {
+            linearMatches += LinearMatcher_PressKey(&linear, keys[i]) >= 0;
+        }
+    }
+    double linearNs = (NowNs() - start) / (NUM_KEYS * (double)NUM_PASSES);
+
+    static OcarinaMatcher matcher;
+    start = NowNs();
+    OcarinaMatcher_Build(&matcher, OcarinaSongKeySets, OCARINA_NUM_SONGS);
+    double buildUs = (NowNs() - start) / 1e3;
+    int matcherMatches = 0;
+    start = NowNs();
+    for (int pass = 0; pass < NUM_PASSES; pass++)
+    {
+        for (int i = 0; i < NUM_KEYS; i++)
+        {
+            matcherMatches += OcarinaMatcher_PressKey(&matcher, keys[i]) >= 0;
+        }
+    }
+    double matcherNs = (NowNs() - start) / (NUM_KEYS * (double)NUM_PASSES);
+
+    printf("%d songs, %d states, build %.1fus\n", OCARINA_NUM_SONGS, matcher.numStates, buildUs);
+    printf("linear:    %6.2f ns/press, %d matches\n", linearNs, linearMatches);
+    printf("automaton: %6.2f ns/press, %d matches\n", matcherNs, matcherMatches);
+    return linearMatches == matcherMatches ? 0 : 1;
+}
@@ -0,0 +1,56 @@
+#include <stdio.h>
+#include <time.h>
+
+#include "PolySynthMixer.h"
+
+#define NUM_BUFFERS (200000)
+
+static double NowNs(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1e9 + now.tv_nsec;
+}
+
+// Renders NUM_BUFFERS with the given number of voices held, returns ns per buffer
+static double RenderNsPerBuffer(int numVoices, PolySynthWaveform waveform, int *pPeak)
+{
+    static PolySynthMixer mixer;
+    int16_t buffer[POLY_SYNTH_BUFFER_SAMPLES];
+    PolySynthMixer_Init(&mixer);
+    for (int v = 0; v < numVoices; v++)
+    {
+        PolySynthMixer_NoteOn(&mixer, v, 262 + 65 * v, waveform);
+    }
+
+    int peak = 0;
+    double start = NowNs();
+    for (int b = 0; b < NUM_BUFFERS; b++)
+    {
+        PolySynthMixer_Render(&mixer, buffer);
+        int sample = (buffer[b % POLY_SYNTH_BUFFER_SAMPLES] < 0) ? -buffer[b % POLY_SYNTH_BUFFER_SAMPLES] : buffer[b % POLY_SYNTH_BUFFER_SAMPLES];
+        peak = (sample > peak) ? sample : peak;
+    }
+    double elapsed = NowNs() - start;
+    *pPeak = peak;
+    return elapsed / NUM_BUFFERS;
+}
+
+// Mixer render cost against the time one buffer takes to play. Host numbers only show the
+// relative cost of voices and waveforms, PolySynth_GetStats has the on badge figure. Not a ctest test, run it by hand
+int main(void)
+{
+    double budgetNs = 1e9 * POLY_SYNTH_BUFFER_SAMPLES / POLY_SYNTH_SAMPLE_RATE;
+    printf("%d samples per buffer at %d Hz, %.0f us budget\n", POLY_SYNTH_BUFFER_SAMPLES, POLY_SYNTH_SAMPLE_RATE, budgetNs / 1000);
+    for (int w = 0; w < 2; w++)
+    {
+        for (int voices = 1; voices <= POLY_SYNTH_MAX_VOICES; voices++)
+        {
+            int peak = 0;
+            double ns = RenderNsPerBuffer(voices, w ? POLY_SYNTH_WAVEFORM_SINE : POLY_SYNTH_WAVEFORM_SQUARE, &peak);
+            printf("%-6s %d voices: %7.1f ns per buffer, %5.2f ns per sample, %6.0fx real time, peak %5d\n",
+                   w ? "sine" : "square", voices, ns, ns / POLY_SYNTH_BUFFER_SAMPLES, budgetNs / ns, peak);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,156 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/event_groups.h"
+#include "freertos/task.h"
+
+#include "NotificationDispatcher.h"
+#include "TaskPriorities.h"
+#include "TouchActions.h"
+
+// Replays a dense BLE scan (heartbeat bursts with a busy handler on the bulk lane) mixed with touch
+// commands, and measures touch post to handler latency. The touch handler stands in for the LED mode
+// change SystemState makes on a touch command. The baseline posts the same commands on a bulk event
+#define TRACE_DURATION_US       (4 * 1000 * 1000)
+#define SCAN_PERIOD_US          (20 * 1000)
+#define SCAN_BURST_PEERS        (16)
+#define SCAN_HANDLER_COST_US    (500)       // Peer report parsing and game state update per heartbeat
+#define TOUCH_PERIOD_MIN_US     (3 * 1000)
+#define TOUCH_PERIOD_MAX_US     (7 * 1000)
+#define MAX_TOUCHES             (TRACE_DURATION_US / TOUCH_PERIOD_MIN_US + 1)
+#define DONE_BIT_SCAN           (1 << 0)
+#define DONE_BIT_TOUCH          (1 << 1)
+
+typedef struct TouchSample_t
+{
+    int64_t postUs;
+    TouchActionsCmd touchCmd;
+} TouchSample;
+
+typedef struct PeerSample_t
+{
+    uint8_t peerId;
+    int8_t rssi;
+} PeerSample;
+
+static NotificationDispatcher dispatcher;
+static EventGroupHandle_t doneBits;
+static NotificationEvent touchEvent;
+static uint32_t latenciesUs[MAX_TOUCHES];
+static uint32_t numLatencies;
+
+static void SleepUntilUs(int64_t startUs, int64_t offsetUs)
+{
+    int64_t waitUs = startUs + offsetUs - esp_timer_get_time();
+    if (waitUs > 0)
+    {
+        struct timespec delay = { .tv_sec = waitUs / 1000000, .tv_nsec = (waitUs % 1000000) * 1000 };
+        nanosleep(&delay, NULL);
+    }
+}
+
+static void BusyWaitUs(uint32_t us)
+{
+    int64_t endUs = esp_timer_get_time() + us;
+    while (esp_timer_get_time() < endUs)
+    {
+    }
+}
+
+static void PeerHeartbeatHandler(void *pObj, esp_event_base_t eventBase, int32_t notificationEvent, void *notificationData)
+{
+    BusyWaitUs(SCAN_HANDLER_COST_US);
+}
+
+static void TouchCmdHandler(void *pObj, esp_event_base_t eventBase, int32_t notificationEvent, void *notificationData)
+{
+    TouchSample *pSample = (TouchSample *)notificationData;
+    if (numLatencies < MAX_TOUCHES)
+    {
+        latenciesUs[numLatencies++] = (uint32_t)(esp_timer_get_time() - pSample->postUs);
+    }
+}
+
+static void ScanTask(void *pvParameters)
+{
+    int64_t startUs = *(int64_t *)pvParameters;
+    for (int64_t offsetUs = 0; offsetUs < TRACE_DURATION_US; offsetUs += SCAN_PERIOD_US)
+    {
+        SleepUntilUs(startUs, offsetUs);
+        for (uint8_t i = 0; i < SCAN_BURST_PEERS; i++)
+        {
+            PeerSample peer = { .peerId = i, .rssi = -60 };
+            NotificationDispatcher_NotifyEvent(&dispatcher, NOTIFICATION_EVENTS_BLE_PEER_HEARTBEAT_DETECTED, &peer, sizeof(peer), DEFAULT_NOTIFY_WAIT_DURATION);
+        }
+    }
+    xEventGroupSetBits(doneBits, DONE_BIT_SCAN);
+    vTaskDelete(NULL);
+}
+
+static void TouchTask(void *pvParameters)
+{
+    int64_t startUs = *(int64_t *)pvParameters;
+    unsigned int seed = 1234;   // Same touch trace for both lanes
+    for (int64_t offsetUs = TOUCH_PERIOD_MIN_US; offsetUs < TRACE_DURATION_US; offsetUs += TOUCH_PERIOD_MIN_US + rand_r(&seed) % (TOUCH_PERIOD_MAX_US - TOUCH_PERIOD_MIN_US))
+    {
+        SleepUntilUs(startUs, offsetUs);
+        TouchSample sample = { .postUs = esp_timer_get_time(), .touchCmd = TOUCH_ACTIONS_CMD_NEXT_LED_SEQUENCE };
+        NotificationDispatcher_NotifyEvent(&dispatcher, touchEvent, &sample, sizeof(sample), DEFAULT_NOTIFY_WAIT_DURATION);
+    }
+    // Let the last command drain before reporting
+    vTaskDelay(pdMS_TO_TICKS(50));
+    xEventGroupSetBits(doneBits, DONE_BIT_TOUCH);
+    vTaskDelete(NULL);
+}
+
+static int CompareU32(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+    return (x > y) - (x < y);
+}
+
+static void RunTrace(NotificationEvent event, const char *pLabel)
+{
+    touchEvent = event;
+    numLatencies = 0;
+    xEventGroupClearBits(doneBits, DONE_BIT_SCAN | DONE_BIT_TOUCH);
+
+    int64_t startUs = esp_timer_get_time() + 10 * 1000;
+    xTaskCreate(ScanTask, "scan", configMINIMAL_STACK_SIZE, &startUs, BLE_CONTROL_TASK_PRIORITY, NULL);
+    xTaskCreate(TouchTask, "touch", configMINIMAL_STACK_SIZE, &startUs, TOUCH_SENSOR_TASK_PRIORITY, NULL);
+    xEventGroupWaitBits(doneBits, DONE_BIT_SCAN | DONE_BIT_TOUCH, pdFALSE, pdTRUE, portMAX_DELAY);
+
+    qsort(latenciesUs, numLatencies, sizeof(latenciesUs[0]), CompareU32);
+    printf("%-30s %6u touches  p50 %6u us  p99 %6u us  max %6u us\n", pLabel, numLatencies,
+           latenciesUs[numLatencies / 2], latenciesUs[(numLatencies * 99) / 100], latenciesUs[numLatencies - 1]);
+}
+
+int main(void)
+{
+    // Lets the high lane preempt a busy bulk handler the way it does on target
+    HostTask_UseRealTimePriorities(true);
+    doneBits = xEventGroupCreate();
+    NotificationDispatcher_Init(&dispatcher);
+
+    // Baseline carrier has to stay on the bulk lane with the scan traffic
+    if (NotificationDispatcher_GetEventLane(NOTIFICATION_EVENTS_OCARINA_SONG_MATCHED) != NOTIFICATION_LANE_BULK ||
+        NotificationDispatcher_GetEventLane(NOTIFICATION_EVENTS_BLE_PEER_HEARTBEAT_DETECTED) != NOTIFICATION_LANE_BULK)
+    {
+        fprintf(stderr, "baseline events moved off the bulk lane\n");
+        return 1;
+    }
+
+    NotificationDispatcher_RegisterNotificationEventHandler(&dispatcher, NOTIFICATION_EVENTS_BLE_PEER_HEARTBEAT_DETECTED, PeerHeartbeatHandler, NULL);
+    NotificationDispatcher_RegisterNotificationEventHandler(&dispatcher, NOTIFICATION_EVENTS_OCARINA_SONG_MATCHED, TouchCmdHandler, NULL);
+    NotificationDispatcher_RegisterNotificationEventHandler(&dispatcher, NOTIFICATION_EVENTS_TOUCH_ACTION_CMD, TouchCmdHandler, NULL);
+
+    printf("dense scan: %d heartbeats every %d ms, %d us each\n", SCAN_BURST_PEERS, SCAN_PERIOD_US / 1000, SCAN_HANDLER_COST_US);
+    RunTrace(NOTIFICATION_EVENTS_OCARINA_SONG_MATCHED, "touch cmd on bulk lane");
+    RunTrace(NOTIFICATION_EVENTS_TOUCH_ACTION_CMD, "touch cmd on high lane");
+    return 0;
+}
@@ -0,0 +1,38 @@
+#ifndef OCARINA_LINEAR_MATCHER_H_
+#define OCARINA_LINEAR_MATCHER_H_
+
+#include <string.h>
+
+#include "OcarinaMatcher.h"
+
+// The matcher from before the automaton. Keeps the last 8 keys, scans the key sets in
+// table order and clears the keys on a match
+typedef struct LinearMatcher_t
+{
+    OcarinaKey keys[OCARINA_MAX_SONG_KEYS];
+    int count;
+} LinearMatcher;
+
+static inline int LinearMatcher_PressKey(LinearMatcher *this, OcarinaKey key)
+{
+    if (this->count == OCARINA_MAX_SONG_KEYS)
+    {
+        memmove(&this->keys[0], &this->keys[1], sizeof(this->keys) - sizeof(this->keys[0]));
+        this->count--;
+    }
+    this->keys[this->count++] = key;
+
+    for (int i = 0; i < OCARINA_NUM_SONGS; i++)
+    {
+        const OcarinaKeySet *pKeySet = &OcarinaSongKeySets[i];
+        if (this->count >= pKeySet->NumKeys &&
+            memcmp(&this->keys[this->count - pKeySet->NumKeys], pKeySet->Keys, pKeySet->NumKeys * sizeof(OcarinaKey)) == 0)
+        {
+            this->count = 0;
+            return i;
+        }
+    }
+    return -1;
+}
+
+#endif // OCARINA_LINEAR_MATCHER_H_
@@ -0,0 +1,33 @@
+// Host stand-in for the cJSON calls the tested modules make, see cJSON_host.c. Parses one flat
+// object of strings, numbers, booleans and nulls, which is what the OTA manifest is
+#ifndef HOST_CJSON_H_
+#define HOST_CJSON_H_
+
+#include <stdbool.h>
+
+#define cJSON_Invalid   (0)
+#define cJSON_False     (1 << 0)
+#define cJSON_True      (1 << 1)
+#define cJSON_NULL      (1 << 2)
+#define cJSON_Number    (1 << 3)
+#define cJSON_String    (1 << 4)
+#define cJSON_Object    (1 << 6)
+
+typedef struct cJSON
+{
+    struct cJSON *next;
+    struct cJSON *child;
+    int type;
+    char *valuestring;
+    int valueint;
+    double valuedouble;
+    char *string;
+} cJSON;
+
+cJSON *cJSON_Parse(const char *value);
+cJSON *cJSON_GetObjectItem(const cJSON *object, const char *string);
+bool cJSON_IsString(const cJSON *item);
+bool cJSON_IsNumber(const cJSON *item);
+void cJSON_Delete(cJSON *item);
+
+#endif // HOST_CJSON_H_
@@ -0,0 +1,187 @@
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+#include "cJSON.h"
+
+static const char *_SkipSpace(const char *p)
+{
+    while (*p && isspace((unsigned char)*p))
+    {
+        p++;
+    }
+    return p;
+}
+
+// Copies a quoted string with its escapes resolved. \u escapes become '?', nothing here needs them
+static const char *_ParseString(const char *p, char **pOut)
+{
+    if (*p != '"')
+    {
+        return NULL;
+    }
+    p++;
+    char *out = malloc(strlen(p) + 1);
+    size_t n = 0;
+    while (*p && *p != '"')
+    {
+        char c = *p++;
+        if (c == '\\')
+        {
+            c = *p++;
+            switch (c)
+            {
+                case 'n': c = '\n'; break;
+                case 't': c = '\t'; break;
+                case 'r': c = '\r'; break;
+                case 'b': c = '\b'; break;
+                case 'f': c = '\f'; break;
+                case 'u':
+                    for (int i = 0; i < 4; i++)
+                    {
+                        if (!isxdigit((unsigned char)*p))
+                        {
+                            free(out);
+                            return NULL;
+                        }
+                        p++;
+                    }
+                    c = '?';
+                    break;
+                case '"': case '\\': case '/': break;
+                default:
+                    free(out);
+                    return NULL;
+            }
+        }
+        out[n++] = c;
+    }
+    if (*p != '"')
+    {
+        free(out);
+        return NULL;
+    }
+    out[n] = '\0';
+    *pOut = out;
+    return p + 1;
+}
+
+static const char *_ParseValue(const char *p, cJSON *pItem)
+{
+    if (*p == '"')
+    {
+        pItem->type = cJSON_String;
+        return _ParseString(p, &pItem->valuestring);
+    }
+    if (strncmp(p, "true", 4) == 0)
+    {
+        pItem->type = cJSON_True;
+        pItem->valueint = 1;
+        return p + 4;
+    }
+    if (strncmp(p, "false", 5) == 0)
+    {
+        pItem->type = cJSON_False;
+        return p + 5;
+    }
+    if (strncmp(p, "null", 4) == 0)
+    {
+        pItem->type = cJSON_NULL;
+        return p + 4;
+    }
+    char *end = NULL;
+    double value = strtod(p, &end);
+    if (end == p)
+    {
+        return NULL;
+    }
+    pItem->type = cJSON_Number;
+    pItem->valuedouble = value;
+    pItem->valueint = (int)value;
+    return end;
+}
+
+cJSON *cJSON_Parse(const char *value)
+{
+    if (value == NULL)
+    {
+        return NULL;
+    }
+    const char *p = _SkipSpace(value);
+    if (*p++ != '{')
+    {
+        return NULL;
+    }
+    cJSON *root = calloc(1, sizeof(cJSON));
+    root->type = cJSON_Object;
+    cJSON **ppNext = &root->child;
+
+    p = _SkipSpace(p);
+    if (*p == '}')
+    {
+        return root;
+    }
+    while (p != NULL)
+    {
+        cJSON *pItem = calloc(1, sizeof(cJSON));
+        *ppNext = pItem;
+        ppNext = &pItem->next;
+
+        p = _ParseString(_SkipSpace(p), &pItem->string);
+        p = p ? _SkipSpace(p) : NULL;
+        if (p == NULL || *p++ != ':')
+        {
+            break;
+        }
+        p = _ParseValue(_SkipSpace(p), pItem);
+        p = p ? _SkipSpace(p) : NULL;
+        if (p != NULL && *p == ',')
+        {
+            p++;
+            continue;
+        }
+        if (p != NULL && *p == '}' && *_SkipSpace(p + 1) == '\0')
+        {
+            return root;
+        }
+        break;
+    }
+    cJSON_Delete(root);
+    return NULL;
+}
+
+cJSON *cJSON_GetObjectItem(const cJSON *object, const char *string)
+{
+    for (cJSON *pItem = object ? object->child : NULL; pItem != NULL; pItem = pItem->next)
+    {
+        if (pItem->string && strcasecmp(pItem->string, string) == 0)
+        {
+            return pItem;
+        }
+    }
+    return NULL;
+}
+
+bool cJSON_IsString(const cJSON *item)
+{
+    return item != NULL && item->type == cJSON_String;
+}
+
+bool cJSON_IsNumber(const cJSON *item)
+{
+    return item != NULL && item->type == cJSON_Number;
+}
+
+void cJSON_Delete(cJSON *item)
+{
+    while (item != NULL)
+    {
+        cJSON *pNext = item->next;
+        cJSON_Delete(item->child);
+        free(item->valuestring);
+        free(item->string);
+        free(item);
+        item = pNext;
+    }
+}
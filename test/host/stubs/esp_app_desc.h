@@ -0,0 +1,16 @@
+// Host stand-in for the app descriptor, with only the field the tested modules compare
+#ifndef HOST_ESP_APP_DESC_H_
+#define HOST_ESP_APP_DESC_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct
+{
+    uint8_t app_elf_sha256[32];
+} esp_app_desc_t;
+
+// Hex of the running app's ELF SHA256, like the real one. Provided by the test
+int esp_app_get_elf_sha256(char *dst, size_t size);
+
+#endif // HOST_ESP_APP_DESC_H_
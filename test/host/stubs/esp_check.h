@@ -0,0 +1,8 @@
+// Host stand-in, the tested modules only need the include to resolve
+#ifndef HOST_ESP_CHECK_H_
+#define HOST_ESP_CHECK_H_
+
+#include "esp_err.h"
+#include "esp_log.h"
+
+#endif // HOST_ESP_CHECK_H_
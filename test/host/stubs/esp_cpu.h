@@ -0,0 +1,15 @@
+// Host stand-in. The cycle counter counts nanoseconds at the 1 GHz esp_rom_sys.h reports
+#ifndef HOST_ESP_CPU_H_
+#define HOST_ESP_CPU_H_
+
+#include <stdint.h>
+#include <time.h>
+
+static inline uint32_t esp_cpu_get_cycle_count(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t)((uint64_t)now.tv_sec * 1000000000 + now.tv_nsec);
+}
+
+#endif // HOST_ESP_CPU_H_
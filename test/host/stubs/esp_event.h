@@ -0,0 +1,12 @@
+// Host stand-in for the event loop types the notification handlers use
+#ifndef HOST_ESP_EVENT_H_
+#define HOST_ESP_EVENT_H_
+
+#include <stdint.h>
+
+#include "esp_err.h"
+
+typedef const char *esp_event_base_t;
+typedef void (*esp_event_handler_t)(void *pEventHandlerArgs, esp_event_base_t eventBase, int32_t eventId, void *pEventData);
+
+#endif // HOST_ESP_EVENT_H_
@@ -0,0 +1,15 @@
+// Host stand-in. Every capability comes from the one host heap
+#ifndef HOST_ESP_HEAP_CAPS_H_
+#define HOST_ESP_HEAP_CAPS_H_
+
+#include <stdlib.h>
+
+#define MALLOC_CAP_8BIT         (1 << 2)
+#define MALLOC_CAP_INTERNAL     (1 << 11)
+#define MALLOC_CAP_SPIRAM       (1 << 10)
+
+#define heap_caps_malloc(size, caps)        ((void)(caps), malloc(size))
+#define heap_caps_calloc(n, size, caps)     ((void)(caps), calloc((n), (size)))
+#define heap_caps_free(ptr)                 free(ptr)
+
+#endif // HOST_ESP_HEAP_CAPS_H_
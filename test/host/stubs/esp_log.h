@@ -0,0 +1,17 @@
+// Host stand-in for the ESP-IDF logger. Errors and warnings go to stderr, the rest is dropped
+// but still type checked, so arguments only used in logs don't read as unused
+#ifndef HOST_ESP_LOG_H_
+#define HOST_ESP_LOG_H_
+
+#include <stdio.h>
+
+#define ESP_LOG_INFO 3
+
+#define ESP_LOGE(tag, format, ...) fprintf(stderr, "E %s: " format "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGW(tag, format, ...) fprintf(stderr, "W %s: " format "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGI(tag, format, ...) do { if (0) fprintf(stderr, "%s: " format "\n", tag, ##__VA_ARGS__); } while (0)
+#define ESP_LOGD(tag, format, ...) do { if (0) fprintf(stderr, "%s: " format "\n", tag, ##__VA_ARGS__); } while (0)
+#define ESP_LOGV(tag, format, ...) do { if (0) fprintf(stderr, "%s: " format "\n", tag, ##__VA_ARGS__); } while (0)
+#define ESP_LOG_BUFFER_HEX_LEVEL(tag, buffer, length, level) do { (void)(tag); (void)(buffer); (void)(length); } while (0)
+
+#endif // HOST_ESP_LOG_H_
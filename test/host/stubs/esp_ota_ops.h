@@ -0,0 +1,19 @@
+// Host stand-in for the OTA partition calls. esp_partition.c has the running partition lookup,
+// tests that install images provide the rest
+#ifndef HOST_ESP_OTA_OPS_H_
+#define HOST_ESP_OTA_OPS_H_
+
+#include "esp_app_desc.h"
+#include "esp_partition.h"
+
+#define ESP_ERR_OTA_VALIDATE_FAILED 0x1503
+
+// Tests point this at the partition delta images copy from
+extern const esp_partition_t *pHostRunningPartition;
+
+const esp_partition_t *esp_ota_get_running_partition(void);
+const esp_partition_t *esp_ota_get_next_update_partition(const esp_partition_t *start_from);
+esp_err_t esp_ota_get_partition_description(const esp_partition_t *partition, esp_app_desc_t *app_desc);
+esp_err_t esp_ota_set_boot_partition(const esp_partition_t *partition);
+
+#endif // HOST_ESP_OTA_OPS_H_
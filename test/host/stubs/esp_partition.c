@@ -0,0 +1,50 @@
+#include <string.h>
+
+#include "esp_ota_ops.h"
+#include "esp_partition.h"
+#include "spi_flash_mmap.h"
+
+const esp_partition_t *pHostRunningPartition = NULL;
+
+esp_err_t esp_partition_erase_range(const esp_partition_t *partition, size_t offset, size_t size)
+{
+    if (offset % SPI_FLASH_SEC_SIZE != 0 || size % SPI_FLASH_SEC_SIZE != 0)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (offset + size > partition->size)
+    {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    memset(partition->pHostData + offset, 0xFF, size);
+    return ESP_OK;
+}
+
+esp_err_t esp_partition_write(const esp_partition_t *partition, size_t dst_offset, const void *src, size_t size)
+{
+    const uint8_t *pSrc = src;
+    if (dst_offset + size > partition->size)
+    {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    for (size_t i = 0; i < size; i++)
+    {
+        partition->pHostData[dst_offset + i] &= pSrc[i];
+    }
+    return ESP_OK;
+}
+
+esp_err_t esp_partition_read(const esp_partition_t *partition, size_t src_offset, void *dst, size_t size)
+{
+    if (src_offset + size > partition->size)
+    {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    memcpy(dst, partition->pHostData + src_offset, size);
+    return ESP_OK;
+}
+
+const esp_partition_t *esp_ota_get_running_partition(void)
+{
+    return pHostRunningPartition;
+}
@@ -0,0 +1,22 @@
+// Host stand-in for flash partitions, backed by memory. Writes can only clear bits
+// like NOR flash, so writing a range that wasn't erased first corrupts it
+#ifndef HOST_ESP_PARTITION_H_
+#define HOST_ESP_PARTITION_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "esp_err.h"
+
+typedef struct esp_partition_t
+{
+    uint32_t address;
+    uint32_t size;
+    uint8_t *pHostData;
+} esp_partition_t;
+
+esp_err_t esp_partition_erase_range(const esp_partition_t *partition, size_t offset, size_t size);
+esp_err_t esp_partition_write(const esp_partition_t *partition, size_t dst_offset, const void *src, size_t size);
+esp_err_t esp_partition_read(const esp_partition_t *partition, size_t src_offset, void *dst, size_t size);
+
+#endif // HOST_ESP_PARTITION_H_
@@ -0,0 +1,12 @@
+// Host stand-in, see esp_cpu.h
+#ifndef HOST_ESP_ROM_SYS_H_
+#define HOST_ESP_ROM_SYS_H_
+
+#include <stdint.h>
+
+static inline uint32_t esp_rom_get_cpu_ticks_per_us(void)
+{
+    return 1000;
+}
+
+#endif // HOST_ESP_ROM_SYS_H_
@@ -0,0 +1,12 @@
+// Host stand-in. esp_restart is provided by tests that reach it and returns there
+#ifndef HOST_ESP_SYSTEM_H_
+#define HOST_ESP_SYSTEM_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "esp_err.h"
+
+void esp_restart(void);
+
+#endif // HOST_ESP_SYSTEM_H_
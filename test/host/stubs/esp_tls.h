@@ -0,0 +1,19 @@
+// Host stand-in, there is no TLS session to report errors from
+#ifndef HOST_ESP_TLS_H_
+#define HOST_ESP_TLS_H_
+
+#include <stddef.h>
+
+#include "esp_err.h"
+
+typedef struct esp_tls_last_error *esp_tls_error_handle_t;
+
+static inline esp_err_t esp_tls_get_and_clear_last_error(esp_tls_error_handle_t h, int *esp_tls_code, int *esp_tls_flags)
+{
+    (void)h;
+    (void)esp_tls_code;
+    (void)esp_tls_flags;
+    return ESP_OK;
+}
+
+#endif // HOST_ESP_TLS_H_
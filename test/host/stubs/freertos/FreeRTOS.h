@@ -0,0 +1,60 @@
+// Host stand-in. Tasks are pthreads (see freertos_host.c) and critical sections are a spinlock
+#ifndef HOST_FREERTOS_H_
+#define HOST_FREERTOS_H_
+
+#include <assert.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <unistd.h>
+
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+
+#define pdFALSE                     0
+#define pdTRUE                      1
+#define pdFAIL                      pdFALSE
+#define pdPASS                      pdTRUE
+#define portMAX_DELAY               ((TickType_t)0xffffffffUL)
+#define portTICK_PERIOD_MS          1
+#define configTICK_RATE_HZ          1000
+#define configMINIMAL_STACK_SIZE    2048
+#define tskNO_AFFINITY              0x7fffffff
+#define pdMS_TO_TICKS(ms)           ((TickType_t)(ms))
+#define pdTICKS_TO_MS(ticks)        ((uint32_t)(ticks))
+
+typedef struct
+{
+    atomic_flag locked;
+} portMUX_TYPE;
+
+#define portMUX_INITIALIZER_UNLOCKED { ATOMIC_FLAG_INIT }
+#define portMUX_INITIALIZE(mux) atomic_flag_clear(&(mux)->locked)
+
+// Yield first, then sleep so a holder running at a lower real time priority gets the CPU
+static inline void HostMux_Enter(portMUX_TYPE *pMux)
+{
+    for (uint32_t spins = 0; atomic_flag_test_and_set_explicit(&pMux->locked, memory_order_acquire); spins++)
+    {
+        if (spins < 64)
+        {
+            sched_yield();
+        }
+        else
+        {
+            usleep(10);
+        }
+    }
+}
+
+static inline void HostMux_Exit(portMUX_TYPE *pMux)
+{
+    atomic_flag_clear_explicit(&pMux->locked, memory_order_release);
+}
+
+#define taskENTER_CRITICAL(mux) HostMux_Enter(mux)
+#define taskEXIT_CRITICAL(mux)  HostMux_Exit(mux)
+
+#endif // HOST_FREERTOS_H_
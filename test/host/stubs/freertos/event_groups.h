@@ -0,0 +1,17 @@
+// Host stand-in, a mutex and condition variable behind the FreeRTOS event group calls
+#ifndef HOST_FREERTOS_EVENT_GROUPS_H_
+#define HOST_FREERTOS_EVENT_GROUPS_H_
+
+#include "freertos/FreeRTOS.h"
+
+typedef uint32_t EventBits_t;
+typedef struct HostEventGroup_t *EventGroupHandle_t;
+
+EventGroupHandle_t xEventGroupCreate(void);
+void vEventGroupDelete(EventGroupHandle_t eventGroup);
+EventBits_t xEventGroupSetBits(EventGroupHandle_t eventGroup, EventBits_t bitsToSet);
+EventBits_t xEventGroupClearBits(EventGroupHandle_t eventGroup, EventBits_t bitsToClear);
+EventBits_t xEventGroupGetBits(EventGroupHandle_t eventGroup);
+EventBits_t xEventGroupWaitBits(EventGroupHandle_t eventGroup, EventBits_t bitsToWaitFor, BaseType_t clearOnExit, BaseType_t waitForAllBits, TickType_t ticksToWait);
+
+#endif // HOST_FREERTOS_EVENT_GROUPS_H_
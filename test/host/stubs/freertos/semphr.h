@@ -0,0 +1,16 @@
+// Host stand-in. Mutexes and binary semaphores are both a count guarded by a pthread mutex, see freertos_host.c
+#ifndef HOST_FREERTOS_SEMPHR_H_
+#define HOST_FREERTOS_SEMPHR_H_
+
+#include "freertos/FreeRTOS.h"
+
+typedef struct HostSemaphore_t *SemaphoreHandle_t;
+
+// Mutexes start given, binary semaphores start taken. Neither tracks an owner
+SemaphoreHandle_t xSemaphoreCreateMutex(void);
+SemaphoreHandle_t xSemaphoreCreateBinary(void);
+void vSemaphoreDelete(SemaphoreHandle_t semaphore);
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticksToWait);
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore);
+
+#endif // HOST_FREERTOS_SEMPHR_H_
@@ -0,0 +1,24 @@
+// Host stand-in. Tasks run as pthreads with a counting notification, see freertos_host.c
+#ifndef HOST_FREERTOS_TASK_H_
+#define HOST_FREERTOS_TASK_H_
+
+#include "freertos/FreeRTOS.h"
+
+typedef struct HostTask_t *TaskHandle_t;
+typedef void (*TaskFunction_t)(void *);
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t taskFunction, const char *pName, uint32_t stackDepth, void *pParameters, UBaseType_t priority, TaskHandle_t *pTaskHandle, BaseType_t coreId);
+BaseType_t xTaskCreate(TaskFunction_t taskFunction, const char *pName, uint32_t stackDepth, void *pParameters, UBaseType_t priority, TaskHandle_t *pTaskHandle);
+void vTaskDelete(TaskHandle_t taskHandle);
+void vTaskDelay(TickType_t ticks);
+TickType_t xTaskGetTickCount(void);
+TaskHandle_t xTaskGetCurrentTaskHandle(void);
+UBaseType_t uxTaskGetTaskNumber(TaskHandle_t taskHandle);
+BaseType_t xTaskNotifyGive(TaskHandle_t taskHandle);
+uint32_t ulTaskNotifyTake(BaseType_t clearCountOnExit, TickType_t ticksToWait);
+
+// Host only. Maps task priorities onto SCHED_FIFO so benchmarks see preemption between tasks.
+// Needs CAP_SYS_NICE, falls back to normal scheduling with a warning when it is not allowed
+void HostTask_UseRealTimePriorities(bool enable);
+
+#endif // HOST_FREERTOS_TASK_H_
@@ -0,0 +1,7 @@
+// Host stand-in, the tested modules only need the include to resolve
+#ifndef HOST_FREERTOS_TIMERS_H_
+#define HOST_FREERTOS_TIMERS_H_
+
+#include "freertos/FreeRTOS.h"
+
+#endif // HOST_FREERTOS_TIMERS_H_
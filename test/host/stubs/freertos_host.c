@@ -0,0 +1,356 @@
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/event_groups.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+#define HOST_TASK_MAX_PRIORITY 24
+
+struct HostTask_t
+{
+    pthread_t thread;
+    TaskFunction_t taskFunction;
+    void *pParameters;
+    UBaseType_t priority;
+    UBaseType_t taskNumber;
+    pthread_mutex_t lock;
+    pthread_cond_t notified;
+    uint32_t notifyCount;
+};
+
+struct HostEventGroup_t
+{
+    pthread_mutex_t lock;
+    pthread_cond_t changed;
+    EventBits_t bits;
+};
+
+struct HostSemaphore_t
+{
+    pthread_mutex_t lock;
+    pthread_cond_t given;
+    uint32_t count;
+};
+
+static __thread struct HostTask_t *pCurrentTask = NULL;
+static atomic_uint nextTaskNumber = 1;
+static bool useRealTimePriorities = false;
+
+static void _AbsTimeAfter(struct timespec *pTime, TickType_t ticks)
+{
+    clock_gettime(CLOCK_MONOTONIC, pTime);
+    pTime->tv_sec += ticks / 1000;
+    pTime->tv_nsec += (long)(ticks % 1000) * 1000000;
+    if (pTime->tv_nsec >= 1000000000)
+    {
+        pTime->tv_sec++;
+        pTime->tv_nsec -= 1000000000;
+    }
+}
+
+static void _InitMonotonicCond(pthread_cond_t *pCond)
+{
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(pCond, &attr);
+    pthread_condattr_destroy(&attr);
+}
+
+static void *_TaskEntry(void *pArg)
+{
+    pCurrentTask = pArg;
+    pCurrentTask->taskFunction(pCurrentTask->pParameters);
+    return NULL;
+}
+
+void HostTask_UseRealTimePriorities(bool enable)
+{
+    useRealTimePriorities = enable;
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t taskFunction, const char *pName, uint32_t stackDepth, void *pParameters, UBaseType_t priority, TaskHandle_t *pTaskHandle, BaseType_t coreId)
+{
+    (void)pName;
+    (void)stackDepth;
+    (void)coreId;
+
+    struct HostTask_t *pTask = calloc(1, sizeof(*pTask));
+    if (pTask == NULL)
+    {
+        return pdFAIL;
+    }
+    pTask->taskFunction = taskFunction;
+    pTask->pParameters = pParameters;
+    pTask->priority = priority;
+    pTask->taskNumber = atomic_fetch_add(&nextTaskNumber, 1);
+    pthread_mutex_init(&pTask->lock, NULL);
+    _InitMonotonicCond(&pTask->notified);
+
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+    if (useRealTimePriorities)
+    {
+        struct sched_param param = { .sched_priority = sched_get_priority_min(SCHED_FIFO) + (int)(priority % HOST_TASK_MAX_PRIORITY) };
+        pthread_attr_setinheritsched(&attr, PTHREAD_EXPLICIT_SCHED);
+        pthread_attr_setschedpolicy(&attr, SCHED_FIFO);
+        pthread_attr_setschedparam(&attr, &param);
+    }
+
+    // Publish the handle before the task runs, dispatch loops post to themselves through it
+    if (pTaskHandle)
+    {
+        *pTaskHandle = pTask;
+    }
+    int rc = pthread_create(&pTask->thread, &attr, _TaskEntry, pTask);
+    if (rc == EPERM && useRealTimePriorities)
+    {
+        fprintf(stderr, "W host: real time priorities not permitted, using normal scheduling\n");
+        useRealTimePriorities = false;
+        pthread_attr_setinheritsched(&attr, PTHREAD_INHERIT_SCHED);
+        rc = pthread_create(&pTask->thread, &attr, _TaskEntry, pTask);
+    }
+    pthread_attr_destroy(&attr);
+    return (rc == 0) ? pdPASS : pdFAIL;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t taskFunction, const char *pName, uint32_t stackDepth, void *pParameters, UBaseType_t priority, TaskHandle_t *pTaskHandle)
+{
+    return xTaskCreatePinnedToCore(taskFunction, pName, stackDepth, pParameters, priority, pTaskHandle, tskNO_AFFINITY);
+}
+
+void vTaskDelete(TaskHandle_t taskHandle)
+{
+    // Only self deletion is used. The handle is kept, other tasks may still hold it
+    assert(taskHandle == NULL || taskHandle == pCurrentTask);
+    pthread_exit(NULL);
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+    struct timespec delay = { .tv_sec = ticks / 1000, .tv_nsec = (long)(ticks % 1000) * 1000000 };
+    if (ticks == 0)
+    {
+        sched_yield();
+        return;
+    }
+    while (nanosleep(&delay, &delay) != 0 && errno == EINTR)
+    {
+    }
+}
+
+TickType_t xTaskGetTickCount(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (TickType_t)((uint64_t)now.tv_sec * 1000 + now.tv_nsec / 1000000);
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void)
+{
+    return pCurrentTask;
+}
+
+UBaseType_t uxTaskGetTaskNumber(TaskHandle_t taskHandle)
+{
+    return (taskHandle != NULL) ? taskHandle->taskNumber : 0;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t taskHandle)
+{
+    assert(taskHandle);
+    pthread_mutex_lock(&taskHandle->lock);
+    ++taskHandle->notifyCount;
+    pthread_cond_signal(&taskHandle->notified);
+    pthread_mutex_unlock(&taskHandle->lock);
+    return pdPASS;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clearCountOnExit, TickType_t ticksToWait)
+{
+    struct HostTask_t *pTask = pCurrentTask;
+    assert(pTask);
+
+    struct timespec deadline;
+    _AbsTimeAfter(&deadline, ticksToWait);
+
+    pthread_mutex_lock(&pTask->lock);
+    while (pTask->notifyCount == 0 && ticksToWait != 0)
+    {
+        if (ticksToWait == portMAX_DELAY)
+        {
+            pthread_cond_wait(&pTask->notified, &pTask->lock);
+        }
+        else if (pthread_cond_timedwait(&pTask->notified, &pTask->lock, &deadline) == ETIMEDOUT)
+        {
+            break;
+        }
+    }
+    uint32_t count = pTask->notifyCount;
+    if (count > 0)
+    {
+        pTask->notifyCount = clearCountOnExit ? 0 : count - 1;
+    }
+    pthread_mutex_unlock(&pTask->lock);
+    return count;
+}
+
+EventGroupHandle_t xEventGroupCreate(void)
+{
+    struct HostEventGroup_t *pGroup = calloc(1, sizeof(*pGroup));
+    if (pGroup != NULL)
+    {
+        pthread_mutex_init(&pGroup->lock, NULL);
+        _InitMonotonicCond(&pGroup->changed);
+    }
+    return pGroup;
+}
+
+void vEventGroupDelete(EventGroupHandle_t eventGroup)
+{
+    if (eventGroup != NULL)
+    {
+        pthread_cond_destroy(&eventGroup->changed);
+        pthread_mutex_destroy(&eventGroup->lock);
+        free(eventGroup);
+    }
+}
+
+EventBits_t xEventGroupSetBits(EventGroupHandle_t eventGroup, EventBits_t bitsToSet)
+{
+    pthread_mutex_lock(&eventGroup->lock);
+    eventGroup->bits |= bitsToSet;
+    EventBits_t bits = eventGroup->bits;
+    pthread_cond_broadcast(&eventGroup->changed);
+    pthread_mutex_unlock(&eventGroup->lock);
+    return bits;
+}
+
+EventBits_t xEventGroupClearBits(EventGroupHandle_t eventGroup, EventBits_t bitsToClear)
+{
+    pthread_mutex_lock(&eventGroup->lock);
+    EventBits_t bits = eventGroup->bits;
+    eventGroup->bits &= ~bitsToClear;
+    pthread_mutex_unlock(&eventGroup->lock);
+    return bits;
+}
+
+EventBits_t xEventGroupGetBits(EventGroupHandle_t eventGroup)
+{
+    pthread_mutex_lock(&eventGroup->lock);
+    EventBits_t bits = eventGroup->bits;
+    pthread_mutex_unlock(&eventGroup->lock);
+    return bits;
+}
+
+EventBits_t xEventGroupWaitBits(EventGroupHandle_t eventGroup, EventBits_t bitsToWaitFor, BaseType_t clearOnExit, BaseType_t waitForAllBits, TickType_t ticksToWait)
+{
+    struct timespec deadline;
+    _AbsTimeAfter(&deadline, ticksToWait);
+
+    pthread_mutex_lock(&eventGroup->lock);
+    while (true)
+    {
+        EventBits_t matched = eventGroup->bits & bitsToWaitFor;
+        bool done = waitForAllBits ? (matched == bitsToWaitFor) : (matched != 0);
+        if (done || ticksToWait == 0)
+        {
+            break;
+        }
+        if (ticksToWait == portMAX_DELAY)
+        {
+            pthread_cond_wait(&eventGroup->changed, &eventGroup->lock);
+        }
+        else if (pthread_cond_timedwait(&eventGroup->changed, &eventGroup->lock, &deadline) == ETIMEDOUT)
+        {
+            break;
+        }
+    }
+    EventBits_t bits = eventGroup->bits;
+    EventBits_t matched = bits & bitsToWaitFor;
+    if (clearOnExit && (waitForAllBits ? (matched == bitsToWaitFor) : (matched != 0)))
+    {
+        eventGroup->bits &= ~bitsToWaitFor;
+    }
+    pthread_mutex_unlock(&eventGroup->lock);
+    return bits;
+}
+
+static SemaphoreHandle_t _SemaphoreCreate(uint32_t count)
+{
+    struct HostSemaphore_t *pSemaphore = calloc(1, sizeof(*pSemaphore));
+    if (pSemaphore != NULL)
+    {
+        pthread_mutex_init(&pSemaphore->lock, NULL);
+        _InitMonotonicCond(&pSemaphore->given);
+        pSemaphore->count = count;
+    }
+    return pSemaphore;
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void)
+{
+    return _SemaphoreCreate(1);
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary(void)
+{
+    return _SemaphoreCreate(0);
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t semaphore)
+{
+    if (semaphore != NULL)
+    {
+        pthread_cond_destroy(&semaphore->given);
+        pthread_mutex_destroy(&semaphore->lock);
+        free(semaphore);
+    }
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticksToWait)
+{
+    struct timespec deadline;
+    _AbsTimeAfter(&deadline, ticksToWait);
+
+    pthread_mutex_lock(&semaphore->lock);
+    while (semaphore->count == 0 && ticksToWait != 0)
+    {
+        if (ticksToWait == portMAX_DELAY)
+        {
+            pthread_cond_wait(&semaphore->given, &semaphore->lock);
+        }
+        else if (pthread_cond_timedwait(&semaphore->given, &semaphore->lock, &deadline) == ETIMEDOUT)
+        {
+            break;
+        }
+    }
+    BaseType_t taken = (semaphore->count > 0) ? pdTRUE : pdFALSE;
+    if (taken)
+    {
+        semaphore->count--;
+    }
+    pthread_mutex_unlock(&semaphore->lock);
+    return taken;
+}
+
+// Giving an already given semaphore fails, as it does on target
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore)
+{
+    pthread_mutex_lock(&semaphore->lock);
+    BaseType_t given = (semaphore->count == 0) ? pdTRUE : pdFALSE;
+    if (given)
+    {
+        semaphore->count = 1;
+        pthread_cond_signal(&semaphore->given);
+    }
+    pthread_mutex_unlock(&semaphore->lock);
+    return given;
+}
@@ -0,0 +1,24 @@
+// Host stand-in for the mbedtls public key calls, backed by OpenSSL in mbedtls_pk_host.c
+#ifndef HOST_MBEDTLS_PK_H_
+#define HOST_MBEDTLS_PK_H_
+
+#include <stddef.h>
+
+typedef enum
+{
+    MBEDTLS_MD_NONE = 0,
+    MBEDTLS_MD_SHA256 = 9,
+} mbedtls_md_type_t;
+
+typedef struct mbedtls_pk_context
+{
+    void *pKey;
+} mbedtls_pk_context;
+
+void mbedtls_pk_init(mbedtls_pk_context *ctx);
+void mbedtls_pk_free(mbedtls_pk_context *ctx);
+// DER SubjectPublicKeyInfo, or PEM when the buffer is NUL terminated text
+int mbedtls_pk_parse_public_key(mbedtls_pk_context *ctx, const unsigned char *key, size_t keylen);
+int mbedtls_pk_verify(mbedtls_pk_context *ctx, mbedtls_md_type_t md_alg, const unsigned char *hash, size_t hash_len, const unsigned char *sig, size_t sig_len);
+
+#endif // HOST_MBEDTLS_PK_H_
@@ -0,0 +1,9 @@
+// Host stand-in for the one shot mbedtls SHA256, backed by OpenSSL in mbedtls_pk_host.c
+#ifndef HOST_MBEDTLS_SHA256_H_
+#define HOST_MBEDTLS_SHA256_H_
+
+#include <stddef.h>
+
+int mbedtls_sha256(const unsigned char *input, size_t ilen, unsigned char output[32], int is224);
+
+#endif // HOST_MBEDTLS_SHA256_H_
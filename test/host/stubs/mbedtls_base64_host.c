@@ -0,0 +1,73 @@
+#include <stdint.h>
+#include <string.h>
+
+#include "mbedtls/base64.h"
+
+static const char BASE64_ALPHABET[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+// Output is NUL terminated like mbedtls, olen leaves the terminator out
+int mbedtls_base64_encode(unsigned char *dst, size_t dlen, size_t *olen, const unsigned char *src, size_t slen)
+{
+    size_t needed = 4 * ((slen + 2) / 3);
+    if (dlen < needed + 1)
+    {
+        *olen = needed + 1;
+        return MBEDTLS_ERR_BASE64_BUFFER_TOO_SMALL;
+    }
+    size_t out = 0;
+    for (size_t i = 0; i < slen; i += 3)
+    {
+        uint32_t bits = (uint32_t)src[i] << 16;
+        bits |= (i + 1 < slen) ? (uint32_t)src[i + 1] << 8 : 0;
+        bits |= (i + 2 < slen) ? src[i + 2] : 0;
+        dst[out++] = BASE64_ALPHABET[(bits >> 18) & 0x3f];
+        dst[out++] = BASE64_ALPHABET[(bits >> 12) & 0x3f];
+        dst[out++] = (i + 1 < slen) ? BASE64_ALPHABET[(bits >> 6) & 0x3f] : '=';
+        dst[out++] = (i + 2 < slen) ? BASE64_ALPHABET[bits & 0x3f] : '=';
+    }
+    dst[out] = '\0';
+    *olen = out;
+    return 0;
+}
+
+// Strict about length and padding placement, which is all the callers rely on
+int mbedtls_base64_decode(unsigned char *dst, size_t dlen, size_t *olen, const unsigned char *src, size_t slen)
+{
+    if (slen % 4 != 0)
+    {
+        return MBEDTLS_ERR_BASE64_INVALID_CHARACTER;
+    }
+    size_t padding = 0;
+    while (padding < 2 && padding < slen && src[slen - 1 - padding] == '=')
+    {
+        padding++;
+    }
+    size_t needed = (slen / 4) * 3 - padding;
+    if (dst == NULL || dlen < needed)
+    {
+        *olen = needed;
+        return MBEDTLS_ERR_BASE64_BUFFER_TOO_SMALL;
+    }
+
+    size_t out = 0;
+    for (size_t i = 0; i < slen; i += 4)
+    {
+        uint32_t bits = 0;
+        for (size_t j = 0; j < 4; j++)
+        {
+            uint8_t c = src[i + j];
+            const char *pFound = (c != '\0' && c != '=') ? strchr(BASE64_ALPHABET, c) : NULL;
+            if (pFound == NULL && !(c == '=' && i + j >= slen - padding))
+            {
+                return MBEDTLS_ERR_BASE64_INVALID_CHARACTER;
+            }
+            bits = (bits << 6) | (pFound ? (uint32_t)(pFound - BASE64_ALPHABET) : 0);
+        }
+        for (int shift = 16; shift >= 0 && out < needed; shift -= 8)
+        {
+            dst[out++] = (uint8_t)(bits >> shift);
+        }
+    }
+    *olen = out;
+    return 0;
+}
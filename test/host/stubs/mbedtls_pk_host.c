@@ -0,0 +1,77 @@
+#include <string.h>
+
+#include <openssl/bio.h>
+#include <openssl/evp.h>
+#include <openssl/pem.h>
+#include <openssl/x509.h>
+
+#include "mbedtls/pk.h"
+#include "mbedtls/sha256.h"
+
+// Any non zero value is a failure to the callers, the exact mbedtls codes don't matter here
+#define HOST_MBEDTLS_ERR    -1
+
+void mbedtls_pk_init(mbedtls_pk_context *ctx)
+{
+    ctx->pKey = NULL;
+}
+
+void mbedtls_pk_free(mbedtls_pk_context *ctx)
+{
+    EVP_PKEY_free((EVP_PKEY *)ctx->pKey);
+    ctx->pKey = NULL;
+}
+
+int mbedtls_pk_parse_public_key(mbedtls_pk_context *ctx, const unsigned char *key, size_t keylen)
+{
+    EVP_PKEY *pKey = NULL;
+    if (keylen > 0 && key[keylen - 1] == '\0')
+    {
+        BIO *pBio = BIO_new_mem_buf(key, (int)keylen - 1);
+        pKey = PEM_read_bio_PUBKEY(pBio, NULL, NULL, NULL);
+        BIO_free(pBio);
+    }
+    else
+    {
+        const unsigned char *pDer = key;
+        pKey = d2i_PUBKEY(NULL, &pDer, (long)keylen);
+        if (pKey != NULL && pDer != key + keylen)
+        {
+            EVP_PKEY_free(pKey);
+            pKey = NULL;
+        }
+    }
+    if (pKey == NULL)
+    {
+        return HOST_MBEDTLS_ERR;
+    }
+    ctx->pKey = pKey;
+    return 0;
+}
+
+int mbedtls_pk_verify(mbedtls_pk_context *ctx, mbedtls_md_type_t md_alg, const unsigned char *hash, size_t hash_len, const unsigned char *sig, size_t sig_len)
+{
+    if (ctx->pKey == NULL || md_alg != MBEDTLS_MD_SHA256 || hash_len != 32)
+    {
+        return HOST_MBEDTLS_ERR;
+    }
+    int ret = HOST_MBEDTLS_ERR;
+    EVP_PKEY_CTX *pCtx = EVP_PKEY_CTX_new((EVP_PKEY *)ctx->pKey, NULL);
+    if (pCtx != NULL && EVP_PKEY_verify_init(pCtx) == 1 && EVP_PKEY_CTX_set_signature_md(pCtx, EVP_sha256()) == 1 &&
+        EVP_PKEY_verify(pCtx, sig, sig_len, hash, hash_len) == 1)
+    {
+        ret = 0;
+    }
+    EVP_PKEY_CTX_free(pCtx);
+    return ret;
+}
+
+int mbedtls_sha256(const unsigned char *input, size_t ilen, unsigned char output[32], int is224)
+{
+    unsigned int outlen = 0;
+    if (is224 || EVP_Digest(input, ilen, output, &outlen, EVP_sha256(), NULL) != 1 || outlen != 32)
+    {
+        return HOST_MBEDTLS_ERR;
+    }
+    return 0;
+}
@@ -0,0 +1,148 @@
+#include <string.h>
+
+#include "nvs.h"
+
+#define HOST_NVS_MAX_ENTRIES    (16)
+#define HOST_NVS_MAX_NAME       (16)
+#define HOST_NVS_MAX_BLOB       (512)
+#define HOST_NVS_MAX_HANDLES    (8)
+
+typedef struct HostNvsEntry_t
+{
+    char namespaceName[HOST_NVS_MAX_NAME];
+    char key[HOST_NVS_MAX_NAME];
+    uint8_t value[HOST_NVS_MAX_BLOB];
+    size_t length;
+    int inUse;
+} HostNvsEntry;
+
+typedef struct HostNvsHandle_t
+{
+    char namespaceName[HOST_NVS_MAX_NAME];
+    nvs_open_mode_t mode;
+    int inUse;
+} HostNvsHandle;
+
+static HostNvsEntry entries[HOST_NVS_MAX_ENTRIES];
+static HostNvsHandle handles[HOST_NVS_MAX_HANDLES];
+
+static HostNvsEntry *_HostNvs_Find(const char *namespaceName, const char *key)
+{
+    for (int i = 0; i < HOST_NVS_MAX_ENTRIES; i++)
+    {
+        if (entries[i].inUse && strcmp(entries[i].namespaceName, namespaceName) == 0 &&
+            (key == NULL || strcmp(entries[i].key, key) == 0))
+        {
+            return &entries[i];
+        }
+    }
+    return NULL;
+}
+
+void HostNvs_Erase(void)
+{
+    memset(entries, 0, sizeof(entries));
+}
+
+// Like the real one, a read only open of a namespace that was never written fails
+esp_err_t nvs_open(const char *namespace_name, nvs_open_mode_t open_mode, nvs_handle_t *out_handle)
+{
+    if (strlen(namespace_name) >= HOST_NVS_MAX_NAME)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (open_mode == NVS_READONLY && _HostNvs_Find(namespace_name, NULL) == NULL)
+    {
+        return ESP_ERR_NVS_NOT_FOUND;
+    }
+    for (int i = 0; i < HOST_NVS_MAX_HANDLES; i++)
+    {
+        if (!handles[i].inUse)
+        {
+            strcpy(handles[i].namespaceName, namespace_name);
+            handles[i].mode = open_mode;
+            handles[i].inUse = 1;
+            *out_handle = (nvs_handle_t)(i + 1);
+            return ESP_OK;
+        }
+    }
+    return ESP_ERR_NO_MEM;
+}
+
+esp_err_t nvs_get_blob(nvs_handle_t handle, const char *key, void *out_value, size_t *length)
+{
+    HostNvsEntry *pEntry = _HostNvs_Find(handles[handle - 1].namespaceName, key);
+    if (pEntry == NULL)
+    {
+        return ESP_ERR_NVS_NOT_FOUND;
+    }
+    if (out_value == NULL)
+    {
+        *length = pEntry->length;
+        return ESP_OK;
+    }
+    if (*length < pEntry->length)
+    {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    memcpy(out_value, pEntry->value, pEntry->length);
+    *length = pEntry->length;
+    return ESP_OK;
+}
+
+esp_err_t nvs_set_blob(nvs_handle_t handle, const char *key, const void *value, size_t length)
+{
+    HostNvsHandle *pHandle = &handles[handle - 1];
+    if (pHandle->mode != NVS_READWRITE)
+    {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (strlen(key) >= HOST_NVS_MAX_NAME || length > HOST_NVS_MAX_BLOB)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+    HostNvsEntry *pEntry = _HostNvs_Find(pHandle->namespaceName, key);
+    for (int i = 0; pEntry == NULL && i < HOST_NVS_MAX_ENTRIES; i++)
+    {
+        if (!entries[i].inUse)
+        {
+            pEntry = &entries[i];
+            strcpy(pEntry->namespaceName, pHandle->namespaceName);
+            strcpy(pEntry->key, key);
+            pEntry->inUse = 1;
+        }
+    }
+    if (pEntry == NULL)
+    {
+        return ESP_ERR_NO_MEM;
+    }
+    memcpy(pEntry->value, value, length);
+    pEntry->length = length;
+    return ESP_OK;
+}
+
+esp_err_t nvs_erase_key(nvs_handle_t handle, const char *key)
+{
+    HostNvsHandle *pHandle = &handles[handle - 1];
+    if (pHandle->mode != NVS_READWRITE)
+    {
+        return ESP_ERR_INVALID_STATE;
+    }
+    HostNvsEntry *pEntry = _HostNvs_Find(pHandle->namespaceName, key);
+    if (pEntry == NULL)
+    {
+        return ESP_ERR_NVS_NOT_FOUND;
+    }
+    memset(pEntry, 0, sizeof(*pEntry));
+    return ESP_OK;
+}
+
+esp_err_t nvs_commit(nvs_handle_t handle)
+{
+    return (handles[handle - 1].mode == NVS_READWRITE) ? ESP_OK : ESP_ERR_INVALID_STATE;
+}
+
+void nvs_close(nvs_handle_t handle)
+{
+    handles[handle - 1].inUse = 0;
+}
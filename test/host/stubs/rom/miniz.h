@@ -0,0 +1,75 @@
+// Host stand-in for the ROM tinfl inflater, built on zlib. Covers the calls the OTA
+// decoder makes: a wrapping output window and streaming input
+#ifndef HOST_ROM_MINIZ_H_
+#define HOST_ROM_MINIZ_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <zlib.h>
+
+#define TINFL_LZ_DICT_SIZE                       32768
+#define TINFL_FLAG_PARSE_ZLIB_HEADER             1
+#define TINFL_FLAG_HAS_MORE_INPUT                2
+#define TINFL_FLAG_USING_NON_WRAPPING_OUTPUT_BUF 4
+
+typedef enum
+{
+    TINFL_STATUS_BAD_PARAM = -3,
+    TINFL_STATUS_ADLER32_MISMATCH = -2,
+    TINFL_STATUS_FAILED = -1,
+    TINFL_STATUS_DONE = 0,
+    TINFL_STATUS_NEEDS_MORE_INPUT = 1,
+    TINFL_STATUS_HAS_MORE_OUTPUT = 2
+} tinfl_status;
+
+typedef struct
+{
+    z_stream stream;
+    bool started;
+} tinfl_decompressor;
+
+#define tinfl_init(r) do { memset((r), 0, sizeof(*(r))); } while (0)
+
+// zlib keeps its own window, so writing into the caller's window at pOut_buf_next is enough
+static inline tinfl_status tinfl_decompress(tinfl_decompressor *r, const uint8_t *pIn_buf_next, size_t *pIn_buf_size,
+                                            uint8_t *pOut_buf_start, uint8_t *pOut_buf_next, size_t *pOut_buf_size,
+                                            const uint32_t decomp_flags)
+{
+    (void)pOut_buf_start;
+    if (!(decomp_flags & TINFL_FLAG_PARSE_ZLIB_HEADER))
+    {
+        return TINFL_STATUS_BAD_PARAM;
+    }
+    if (!r->started)
+    {
+        if (inflateInit(&r->stream) != Z_OK)
+        {
+            return TINFL_STATUS_FAILED;
+        }
+        r->started = true;
+    }
+
+    r->stream.next_in = (Bytef *)pIn_buf_next;
+    r->stream.avail_in = *pIn_buf_size;
+    r->stream.next_out = pOut_buf_next;
+    r->stream.avail_out = *pOut_buf_size;
+    int ret = inflate(&r->stream, Z_NO_FLUSH);
+    *pIn_buf_size -= r->stream.avail_in;
+    *pOut_buf_size -= r->stream.avail_out;
+
+    if (ret == Z_STREAM_END)
+    {
+        inflateEnd(&r->stream);
+        return TINFL_STATUS_DONE;
+    }
+    if (ret != Z_OK && ret != Z_BUF_ERROR)
+    {
+        inflateEnd(&r->stream);
+        return TINFL_STATUS_FAILED;
+    }
+    return (r->stream.avail_out == 0) ? TINFL_STATUS_HAS_MORE_OUTPUT : TINFL_STATUS_NEEDS_MORE_INPUT;
+}
+
+#endif // HOST_ROM_MINIZ_H_
@@ -0,0 +1,9 @@
+// Host stand-in for the generated config, with the debug options the tests exercise
+#ifndef HOST_SDKCONFIG_H_
+#define HOST_SDKCONFIG_H_
+
+#define CONFIG_MEM_TRACK 1
+#define CONFIG_NOTIFICATIONS_HIGH_TASK_CORE -1
+#define CONFIG_NOTIFICATIONS_BULK_TASK_CORE -1
+
+#endif // HOST_SDKCONFIG_H_
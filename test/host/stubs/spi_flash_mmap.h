@@ -0,0 +1,7 @@
+// Host stand-in for the flash sector size
+#ifndef HOST_SPI_FLASH_MMAP_H_
+#define HOST_SPI_FLASH_MMAP_H_
+
+#define SPI_FLASH_SEC_SIZE 4096
+
+#endif // HOST_SPI_FLASH_MMAP_H_
@@ -0,0 +1,244 @@
+#include <assert.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "CircularBuffer.h"
+#include "Utilities.h"
+
+#define SPSC_NUM_ITEMS  2000000
+#define MODEL_NUM_STEPS 200000
+#define MODEL_MAX_ITEMS 64
+
+// Odd sized items catch stride mistakes in the byte offsets
+typedef struct Item_t
+{
+    uint8_t bytes[3];
+} Item;
+
+static Item MakeItem(uint32_t value)
+{
+    Item item = { { (uint8_t)value, (uint8_t)(value >> 8), (uint8_t)(value >> 16) } };
+    return item;
+}
+
+static uint32_t NextRandom(uint32_t *pState)
+{
+    // xorshift32, fixed seed so failures reproduce
+    *pState ^= *pState << 13;
+    *pState ^= *pState >> 17;
+    *pState ^= *pState << 5;
+    return *pState;
+}
+
+static void TestSingleItems(bool lockFree)
+{
+    CircularBuffer cb;
+    Item item;
+    assert((lockFree ? CircularBuffer_InitLockFree(&cb, 4, sizeof(Item)) : CircularBuffer_Init(&cb, 4, sizeof(Item))) == ESP_OK);
+    assert(cb.capacity == 4);
+    assert(CircularBuffer_PopFront(&cb, &item) == ESP_FAIL);
+
+    // Several laps so head and tail both wrap
+    uint32_t pushed = 0;
+    uint32_t popped = 0;
+    for (int lap = 0; lap < 5; lap++)
+    {
+        while (CircularBuffer_Count(&cb) < 4)
+        {
+            item = MakeItem(pushed++);
+            assert(CircularBuffer_PushBack(&cb, &item) == ESP_OK);
+        }
+        assert(CircularBuffer_PushBack(&cb, &item) == ESP_FAIL);
+        for (int i = 0; i < 3; i++)
+        {
+            assert(CircularBuffer_PopFront(&cb, &item) == ESP_OK);
+            Item expected = MakeItem(popped++);
+            assert(memcmp(&item, &expected, sizeof(Item)) == 0);
+        }
+    }
+    assert(CircularBuffer_Count(&cb) == 1);
+
+    CircularBuffer_Clear(&cb);
+    assert(CircularBuffer_Count(&cb) == 0);
+    assert(CircularBuffer_PopFront(&cb, &item) == ESP_FAIL);
+    CircularBuffer_Free(&cb);
+    assert(cb.pBuffer == NULL);
+}
+
+static void TestLockFreeRoundsCapacity(void)
+{
+    CircularBuffer cb;
+    assert(CircularBuffer_InitLockFree(&cb, 5, sizeof(Item)) == ESP_OK);
+    assert(cb.capacity == 8);
+    assert(cb.mask == 7);
+    CircularBuffer_Free(&cb);
+
+    assert(CircularBuffer_InitLockFree(&cb, 8, sizeof(Item)) == ESP_OK);
+    assert(cb.capacity == 8);
+    CircularBuffer_Free(&cb);
+}
+
+// MatchSequence compares against the newest items, across the wrap
+static void TestMatchSequence(bool lockFree)
+{
+    CircularBuffer cb;
+    assert((lockFree ? CircularBuffer_InitLockFree(&cb, 8, sizeof(int)) : CircularBuffer_Init(&cb, 8, sizeof(int))) == ESP_OK);
+    for (int i = 0; i < 13; i++)
+    {
+        int discard;
+        if (CircularBuffer_Count(&cb) == 8)
+        {
+            assert(CircularBuffer_PopFront(&cb, &discard) == ESP_OK);
+        }
+        assert(CircularBuffer_PushBack(&cb, &i) == ESP_OK);
+    }
+
+    static const int tail[] = { 9, 10, 11, 12 };
+    static const int all[] = { 5, 6, 7, 8, 9, 10, 11, 12 };
+    static const int wrong[] = { 9, 10, 12 };
+    static const int tooLong[] = { 4, 5, 6, 7, 8, 9, 10, 11, 12 };
+    assert(CircularBuffer_MatchSequence(&cb, tail, 4) == ESP_OK);
+    assert(CircularBuffer_MatchSequence(&cb, all, 8) == ESP_OK);
+    assert(CircularBuffer_MatchSequence(&cb, wrong, 3) == ESP_FAIL);
+    assert(CircularBuffer_MatchSequence(&cb, tooLong, 9) == ESP_FAIL);
+    CircularBuffer_Free(&cb);
+}
+
+// Random single and bulk operations against a flat array model, with a capacity that doesn't divide the chunk sizes
+static void TestBulkAgainstModel(bool lockFree)
+{
+    CircularBuffer cb;
+    static uint32_t model[MODEL_NUM_STEPS * MODEL_MAX_ITEMS / 2];
+    size_t modelHead = 0;
+    size_t modelTail = 0;
+    uint32_t random = lockFree ? 0x5EED1234 : 0x0BADCAFE;
+    uint32_t nextValue = 0;
+
+    assert((lockFree ? CircularBuffer_InitLockFree(&cb, 32, sizeof(uint32_t)) : CircularBuffer_Init(&cb, 27, sizeof(uint32_t))) == ESP_OK);
+    for (int step = 0; step < MODEL_NUM_STEPS && modelHead + MODEL_MAX_ITEMS < sizeof(model) / sizeof(model[0]); step++)
+    {
+        uint32_t value = NextRandom(&random);
+        size_t numItems = (value >> 8) % MODEL_MAX_ITEMS;
+        uint32_t items[MODEL_MAX_ITEMS];
+
+        if (value & 1)
+        {
+            for (size_t i = 0; i < numItems; i++)
+            {
+                items[i] = nextValue + i;
+            }
+            size_t expected = MIN(numItems, cb.capacity - (modelHead - modelTail));
+            size_t numPushed = (value & 2) ? CircularBuffer_PushBackN(&cb, items, numItems)
+                                           : (numItems > 0 && CircularBuffer_PushBack(&cb, items) == ESP_OK);
+            if (!(value & 2))
+            {
+                expected = MIN(expected, 1);
+            }
+            assert(numPushed == expected);
+            for (size_t i = 0; i < numPushed; i++)
+            {
+                model[modelHead++] = nextValue++;
+            }
+        }
+        else
+        {
+            size_t expected = MIN(numItems, modelHead - modelTail);
+            size_t numPopped = (value & 2) ? CircularBuffer_PopFrontN(&cb, items, numItems)
+                                           : (numItems > 0 && CircularBuffer_PopFront(&cb, items) == ESP_OK);
+            if (!(value & 2))
+            {
+                expected = MIN(expected, 1);
+            }
+            assert(numPopped == expected);
+            for (size_t i = 0; i < numPopped; i++)
+            {
+                assert(items[i] == model[modelTail++]);
+            }
+        }
+        assert((size_t)CircularBuffer_Count(&cb) == modelHead - modelTail);
+    }
+    CircularBuffer_Free(&cb);
+}
+
+typedef struct SpscContext_t
+{
+    CircularBuffer cb;
+    uint32_t producerRandom;
+    uint32_t consumerRandom;
+} SpscContext;
+
+static void *SpscProducer(void *pArg)
+{
+    SpscContext *pContext = pArg;
+    uint32_t next = 0;
+    uint32_t items[MODEL_MAX_ITEMS];
+    while (next < SPSC_NUM_ITEMS)
+    {
+        size_t numItems = MIN(1 + NextRandom(&pContext->producerRandom) % MODEL_MAX_ITEMS, SPSC_NUM_ITEMS - next);
+        for (size_t i = 0; i < numItems; i++)
+        {
+            items[i] = next + i;
+        }
+        size_t numPushed = CircularBuffer_PushBackN(&pContext->cb, items, numItems);
+        if (numPushed == 0)
+        {
+            // Full, let the consumer run when there's a single core
+            sched_yield();
+        }
+        next += numPushed;
+    }
+    return NULL;
+}
+
+static void *SpscConsumer(void *pArg)
+{
+    SpscContext *pContext = pArg;
+    uint32_t expected = 0;
+    uint32_t items[MODEL_MAX_ITEMS];
+    while (expected < SPSC_NUM_ITEMS)
+    {
+        size_t maxItems = 1 + NextRandom(&pContext->consumerRandom) % MODEL_MAX_ITEMS;
+        size_t numPopped = CircularBuffer_PopFrontN(&pContext->cb, items, maxItems);
+        if (numPopped == 0)
+        {
+            sched_yield();
+        }
+        for (size_t i = 0; i < numPopped; i++)
+        {
+            assert(items[i] == expected++);
+        }
+    }
+    return NULL;
+}
+
+// One producer and one consumer thread, every item arrives once and in order
+static void TestLockFreeSpsc(void)
+{
+    static SpscContext context = { .producerRandom = 0x1234567, .consumerRandom = 0x7654321 };
+    pthread_t producer;
+    pthread_t consumer;
+
+    assert(CircularBuffer_InitLockFree(&context.cb, 100, sizeof(uint32_t)) == ESP_OK);
+    assert(pthread_create(&consumer, NULL, SpscConsumer, &context) == 0);
+    assert(pthread_create(&producer, NULL, SpscProducer, &context) == 0);
+    assert(pthread_join(producer, NULL) == 0);
+    assert(pthread_join(consumer, NULL) == 0);
+    assert(CircularBuffer_Count(&context.cb) == 0);
+    CircularBuffer_Free(&context.cb);
+}
+
+int main(void)
+{
+    TestSingleItems(false);
+    TestSingleItems(true);
+    TestLockFreeRoundsCapacity();
+    TestMatchSequence(false);
+    TestMatchSequence(true);
+    TestBulkAgainstModel(false);
+    TestBulkAgainstModel(true);
+    TestLockFreeSpsc();
+    printf("circular buffer: ok\n");
+    return 0;
+}
@@ -0,0 +1,270 @@
+#include <assert.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "hashmap.h"
+
+#define CAPACITY        16
+#define MODEL_NUM_KEYS  40
+#define MODEL_NUM_STEPS 200000
+
+// Odd sized keys, so the slot is rounded up past the key
+typedef struct Key_t
+{
+    uint8_t bytes[5];
+} Key;
+
+typedef HASHMAP(Key, int) KeyMap;
+typedef HASHMAP(char, int) StringMap;
+
+static size_t KeyHash(const Key *pKey)
+{
+    return hashmap_hash_default(pKey, sizeof(*pKey));
+}
+
+static int KeyCompare(const Key *pA, const Key *pB)
+{
+    return memcmp(pA, pB, sizeof(*pA));
+}
+
+// Each key gets its own exact size allocation, so a copy past the key trips AddressSanitizer
+static Key *NewKey(uint32_t value)
+{
+    Key *pKey = malloc(sizeof(Key));
+    assert(pKey);
+    pKey->bytes[0] = 0xA5;
+    memcpy(&pKey->bytes[1], &value, sizeof(value));
+    return pKey;
+}
+
+static uint32_t NextRandom(uint32_t *pState)
+{
+    // xorshift32, fixed seed so failures reproduce
+    *pState ^= *pState << 13;
+    *pState ^= *pState >> 17;
+    *pState ^= *pState << 5;
+    return *pState;
+}
+
+static void TestInitRejectsBadArena(void)
+{
+    static void *arena[HASHMAP_ARENA_SIZE(CAPACITY, sizeof(Key)) / sizeof(void *)];
+    KeyMap map;
+
+    assert(hashmap_init_arena(&map, KeyHash, KeyCompare, arena, sizeof(arena) - 1, CAPACITY, sizeof(Key), NULL) == -EINVAL);
+    assert(hashmap_init_arena(&map, KeyHash, KeyCompare, (char *)arena + 1, sizeof(arena) - sizeof(void *), 1, sizeof(Key), NULL) == -EINVAL);
+    assert(hashmap_init_arena(&map, KeyHash, KeyCompare, NULL, sizeof(arena), CAPACITY, sizeof(Key), NULL) == -EINVAL);
+    assert(hashmap_init_arena(&map, KeyHash, KeyCompare, arena, sizeof(arena), 0, sizeof(Key), NULL) == -EINVAL);
+    assert(hashmap_init_arena(&map, KeyHash, KeyCompare, arena, sizeof(arena), CAPACITY, sizeof(Key), NULL) == 0);
+    assert(map.map_base.key_size == sizeof(Key));
+    assert(map.map_base.key_slot_size == HASHMAP_ARENA_KEY_SLOT_SIZE(sizeof(Key)));
+    assert(map.map_base.table_size * 3 >= CAPACITY * 4);
+}
+
+// Puts copy the key into a slot, fill up to capacity and then fail with -ENOSPC
+static void TestPutGetRemove(void)
+{
+    static void *arena[HASHMAP_ARENA_SIZE(CAPACITY, sizeof(Key)) / sizeof(void *)];
+    static int data[CAPACITY + 1];
+    KeyMap map;
+    Key *pKeys[CAPACITY + 1];
+
+    assert(hashmap_init_arena(&map, KeyHash, KeyCompare, arena, sizeof(arena), CAPACITY, sizeof(Key), NULL) == 0);
+    for (int i = 0; i <= CAPACITY; i++)
+    {
+        pKeys[i] = NewKey(i);
+    }
+    for (int i = 0; i < CAPACITY; i++)
+    {
+        assert(hashmap_put(&map, pKeys[i], &data[i]) == 0);
+    }
+    assert(hashmap_put(&map, pKeys[0], &data[0]) == -EEXIST);
+    assert(hashmap_put(&map, pKeys[CAPACITY], &data[CAPACITY]) == -ENOSPC);
+    assert(hashmap_size(&map) == CAPACITY);
+    assert(map.map_base.key_free_list == NULL);
+
+    struct hashmap_stats stats;
+    hashmap_stats(&map, &stats);
+    assert(stats.full == 1);
+    assert(stats.rehashes == 0);
+
+    // The map holds its own copies, with the slot padding zeroed
+    const Key *pKey;
+    int *pData;
+    hashmap_foreach(pKey, pData, &map)
+    {
+        int i = pData - data;
+        assert(pKey != pKeys[i]);
+        assert((const char *)pKey >= (const char *)arena && (const char *)pKey < (const char *)arena + sizeof(arena));
+        assert(memcmp(pKey, pKeys[i], sizeof(Key)) == 0);
+        for (size_t b = sizeof(Key); b < map.map_base.key_slot_size; b++)
+        {
+            assert(((const uint8_t *)pKey)[b] == 0);
+        }
+    }
+    for (int i = 0; i < CAPACITY; i++)
+    {
+        Key lookup = *pKeys[i];
+        free(pKeys[i]);
+        pKeys[i] = NULL;
+        assert(hashmap_get(&map, &lookup) == &data[i]);
+        pKeys[i] = NewKey(i);
+    }
+
+    // A removed key's slot is the next one handed out
+    const Key *pRemovedSlot = NULL;
+    hashmap_foreach(pKey, pData, &map)
+    {
+        if (pData == &data[3])
+        {
+            pRemovedSlot = pKey;
+        }
+    }
+    assert(hashmap_remove(&map, pKeys[3]) == &data[3]);
+    assert(hashmap_remove(&map, pKeys[3]) == NULL);
+    assert(hashmap_get(&map, pKeys[3]) == NULL);
+    assert(map.map_base.key_free_list == pRemovedSlot);
+    assert(hashmap_put(&map, pKeys[CAPACITY], &data[CAPACITY]) == 0);
+    assert(hashmap_get(&map, pKeys[CAPACITY]) == &data[CAPACITY]);
+    hashmap_foreach(pKey, pData, &map)
+    {
+        if (pData == &data[CAPACITY])
+        {
+            assert(pKey == pRemovedSlot);
+        }
+    }
+
+    // Clear returns every slot to the free list
+    hashmap_clear(&map);
+    assert(hashmap_size(&map) == 0);
+    for (int i = 0; i < CAPACITY; i++)
+    {
+        assert(hashmap_put(&map, pKeys[i], &data[i]) == 0);
+    }
+    assert(hashmap_put(&map, pKeys[CAPACITY], &data[CAPACITY]) == -ENOSPC);
+
+    hashmap_cleanup(&map);
+    for (int i = 0; i <= CAPACITY; i++)
+    {
+        free(pKeys[i]);
+    }
+}
+
+// String keys go through the copy function, which rejects strings longer than the slot
+static void TestStringKeys(void)
+{
+    static void *arena[HASHMAP_ARENA_SIZE(4, 12) / sizeof(void *)];
+    static int data[4];
+    StringMap map;
+
+    assert(hashmap_init_arena(&map, hashmap_hash_string, strcmp, arena, sizeof(arena), 4, 12, hashmap_key_copy_string) == 0);
+    char name[32] = "badge-1";
+    assert(hashmap_put(&map, name, &data[0]) == 0);
+    strcpy(name, "badge-2");
+    assert(hashmap_put(&map, name, &data[1]) == 0);
+    assert(hashmap_get(&map, "badge-1") == &data[0]);
+    assert(hashmap_get(&map, "badge-2") == &data[1]);
+
+    // A string that doesn't fit the slot is rejected and the slot goes back on the free list
+    void *pFreeList = map.map_base.key_free_list;
+    assert(hashmap_put(&map, "badge-name-too-long", &data[2]) == -E2BIG);
+    assert(map.map_base.key_free_list == pFreeList);
+    assert(hashmap_size(&map) == 2);
+    assert(hashmap_put(&map, "badge-3", &data[2]) == 0);
+    hashmap_cleanup(&map);
+}
+
+// key_size 0 keeps the caller's key pointers
+static void TestCallerOwnedKeys(void)
+{
+    static void *arena[HASHMAP_ARENA_SIZE(4, 0) / sizeof(void *)];
+    static int data[4];
+    StringMap map;
+    static const char *names[] = { "a", "b", "c", "d", "e" };
+
+    assert(hashmap_init_arena(&map, hashmap_hash_string, strcmp, arena, sizeof(arena), 4, 0, NULL) == 0);
+    for (int i = 0; i < 4; i++)
+    {
+        assert(hashmap_put(&map, names[i], &data[i]) == 0);
+    }
+    assert(hashmap_put(&map, names[4], &data[0]) == -ENOSPC);
+
+    const char *pKey;
+    int *pData;
+    hashmap_foreach(pKey, pData, &map)
+    {
+        assert(pKey == names[pData - data]);
+    }
+    hashmap_cleanup(&map);
+}
+
+// Seeded random puts and removes against a presence model
+static void TestAgainstModel(void)
+{
+    static void *arena[HASHMAP_ARENA_SIZE(CAPACITY, sizeof(Key)) / sizeof(void *)];
+    static int data[MODEL_NUM_KEYS];
+    bool present[MODEL_NUM_KEYS] = {0};
+    size_t numPresent = 0;
+    uint32_t random = 0x600DF00D;
+    KeyMap map;
+
+    assert(hashmap_init_arena(&map, KeyHash, KeyCompare, arena, sizeof(arena), CAPACITY, sizeof(Key), NULL) == 0);
+    for (int step = 0; step < MODEL_NUM_STEPS; step++)
+    {
+        uint32_t value = NextRandom(&random);
+        int i = (value >> 1) % MODEL_NUM_KEYS;
+        Key *pKey = NewKey(i);
+        if (value & 1)
+        {
+            int expected = present[i] ? -EEXIST : (numPresent == CAPACITY ? -ENOSPC : 0);
+            assert(hashmap_put(&map, pKey, &data[i]) == expected);
+            if (expected == 0)
+            {
+                present[i] = true;
+                numPresent++;
+            }
+        }
+        else
+        {
+            assert(hashmap_remove(&map, pKey) == (present[i] ? &data[i] : NULL));
+            if (present[i])
+            {
+                present[i] = false;
+                numPresent--;
+            }
+        }
+        free(pKey);
+        assert(hashmap_size(&map) == numPresent);
+    }
+
+    for (int i = 0; i < MODEL_NUM_KEYS; i++)
+    {
+        Key *pKey = NewKey(i);
+        assert(hashmap_get(&map, pKey) == (present[i] ? &data[i] : NULL));
+        free(pKey);
+    }
+
+    // Every unused slot is still on the free list
+    size_t numFree = 0;
+    for (void *pSlot = map.map_base.key_free_list; pSlot; pSlot = *(void **)pSlot)
+    {
+        numFree++;
+    }
+    assert(numFree == CAPACITY - numPresent);
+    hashmap_cleanup(&map);
+}
+
+int main(void)
+{
+    TestInitRejectsBadArena();
+    TestPutGetRemove();
+    TestStringKeys();
+    TestCallerOwnedKeys();
+    TestAgainstModel();
+    printf("hashmap: ok\n");
+    return 0;
+}
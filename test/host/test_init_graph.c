@@ -0,0 +1,178 @@
+#include <assert.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "InitGraph.h"
+#include "NotificationDispatcher.h"
+
+#define NUM_RUNS            200
+#define MAX_STEP_SLEEP_US   300
+
+typedef struct StepRun_t
+{
+    const InitGraphStep *pSteps;
+    int numSteps;
+    uint32_t seed;
+    atomic_uint startedSteps;
+    atomic_uint doneSteps;
+    atomic_int runCount[INIT_GRAPH_MAX_STEPS];
+} StepRun;
+
+static uint32_t NextRandom(uint32_t *pState)
+{
+    // xorshift32, fixed seed so failures reproduce
+    *pState ^= *pState << 13;
+    *pState ^= *pState >> 17;
+    *pState ^= *pState << 5;
+    return *pState;
+}
+
+static uint32_t DependencyClosure(const InitGraphStep *pSteps, int numSteps, int step)
+{
+    uint32_t closure = pSteps[step].dependsOn;
+    uint32_t previous;
+    do
+    {
+        previous = closure;
+        for (int i = 0; i < numSteps; i++)
+        {
+            if (closure & INIT_GRAPH_STEP_BIT(i))
+            {
+                closure |= pSteps[i].dependsOn;
+            }
+        }
+    } while (closure != previous);
+    return closure;
+}
+
+// Returns the number of posted events that can reach a step before its handler registers
+static int CountEarlyPosts(const InitGraphStep *pSteps, int numSteps, bool print)
+{
+    int earlyPosts = 0;
+    for (int poster = 0; poster < numSteps; poster++)
+    {
+        uint32_t closure = DependencyClosure(pSteps, numSteps, poster);
+        for (int handler = 0; handler < numSteps; handler++)
+        {
+            uint64_t early = pSteps[poster].postsEvents & pSteps[handler].handlesEvents;
+            if (handler == poster || early == 0 || (closure & INIT_GRAPH_STEP_BIT(handler)))
+            {
+                continue;
+            }
+            for (int event = 0; event < NOTIFICATION_EVENTS_COUNT; event++)
+            {
+                if (early & INIT_GRAPH_EVENT_BIT(event))
+                {
+                    if (print)
+                    {
+                        fprintf(stderr, "%s posts event %d before %s registers its handler\n", pSteps[poster].name, event, pSteps[handler].name);
+                    }
+                    ++earlyPosts;
+                }
+            }
+        }
+    }
+    return earlyPosts;
+}
+
+static void TestStepTable(void)
+{
+    uint32_t allSteps = INIT_GRAPH_STEP_BIT(INIT_STEP_COUNT) - 1;
+    for (int i = 0; i < INIT_STEP_COUNT; i++)
+    {
+        const InitGraphStep *pStep = &SystemStateInitSteps[i];
+        assert(pStep->name != NULL);
+        assert((pStep->dependsOn & ~allSteps) == 0);
+        // A step in its own closure is a cycle, the graph would never finish
+        assert(!(DependencyClosure(SystemStateInitSteps, INIT_STEP_COUNT, i) & INIT_GRAPH_STEP_BIT(i)));
+        assert((pStep->handlesEvents >> NOTIFICATION_EVENTS_COUNT) == 0);
+        assert((pStep->postsEvents >> NOTIFICATION_EVENTS_COUNT) == 0);
+    }
+    assert(CountEarlyPosts(SystemStateInitSteps, INIT_STEP_COUNT, true) == 0);
+
+    // The check catches BLE starting before LedControl, the order the table used to allow
+    InitGraphStep steps[INIT_STEP_COUNT];
+    memcpy(steps, SystemStateInitSteps, sizeof(steps));
+    steps[INIT_STEP_BLE].dependsOn &= ~INIT_GRAPH_STEP_BIT(INIT_STEP_LED_CONTROL);
+    assert(CountEarlyPosts(steps, INIT_STEP_COUNT, false) > 0);
+}
+
+static esp_err_t StubStep(void *pContext, int step)
+{
+    StepRun *pRun = (StepRun *)pContext;
+    assert(step >= 0 && step < pRun->numSteps);
+
+    // Every dependency has finished, not just started
+    uint32_t doneSteps = atomic_load(&pRun->doneSteps);
+    assert((pRun->pSteps[step].dependsOn & ~doneSteps) == 0);
+    assert(!(atomic_fetch_or(&pRun->startedSteps, INIT_GRAPH_STEP_BIT(step)) & INIT_GRAPH_STEP_BIT(step)));
+    atomic_fetch_add(&pRun->runCount[step], 1);
+
+    uint32_t state = pRun->seed ^ ((uint32_t)(step + 1) * 2654435761u);
+    uint32_t sleepUs = NextRandom(&state) % (MAX_STEP_SLEEP_US + 1);
+    struct timespec delay = { .tv_sec = 0, .tv_nsec = (long)sleepUs * 1000 };
+    nanosleep(&delay, NULL);
+
+    atomic_fetch_or(&pRun->doneSteps, INIT_GRAPH_STEP_BIT(step));
+    return ESP_OK;
+}
+
+static void HelperTask(void *pvParameters)
+{
+    InitGraph *pGraph = (InitGraph *)pvParameters;
+    InitGraph_Run(pGraph);
+    InitGraph_HelperDone(pGraph);
+    vTaskDelete(NULL);
+}
+
+static void TestParallelRuns(void)
+{
+    static StepRun run;
+    for (uint32_t i = 0; i < NUM_RUNS; i++)
+    {
+        run.pSteps = SystemStateInitSteps;
+        run.numSteps = INIT_STEP_COUNT;
+        run.seed = i + 1;
+        atomic_init(&run.startedSteps, 0);
+        atomic_init(&run.doneSteps, 0);
+        for (int step = 0; step < INIT_STEP_COUNT; step++)
+        {
+            atomic_init(&run.runCount[step], 0);
+        }
+
+        // Two workers, like the boot task and the helper on the other core
+        InitGraph graph;
+        assert(InitGraph_Init(&graph, SystemStateInitSteps, INIT_STEP_COUNT, StubStep, &run) == ESP_OK);
+        assert(xTaskCreate(HelperTask, "InitHelper", configMINIMAL_STACK_SIZE, &graph, 1, NULL) == pdPASS);
+        InitGraph_Run(&graph);
+        InitGraph_WaitHelperDone(&graph);
+        InitGraph_Deinit(&graph);
+
+        assert(atomic_load(&run.doneSteps) == INIT_GRAPH_STEP_BIT(INIT_STEP_COUNT) - 1);
+        for (int step = 0; step < INIT_STEP_COUNT; step++)
+        {
+            assert(atomic_load(&run.runCount[step]) == 1);
+        }
+    }
+}
+
+static void TestInvalidStepCount(void)
+{
+    InitGraph graph;
+    assert(InitGraph_Init(&graph, SystemStateInitSteps, 0, StubStep, NULL) == ESP_ERR_INVALID_ARG);
+    assert(InitGraph_Init(&graph, SystemStateInitSteps, INIT_GRAPH_MAX_STEPS + 1, StubStep, NULL) == ESP_ERR_INVALID_ARG);
+}
+
+int main(void)
+{
+    TestStepTable();
+    TestInvalidStepCount();
+    TestParallelRuns();
+    printf("init graph: ok\n");
+    return 0;
+}
@@ -0,0 +1,122 @@
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "MemTrack.h"
+
+// Fails the test if any tag holds more bytes than at the last mark
+static void AssertNoLeaks(void)
+{
+    for (MemTag tag = 0; tag < MEM_TAG_COUNT; tag++)
+    {
+        int32_t growth = MemTrack_GetGrowthSinceMark(tag);
+        if (growth != 0)
+        {
+            fprintf(stderr, "%s leaked %d bytes\n", MemTrack_GetTagName(tag), (int)growth);
+        }
+        assert(growth == 0);
+    }
+}
+
+static void TestCounters(void)
+{
+    MemTrackStats stats;
+    void *pBlocks[4];
+
+    pBlocks[0] = MemTrack_Malloc(MEM_TAG_HTTP_QUEUE, 100);
+    pBlocks[1] = MemTrack_Malloc(MEM_TAG_HTTP_QUEUE, 28);
+    pBlocks[2] = MemTrack_Calloc(MEM_TAG_HTTP_QUEUE, 4, 16);
+    pBlocks[3] = MemTrack_Malloc(MEM_TAG_CJSON, 10);
+    for (int i = 0; i < 4; i++)
+    {
+        assert(pBlocks[i]);
+        // Blocks keep malloc's alignment behind the header
+        assert((uintptr_t)pBlocks[i] % 8 == 0);
+    }
+    for (int i = 0; i < 64; i++)
+    {
+        assert(((uint8_t *)pBlocks[2])[i] == 0);
+    }
+
+    MemTrack_GetStats(MEM_TAG_HTTP_QUEUE, &stats);
+    assert(stats.liveBytes == 192);
+    assert(stats.peakBytes == 192);
+    assert(stats.liveBlocks == 3);
+    assert(stats.allocCount == 3);
+    assert(stats.freeCount == 0);
+
+    MemTrack_Free(pBlocks[0]);
+    MemTrack_Free(pBlocks[1]);
+    MemTrack_Free(NULL);
+    MemTrack_GetStats(MEM_TAG_HTTP_QUEUE, &stats);
+    assert(stats.liveBytes == 64);
+    assert(stats.peakBytes == 192);
+    assert(stats.liveBlocks == 1);
+    assert(stats.freeCount == 2);
+
+    // Other tags are counted apart
+    MemTrack_GetStats(MEM_TAG_CJSON, &stats);
+    assert(stats.liveBytes == 10);
+    assert(stats.liveBlocks == 1);
+    MemTrack_GetStats(MEM_TAG_LED_SEQUENCES, &stats);
+    assert(stats.allocCount == 0);
+
+    MemTrack_Free(pBlocks[2]);
+    MemTrack_Free(pBlocks[3]);
+}
+
+// Sizes that can't be allocated fail and count against the tag without changing live bytes
+static void TestFailedAllocations(void)
+{
+    MemTrackStats before;
+    MemTrackStats after;
+    MemTrack_GetStats(MEM_TAG_HTTP_REQUEST, &before);
+
+    assert(MemTrack_Malloc(MEM_TAG_HTTP_REQUEST, SIZE_MAX - 4) == NULL);
+    assert(MemTrack_Calloc(MEM_TAG_HTTP_REQUEST, SIZE_MAX / 2, 4) == NULL);
+
+    MemTrack_GetStats(MEM_TAG_HTTP_REQUEST, &after);
+    assert(after.failedCount == before.failedCount + 1);
+    assert(after.liveBytes == before.liveBytes);
+    assert(after.allocCount == before.allocCount);
+}
+
+// A balanced workload passes the leak check, an unbalanced one shows up as growth on its tag
+static void TestGrowthSinceMark(void)
+{
+    void *pKept = MemTrack_Malloc(MEM_TAG_SEEN_EVENT_MAP, 40);
+    MemTrack_Mark();
+    for (int round = 0; round < 100; round++)
+    {
+        void *pRequest = MemTrack_Malloc(MEM_TAG_HTTP_REQUEST, 256 + round);
+        void *pEvent = MemTrack_Calloc(MEM_TAG_SEEN_EVENT_MAP, 1, 24);
+        MemTrack_Free(pRequest);
+        MemTrack_Free(pEvent);
+    }
+    AssertNoLeaks();
+
+    void *pLeaked = MemTrack_Malloc(MEM_TAG_LED_SEQUENCES, 33);
+    assert(MemTrack_GetGrowthSinceMark(MEM_TAG_LED_SEQUENCES) == 33);
+    assert(MemTrack_GetGrowthSinceMark(MEM_TAG_SEEN_EVENT_MAP) == 0);
+
+    // Blocks held from before the mark don't count until they are freed
+    MemTrack_Free(pKept);
+    assert(MemTrack_GetGrowthSinceMark(MEM_TAG_SEEN_EVENT_MAP) == -40);
+    MemTrack_Free(pLeaked);
+    MemTrack_Mark();
+    AssertNoLeaks();
+}
+
+int main(void)
+{
+    MemTrack_Mark();
+    TestCounters();
+    TestFailedAllocations();
+    AssertNoLeaks();
+    TestGrowthSinceMark();
+    assert(strcmp(MemTrack_GetTagName(MEM_TAG_CJSON), "cjson") == 0);
+    assert(strcmp(MemTrack_GetTagName(MEM_TAG_COUNT), "unknown") == 0);
+    printf("mem track: ok\n");
+    return 0;
+}
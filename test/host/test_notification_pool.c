@@ -0,0 +1,255 @@
+#include <assert.h>
+#include <stdatomic.h>
+#include <stdio.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "NotificationDispatcher.h"
+
+#define NUM_SUBSCRIBERS         5
+#define NUM_RETAINERS           2       // Subscribers that keep the payload past their handler
+#define NUM_POSTS               40
+#define PAYLOAD_SIZE            24
+#define WAIT_MS                 2000
+
+// Bulk lane events nothing else in the test posts
+#define FANOUT_EVENT            NOTIFICATION_EVENTS_GAME_EVENT_JOINED
+#define GATE_EVENT              NOTIFICATION_EVENTS_GAME_EVENT_ENDED
+#define FILL_EVENT              NOTIFICATION_EVENTS_FIRST_TIME_POWER_ON
+
+typedef struct Subscriber_t
+{
+    uint32_t index;
+    atomic_uint calls;
+} Subscriber;
+
+static NotificationDispatcher dispatcher;
+static Subscriber subscribers[NUM_SUBSCRIBERS];
+static void *retained[NUM_RETAINERS][NUM_POSTS];
+static atomic_bool gateOpen;
+static atomic_uint gateCalls;
+static atomic_uint fillCalls;
+
+static void WaitFor(atomic_uint *pCounter, uint32_t expected)
+{
+    TickType_t startTicks = xTaskGetTickCount();
+    while (atomic_load(pCounter) < expected)
+    {
+        assert(xTaskGetTickCount() - startTicks < pdMS_TO_TICKS(WAIT_MS));
+        vTaskDelay(1);
+    }
+    assert(atomic_load(pCounter) == expected);
+}
+
+static NotificationPoolStats GetPoolStats(NotificationPoolIndex poolIndex, uint32_t *pHeapPayloads)
+{
+    NotificationPoolStats stats[NOTIFICATION_POOL_COUNT];
+    assert(NotificationDispatcher_GetPoolStats(&dispatcher, stats, pHeapPayloads) == ESP_OK);
+    return stats[poolIndex];
+}
+
+// Free list walk, a block released twice would show up twice or loop
+static uint32_t FreeListLength(NotificationPoolIndex poolIndex)
+{
+    _Static_assert(NOTIFICATION_POOL_LARGE_BLOCK_COUNT <= NOTIFICATION_POOL_SMALL_BLOCK_COUNT, "seen sized for the small pool");
+    NotificationPool *pPool = &dispatcher.pools[poolIndex];
+    NotificationPayloadHeader *seen[NOTIFICATION_POOL_SMALL_BLOCK_COUNT];
+    uint32_t length = 0;
+    for (NotificationPayloadHeader *pHeader = pPool->pFreeList; pHeader != NULL; pHeader = pHeader->pNext)
+    {
+        assert(length < pPool->stats.blockCount);
+        for (uint32_t i = 0; i < length; i++)
+        {
+            assert(seen[i] != pHeader);
+        }
+        seen[length++] = pHeader;
+    }
+    return length;
+}
+
+static void AssertPoolsIdle(void)
+{
+    // The dispatch task releases right after the last handler returns
+    TickType_t startTicks = xTaskGetTickCount();
+    while (GetPoolStats(NOTIFICATION_POOL_SMALL, NULL).inUse != 0 || GetPoolStats(NOTIFICATION_POOL_LARGE, NULL).inUse != 0)
+    {
+        assert(xTaskGetTickCount() - startTicks < pdMS_TO_TICKS(WAIT_MS));
+        vTaskDelay(1);
+    }
+    for (uint32_t i = 0; i < NOTIFICATION_POOL_COUNT; i++)
+    {
+        assert(FreeListLength(i) == GetPoolStats(i, NULL).blockCount);
+    }
+}
+
+static void FanoutHandler(void *pObj, esp_event_base_t eventBase, int32_t notificationEvent, void *notificationData)
+{
+    Subscriber *pSubscriber = (Subscriber *)pObj;
+    uint32_t call = atomic_load(&pSubscriber->calls);
+    assert(*(uint32_t *)notificationData == call);
+    if (pSubscriber->index < NUM_RETAINERS)
+    {
+        NotificationDispatcher_RetainPayload(&dispatcher, notificationData);
+        retained[pSubscriber->index][call] = notificationData;
+    }
+    atomic_store(&pSubscriber->calls, call + 1);
+}
+
+static void GateHandler(void *pObj, esp_event_base_t eventBase, int32_t notificationEvent, void *notificationData)
+{
+    atomic_fetch_add(&gateCalls, 1);
+    while (!atomic_load(&gateOpen))
+    {
+        vTaskDelay(1);
+    }
+}
+
+static void FillHandler(void *pObj, esp_event_base_t eventBase, int32_t notificationEvent, void *notificationData)
+{
+    atomic_fetch_add(&fillCalls, 1);
+}
+
+static void TestFanoutReturnsSlotOnce(void)
+{
+    for (uint32_t i = 0; i < NUM_SUBSCRIBERS; i++)
+    {
+        subscribers[i].index = i;
+        atomic_init(&subscribers[i].calls, 0);
+        assert(NotificationDispatcher_RegisterNotificationEventHandler(&dispatcher, FANOUT_EVENT, FanoutHandler, &subscribers[i]) == ESP_OK);
+    }
+
+    NotificationPoolStats before = GetPoolStats(NOTIFICATION_POOL_SMALL, NULL);
+    for (uint32_t n = 0; n < NUM_POSTS; n++)
+    {
+        uint32_t *pPayload = NotificationDispatcher_AcquirePayload(&dispatcher, PAYLOAD_SIZE);
+        assert(pPayload);
+        *pPayload = n;
+        assert(NotificationDispatcher_NotifyPayload(&dispatcher, FANOUT_EVENT, pPayload, WAIT_MS) == ESP_OK);
+    }
+    for (uint32_t i = 0; i < NUM_SUBSCRIBERS; i++)
+    {
+        WaitFor(&subscribers[i].calls, NUM_POSTS);
+    }
+
+    // Retained payloads stay out of the pool after the dispatcher dropped its reference
+    vTaskDelay(pdMS_TO_TICKS(10));
+    NotificationPoolStats held = GetPoolStats(NOTIFICATION_POOL_SMALL, NULL);
+    assert(held.inUse == NUM_POSTS);
+    assert(held.acquired - before.acquired == NUM_POSTS);
+
+    // Released by the first retainer, still held by the second
+    for (uint32_t n = 0; n < NUM_POSTS; n++)
+    {
+        assert(retained[0][n] == retained[1][n]);
+        NotificationDispatcher_ReleasePayload(&dispatcher, retained[0][n]);
+        assert(*(uint32_t *)retained[1][n] == n);
+    }
+    assert(GetPoolStats(NOTIFICATION_POOL_SMALL, NULL).inUse == NUM_POSTS);
+
+    for (uint32_t n = 0; n < NUM_POSTS; n++)
+    {
+        NotificationDispatcher_ReleasePayload(&dispatcher, retained[1][n]);
+    }
+    AssertPoolsIdle();
+}
+
+static void TestExhaustionFallsBackToHeap(void)
+{
+    uint32_t smallCount = GetPoolStats(NOTIFICATION_POOL_SMALL, NULL).blockCount;
+    uint32_t largeCount = GetPoolStats(NOTIFICATION_POOL_LARGE, NULL).blockCount;
+    void *pPayloads[NOTIFICATION_POOL_SMALL_BLOCK_COUNT + NOTIFICATION_POOL_LARGE_BLOCK_COUNT];
+    uint32_t heapBefore = 0;
+    NotificationPoolStats smallBefore = GetPoolStats(NOTIFICATION_POOL_SMALL, &heapBefore);
+    NotificationPoolStats largeBefore = GetPoolStats(NOTIFICATION_POOL_LARGE, NULL);
+
+    // Small requests move up to the large pool when the small one is empty
+    for (uint32_t i = 0; i < smallCount + largeCount; i++)
+    {
+        pPayloads[i] = NotificationDispatcher_AcquirePayload(&dispatcher, PAYLOAD_SIZE);
+        assert(pPayloads[i]);
+    }
+    uint32_t heapPayloads = 0;
+    NotificationPoolStats small = GetPoolStats(NOTIFICATION_POOL_SMALL, &heapPayloads);
+    NotificationPoolStats large = GetPoolStats(NOTIFICATION_POOL_LARGE, NULL);
+    assert(small.inUse == smallCount && large.inUse == largeCount);
+    assert(small.exhausted - smallBefore.exhausted == largeCount);
+    assert(heapPayloads == heapBefore);
+
+    void *pHeapPayload = NotificationDispatcher_AcquirePayload(&dispatcher, PAYLOAD_SIZE);
+    assert(pHeapPayload);
+    GetPoolStats(NOTIFICATION_POOL_SMALL, &heapPayloads);
+    assert(heapPayloads == heapBefore + 1);
+    assert(GetPoolStats(NOTIFICATION_POOL_LARGE, NULL).exhausted == largeBefore.exhausted + 1);
+    NotificationDispatcher_ReleasePayload(&dispatcher, pHeapPayload);
+
+    for (uint32_t i = 0; i < smallCount + largeCount; i++)
+    {
+        NotificationDispatcher_ReleasePayload(&dispatcher, pPayloads[i]);
+    }
+    AssertPoolsIdle();
+}
+
+static void TestFullRingTimesOut(void)
+{
+    atomic_init(&gateOpen, false);
+    atomic_init(&gateCalls, 0);
+    atomic_init(&fillCalls, 0);
+    assert(NotificationDispatcher_RegisterNotificationEventHandler(&dispatcher, GATE_EVENT, GateHandler, NULL) == ESP_OK);
+    assert(NotificationDispatcher_RegisterNotificationEventHandler(&dispatcher, FILL_EVENT, FillHandler, NULL) == ESP_OK);
+
+    // Hold the bulk dispatch task in a handler, then fill its ring with pooled payloads
+    assert(NotificationDispatcher_NotifyEvent(&dispatcher, GATE_EVENT, NULL, 0, WAIT_MS) == ESP_OK);
+    WaitFor(&gateCalls, 1);
+    uint32_t value = 0;
+    for (uint32_t i = 0; i < NOTIFICATION_QUEUE_SIZE; i++)
+    {
+        assert(NotificationDispatcher_NotifyEvent(&dispatcher, FILL_EVENT, &value, sizeof(value), 0) == ESP_OK);
+    }
+
+    uint32_t droppedBefore = NotificationDispatcher_GetDroppedCount(&dispatcher, NOTIFICATION_LANE_BULK);
+    NotificationPoolStats small = GetPoolStats(NOTIFICATION_POOL_SMALL, NULL);
+    assert(small.inUse == NOTIFICATION_QUEUE_SIZE);
+
+    // A pooled payload that cannot be queued goes back to its pool
+    void *pPayload = NotificationDispatcher_AcquirePayload(&dispatcher, sizeof(value));
+    TickType_t startTicks = xTaskGetTickCount();
+    assert(NotificationDispatcher_NotifyPayload(&dispatcher, FILL_EVENT, pPayload, 20) == ESP_ERR_TIMEOUT);
+    assert(xTaskGetTickCount() - startTicks >= pdMS_TO_TICKS(20));
+    assert(NotificationDispatcher_GetDroppedCount(&dispatcher, NOTIFICATION_LANE_BULK) == droppedBefore + 1);
+    assert(GetPoolStats(NOTIFICATION_POOL_SMALL, NULL).inUse == NOTIFICATION_QUEUE_SIZE);
+
+    // With every pool empty the copy comes from the heap, then takes the same retry and timeout path
+    uint32_t numHeld = (small.blockCount - small.inUse) + GetPoolStats(NOTIFICATION_POOL_LARGE, NULL).blockCount;
+    void *pHeld[NOTIFICATION_POOL_SMALL_BLOCK_COUNT + NOTIFICATION_POOL_LARGE_BLOCK_COUNT];
+    for (uint32_t i = 0; i < numHeld; i++)
+    {
+        pHeld[i] = NotificationDispatcher_AcquirePayload(&dispatcher, sizeof(value));
+    }
+    uint32_t heapBefore = 0;
+    GetPoolStats(NOTIFICATION_POOL_SMALL, &heapBefore);
+    assert(NotificationDispatcher_NotifyEvent(&dispatcher, FILL_EVENT, &value, sizeof(value), 20) == ESP_ERR_TIMEOUT);
+    uint32_t heapPayloads = 0;
+    GetPoolStats(NOTIFICATION_POOL_SMALL, &heapPayloads);
+    assert(heapPayloads == heapBefore + 1);
+    assert(NotificationDispatcher_GetDroppedCount(&dispatcher, NOTIFICATION_LANE_BULK) == droppedBefore + 2);
+    for (uint32_t i = 0; i < numHeld; i++)
+    {
+        NotificationDispatcher_ReleasePayload(&dispatcher, pHeld[i]);
+    }
+
+    // Only the queued posts are delivered
+    atomic_store(&gateOpen, true);
+    WaitFor(&fillCalls, NOTIFICATION_QUEUE_SIZE);
+    AssertPoolsIdle();
+}
+
+int main(void)
+{
+    assert(NotificationDispatcher_Init(&dispatcher) == ESP_OK);
+    TestFanoutReturnsSlotOnce();
+    TestExhaustionFallsBackToHeap();
+    TestFullRingTimesOut();
+    printf("notification pool: ok\n");
+    return 0;
+}
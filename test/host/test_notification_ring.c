@@ -0,0 +1,135 @@
+#include <assert.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "NotificationDispatcher.h"
+
+#define NUM_PRODUCERS           4
+#define POSTS_PER_LANE          20000
+#define POST_WAIT_MS            5000    // Long enough that a full ring waits instead of dropping
+
+typedef struct RingItem_t
+{
+    uint32_t producerId;
+    uint32_t sequence;
+    int64_t postUs;
+} RingItem;
+
+typedef struct LaneResult_t
+{
+    NotificationEvent notificationEvent;
+    uint32_t nextSequence[NUM_PRODUCERS];   // Only touched by the lane's dispatch task
+    uint32_t latenciesUs[NUM_PRODUCERS * POSTS_PER_LANE];
+    atomic_uint received;
+} LaneResult;
+
+static NotificationDispatcher dispatcher;
+static LaneResult laneResults[NOTIFICATION_LANE_COUNT];
+
+static void RingItemHandler(void *pObj, esp_event_base_t eventBase, int32_t notificationEvent, void *notificationData)
+{
+    LaneResult *pResult = (LaneResult *)pObj;
+    RingItem *pItem = (RingItem *)notificationData;
+    assert(notificationEvent == pResult->notificationEvent);
+    assert(pItem->producerId < NUM_PRODUCERS);
+
+    // One consumer per lane, so each producer's posts come out in the order they went in
+    assert(pItem->sequence == pResult->nextSequence[pItem->producerId]);
+    ++pResult->nextSequence[pItem->producerId];
+
+    uint32_t index = atomic_load_explicit(&pResult->received, memory_order_relaxed);
+    pResult->latenciesUs[index] = (uint32_t)(esp_timer_get_time() - pItem->postUs);
+    atomic_store_explicit(&pResult->received, index + 1, memory_order_release);
+}
+
+static void *Producer(void *pArg)
+{
+    uint32_t producerId = (uint32_t)(uintptr_t)pArg;
+    for (uint32_t sequence = 0; sequence < POSTS_PER_LANE; sequence++)
+    {
+        // Interleave both lanes so their producers contend on the pool as well as the rings
+        for (uint32_t lane = 0; lane < NOTIFICATION_LANE_COUNT; lane++)
+        {
+            RingItem item = { .producerId = producerId, .sequence = sequence, .postUs = esp_timer_get_time() };
+            assert(NotificationDispatcher_NotifyEvent(&dispatcher, laneResults[lane].notificationEvent, &item, sizeof(item), POST_WAIT_MS) == ESP_OK);
+        }
+    }
+    return NULL;
+}
+
+static int CompareU32(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+    return (x > y) - (x < y);
+}
+
+static void TestMultiProducerStress(void)
+{
+    laneResults[NOTIFICATION_LANE_BULK].notificationEvent = NOTIFICATION_EVENTS_BLE_PEER_HEARTBEAT_DETECTED;
+    laneResults[NOTIFICATION_LANE_HIGH].notificationEvent = NOTIFICATION_EVENTS_SONG_NOTE_ACTION;
+    for (uint32_t lane = 0; lane < NOTIFICATION_LANE_COUNT; lane++)
+    {
+        LaneResult *pResult = &laneResults[lane];
+        assert(NotificationDispatcher_GetEventLane(pResult->notificationEvent) == lane);
+        atomic_init(&pResult->received, 0);
+        assert(NotificationDispatcher_RegisterNotificationEventHandler(&dispatcher, pResult->notificationEvent, RingItemHandler, pResult) == ESP_OK);
+    }
+
+    pthread_t producers[NUM_PRODUCERS];
+    for (uint32_t i = 0; i < NUM_PRODUCERS; i++)
+    {
+        assert(pthread_create(&producers[i], NULL, Producer, (void *)(uintptr_t)i) == 0);
+    }
+    for (uint32_t i = 0; i < NUM_PRODUCERS; i++)
+    {
+        assert(pthread_join(producers[i], NULL) == 0);
+    }
+
+    for (uint32_t lane = 0; lane < NOTIFICATION_LANE_COUNT; lane++)
+    {
+        LaneResult *pResult = &laneResults[lane];
+        TickType_t startTicks = xTaskGetTickCount();
+        while (atomic_load_explicit(&pResult->received, memory_order_acquire) < NUM_PRODUCERS * POSTS_PER_LANE)
+        {
+            assert(xTaskGetTickCount() - startTicks < pdMS_TO_TICKS(POST_WAIT_MS));
+            vTaskDelay(1);
+        }
+        assert(NotificationDispatcher_GetDroppedCount(&dispatcher, lane) == 0);
+        for (uint32_t i = 0; i < NUM_PRODUCERS; i++)
+        {
+            assert(pResult->nextSequence[i] == POSTS_PER_LANE);
+        }
+
+        uint32_t count = atomic_load(&pResult->received);
+        assert(count == NUM_PRODUCERS * POSTS_PER_LANE);
+        qsort(pResult->latenciesUs, count, sizeof(uint32_t), CompareU32);
+        printf("%s lane: %u posts from %d producers, post to handler p50 %u us  p99 %u us  max %u us\n",
+               (lane == NOTIFICATION_LANE_HIGH) ? "high" : "bulk", count, NUM_PRODUCERS,
+               pResult->latenciesUs[count / 2], pResult->latenciesUs[(count * 99) / 100], pResult->latenciesUs[count - 1]);
+    }
+
+    // Every copied payload goes back to its pool. The last release follows the last handler
+    NotificationPoolStats stats[NOTIFICATION_POOL_COUNT];
+    TickType_t startTicks = xTaskGetTickCount();
+    do
+    {
+        assert(xTaskGetTickCount() - startTicks < pdMS_TO_TICKS(POST_WAIT_MS));
+        vTaskDelay(1);
+        assert(NotificationDispatcher_GetPoolStats(&dispatcher, stats, NULL) == ESP_OK);
+    } while (stats[NOTIFICATION_POOL_SMALL].inUse != 0);
+}
+
+int main(void)
+{
+    assert(NotificationDispatcher_Init(&dispatcher) == ESP_OK);
+    TestMultiProducerStress();
+    printf("notification ring: ok\n");
+    return 0;
+}
@@ -0,0 +1,120 @@
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "OcarinaMatcher.h"
+#include "ocarina_linear_matcher.h"
+
+#define NUM_RANDOM_PRESSES 5000000
+
+static uint32_t NextRandom(uint32_t *pState)
+{
+    // xorshift32, fixed seed so failures reproduce
+    *pState ^= *pState << 13;
+    *pState ^= *pState >> 17;
+    *pState ^= *pState << 5;
+    return *pState;
+}
+
+static void TestEachSongMatches(void)
+{
+    OcarinaMatcher matcher;
+    OcarinaMatcher_Build(&matcher, OcarinaSongKeySets, OCARINA_NUM_SONGS);
+    assert(matcher.numStates == 66);
+
+    for (int i = 0; i < OCARINA_NUM_SONGS; i++)
+    {
+        const OcarinaKeySet *pKeySet = &OcarinaSongKeySets[i];
+        OcarinaMatcher_Reset(&matcher);
+        for (int k = 0; k < pKeySet->NumKeys - 1; k++)
+        {
+            assert(OcarinaMatcher_PressKey(&matcher, pKeySet->Keys[k]) < 0);
+        }
+        assert(OcarinaMatcher_PressKey(&matcher, pKeySet->Keys[pKeySet->NumKeys - 1]) == i);
+        assert(matcher.state == 0);
+    }
+
+    // Out of range keys are ignored and keep the current state
+    OcarinaMatcher_Reset(&matcher);
+    assert(OcarinaMatcher_PressKey(&matcher, OCARINA_KEY_X) < 0);
+    uint8_t state = matcher.state;
+    assert(OcarinaMatcher_PressKey(&matcher, OCARINA_NUM_KEYS) < 0);
+    assert(OcarinaMatcher_PressKey(&matcher, (OcarinaKey)-1) < 0);
+    assert(matcher.state == state);
+}
+
+// Keys before a song carry over, keys before a match don't
+static void TestOverlaps(void)
+{
+    OcarinaMatcher matcher;
+    OcarinaMatcher_Build(&matcher, OcarinaSongKeySets, OCARINA_NUM_SONGS);
+
+    // Bolero of Fire's tail after a stray prefix
+    static const OcarinaKey bolero[] = { OCARINA_KEY_R, OCARINA_KEY_R, OCARINA_KEY_L, OCARINA_KEY_R, OCARINA_KEY_L,
+                                         OCARINA_KEY_Y, OCARINA_KEY_R, OCARINA_KEY_Y, OCARINA_KEY_R };
+    for (size_t k = 0; k < sizeof(bolero) / sizeof(bolero[0]) - 1; k++)
+    {
+        assert(OcarinaMatcher_PressKey(&matcher, bolero[k]) < 0);
+    }
+    assert(OcarinaMatcher_PressKey(&matcher, bolero[8]) == 7);
+
+    // Zelda's Lullaby completes, so its last keys can't start Epona's Song
+    static const OcarinaKey lullabyThenEpona[] = { OCARINA_KEY_X, OCARINA_KEY_A, OCARINA_KEY_Y, OCARINA_KEY_X, OCARINA_KEY_A,
+                                                   OCARINA_KEY_Y, OCARINA_KEY_X, OCARINA_KEY_Y };
+    int matched = -1;
+    for (size_t k = 0; k < sizeof(lullabyThenEpona) / sizeof(lullabyThenEpona[0]); k++)
+    {
+        int result = OcarinaMatcher_PressKey(&matcher, lullabyThenEpona[k]);
+        if (result >= 0)
+        {
+            assert(k == 5 && result == 0);
+            matched = result;
+        }
+    }
+    assert(matched == 0);
+}
+
+// The automaton agrees with the linear matcher on every key press
+static void TestMatchesLinearMatcher(void)
+{
+    OcarinaMatcher matcher;
+    LinearMatcher linear = {0};
+    uint32_t random = 0x2024BAD6;
+    int numMatches = 0;
+    int songMatches[OCARINA_NUM_SONGS] = {0};
+
+    OcarinaMatcher_Build(&matcher, OcarinaSongKeySets, OCARINA_NUM_SONGS);
+    for (int n = 0; n < NUM_RANDOM_PRESSES; n++)
+    {
+        // Mostly the five song keys, like a player would press them
+        static const OcarinaKey songKeys[] = { OCARINA_KEY_L, OCARINA_KEY_R, OCARINA_KEY_Y, OCARINA_KEY_X, OCARINA_KEY_A };
+        uint32_t value = NextRandom(&random);
+        OcarinaKey key = (value & 0xF) == 0 ? (OcarinaKey)((value >> 4) % OCARINA_NUM_KEYS) : songKeys[(value >> 4) % 5];
+
+        int expected = LinearMatcher_PressKey(&linear, key);
+        int result = OcarinaMatcher_PressKey(&matcher, key);
+        assert(result == expected);
+        if (result >= 0)
+        {
+            numMatches++;
+            songMatches[result]++;
+        }
+    }
+
+    // Every song got matched, so the comparison covered all of the table
+    assert(numMatches > 0);
+    for (int i = 0; i < OCARINA_NUM_SONGS; i++)
+    {
+        assert(songMatches[i] > 0);
+    }
+    printf("ocarina matcher: %d matches over %d key presses\n", numMatches, NUM_RANDOM_PRESSES);
+}
+
+int main(void)
+{
+    TestEachSongMatches();
+    TestOverlaps();
+    TestMatchesLinearMatcher();
+    printf("ocarina matcher: ok\n");
+    return 0;
+}
@@ -0,0 +1,265 @@
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zlib.h>
+
+#include "esp_ota_ops.h"
+#include "spi_flash_mmap.h"
+#include "OtaImageDecoder.h"
+
+#define TARGET_SIZE   (256 * 1024)
+#define SOURCE_SIZE   (64 * 1024)
+#define IMAGE_SIZE    (200 * 1024)
+#define MAX_STREAM    (IMAGE_SIZE * 2)
+
+static uint8_t targetData[TARGET_SIZE];
+static uint8_t sourceData[SOURCE_SIZE];
+static const esp_partition_t target = { 0x110000, TARGET_SIZE, targetData };
+static const esp_partition_t source = { 0x10000, SOURCE_SIZE, sourceData };
+
+static uint32_t NextRandom(uint32_t *pState)
+{
+    // xorshift32, fixed seed so failures reproduce
+    *pState ^= *pState << 13;
+    *pState ^= *pState >> 17;
+    *pState ^= *pState << 5;
+    return *pState;
+}
+
+// Zeroed flash reads back wrong unless the decoder erases before it writes
+static void ResetTarget(void)
+{
+    memset(targetData, 0, sizeof(targetData));
+}
+
+// An image with runs and repeats that compresses, plus noise so the window wraps with real content
+static void MakeImage(uint8_t *pImage, size_t length, uint32_t seed)
+{
+    for (size_t i = 0; i < length; i++)
+    {
+        uint32_t value = NextRandom(&seed);
+        pImage[i] = (i % 4096 < 1024) ? (uint8_t)value : (uint8_t)(i / 64);
+    }
+}
+
+static size_t Compress(uint8_t *pStream, const uint8_t *pData, size_t length)
+{
+    uLongf streamLength = MAX_STREAM;
+    assert(compress2(pStream, &streamLength, pData, length, Z_BEST_COMPRESSION) == Z_OK);
+    return streamLength;
+}
+
+// Feeds the stream in random chunk sizes up to maxChunk. Returns the first write error
+static esp_err_t WriteChunks(OtaImageDecoder *pDecoder, const uint8_t *pStream, size_t length, size_t maxChunk, uint32_t seed)
+{
+    esp_err_t ret = ESP_OK;
+    size_t offset = 0;
+    while (ret == ESP_OK && offset < length)
+    {
+        size_t chunk = 1 + NextRandom(&seed) % maxChunk;
+        chunk = (chunk > length - offset) ? length - offset : chunk;
+        ret = OtaImageDecoder_Write(pDecoder, pStream + offset, chunk);
+        offset += chunk;
+    }
+    return ret;
+}
+
+static esp_err_t Decode(OtaImageEncoding encoding, const uint8_t *pStream, size_t length, size_t maxChunk, uint32_t *pImageSize)
+{
+    OtaImageDecoder decoder;
+    assert(OtaImageDecoder_Init(&decoder, encoding, &target, 0) == ESP_OK);
+    esp_err_t ret = WriteChunks(&decoder, pStream, length, maxChunk, (uint32_t)length | 1);
+    if (ret == ESP_OK)
+    {
+        ret = OtaImageDecoder_Finish(&decoder, pImageSize);
+    }
+    OtaImageDecoder_Deinit(&decoder);
+    return ret;
+}
+
+static void TestRaw(void)
+{
+    static uint8_t image[IMAGE_SIZE];
+    uint32_t imageSize = 0;
+    MakeImage(image, sizeof(image), 1);
+
+    ResetTarget();
+    assert(Decode(OTA_IMAGE_ENCODING_RAW, image, sizeof(image), 5000, &imageSize) == ESP_OK);
+    assert(imageSize == sizeof(image));
+    assert(memcmp(targetData, image, sizeof(image)) == 0);
+
+    // Resuming at a sector boundary redoes that sector and keeps what came before it
+    OtaImageDecoder decoder;
+    uint32_t resumeOffset = 3 * SPI_FLASH_SEC_SIZE;
+    memset(targetData + resumeOffset, 0, sizeof(targetData) - resumeOffset);
+    assert(OtaImageDecoder_Init(&decoder, OTA_IMAGE_ENCODING_RAW, &target, resumeOffset) == ESP_OK);
+    assert(WriteChunks(&decoder, image + resumeOffset, sizeof(image) - resumeOffset, 3000, 7) == ESP_OK);
+    assert(OtaImageDecoder_Finish(&decoder, &imageSize) == ESP_OK);
+    assert(imageSize == sizeof(image));
+    assert(memcmp(targetData, image, sizeof(image)) == 0);
+    OtaImageDecoder_Deinit(&decoder);
+
+    // An image bigger than the partition is rejected
+    static uint8_t tooBig[TARGET_SIZE + 1];
+    ResetTarget();
+    assert(Decode(OTA_IMAGE_ENCODING_RAW, tooBig, sizeof(tooBig), 8192, NULL) == ESP_ERR_INVALID_SIZE);
+}
+
+static void TestDeflate(void)
+{
+    static uint8_t image[IMAGE_SIZE];
+    static uint8_t stream[MAX_STREAM];
+    uint32_t imageSize = 0;
+    MakeImage(image, sizeof(image), 2);
+    size_t streamLength = Compress(stream, image, sizeof(image));
+    assert(streamLength < sizeof(image));
+
+    // Large chunks, then single bytes so every state boundary gets split
+    size_t maxChunks[] = { 4096, 1 };
+    for (size_t i = 0; i < sizeof(maxChunks) / sizeof(maxChunks[0]); i++)
+    {
+        ResetTarget();
+        assert(Decode(OTA_IMAGE_ENCODING_DEFLATE, stream, streamLength, maxChunks[i], &imageSize) == ESP_OK);
+        assert(imageSize == sizeof(image));
+        assert(memcmp(targetData, image, sizeof(image)) == 0);
+    }
+
+    // A truncated stream fails at finish
+    ResetTarget();
+    assert(Decode(OTA_IMAGE_ENCODING_DEFLATE, stream, streamLength - 10, 4096, NULL) == ESP_ERR_INVALID_SIZE);
+
+    // A corrupt zlib header fails the write
+    stream[0] ^= 0xFF;
+    ResetTarget();
+    assert(Decode(OTA_IMAGE_ENCODING_DEFLATE, stream, streamLength, 4096, NULL) == ESP_ERR_INVALID_RESPONSE);
+}
+
+// Builds delta records and the image they should produce side by side
+typedef struct DeltaBuilder_t
+{
+    uint8_t records[MAX_STREAM];
+    size_t recordsLength;
+    uint8_t image[IMAGE_SIZE];
+    size_t imageLength;
+} DeltaBuilder;
+
+static void PutU32(DeltaBuilder *pBuilder, uint32_t value)
+{
+    for (int i = 0; i < 4; i++)
+    {
+        pBuilder->records[pBuilder->recordsLength++] = (uint8_t)(value >> (8 * i));
+    }
+}
+
+static void AddCopy(DeltaBuilder *pBuilder, uint32_t sourceOffset, uint32_t length)
+{
+    pBuilder->records[pBuilder->recordsLength++] = OTA_DELTA_RECORD_COPY;
+    PutU32(pBuilder, sourceOffset);
+    PutU32(pBuilder, length);
+    if ((uint64_t)sourceOffset + length <= SOURCE_SIZE)
+    {
+        memcpy(pBuilder->image + pBuilder->imageLength, sourceData + sourceOffset, length);
+        pBuilder->imageLength += length;
+    }
+}
+
+static void AddInsert(DeltaBuilder *pBuilder, const uint8_t *pData, uint32_t length)
+{
+    pBuilder->records[pBuilder->recordsLength++] = OTA_DELTA_RECORD_INSERT;
+    PutU32(pBuilder, length);
+    memcpy(pBuilder->records + pBuilder->recordsLength, pData, length);
+    pBuilder->recordsLength += length;
+    memcpy(pBuilder->image + pBuilder->imageLength, pData, length);
+    pBuilder->imageLength += length;
+}
+
+static void AddRecord(DeltaBuilder *pBuilder, uint8_t type)
+{
+    pBuilder->records[pBuilder->recordsLength++] = type;
+}
+
+static esp_err_t DecodeDelta(const DeltaBuilder *pBuilder, size_t maxChunk, uint32_t *pImageSize)
+{
+    static uint8_t stream[MAX_STREAM];
+    size_t streamLength = Compress(stream, pBuilder->records, pBuilder->recordsLength);
+    ResetTarget();
+    return Decode(OTA_IMAGE_ENCODING_DELTA, stream, streamLength, maxChunk, pImageSize);
+}
+
+static void TestDelta(void)
+{
+    static DeltaBuilder builder;
+    static uint8_t literal[40000];
+    uint32_t imageSize = 0;
+    MakeImage(sourceData, sizeof(sourceData), 3);
+    MakeImage(literal, sizeof(literal), 4);
+    pHostRunningPartition = &source;
+
+    // Copies longer than the copy buffer, an empty insert and inserts larger than the inflate window
+    memset(&builder, 0, sizeof(builder));
+    AddCopy(&builder, 1000, 5000);
+    AddInsert(&builder, literal, 300);
+    AddCopy(&builder, 0, SOURCE_SIZE);
+    AddInsert(&builder, literal, 0);
+    AddCopy(&builder, SOURCE_SIZE - 7, 7);
+    AddInsert(&builder, literal + 300, sizeof(literal) - 300);
+    AddCopy(&builder, 12345, 0);
+    AddCopy(&builder, 20000, 33333);
+    AddRecord(&builder, OTA_DELTA_RECORD_END);
+
+    size_t maxChunks[] = { 4096, 1 };
+    for (size_t i = 0; i < sizeof(maxChunks) / sizeof(maxChunks[0]); i++)
+    {
+        assert(DecodeDelta(&builder, maxChunks[i], &imageSize) == ESP_OK);
+        assert(imageSize == builder.imageLength);
+        assert(memcmp(targetData, builder.image, builder.imageLength) == 0);
+    }
+
+    // Missing end record
+    builder.recordsLength--;
+    assert(DecodeDelta(&builder, 4096, NULL) == ESP_ERR_INVALID_SIZE);
+
+    // Data after the end record
+    AddRecord(&builder, OTA_DELTA_RECORD_END);
+    AddInsert(&builder, literal, 10);
+    assert(DecodeDelta(&builder, 4096, NULL) == ESP_ERR_INVALID_RESPONSE);
+
+    // Unknown record type
+    memset(&builder, 0, sizeof(builder));
+    AddInsert(&builder, literal, 10);
+    AddRecord(&builder, 7);
+    AddRecord(&builder, OTA_DELTA_RECORD_END);
+    assert(DecodeDelta(&builder, 4096, NULL) == ESP_ERR_INVALID_RESPONSE);
+
+    // Copies outside the source partition, including an offset plus length that overflows 32 bits
+    memset(&builder, 0, sizeof(builder));
+    AddCopy(&builder, SOURCE_SIZE - 10, 11);
+    AddRecord(&builder, OTA_DELTA_RECORD_END);
+    assert(DecodeDelta(&builder, 4096, NULL) == ESP_ERR_INVALID_SIZE);
+    memset(&builder, 0, sizeof(builder));
+    AddCopy(&builder, 0xFFFFFFF0, 0x20);
+    AddRecord(&builder, OTA_DELTA_RECORD_END);
+    assert(DecodeDelta(&builder, 4096, NULL) == ESP_ERR_INVALID_SIZE);
+}
+
+static void TestInitErrors(void)
+{
+    OtaImageDecoder decoder;
+    assert(OtaImageDecoder_Init(&decoder, OTA_IMAGE_ENCODING_UNKNOWN, &target, 0) == ESP_ERR_NOT_SUPPORTED);
+
+    // Delta images need a running partition to copy from
+    pHostRunningPartition = NULL;
+    assert(OtaImageDecoder_Init(&decoder, OTA_IMAGE_ENCODING_DELTA, &target, 0) != ESP_OK);
+    assert(decoder.pInflator == NULL && decoder.pDictionary == NULL && decoder.pCopyBuffer == NULL);
+}
+
+int main(void)
+{
+    TestRaw();
+    TestDeflate();
+    TestDelta();
+    TestInitErrors();
+    printf("ota image decoder: ok\n");
+    return 0;
+}
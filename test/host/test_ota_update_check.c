@@ -0,0 +1,644 @@
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zlib.h>
+
+#include <openssl/evp.h>
+#include <openssl/x509.h>
+
+#include "esp_app_desc.h"
+#include "esp_http_client.h"
+#include "esp_https_ota.h"
+#include "esp_ota_ops.h"
+#include "mbedtls/base64.h"
+#include "nvs.h"
+
+#include "OtaUpdate.h"
+#include "OtaUpdate_Check.h"
+
+#define TEST_OTA_URL            CONFIG_OTA_UPDATE_URL"_FMAN25"
+#define TEST_MANIFEST_URL       TEST_OTA_URL".json"
+#define TEST_DEFLATE_URL        "https://ota.test/badge.bin.z"
+
+#define IMAGE_SIZE              (300 * 1024 + 123)
+#define PARTITION_SIZE          (512 * 1024)
+// esp_image_header_t, one segment header and esp_app_desc_t, what esp_https_ota reads before
+// handing out the descriptor. The ELF SHA256 sits 144 bytes into the descriptor
+#define IMAGE_HEADER_BYTES      (24 + 8 + 256)
+#define IMAGE_SHA_OFFSET        (24 + 8 + 144)
+#define SERVER_CHUNK_SIZE       (1000)
+#define DROP_AFTER_BYTES        (40000)
+
+// Test only key pair, PKCS8 and SubjectPublicKeyInfo DER. The public half is built into the
+// test as CONFIG_OTA_MANIFEST_PUBLIC_KEY, the shipped sdkconfig has a different key
+static const char TEST_PRIVATE_KEY_B64[] =
+    "MIGHAgEAMBMGByqGSM49AgEGCCqGSM49AwEHBG0wawIBAQQgxp29XVk7FsPR04CW7Ixt2Vyt8Q1HotZXfLor6vtWTYOhRANCAATxBGHI0/90kZzodBH2HX3czp7xQsb5y234AA1UFrUGMBmT0I5Qz9Q7mb8ClOBQp4YtE1errsJa4IPHG7l2eUUi";
+
+// Stand-in server. Files are served by URL, with Range support and per request connection
+// drops. bytesServed counts body bytes and is compared with the OTA check's own counter
+#define MAX_SERVER_FILES        (4)
+
+typedef struct ServerFile_t
+{
+    const char *url;
+    const uint8_t *pData;
+    size_t size;
+} ServerFile;
+
+static struct
+{
+    ServerFile files[MAX_SERVER_FILES];
+    int numFiles;
+    bool ignoreRange;
+    size_t dropAfterBytes;      // Per request, 0 never drops
+    uint32_t requests;
+    uint32_t bytesServed;
+} server;
+
+struct esp_http_client
+{
+    esp_http_client_config_t config;
+    const ServerFile *pFile;
+    int statusCode;
+    bool hasRange;
+    size_t rangeStart;
+    size_t offset;
+    size_t requestBytes;
+};
+
+static void Server_Reset(void)
+{
+    memset(&server, 0, sizeof(server));
+}
+
+static void Server_Publish(const char *url, const void *pData, size_t size)
+{
+    assert(server.numFiles < MAX_SERVER_FILES);
+    server.files[server.numFiles++] = (ServerFile){ url, pData, size };
+}
+
+static const ServerFile *Server_Find(const char *url)
+{
+    for (int i = 0; i < server.numFiles; i++)
+    {
+        if (strcmp(server.files[i].url, url) == 0)
+        {
+            return &server.files[i];
+        }
+    }
+    return NULL;
+}
+
+esp_http_client_handle_t esp_http_client_init(const esp_http_client_config_t *config)
+{
+    assert(config->crt_bundle_attach != NULL);
+    assert(strncmp(config->url, "https://", 8) == 0);
+    esp_http_client_handle_t client = calloc(1, sizeof(struct esp_http_client));
+    client->config = *config;
+    return client;
+}
+
+esp_err_t esp_http_client_set_header(esp_http_client_handle_t client, const char *key, const char *value)
+{
+    unsigned long rangeStart = 0;
+    if (strcmp(key, "Range") == 0 && sscanf(value, "bytes=%lu-", &rangeStart) == 1)
+    {
+        client->hasRange = true;
+        client->rangeStart = rangeStart;
+    }
+    return ESP_OK;
+}
+
+// Small bodies in one go, like the manifest fetch
+esp_err_t esp_http_client_perform(esp_http_client_handle_t client)
+{
+    server.requests++;
+    client->pFile = Server_Find(client->config.url);
+    client->statusCode = client->pFile ? 200 : 404;
+    for (size_t offset = 0; client->pFile && offset < client->pFile->size; offset += SERVER_CHUNK_SIZE)
+    {
+        size_t length = client->pFile->size - offset;
+        length = (length < SERVER_CHUNK_SIZE) ? length : SERVER_CHUNK_SIZE;
+        esp_http_client_event_t evt = { HTTP_EVENT_ON_DATA, client, (void *)(client->pFile->pData + offset), (int)length, client->config.user_data, NULL, NULL };
+        server.bytesServed += length;
+        client->config.event_handler(&evt);
+    }
+    esp_http_client_event_t finish = { HTTP_EVENT_ON_FINISH, client, NULL, 0, client->config.user_data, NULL, NULL };
+    client->config.event_handler(&finish);
+    return ESP_OK;
+}
+
+esp_err_t esp_http_client_open(esp_http_client_handle_t client, int write_len)
+{
+    server.requests++;
+    client->pFile = Server_Find(client->config.url);
+    client->offset = 0;
+    client->requestBytes = 0;
+    if (client->pFile == NULL)
+    {
+        client->statusCode = 404;
+    }
+    else if (client->hasRange && !server.ignoreRange)
+    {
+        client->statusCode = 206;
+        client->offset = client->rangeStart;
+        char key[] = "Content-Range";
+        char value[64];
+        snprintf(value, sizeof(value), "bytes %zu-%zu/%zu", client->rangeStart, client->pFile->size - 1, client->pFile->size);
+        esp_http_client_event_t evt = { HTTP_EVENT_ON_HEADER, client, NULL, 0, client->config.user_data, key, value };
+        if (client->config.event_handler)
+        {
+            client->config.event_handler(&evt);
+        }
+    }
+    else
+    {
+        client->statusCode = 200;
+    }
+    return ESP_OK;
+}
+
+int64_t esp_http_client_fetch_headers(esp_http_client_handle_t client)
+{
+    return client->pFile ? (int64_t)(client->pFile->size - client->offset) : 0;
+}
+
+// Returns -1 once the request has hit dropAfterBytes, like a link that went away
+int esp_http_client_read(esp_http_client_handle_t client, char *buffer, int len)
+{
+    if (client->pFile == NULL || (server.dropAfterBytes && client->requestBytes >= server.dropAfterBytes))
+    {
+        return -1;
+    }
+    size_t length = client->pFile->size - client->offset;
+    length = (length < (size_t)len) ? length : (size_t)len;
+    if (server.dropAfterBytes && client->requestBytes + length > server.dropAfterBytes)
+    {
+        length = server.dropAfterBytes - client->requestBytes;
+    }
+    memcpy(buffer, client->pFile->pData + client->offset, length);
+    client->offset += length;
+    client->requestBytes += length;
+    server.bytesServed += length;
+    return (int)length;
+}
+
+int esp_http_client_get_status_code(esp_http_client_handle_t client)
+{
+    return client->statusCode;
+}
+
+bool esp_http_client_is_chunked_response(esp_http_client_handle_t client)
+{
+    return false;
+}
+
+esp_err_t esp_http_client_close(esp_http_client_handle_t client)
+{
+    return ESP_OK;
+}
+
+esp_err_t esp_http_client_cleanup(esp_http_client_handle_t client)
+{
+    free(client);
+    return ESP_OK;
+}
+
+// Partitions, the running app and the boot selection
+static uint8_t runningData[PARTITION_SIZE];
+static uint8_t updateData[PARTITION_SIZE];
+static const esp_partition_t runningPartition = { 0x10000, PARTITION_SIZE, runningData };
+static const esp_partition_t updatePartition = { 0x110000, PARTITION_SIZE, updateData };
+static const esp_partition_t *pBootPartition;
+static int restarts;
+static uint32_t fakeTicks;
+
+const esp_partition_t *esp_ota_get_next_update_partition(const esp_partition_t *start_from)
+{
+    return &updatePartition;
+}
+
+esp_err_t esp_ota_get_partition_description(const esp_partition_t *partition, esp_app_desc_t *app_desc)
+{
+    return esp_partition_read(partition, IMAGE_SHA_OFFSET, app_desc->app_elf_sha256, sizeof(app_desc->app_elf_sha256));
+}
+
+esp_err_t esp_ota_set_boot_partition(const esp_partition_t *partition)
+{
+    pBootPartition = partition;
+    return ESP_OK;
+}
+
+int esp_app_get_elf_sha256(char *dst, size_t size)
+{
+    esp_app_desc_t desc;
+    assert(esp_ota_get_partition_description(&runningPartition, &desc) == ESP_OK);
+    int n = 0;
+    for (size_t i = 0; i < sizeof(desc.app_elf_sha256) && (size_t)n + 2 < size; i++)
+    {
+        n += snprintf(dst + n, size - n, "%02x", desc.app_elf_sha256[i]);
+    }
+    return n;
+}
+
+void esp_restart(void)
+{
+    restarts++;
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+    fakeTicks += ticks;
+}
+
+TickType_t xTaskGetTickCount(void)
+{
+    return fakeTicks;
+}
+
+esp_err_t NotificationDispatcher_NotifyEvent(NotificationDispatcher *this, NotificationEvent notificationEvent, void *data, int dataSize, uint32_t waitDurationMSec)
+{
+    return ESP_OK;
+}
+
+// esp_https_ota on top of the stand-in server, for the no manifest fallback
+struct esp_https_ota
+{
+    esp_http_client_handle_t client;
+    uint8_t header[IMAGE_HEADER_BYTES];
+    int lenRead;
+    int imageSize;
+};
+
+static int ReadFully(esp_http_client_handle_t client, uint8_t *pBuffer, int length)
+{
+    int total = 0;
+    while (total < length)
+    {
+        int n = esp_http_client_read(client, (char *)pBuffer + total, length - total);
+        if (n <= 0)
+        {
+            break;
+        }
+        total += n;
+    }
+    return total;
+}
+
+esp_err_t esp_https_ota_begin(const esp_https_ota_config_t *ota_config, esp_https_ota_handle_t *handle)
+{
+    esp_https_ota_handle_t ota = calloc(1, sizeof(struct esp_https_ota));
+    ota->client = esp_http_client_init(ota_config->http_config);
+    esp_http_client_open(ota->client, 0);
+    ota->imageSize = (int)esp_http_client_fetch_headers(ota->client);
+    if (esp_http_client_get_status_code(ota->client) != 200 ||
+        (ota->lenRead = ReadFully(ota->client, ota->header, IMAGE_HEADER_BYTES)) != IMAGE_HEADER_BYTES)
+    {
+        esp_http_client_cleanup(ota->client);
+        free(ota);
+        return ESP_FAIL;
+    }
+    *handle = ota;
+    return ESP_OK;
+}
+
+esp_err_t esp_https_ota_get_img_desc(esp_https_ota_handle_t handle, esp_app_desc_t *new_app_info)
+{
+    memcpy(new_app_info->app_elf_sha256, handle->header + IMAGE_SHA_OFFSET, sizeof(new_app_info->app_elf_sha256));
+    return ESP_OK;
+}
+
+esp_err_t esp_https_ota_perform(esp_https_ota_handle_t handle)
+{
+    if (handle->lenRead == IMAGE_HEADER_BYTES)
+    {
+        assert(esp_partition_erase_range(&updatePartition, 0, PARTITION_SIZE) == ESP_OK);
+        assert(esp_partition_write(&updatePartition, 0, handle->header, IMAGE_HEADER_BYTES) == ESP_OK);
+    }
+    uint8_t chunk[4096];
+    int n = ReadFully(handle->client, chunk, sizeof(chunk));
+    if (n > 0)
+    {
+        assert(esp_partition_write(&updatePartition, handle->lenRead, chunk, n) == ESP_OK);
+        handle->lenRead += n;
+    }
+    if (handle->lenRead < handle->imageSize)
+    {
+        return (n > 0) ? ESP_ERR_HTTPS_OTA_IN_PROGRESS : ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+bool esp_https_ota_is_complete_data_received(esp_https_ota_handle_t handle)
+{
+    return handle->lenRead == handle->imageSize;
+}
+
+int esp_https_ota_get_image_len_read(esp_https_ota_handle_t handle)
+{
+    return handle->lenRead;
+}
+
+int esp_https_ota_get_image_size(esp_https_ota_handle_t handle)
+{
+    return handle->imageSize;
+}
+
+esp_err_t esp_https_ota_abort(esp_https_ota_handle_t handle)
+{
+    esp_http_client_cleanup(handle->client);
+    free(handle);
+    return ESP_OK;
+}
+
+esp_err_t esp_https_ota_finish(esp_https_ota_handle_t handle)
+{
+    esp_https_ota_abort(handle);
+    return esp_ota_set_boot_partition(&updatePartition);
+}
+
+// Images, manifests and signing
+static uint8_t runningImage[IMAGE_SIZE];
+static uint8_t newImage[IMAGE_SIZE];
+static uint8_t deflateImage[IMAGE_SIZE + 1024];
+static size_t deflateSize;
+static char manifestJson[2048];
+static char responseBuffer[OTA_HTTP_RESPONSE_BUFFER_SIZE + 1];
+
+static uint32_t NextRandom(uint32_t *pState)
+{
+    // xorshift32, fixed seed so failures reproduce
+    *pState ^= *pState << 13;
+    *pState ^= *pState >> 17;
+    *pState ^= *pState << 5;
+    return *pState;
+}
+
+// Symbols from a small alphabet so the deflate stream is noticeably smaller than the image
+static void MakeImage(uint8_t *pImage, uint32_t seed)
+{
+    for (size_t i = 0; i < IMAGE_SIZE; i++)
+    {
+        pImage[i] = (uint8_t)("0123456789abcdef"[NextRandom(&seed) & 0xF]);
+    }
+    for (int i = 0; i < 32; i++)
+    {
+        pImage[IMAGE_SHA_OFFSET + i] = (uint8_t)NextRandom(&seed);
+    }
+}
+
+static void ShaHex(const uint8_t *pImage, char *pHex)
+{
+    for (int i = 0; i < 32; i++)
+    {
+        sprintf(pHex + 2 * i, "%02x", pImage[IMAGE_SHA_OFFSET + i]);
+    }
+}
+
+static void InstallRunningImage(const uint8_t *pImage)
+{
+    memset(runningData, 0xFF, sizeof(runningData));
+    memcpy(runningData, pImage, IMAGE_SIZE);
+    pHostRunningPartition = &runningPartition;
+}
+
+// Signs the fields the way VerifyManifestSignature joins them
+static void SignManifest(const OtaUpdate_Manifest *pManifest, char *pSignatureB64, size_t signatureB64Size)
+{
+    char message[OTA_MANIFEST_MAX_SIGNED_LENGTH];
+    int messageLength = snprintf(message, sizeof(message), "%s\n%s\n%u\n%s\n%s\n%u\n%s\n%u\n%s",
+                                 pManifest->version, pManifest->elfSha256, pManifest->size, pManifest->url,
+                                 pManifest->deflateUrl, pManifest->deflateSize,
+                                 pManifest->deltaUrl, pManifest->deltaSize, pManifest->deltaSourceSha256);
+    uint8_t keyDer[256];
+    size_t keyLength = 0;
+    assert(mbedtls_base64_decode(keyDer, sizeof(keyDer), &keyLength, (const uint8_t *)TEST_PRIVATE_KEY_B64, strlen(TEST_PRIVATE_KEY_B64)) == 0);
+    const uint8_t *pKeyDer = keyDer;
+    EVP_PKEY *pKey = d2i_AutoPrivateKey(NULL, &pKeyDer, (long)keyLength);
+    assert(pKey != NULL);
+
+    uint8_t signature[OTA_MANIFEST_MAX_SIGNATURE_SIZE];
+    size_t signatureLength = sizeof(signature);
+    EVP_MD_CTX *pCtx = EVP_MD_CTX_new();
+    assert(EVP_DigestSignInit(pCtx, NULL, EVP_sha256(), NULL, pKey) == 1);
+    assert(EVP_DigestSign(pCtx, signature, &signatureLength, (const uint8_t *)message, messageLength) == 1);
+    EVP_MD_CTX_free(pCtx);
+    EVP_PKEY_free(pKey);
+
+    size_t outlen = 0;
+    assert(mbedtls_base64_encode((uint8_t *)pSignatureB64, signatureB64Size, &outlen, signature, signatureLength) == 0);
+}
+
+typedef enum ManifestSigning_e
+{
+    MANIFEST_SIGNED,
+    MANIFEST_UNSIGNED,
+    MANIFEST_SIGNED_FOR_OTHER_SIZE,     // Signature is valid for a manifest that lists a different size
+} ManifestSigning;
+
+static void PublishManifest(const uint8_t *pImage, bool offerDeflate, ManifestSigning signing)
+{
+    OtaUpdate_Manifest manifest = { 0 };
+    strcpy(manifest.version, "2.1.0");
+    ShaHex(pImage, manifest.elfSha256);
+    manifest.size = IMAGE_SIZE;
+    strcpy(manifest.url, TEST_OTA_URL);
+    if (offerDeflate)
+    {
+        uLongf length = sizeof(deflateImage);
+        assert(compress2(deflateImage, &length, pImage, IMAGE_SIZE, Z_BEST_COMPRESSION) == Z_OK);
+        deflateSize = length;
+        strcpy(manifest.deflateUrl, TEST_DEFLATE_URL);
+        manifest.deflateSize = (uint32_t)deflateSize;
+        Server_Publish(TEST_DEFLATE_URL, deflateImage, deflateSize);
+    }
+
+    char signature[OTA_MANIFEST_MAX_SIGNATURE_SIZE];
+    OtaUpdate_Manifest signedManifest = manifest;
+    signedManifest.size += (signing == MANIFEST_SIGNED_FOR_OTHER_SIZE);
+    SignManifest(&signedManifest, signature, sizeof(signature));
+
+    int n = snprintf(manifestJson, sizeof(manifestJson), "{\"version\": \"%s\", \"elf_sha256\": \"%s\", \"size\": %u, \"url\": \"%s\"",
+                     manifest.version, manifest.elfSha256, manifest.size, manifest.url);
+    if (offerDeflate)
+    {
+        n += snprintf(manifestJson + n, sizeof(manifestJson) - n, ", \"deflate_url\": \"%s\", \"deflate_size\": %u", manifest.deflateUrl, manifest.deflateSize);
+    }
+    if (signing != MANIFEST_UNSIGNED)
+    {
+        n += snprintf(manifestJson + n, sizeof(manifestJson) - n, ", \"signature\": \"%s\"", signature);
+    }
+    n += snprintf(manifestJson + n, sizeof(manifestJson) - n, "}");
+    assert(n < (int)sizeof(manifestJson));
+    Server_Publish(TEST_MANIFEST_URL, manifestJson, strlen(manifestJson));
+}
+
+static void StartTest(OtaUpdate *pOta)
+{
+    memset(pOta, 0, sizeof(*pOta));
+    Server_Reset();
+    HostNvs_Erase();
+    memset(updateData, 0xFF, sizeof(updateData));
+    pBootPartition = NULL;
+    restarts = 0;
+    InstallRunningImage(runningImage);
+}
+
+// One check. Whatever path it takes, its byte counter has to match what the server sent
+static void RunCheck(OtaUpdate *pOta)
+{
+    uint64_t totalBytes = pOta->stats.totalBytes;
+    server.requests = 0;
+    server.bytesServed = 0;
+    OtaUpdate_RunCheck(pOta, responseBuffer);
+    assert(pOta->stats.lastCheckBytes == server.bytesServed);
+    assert(pOta->stats.totalBytes == totalBytes + server.bytesServed);
+}
+
+static void ExpectInstalled(const uint8_t *pImage)
+{
+    assert(restarts == 1);
+    assert(pBootPartition == &updatePartition);
+    assert(memcmp(updateData, pImage, IMAGE_SIZE) == 0);
+}
+
+static void TestMatchingManifestSkipsTheImage(void)
+{
+    static OtaUpdate ota;
+    StartTest(&ota);
+    Server_Publish(TEST_OTA_URL, runningImage, IMAGE_SIZE);
+    PublishManifest(runningImage, true, MANIFEST_SIGNED);
+
+    RunCheck(&ota);
+    assert(server.requests == 1);
+    assert(ota.stats.lastCheckBytes == strlen(manifestJson));
+    assert(ota.stats.downloadsSkipped == 1);
+    assert(ota.stats.downloadsStarted == 0);
+    assert(restarts == 0);
+    printf("matching manifest: %u bytes\n", ota.stats.lastCheckBytes);
+}
+
+// A bad or missing signature ends the check. Falling back to the image header would let
+// anyone who can answer the manifest URL push an image
+static void TestBadSignatureNeverFallsBack(void)
+{
+    static OtaUpdate ota;
+    const ManifestSigning signings[] = { MANIFEST_SIGNED_FOR_OTHER_SIZE, MANIFEST_UNSIGNED };
+    for (size_t i = 0; i < sizeof(signings) / sizeof(signings[0]); i++)
+    {
+        StartTest(&ota);
+        Server_Publish(TEST_OTA_URL, newImage, IMAGE_SIZE);
+        PublishManifest(newImage, false, signings[i]);
+
+        RunCheck(&ota);
+        assert(server.requests == 1);
+        assert(ota.stats.lastCheckBytes == strlen(manifestJson));
+        assert(ota.stats.manifestFallbacks == 0);
+        assert(ota.stats.downloadsStarted == 0);
+        assert(pBootPartition == NULL);
+    }
+}
+
+static void TestNoManifestReadsOnlyTheHeader(void)
+{
+    static OtaUpdate ota;
+    StartTest(&ota);
+    Server_Publish(TEST_OTA_URL, runningImage, IMAGE_SIZE);
+
+    RunCheck(&ota);
+    assert(server.requests == 2);
+    assert(ota.stats.manifestFallbacks == 1);
+    assert(ota.stats.lastCheckBytes == IMAGE_HEADER_BYTES);
+    assert(restarts == 0);
+
+    // A new image behind the same URL is downloaded whole through esp_https_ota
+    Server_Reset();
+    Server_Publish(TEST_OTA_URL, newImage, IMAGE_SIZE);
+    RunCheck(&ota);
+    assert(ota.stats.manifestFallbacks == 2);
+    assert(ota.stats.lastCheckBytes == IMAGE_SIZE);
+    ExpectInstalled(newImage);
+    printf("no manifest: %u header bytes when current, %u bytes to update\n", IMAGE_HEADER_BYTES, ota.stats.lastCheckBytes);
+}
+
+static void TestDeflateStreamIsPreferred(void)
+{
+    static OtaUpdate ota;
+    StartTest(&ota);
+    Server_Publish(TEST_OTA_URL, newImage, IMAGE_SIZE);
+    PublishManifest(newImage, true, MANIFEST_SIGNED);
+
+    RunCheck(&ota);
+    assert(ota.stats.lastCheckBytes == strlen(manifestJson) + deflateSize);
+    assert(ota.stats.downloadsStarted == 1);
+    ExpectInstalled(newImage);
+    printf("deflate stream: %u bytes for a %d byte image\n", ota.stats.lastCheckBytes, IMAGE_SIZE);
+}
+
+// Every request drops after DROP_AFTER_BYTES until the retries run out. The next check picks up
+// from the saved offset, redoing only the sector the save may have cut through
+static void TestRawDownloadResumesOnNextCheck(void)
+{
+    static OtaUpdate ota;
+    StartTest(&ota);
+    Server_Publish(TEST_OTA_URL, newImage, IMAGE_SIZE);
+    PublishManifest(newImage, false, MANIFEST_SIGNED);
+    size_t manifestBytes = strlen(manifestJson);
+
+    server.dropAfterBytes = DROP_AFTER_BYTES;
+    RunCheck(&ota);
+    uint32_t attempts = CONFIG_OTA_RESUME_MAX_RETRIES + 1;
+    uint32_t firstCheckImageBytes = attempts * DROP_AFTER_BYTES;
+    assert(server.requests == 1 + attempts);
+    assert(ota.stats.lastCheckBytes == manifestBytes + firstCheckImageBytes);
+    assert(restarts == 0);
+
+    OtaUpdate_ResumeState state;
+    assert(OtaUpdate_LoadResumeState(&state) == ESP_OK);
+    assert(state.offset == firstCheckImageBytes);
+
+    server.dropAfterBytes = 0;
+    RunCheck(&ota);
+    uint32_t resumeOffset = firstCheckImageBytes & ~(4096u - 1);
+    assert(ota.stats.resumes == 1);
+    assert(ota.stats.lastCheckBytes == manifestBytes + IMAGE_SIZE - resumeOffset);
+    assert(ota.stats.totalBytes == 2 * manifestBytes + firstCheckImageBytes + IMAGE_SIZE - resumeOffset);
+    ExpectInstalled(newImage);
+    assert(OtaUpdate_LoadResumeState(&state) != ESP_OK);
+    printf("resumed download: %u + %u bytes over two checks for a %d byte image\n",
+           (uint32_t)(manifestBytes + firstCheckImageBytes), ota.stats.lastCheckBytes, IMAGE_SIZE);
+}
+
+// A server that answers a Range request with the whole image costs a full download, counted as such
+static void TestServerIgnoringRangeRestarts(void)
+{
+    static OtaUpdate ota;
+    StartTest(&ota);
+    Server_Publish(TEST_OTA_URL, newImage, IMAGE_SIZE);
+    PublishManifest(newImage, false, MANIFEST_SIGNED);
+
+    server.dropAfterBytes = DROP_AFTER_BYTES;
+    RunCheck(&ota);
+    server.dropAfterBytes = 0;
+    server.ignoreRange = true;
+    RunCheck(&ota);
+    assert(ota.stats.resumes == 1);
+    assert(ota.stats.lastCheckBytes == strlen(manifestJson) + IMAGE_SIZE);
+    ExpectInstalled(newImage);
+}
+
+int main(void)
+{
+    MakeImage(runningImage, 1);
+    MakeImage(newImage, 2);
+
+    TestMatchingManifestSkipsTheImage();
+    TestBadSignatureNeverFallsBack();
+    TestNoManifestReadsOnlyTheHeader();
+    TestDeflateStreamIsPreferred();
+    TestRawDownloadResumesOnNextCheck();
+    TestServerIgnoringRangeRestarts();
+    printf("ota update check: ok\n");
+    return 0;
+}
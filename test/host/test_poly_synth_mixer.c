@@ -0,0 +1,155 @@
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "PolySynthMixer.h"
+
+#define NUM_BUFFERS     (20000)     // About 160 s of audio at 16 kHz
+#define FULL_SCALE      (32767)
+
+static uint32_t NextRandom(uint32_t *pState)
+{
+    // xorshift32, fixed seed so failures reproduce
+    *pState ^= *pState << 13;
+    *pState ^= *pState >> 17;
+    *pState ^= *pState << 5;
+    return *pState;
+}
+
+// Every voice in every waveform, started together at the same pitch so the peaks line up.
+// The envelope settles at full level and the mix stays inside full scale
+static void TestAllVoicesInPhase(void)
+{
+    static PolySynthMixer mixer;
+    int16_t buffer[POLY_SYNTH_BUFFER_SAMPLES];
+    const PolySynthWaveform waveforms[] = { POLY_SYNTH_WAVEFORM_SQUARE, POLY_SYNTH_WAVEFORM_SINE };
+
+    for (size_t w = 0; w < sizeof(waveforms) / sizeof(waveforms[0]); w++)
+    {
+        PolySynthMixer_Init(&mixer);
+        for (int v = 0; v < POLY_SYNTH_MAX_VOICES; v++)
+        {
+            assert(PolySynthMixer_NoteOn(&mixer, v, 440, waveforms[w]) == ESP_OK);
+        }
+
+        int peak = 0;
+        for (int b = 0; b < 50; b++)
+        {
+            assert(PolySynthMixer_Render(&mixer, buffer));
+            for (int i = 0; i < POLY_SYNTH_BUFFER_SAMPLES; i++)
+            {
+                peak = (abs(buffer[i]) > peak) ? abs(buffer[i]) : peak;
+            }
+        }
+        assert(peak <= FULL_SCALE);
+        // Within a count per voice of full scale, so the headroom isn't wasted either
+        assert(peak >= FULL_SCALE - 2 * POLY_SYNTH_MAX_VOICES);
+        printf("%d voices in phase, %s: peak %d of %d\n", POLY_SYNTH_MAX_VOICES, w ? "sine" : "square", peak, FULL_SCALE);
+    }
+}
+
+// Random chords, retriggers and releases. Each voice also plays alone in its own mixer, and the
+// int16 mix has to match the exact sum of the solo voices. A mix that wrapped would not
+static void TestRandomChordsMatchSoloSum(void)
+{
+    static PolySynthMixer mix;
+    static PolySynthMixer solo[POLY_SYNTH_MAX_VOICES];
+    int16_t mixBuffer[POLY_SYNTH_BUFFER_SAMPLES];
+    int16_t soloBuffer[POLY_SYNTH_BUFFER_SAMPLES];
+    int32_t sum[POLY_SYNTH_BUFFER_SAMPLES];
+    uint32_t seed = 1;
+    int peak = 0;
+    int activeBuffers = 0;
+
+    PolySynthMixer_Init(&mix);
+    for (int v = 0; v < POLY_SYNTH_MAX_VOICES; v++)
+    {
+        PolySynthMixer_Init(&solo[v]);
+    }
+
+    for (int b = 0; b < NUM_BUFFERS; b++)
+    {
+        // A few events a second per voice, from a low bass note to near Nyquist
+        for (int v = 0; v < POLY_SYNTH_MAX_VOICES; v++)
+        {
+            uint32_t r = NextRandom(&seed);
+            if (r % 64 == 0)
+            {
+                uint32_t frequencyHz = 40 + (r >> 8) % (POLY_SYNTH_SAMPLE_RATE / 2 - 41);
+                PolySynthWaveform waveform = (r >> 6) & 1 ? POLY_SYNTH_WAVEFORM_SINE : POLY_SYNTH_WAVEFORM_SQUARE;
+                assert(PolySynthMixer_NoteOn(&mix, v, frequencyHz, waveform) == ESP_OK);
+                assert(PolySynthMixer_NoteOn(&solo[v], v, frequencyHz, waveform) == ESP_OK);
+            }
+            else if (r % 64 == 1)
+            {
+                assert(PolySynthMixer_NoteOff(&mix, v) == ESP_OK);
+                assert(PolySynthMixer_NoteOff(&solo[v], v) == ESP_OK);
+            }
+        }
+
+        bool active = PolySynthMixer_Render(&mix, mixBuffer);
+        bool anySoloActive = false;
+        for (int i = 0; i < POLY_SYNTH_BUFFER_SAMPLES; i++)
+        {
+            sum[i] = 0;
+        }
+        for (int v = 0; v < POLY_SYNTH_MAX_VOICES; v++)
+        {
+            anySoloActive |= PolySynthMixer_Render(&solo[v], soloBuffer);
+            for (int i = 0; i < POLY_SYNTH_BUFFER_SAMPLES; i++)
+            {
+                sum[i] += soloBuffer[i];
+            }
+        }
+        assert(active == anySoloActive);
+        activeBuffers += active;
+
+        for (int i = 0; i < POLY_SYNTH_BUFFER_SAMPLES; i++)
+        {
+            assert(sum[i] >= -FULL_SCALE && sum[i] <= FULL_SCALE);
+            assert(mixBuffer[i] == sum[i]);
+            peak = (abs(mixBuffer[i]) > peak) ? abs(mixBuffer[i]) : peak;
+        }
+    }
+    assert(activeBuffers > NUM_BUFFERS / 2);
+    printf("random chords: %d of %d buffers sounding, peak %d of %d\n", activeBuffers, NUM_BUFFERS, peak, FULL_SCALE);
+}
+
+static void TestInvalidNotes(void)
+{
+    static PolySynthMixer mixer;
+    int16_t buffer[POLY_SYNTH_BUFFER_SAMPLES];
+    PolySynthMixer_Init(&mixer);
+
+    assert(PolySynthMixer_NoteOn(&mixer, -1, 440, POLY_SYNTH_WAVEFORM_SQUARE) == ESP_ERR_INVALID_ARG);
+    assert(PolySynthMixer_NoteOn(&mixer, POLY_SYNTH_MAX_VOICES, 440, POLY_SYNTH_WAVEFORM_SQUARE) == ESP_ERR_INVALID_ARG);
+    assert(PolySynthMixer_NoteOn(&mixer, 0, 0, POLY_SYNTH_WAVEFORM_SQUARE) == ESP_ERR_INVALID_ARG);
+    assert(PolySynthMixer_NoteOn(&mixer, 0, POLY_SYNTH_SAMPLE_RATE / 2, POLY_SYNTH_WAVEFORM_SQUARE) == ESP_ERR_INVALID_ARG);
+    assert(PolySynthMixer_NoteOff(&mixer, POLY_SYNTH_MAX_VOICES) == ESP_ERR_INVALID_ARG);
+
+    // Nothing was started, so the mixer is idle and renders silence
+    assert(!PolySynthMixer_Render(&mixer, buffer));
+    for (int i = 0; i < POLY_SYNTH_BUFFER_SAMPLES; i++)
+    {
+        assert(buffer[i] == 0);
+    }
+
+    // A released note fades out within the release time and the mixer goes idle again
+    assert(PolySynthMixer_NoteOn(&mixer, 0, 440, POLY_SYNTH_WAVEFORM_SQUARE) == ESP_OK);
+    assert(PolySynthMixer_Render(&mixer, buffer));
+    assert(PolySynthMixer_NoteOff(&mixer, 0) == ESP_OK);
+    int buffers = 0;
+    while (PolySynthMixer_Render(&mixer, buffer))
+    {
+        assert(++buffers <= POLY_SYNTH_SAMPLE_RATE / 50 / POLY_SYNTH_BUFFER_SAMPLES + 1);
+    }
+}
+
+int main(void)
+{
+    TestAllVoicesInPhase();
+    TestRandomChordsMatchSoloSum();
+    TestInvalidNotes();
+    printf("poly synth mixer: ok\n");
+    return 0;
+}
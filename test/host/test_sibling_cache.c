@@ -0,0 +1,307 @@
+#include <assert.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "esp_err.h"
+#include "mbedtls/base64.h"
+
+#include "Mutex.h"
+#include "SiblingCache.h"
+
+#define MAX_TEST_SIBLINGS       (SIBLING_CACHE_CAPACITY + 16)
+#define STRESS_READERS          (4)
+#define STRESS_WRITERS          (2)
+#define STRESS_ITERATIONS       (20000)
+#define STRESS_WORDS            (16)
+#define LOCK_WAIT_TICKS         pdMS_TO_TICKS(5000)
+
+static void MakeId(uint32_t n, uint8_t *pBadgeId)
+{
+    for (int i = 0; i < BADGE_ID_SIZE; i++)
+    {
+        pBadgeId[i] = (uint8_t)(n * 2654435761u >> (i * 4)) ^ (uint8_t)i;
+    }
+}
+
+static void MakeIdB64(uint32_t n, char *pBadgeIdB64)
+{
+    uint8_t badgeId[BADGE_ID_SIZE];
+    size_t outlen = 0;
+    MakeId(n, badgeId);
+    assert(mbedtls_base64_encode((unsigned char *)pBadgeIdB64, BADGE_ID_B64_SIZE, &outlen, badgeId, BADGE_ID_SIZE) == 0);
+}
+
+// Updates the cache with ids first..first+count-1, the way a heartbeat response lists them
+static void UpdateRange(SiblingCache *pCache, uint32_t first, int count)
+{
+    static uint8_t badgeIds[MAX_TEST_SIBLINGS][BADGE_ID_SIZE];
+    assert(count <= MAX_TEST_SIBLINGS);
+    for (int i = 0; i < count; i++)
+    {
+        MakeId(first + i, badgeIds[i]);
+    }
+    SiblingCache_Update(pCache, badgeIds, count);
+}
+
+static int CountEntries(SiblingCache *pCache)
+{
+    int count = 0;
+    for (int i = 0; i < SIBLING_CACHE_CAPACITY; i++)
+    {
+        count += pCache->entries[i].inUse;
+    }
+    return count;
+}
+
+static bool MarkSeen(SiblingCache *pCache, uint32_t n)
+{
+    char badgeIdB64[BADGE_ID_B64_SIZE];
+    MakeIdB64(n, badgeIdB64);
+    return SiblingCache_MarkSeen(pCache, badgeIdB64);
+}
+
+static void TestFullTableThenSmallerList(void)
+{
+    static SiblingCache cache;
+    assert(SiblingCache_Init(&cache) == ESP_OK);
+
+    UpdateRange(&cache, 0, SIBLING_CACHE_CAPACITY);
+    assert(CountEntries(&cache) == SIBLING_CACHE_CAPACITY);
+    for (uint32_t n = 0; n < SIBLING_CACHE_CAPACITY; n++)
+    {
+        assert(!MarkSeen(&cache, n));
+        assert(MarkSeen(&cache, n));
+    }
+
+    // Half of the old list stays, half is new. Kept siblings stay seen, evicted ones are gone
+    uint32_t first = SIBLING_CACHE_CAPACITY / 2;
+    int count = SIBLING_CACHE_CAPACITY / 4 * 3;
+    UpdateRange(&cache, first, count);
+    assert(CountEntries(&cache) == count);
+    for (uint32_t n = 0; n < first; n++)
+    {
+        assert(!MarkSeen(&cache, n));
+        assert(!MarkSeen(&cache, n));
+    }
+    for (uint32_t n = first; n < SIBLING_CACHE_CAPACITY; n++)
+    {
+        assert(MarkSeen(&cache, n));
+    }
+    for (uint32_t n = SIBLING_CACHE_CAPACITY; n < first + count; n++)
+    {
+        assert(!MarkSeen(&cache, n));
+        assert(MarkSeen(&cache, n));
+    }
+
+    // An empty list clears the cache
+    UpdateRange(&cache, 0, 0);
+    assert(CountEntries(&cache) == 0);
+    assert(!MarkSeen(&cache, first));
+}
+
+static void TestDuplicateId(void)
+{
+    static SiblingCache cache;
+    static uint8_t badgeIds[4][BADGE_ID_SIZE];
+    assert(SiblingCache_Init(&cache) == ESP_OK);
+
+    MakeId(7, badgeIds[0]);
+    MakeId(8, badgeIds[1]);
+    MakeId(7, badgeIds[2]);
+    MakeId(7, badgeIds[3]);
+    SiblingCache_Update(&cache, badgeIds, 4);
+    assert(CountEntries(&cache) == 2);
+    assert(!MarkSeen(&cache, 7));
+    assert(MarkSeen(&cache, 7));
+
+    // Listed twice again, the one entry keeps its seen flag
+    SiblingCache_Update(&cache, badgeIds, 4);
+    assert(CountEntries(&cache) == 2);
+    assert(MarkSeen(&cache, 7));
+    assert(!MarkSeen(&cache, 8));
+}
+
+static void TestListLongerThanCapacity(void)
+{
+    static SiblingCache cache;
+    assert(SiblingCache_Init(&cache) == ESP_OK);
+
+    // The first CAPACITY ids are kept, the rest are dropped without touching memory past the table
+    UpdateRange(&cache, 100, MAX_TEST_SIBLINGS);
+    assert(CountEntries(&cache) == SIBLING_CACHE_CAPACITY);
+    for (uint32_t n = 100; n < 100 + SIBLING_CACHE_CAPACITY; n++)
+    {
+        assert(!MarkSeen(&cache, n));
+    }
+    for (uint32_t n = 100 + SIBLING_CACHE_CAPACITY; n < 100 + MAX_TEST_SIBLINGS; n++)
+    {
+        assert(!MarkSeen(&cache, n));
+        assert(!MarkSeen(&cache, n));
+    }
+
+    // A shifted long list evicts the unlisted head first, so new ids take the freed slots
+    UpdateRange(&cache, 100 + MAX_TEST_SIBLINGS - SIBLING_CACHE_CAPACITY, MAX_TEST_SIBLINGS);
+    assert(CountEntries(&cache) == SIBLING_CACHE_CAPACITY);
+    assert(MarkSeen(&cache, 100 + SIBLING_CACHE_CAPACITY - 1));
+    assert(!MarkSeen(&cache, 100 + MAX_TEST_SIBLINGS - 1));
+}
+
+static void TestInvalidIds(void)
+{
+    static SiblingCache cache;
+    uint8_t badgeId[BADGE_ID_SIZE];
+    assert(SiblingCache_Init(&cache) == ESP_OK);
+    UpdateRange(&cache, 0, 1);
+
+    assert(!SiblingCache_DecodeId("", badgeId));
+    assert(!SiblingCache_DecodeId("AAAA", badgeId));
+    assert(!SiblingCache_DecodeId("AAAAAAAAAAAAAAAA", badgeId));
+    assert(!SiblingCache_DecodeId("AAAAAAAA*AA=", badgeId));
+    assert(!SiblingCache_MarkSeen(&cache, "not an id"));
+}
+
+// RWLock: many readers at once, writers alone. Writers fill the words with one value, readers
+// check they never see a half written set
+typedef struct RWLockStress_t
+{
+    RWLock lock;
+    uint32_t words[STRESS_WORDS];
+    atomic_int readers;
+    atomic_int writers;
+    atomic_int maxReaders;
+} RWLockStress;
+
+static RWLockStress stress;
+
+static void *StressReader(void *pArg)
+{
+    for (int i = 0; i < STRESS_ITERATIONS; i++)
+    {
+        assert(RWLock_ReadLock(&stress.lock, LOCK_WAIT_TICKS) == ESP_OK);
+        int readers = atomic_fetch_add(&stress.readers, 1) + 1;
+        assert(atomic_load(&stress.writers) == 0);
+        int maxReaders = atomic_load(&stress.maxReaders);
+        while (readers > maxReaders && !atomic_compare_exchange_weak(&stress.maxReaders, &maxReaders, readers))
+        {
+        }
+        for (int w = 1; w < STRESS_WORDS; w++)
+        {
+            assert(stress.words[w] == stress.words[0]);
+        }
+        if ((i & 63) == 0)
+        {
+            sched_yield();
+        }
+        atomic_fetch_sub(&stress.readers, 1);
+        assert(RWLock_ReadUnlock(&stress.lock) == ESP_OK);
+    }
+    return NULL;
+}
+
+static void *StressWriter(void *pArg)
+{
+    uint32_t writerId = (uint32_t)(uintptr_t)pArg;
+    for (int i = 0; i < STRESS_ITERATIONS / 8; i++)
+    {
+        assert(RWLock_WriteLock(&stress.lock, LOCK_WAIT_TICKS) == ESP_OK);
+        assert(atomic_fetch_add(&stress.writers, 1) == 0);
+        assert(atomic_load(&stress.readers) == 0);
+        for (int w = 0; w < STRESS_WORDS; w++)
+        {
+            stress.words[w] = (writerId << 24) | (uint32_t)i;
+            if (w == STRESS_WORDS / 2)
+            {
+                sched_yield();
+            }
+        }
+        atomic_fetch_sub(&stress.writers, 1);
+        assert(RWLock_WriteUnlock(&stress.lock) == ESP_OK);
+    }
+    return NULL;
+}
+
+static void TestRWLockStress(void)
+{
+    assert(RWLock_Create(&stress.lock) == ESP_OK);
+    pthread_t threads[STRESS_READERS + STRESS_WRITERS];
+    for (int i = 0; i < STRESS_READERS; i++)
+    {
+        assert(pthread_create(&threads[i], NULL, StressReader, NULL) == 0);
+    }
+    for (int i = 0; i < STRESS_WRITERS; i++)
+    {
+        assert(pthread_create(&threads[STRESS_READERS + i], NULL, StressWriter, (void *)(uintptr_t)(i + 1)) == 0);
+    }
+    for (int i = 0; i < STRESS_READERS + STRESS_WRITERS; i++)
+    {
+        assert(pthread_join(threads[i], NULL) == 0);
+    }
+
+    // Balanced unlocks leave the lock free for a writer, an extra read unlock is refused
+    assert(RWLock_WriteLock(&stress.lock, 0) == ESP_OK);
+    assert(RWLock_WriteUnlock(&stress.lock) == ESP_OK);
+    assert(RWLock_ReadUnlock(&stress.lock) == ESP_FAIL);
+    printf("rwlock: %d readers, %d writers, up to %d readers held the lock together\n",
+           STRESS_READERS, STRESS_WRITERS, atomic_load(&stress.maxReaders));
+}
+
+// The peer heartbeat handler marks siblings while the HTTP task replaces the list
+static SiblingCache sharedCache;
+
+static void *CacheUpdater(void *pArg)
+{
+    for (int i = 0; i < STRESS_ITERATIONS / 20; i++)
+    {
+        UpdateRange(&sharedCache, (uint32_t)(i % 8), SIBLING_CACHE_CAPACITY - (i % 5));
+        assert(CountEntries(&sharedCache) <= SIBLING_CACHE_CAPACITY);
+    }
+    return NULL;
+}
+
+static void *CacheMarker(void *pArg)
+{
+    for (int i = 0; i < STRESS_ITERATIONS; i++)
+    {
+        MarkSeen(&sharedCache, (uint32_t)(i % (SIBLING_CACHE_CAPACITY + 8)));
+    }
+    return NULL;
+}
+
+static void TestCacheUpdateWhileMarking(void)
+{
+    assert(SiblingCache_Init(&sharedCache) == ESP_OK);
+    pthread_t threads[3];
+    assert(pthread_create(&threads[0], NULL, CacheUpdater, NULL) == 0);
+    assert(pthread_create(&threads[1], NULL, CacheMarker, NULL) == 0);
+    assert(pthread_create(&threads[2], NULL, CacheMarker, NULL) == 0);
+    for (int i = 0; i < 3; i++)
+    {
+        assert(pthread_join(threads[i], NULL) == 0);
+    }
+
+    // Every entry is unique after the churn
+    for (int i = 0; i < SIBLING_CACHE_CAPACITY; i++)
+    {
+        for (int j = i + 1; j < SIBLING_CACHE_CAPACITY; j++)
+        {
+            assert(!(sharedCache.entries[i].inUse && sharedCache.entries[j].inUse &&
+                     memcmp(sharedCache.entries[i].badgeId, sharedCache.entries[j].badgeId, BADGE_ID_SIZE) == 0));
+        }
+    }
+}
+
+int main(void)
+{
+    TestFullTableThenSmallerList();
+    TestDuplicateId();
+    TestListLongerThanCapacity();
+    TestInvalidIds();
+    TestRWLockStress();
+    TestCacheUpdateWhileMarking();
+    printf("sibling cache: ok\n");
+    return 0;
+}
@@ -0,0 +1,230 @@
+#include <assert.h>
+#include <stdio.h>
+
+#include "esp_timer.h"
+
+#include "Song.h"
+#include "SongSequencer.h"
+
+#define START_TIME_US       (1000000)
+#define MAX_LATENESS_US     (20000)     // Callback lateness injected on every step
+#define STALL_US            (400000)    // One long stall, like a flash write holding off the timer task
+#define SONG_NOTE_PAUSE_US  (50000)
+
+// One shot timer on a fake clock. The test fires it by hand, late by whatever it chooses
+struct esp_timer
+{
+    esp_timer_cb_t callback;
+    void *arg;
+    bool armed;
+    int64_t fireAtUs;
+};
+
+static struct esp_timer fakeTimer;
+static int64_t nowUs;
+
+int64_t esp_timer_get_time(void)
+{
+    return nowUs;
+}
+
+esp_err_t esp_timer_create(const esp_timer_create_args_t *create_args, esp_timer_handle_t *out_handle)
+{
+    fakeTimer.callback = create_args->callback;
+    fakeTimer.arg = create_args->arg;
+    fakeTimer.armed = false;
+    *out_handle = &fakeTimer;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_start_once(esp_timer_handle_t timer, uint64_t timeout_us)
+{
+    assert(!timer->armed);
+    timer->armed = true;
+    timer->fireAtUs = nowUs + (int64_t)timeout_us;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_stop(esp_timer_handle_t timer)
+{
+    timer->armed = false;
+    return ESP_OK;
+}
+
+static uint32_t NextRandom(uint32_t *pState)
+{
+    // xorshift32, fixed seed so failures reproduce
+    *pState ^= *pState << 13;
+    *pState ^= *pState >> 17;
+    *pState ^= *pState << 5;
+    return *pState;
+}
+
+// Expected tone changes, from the song itself: each note starts at the sum of the durations
+// before it, and unslurred notes go quiet for the pause at the end of their duration
+#define MAX_STEPS   (2048)
+
+typedef struct ToneStep_t
+{
+    int64_t atUs;
+    NoteName note;
+} ToneStep;
+
+static ToneStep expectedSteps[MAX_STEPS];
+static int numExpectedSteps;
+static int64_t expectedEndUs;
+
+static int numSteps;
+static int64_t maxErrorUs;
+static bool done;
+
+static void ExpectSong(const SongNotes *pSong, int64_t startUs)
+{
+    SongCursor cursor;
+    Note note;
+    SongCursor_Init(&cursor, pSong);
+    numExpectedSteps = 0;
+    int64_t atUs = startUs;
+    while (SongCursor_Next(&cursor, &note))
+    {
+        assert(numExpectedSteps + 2 <= MAX_STEPS);
+        expectedSteps[numExpectedSteps++] = (ToneStep){ atUs, note.note };
+        atUs += (int64_t)note.durationMs * 1000;
+        if (note.slur == 0)
+        {
+            expectedSteps[numExpectedSteps++] = (ToneStep){ atUs - SONG_NOTE_PAUSE_US, NOTE_REST };
+        }
+    }
+    expectedEndUs = atUs;
+    numSteps = 0;
+    maxErrorUs = 0;
+    done = false;
+}
+
+static void CheckTone(void *pContext, NoteName note)
+{
+    SongSequencer *pSequencer = (SongSequencer *)pContext;
+    assert(!done);
+    assert(numSteps < numExpectedSteps);
+    const ToneStep *pStep = &expectedSteps[numSteps++];
+    assert(note == pStep->note);
+    // Never early, and late only by what the callbacks themselves were late
+    int64_t errorUs = nowUs - pStep->atUs;
+    assert(errorUs >= 0);
+    maxErrorUs = (errorUs > maxErrorUs) ? errorUs : maxErrorUs;
+    // The deadline for the following step is set from this one, so it must still be exact
+    assert(pSequencer->nextDeadlineUs == pStep->atUs);
+}
+
+static void CheckDone(void *pContext)
+{
+    SongSequencer *pSequencer = (SongSequencer *)pContext;
+    assert(!done);
+    assert(numSteps == numExpectedSteps);
+    assert(pSequencer->nextDeadlineUs == expectedEndUs);
+    assert(nowUs >= expectedEndUs);
+    done = true;
+}
+
+// Fires the timer until the song is done. Returns the lateness a scheduler that timed each
+// step from its own callback would have piled up
+static int64_t RunSong(uint32_t *pSeed, int stallStep)
+{
+    int64_t naiveDriftUs = 0;
+    int step = 0;
+    while (fakeTimer.armed)
+    {
+        fakeTimer.armed = false;
+        int64_t latenessUs = NextRandom(pSeed) % (MAX_LATENESS_US + 1);
+        if (step++ == stallStep)
+        {
+            latenessUs = STALL_US;
+        }
+        nowUs = ((fakeTimer.fireAtUs > nowUs) ? fakeTimer.fireAtUs : nowUs) + latenessUs;
+        naiveDriftUs += latenessUs;
+        fakeTimer.callback(fakeTimer.arg);
+    }
+    assert(done);
+    return naiveDriftUs;
+}
+
+static void TestEverySongWithLateCallbacks(void)
+{
+    static SongSequencer sequencer;
+    uint32_t seed = 1;
+    assert(SongSequencer_Init(&sequencer, CheckTone, CheckDone, &sequencer) == ESP_OK);
+
+    nowUs = START_TIME_US;
+    for (Song song = 0; song < NUM_SONGS; song++)
+    {
+        ExpectSong(GetSong(song), nowUs);
+        assert(SongSequencer_Start(&sequencer, GetSong(song)) == ESP_OK);
+        int64_t naiveDriftUs = RunSong(&seed, -1);
+
+        // A late callback only delays its own step. Steps with no time between them can stack
+        // two latenesses, never more
+        assert(maxErrorUs <= 2 * MAX_LATENESS_US);
+        // The sequencer's own lateness figure saw the same steps, plus the end of the song
+        int64_t endErrorUs = nowUs - expectedEndUs;
+        assert(endErrorUs <= MAX_LATENESS_US);
+        assert(sequencer.maxLatenessUs == ((endErrorUs > maxErrorUs) ? endErrorUs : maxErrorUs));
+        printf("song %2d: %3d steps over %6lld ms, worst step %5lld us late, %6lld us drift from callback relative timing\n",
+               song, numExpectedSteps, (long long)(expectedEndUs - expectedSteps[0].atUs) / 1000,
+               (long long)maxErrorUs, (long long)naiveDriftUs);
+    }
+}
+
+// A long stall puts every step behind at once. Steps that are due fire straight away and the
+// song catches back up to its deadlines instead of playing the rest late
+static void TestCatchUpAfterStall(void)
+{
+    static SongSequencer sequencer;
+    uint32_t seed = 2;
+    assert(SongSequencer_Init(&sequencer, CheckTone, CheckDone, &sequencer) == ESP_OK);
+
+    nowUs = START_TIME_US;
+    ExpectSong(GetSong(SONG_ZELDA_THEME), nowUs);
+    assert(SongSequencer_Start(&sequencer, GetSong(SONG_ZELDA_THEME)) == ESP_OK);
+    RunSong(&seed, 10);
+    assert(maxErrorUs >= STALL_US);
+    assert(nowUs - expectedEndUs <= MAX_LATENESS_US);
+}
+
+// Restarting mid song drops the old deadlines and times the new song from the restart
+static void TestRestartMidSong(void)
+{
+    static SongSequencer sequencer;
+    uint32_t seed = 3;
+    assert(SongSequencer_Init(&sequencer, CheckTone, CheckDone, &sequencer) == ESP_OK);
+
+    nowUs = START_TIME_US;
+    ExpectSong(GetSong(SONG_SONG_OF_STORMS), nowUs);
+    assert(SongSequencer_Start(&sequencer, GetSong(SONG_SONG_OF_STORMS)) == ESP_OK);
+    for (int i = 0; i < 5; i++)
+    {
+        fakeTimer.armed = false;
+        nowUs = fakeTimer.fireAtUs + NextRandom(&seed) % (MAX_LATENESS_US + 1);
+        fakeTimer.callback(fakeTimer.arg);
+    }
+
+    nowUs += 12345;
+    ExpectSong(GetSong(SONG_SUNS_SONG), nowUs);
+    assert(SongSequencer_Start(&sequencer, GetSong(SONG_SUNS_SONG)) == ESP_OK);
+    RunSong(&seed, -1);
+    assert(nowUs - expectedEndUs <= MAX_LATENESS_US);
+
+    // Stopping disarms the timer and leaves nothing to play
+    ExpectSong(GetSong(SONG_FANFARE), nowUs);
+    assert(SongSequencer_Start(&sequencer, GetSong(SONG_FANFARE)) == ESP_OK);
+    SongSequencer_Stop(&sequencer);
+    assert(!fakeTimer.armed);
+}
+
+int main(void)
+{
+    TestEverySongWithLateCallbacks();
+    TestCatchUpAfterStall();
+    TestRestartMidSong();
+    printf("song sequencer: ok\n");
+    return 0;
+}
@@ -0,0 +1,197 @@
+#include <assert.h>
+#include <stdio.h>
+
+#include "Song.h"
+#include "Notes.h"
+
+// Whole note fractions of the float NOTE_TYPE_* values the integer timing replaced
+static const double oldNoteTypes[NUM_NOTE_DURATIONS] =
+{
+    [NOTE_DURATION_WHOLE]                  = 1.0,
+    [NOTE_DURATION_HALF]                   = 1.0/2.0,
+    [NOTE_DURATION_QUARTER]                = 1.0/4.0,
+    [NOTE_DURATION_EIGHTH]                 = 1.0/8.0,
+    [NOTE_DURATION_SIXTEENTH]              = 1.0/16.0,
+    [NOTE_DURATION_THIRTY_SECOND]          = 1.0/32.0,
+    [NOTE_DURATION_SIXTY_FOURTH]           = 1.0/64.0,
+    [NOTE_DURATION_HALF_DOT]               = 1.0/2.0 + 1.0/4.0,
+    [NOTE_DURATION_HALF_DOT_DOT]           = 1.0/2.0 + 1.0/4.0 + 1.0/8.0,
+    [NOTE_DURATION_QUARTER_DOT]            = 1.0/4.0 + 1.0/8.0,
+    [NOTE_DURATION_QUARTER_DOT_DOT]        = 1.0/4.0 + 1.0/8.0 + 1.0/16.0,
+    [NOTE_DURATION_EIGHTH_DOT]             = 1.0/8.0 + 1.0/16.0,
+    [NOTE_DURATION_QUARTER_TRIPLET]        = 1.0/4.0/3.0,
+    [NOTE_DURATION_QUARTER_TRIPLET_DOUBLE] = 1.0/4.0/3.0 * 2.0,
+    [NOTE_DURATION_QUARTER_NINELET]        = 1.0/4.0/9.0,
+};
+
+// The double formula from before integer timing. noteType went through a float parameter
+static int OldNoteDurationInMilliseconds(int tempo, float noteType)
+{
+    double beatDuration = 60000.0 / tempo;
+    double duration = beatDuration * 4.0 * noteType;
+    return (int)(duration > 50 ? duration : 50);
+}
+
+static void TestKnownDurations(void)
+{
+    assert(GetNoteDurationInMilliseconds(120, NOTE_DURATION_WHOLE) == 2000);
+    assert(GetNoteDurationInMilliseconds(120, NOTE_DURATION_HALF) == 1000);
+    assert(GetNoteDurationInMilliseconds(120, NOTE_DURATION_QUARTER) == 500);
+    assert(GetNoteDurationInMilliseconds(120, NOTE_DURATION_EIGHTH) == 250);
+    assert(GetNoteDurationInMilliseconds(120, NOTE_DURATION_SIXTEENTH) == 125);
+    assert(GetNoteDurationInMilliseconds(120, NOTE_DURATION_HALF_DOT) == 1500);
+    assert(GetNoteDurationInMilliseconds(120, NOTE_DURATION_HALF_DOT_DOT) == 1750);
+    assert(GetNoteDurationInMilliseconds(120, NOTE_DURATION_QUARTER_DOT) == 750);
+    assert(GetNoteDurationInMilliseconds(120, NOTE_DURATION_QUARTER_TRIPLET) == 166);
+    assert(GetNoteDurationInMilliseconds(120, NOTE_DURATION_QUARTER_NINELET) == 55);
+
+    // Shorter notes are clamped to the 50ms filter period
+    assert(GetNoteDurationInMilliseconds(120, NOTE_DURATION_THIRTY_SECOND) == 62);
+    assert(GetNoteDurationInMilliseconds(120, NOTE_DURATION_SIXTY_FOURTH) == 50);
+    assert(GetNoteDurationInMilliseconds(1000, NOTE_DURATION_SIXTY_FOURTH) == 50);
+
+    assert(GetNoteDurationInMilliseconds(0, NOTE_DURATION_QUARTER) == -1);
+    assert(GetNoteDurationInMilliseconds(-120, NOTE_DURATION_QUARTER) == -1);
+    assert(GetNoteDurationInMilliseconds(120, (NoteDuration)-1) == -1);
+    assert(GetNoteDurationInMilliseconds(120, NUM_NOTE_DURATIONS) == -1);
+}
+
+// Integer timing matches the old float formula, except double-dotted lengths
+// where float rounding came out one millisecond short of the exact value
+static void TestMatchesOldFormula(void)
+{
+    for (int tempo = 1; tempo <= 1000; tempo++)
+    {
+        SongTiming timing;
+        SongTiming_Init(&timing, tempo);
+        assert(timing.tempo == tempo);
+        for (int duration = 0; duration < NUM_NOTE_DURATIONS; duration++)
+        {
+            int newMs = GetNoteDurationInMilliseconds(tempo, duration);
+            int oldMs = OldNoteDurationInMilliseconds(tempo, (float)oldNoteTypes[duration]);
+            // Whole notes below tempo 4 don't fit the uint16_t table, no song is that slow
+            assert(tempo < 4 || timing.durationMs[duration] == newMs);
+            if (duration == NOTE_DURATION_HALF_DOT_DOT || duration == NOTE_DURATION_QUARTER_DOT_DOT)
+            {
+                assert(newMs == oldMs || newMs == oldMs + 1);
+            }
+            else
+            {
+                assert(newMs == oldMs);
+            }
+        }
+    }
+}
+
+// Every packed song decodes to exactly its note count and consumes all its event bytes
+static void TestAllSongsDecode(void)
+{
+    for (Song song = 0; song < NUM_SONGS; song++)
+    {
+        const SongNotes *pSong = GetSong(song);
+        assert(pSong);
+        assert(pSong->songName);
+        assert(pSong->tempo > 0);
+
+        SongCursor cursor;
+        Note note;
+        int numNotes = 0;
+        SongCursor_Init(&cursor, pSong);
+        while (SongCursor_Next(&cursor, &note))
+        {
+            assert(note.note < NOTE_TOTAL_NUM_NOTES);
+            assert(note.duration >= 0 && note.duration < NUM_NOTE_DURATIONS);
+            assert(note.durationMs == GetNoteDurationInMilliseconds(pSong->tempo, note.duration));
+            assert(note.slur == 0 || note.slur == 1);
+            numNotes++;
+        }
+        assert(numNotes == pSong->numNotes);
+        assert(cursor.eventOffset == pSong->numEventBytes);
+    }
+
+    assert(GetSong(SONG_NONE) == NULL);
+    assert(GetSong(NUM_SONGS) == NULL);
+}
+
+// Note events reuse the duration and slur of the last timed event
+static void TestEventDecode(void)
+{
+    static const uint8_t events[] = {
+        SONG_NOTE_TIMED(NOTE_A3, EIGHTH, 1),
+        SONG_NOTE(NOTE_F3),
+        SONG_NOTE_TIMED(NOTE_D4, QUARTER_DOT, 0),
+        SONG_NOTE(NOTE_REST),
+        SONG_NOTE(NOTE_B6),
+    };
+    const SongNotes song = { "test", 60, 5, sizeof(events), events };
+    static const struct { NoteName note; NoteDuration duration; uint16_t durationMs; int slur; } expected[] = {
+        { NOTE_A3,   NOTE_DURATION_EIGHTH,      500,  1 },
+        { NOTE_F3,   NOTE_DURATION_EIGHTH,      500,  1 },
+        { NOTE_D4,   NOTE_DURATION_QUARTER_DOT, 1500, 0 },
+        { NOTE_REST, NOTE_DURATION_QUARTER_DOT, 1500, 0 },
+        { NOTE_B6,   NOTE_DURATION_QUARTER_DOT, 1500, 0 },
+    };
+
+    SongCursor cursor;
+    Note note;
+    SongCursor_Init(&cursor, &song);
+    for (size_t i = 0; i < sizeof(expected) / sizeof(expected[0]); i++)
+    {
+        assert(SongCursor_Next(&cursor, &note));
+        assert(note.note == expected[i].note);
+        assert(note.duration == expected[i].duration);
+        assert(note.durationMs == expected[i].durationMs);
+        assert(note.slur == expected[i].slur);
+    }
+    assert(!SongCursor_Next(&cursor, &note));
+
+    // The first note starts as an unslurred quarter when no timed event came first
+    const SongNotes untimed = { "untimed", 120, 1, 1, &events[2] };
+    SongCursor_Init(&cursor, &untimed);
+    assert(SongCursor_Next(&cursor, &note));
+    assert(note.duration == NOTE_DURATION_QUARTER);
+    assert(note.durationMs == 500);
+    assert(note.slur == 0);
+
+    // A timed event cut off before its timing byte ends the song
+    const SongNotes truncated = { "truncated", 120, 3, 3, events };
+    SongCursor_Init(&cursor, &truncated);
+    assert(SongCursor_Next(&cursor, &note));
+    assert(SongCursor_Next(&cursor, &note));
+    assert(!SongCursor_Next(&cursor, &note));
+
+    // The note count stops decoding before the event bytes run out
+    const SongNotes counted = { "counted", 120, 2, sizeof(events), events };
+    SongCursor_Init(&cursor, &counted);
+    assert(SongCursor_Next(&cursor, &note));
+    assert(SongCursor_Next(&cursor, &note));
+    assert(!SongCursor_Next(&cursor, &note));
+
+    SongCursor_Init(&cursor, NULL);
+    assert(!SongCursor_Next(&cursor, &note));
+}
+
+static void TestNoteFrequencies(void)
+{
+    assert(GetNoteFrequency(NOTE_REST) == 0);
+    for (NoteName note = NOTE_C0; note < NOTE_TOTAL_NUM_NOTES; note++)
+    {
+        assert(GetNoteFrequency(note) > 0);
+        if (note > NOTE_C0)
+        {
+            assert(GetNoteFrequency(note) >= GetNoteFrequency(note - 1));
+        }
+    }
+    assert(GetNoteFrequency(NOTE_A4) == 440);
+}
+
+int main(void)
+{
+    TestKnownDurations();
+    TestMatchesOldFormula();
+    TestAllSongsDecode();
+    TestEventDecode();
+    TestNoteFrequencies();
+    printf("songs: ok\n");
+    return 0;
+}
@@ -0,0 +1,120 @@
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "TouchActions.h"
+#include "touch_actions_chains.h"
+
+#define NUM_PAD_STATES      (TOUCH_SENSOR_EVENT_VERY_LONG_PRESSED + 1)
+#define MAX_CMDS_PER_EVENT  (16)
+
+// Stands in for the dispatcher, the handler is called directly and the commands it posts are captured
+static esp_event_handler_t touchSenseHandler;
+static void *pTouchSenseHandlerObj;
+static TouchActionsCmd postedCmds[MAX_CMDS_PER_EVENT];
+static int numPostedCmds;
+
+esp_err_t NotificationDispatcher_RegisterNotificationEventHandler(NotificationDispatcher *this, NotificationEvent notificationEvent, esp_event_handler_t eventHandler, void *eventHandlerArgs)
+{
+    assert(notificationEvent == NOTIFICATION_EVENTS_TOUCH_SENSE_ACTION);
+    touchSenseHandler = eventHandler;
+    pTouchSenseHandlerObj = eventHandlerArgs;
+    return ESP_OK;
+}
+
+esp_err_t NotificationDispatcher_NotifyEvent(NotificationDispatcher *this, NotificationEvent notificationEvent, void *data, int dataSize, uint32_t waitDurationMSec)
+{
+    assert(notificationEvent == NOTIFICATION_EVENTS_TOUCH_ACTION_CMD);
+    assert(dataSize == sizeof(TouchActionsCmd));
+    assert(numPostedCmds < MAX_CMDS_PER_EVENT);
+    postedCmds[numPostedCmds++] = *(TouchActionsCmd *)data;
+    return ESP_OK;
+}
+
+static void SetPad(int pad, TouchSensorEvent touchSensorEvent)
+{
+    TouchSensorEventNotificationData notificationData = { .touchSensorEvent = touchSensorEvent, .touchSensorIdx = pad };
+    numPostedCmds = 0;
+    touchSenseHandler(pTouchSenseHandlerObj, NULL, NOTIFICATION_EVENTS_TOUCH_SENSE_ACTION, &notificationData);
+}
+
+static void ExpectChainedCommands(const TouchSensorEvent *values, uint32_t stateIndex)
+{
+    TouchActionsCmd expectedCmds[MAX_CMDS_PER_EVENT];
+    int numExpectedCmds = ChainedTouchActions_Commands(values, expectedCmds);
+    if (numExpectedCmds != numPostedCmds || memcmp(expectedCmds, postedCmds, numPostedCmds * sizeof(TouchActionsCmd)) != 0)
+    {
+        fprintf(stderr, "state %u pads", stateIndex);
+        for (int pad = 0; pad < TOUCH_SENSOR_NUM_BUTTONS; pad++)
+        {
+            fprintf(stderr, " %d", values[pad]);
+        }
+        fprintf(stderr, ": chains posted %d commands (first %d), table posted %d (first %d)\n",
+                numExpectedCmds, numExpectedCmds ? expectedCmds[0] : -1, numPostedCmds, numPostedCmds ? postedCmds[0] : -1);
+        assert(false);
+    }
+}
+
+// Walks every pad state in reflected Gray code order, so each step is a single pad event
+// the way the touch sensor delivers them, and compares the table with the old chains
+static void TestAllPadStates(void)
+{
+    static TouchActions touchActions;
+    assert(TouchActions_Init(&touchActions, NULL) == ESP_OK);
+    assert(touchSenseHandler != NULL);
+
+    TouchSensorEvent values[TOUCH_SENSOR_NUM_BUTTONS] = { 0 };
+    int directions[TOUCH_SENSOR_NUM_BUTTONS];
+    for (int pad = 0; pad < TOUCH_SENSOR_NUM_BUTTONS; pad++)
+    {
+        directions[pad] = 1;
+    }
+
+    // The start state has no event of its own, release a pad to get there
+    SetPad(0, TOUCH_SENSOR_EVENT_RELEASED);
+    ExpectChainedCommands(values, 0);
+
+    uint32_t numStates = 1;
+    uint32_t numCommands = numPostedCmds;
+    while (true)
+    {
+        int pad = 0;
+        while (pad < TOUCH_SENSOR_NUM_BUTTONS)
+        {
+            int next = (int)values[pad] + directions[pad];
+            if (next >= 0 && next < NUM_PAD_STATES)
+            {
+                values[pad] = (TouchSensorEvent)next;
+                break;
+            }
+            directions[pad] = -directions[pad];
+            pad++;
+        }
+        if (pad == TOUCH_SENSOR_NUM_BUTTONS)
+        {
+            break;
+        }
+
+        SetPad(pad, values[pad]);
+        ExpectChainedCommands(values, numStates);
+        numCommands += numPostedCmds;
+        numStates++;
+    }
+
+    uint32_t expectedStates = 1;
+    for (int pad = 0; pad < TOUCH_SENSOR_NUM_BUTTONS; pad++)
+    {
+        expectedStates *= NUM_PAD_STATES;
+    }
+    assert(numStates == expectedStates);
+    // Every badge has gestures past CLEAR, make sure the walk reached some of them
+    assert(numCommands > 1);
+    printf("touch actions: %u pad states, %u commands match the old chains\n", numStates, numCommands);
+}
+
+int main(void)
+{
+    TestAllPadStates();
+    printf("touch actions: ok\n");
+    return 0;
+}
@@ -0,0 +1,226 @@
+#include <assert.h>
+#include <stdio.h>
+
+#include "TouchPadFilter.h"
+
+#define BASELINE            (1000)
+#define NOISE_COUNTS        (6)     // Peak to peak noise on an idle pad
+#define PRESS_DEPTH         (300)   // A finger pulls the reading down by roughly a third
+
+static uint32_t NextRandom(uint32_t *pState)
+{
+    // xorshift32, fixed seed so failures reproduce
+    *pState ^= *pState << 13;
+    *pState ^= *pState >> 17;
+    *pState ^= *pState << 5;
+    return *pState;
+}
+
+static uint16_t Noisy(uint32_t *pSeed, int32_t value)
+{
+    value += (int32_t)(NextRandom(pSeed) % (NOISE_COUNTS + 1)) - NOISE_COUNTS / 2;
+    return (uint16_t)((value < 0) ? 0 : value);
+}
+
+// The pad state machine as TouchSensor drives it, counting touch and release edges
+typedef struct PadRun_t
+{
+    TouchPadFilter filter;
+    bool touched;
+    int touches;
+    int releases;
+} PadRun;
+
+static void PadRun_Init(PadRun *pRun, uint16_t value)
+{
+    TouchPadFilter_Reset(&pRun->filter, value);
+    pRun->touched = false;
+    pRun->touches = 0;
+    pRun->releases = 0;
+}
+
+static void PadRun_Sample(PadRun *pRun, uint16_t rawValue)
+{
+    bool touched = TouchPadFilter_Update(&pRun->filter, rawValue, pRun->touched, NULL);
+    pRun->touches += (!pRun->touched && touched);
+    pRun->releases += (pRun->touched && !touched);
+    pRun->touched = touched;
+
+    uint32_t baseline = pRun->filter.baselineQ4 >> 4;
+    assert(pRun->filter.touchThreshold <= pRun->filter.releaseThreshold);
+    assert(pRun->filter.releaseThreshold <= baseline);
+}
+
+// Temperature and humidity move the idle reading by hundreds of counts over minutes
+static void TestDriftIsNotATouch(void)
+{
+    uint32_t seed = 1;
+    PadRun run;
+    PadRun_Init(&run, BASELINE);
+
+    int32_t valueQ8 = BASELINE << 8;
+    const int32_t driftQ8[] = { 64, -51, 80, -38 };     // Up to 0.3 counts per sample, under the fall slew limit
+    for (int leg = 0; leg < 4; leg++)
+    {
+        for (int i = 0; i < 1500; i++)
+        {
+            valueQ8 += driftQ8[leg];
+            PadRun_Sample(&run, Noisy(&seed, valueQ8 >> 8));
+        }
+    }
+    assert(run.touches == 0);
+
+    // The baseline followed, a real press still lands from wherever the drift left it
+    int32_t value = valueQ8 >> 8;
+    for (int i = 0; i < 20; i++)
+    {
+        PadRun_Sample(&run, Noisy(&seed, value - PRESS_DEPTH));
+    }
+    assert(run.touched);
+    assert(run.touches == 1);
+}
+
+static void TestSpikesAreNotATouch(void)
+{
+    uint32_t seed = 2;
+    PadRun run;
+    PadRun_Init(&run, BASELINE);
+
+    for (int i = 0; i < 5000; i++)
+    {
+        uint16_t value = Noisy(&seed, BASELINE);
+        // Isolated single sample glitches all the way to zero or far above the baseline
+        if (i % 37 == 0)
+        {
+            value = 0;
+        }
+        else if (i % 53 == 0)
+        {
+            value = 4 * BASELINE;
+        }
+        PadRun_Sample(&run, value);
+    }
+    assert(run.touches == 0);
+    uint32_t baseline = run.filter.baselineQ4 >> 4;
+    assert(baseline > BASELINE - 2 * NOISE_COUNTS && baseline < BASELINE + 2 * NOISE_COUNTS);
+}
+
+static void TestPressesAreDetected(void)
+{
+    uint32_t seed = 3;
+    PadRun run;
+    PadRun_Init(&run, BASELINE);
+
+    for (int press = 0; press < 50; press++)
+    {
+        int holdSamples = 2 + press % 40;
+        for (int i = 0; i < 30; i++)
+        {
+            PadRun_Sample(&run, Noisy(&seed, BASELINE));
+        }
+        assert(!run.touched);
+        for (int i = 0; i < holdSamples; i++)
+        {
+            PadRun_Sample(&run, Noisy(&seed, BASELINE - PRESS_DEPTH));
+        }
+        // The median filter costs one sample, anything held for two is a touch
+        assert(run.touched);
+    }
+    for (int i = 0; i < 3; i++)
+    {
+        PadRun_Sample(&run, Noisy(&seed, BASELINE));
+    }
+    assert(!run.touched);
+    assert(run.touches == 50);
+    assert(run.releases == 50);
+}
+
+// A finger closing in slowly falls faster than the baseline is allowed to, so it still reads as a touch
+static void TestSlowApproachIsDetected(void)
+{
+    uint32_t seed = 4;
+    PadRun run;
+    PadRun_Init(&run, BASELINE);
+
+    int32_t valueQ8 = BASELINE << 8;
+    for (int i = 0; i < 400 && !run.touched; i++)
+    {
+        valueQ8 -= 384;     // 1.5 counts per sample
+        PadRun_Sample(&run, Noisy(&seed, valueQ8 >> 8));
+    }
+    assert(run.touched);
+    assert(run.touches == 1);
+
+    // Held long enough for a very long press, the baseline does not chase the finger
+    uint32_t baselineQ4 = run.filter.baselineQ4;
+    for (int i = 0; i < 500; i++)
+    {
+        PadRun_Sample(&run, Noisy(&seed, valueQ8 >> 8));
+    }
+    assert(run.touched);
+    assert(run.filter.baselineQ4 == baselineQ4);
+    for (int i = 0; i < 3; i++)
+    {
+        PadRun_Sample(&run, Noisy(&seed, BASELINE));
+    }
+    assert(!run.touched);
+}
+
+static void TestFallSlewLimit(void)
+{
+    TouchPadFilter filter;
+    TouchPadFilter_Reset(&filter, BASELINE);
+
+    // However far the value drops, the baseline falls by at most one count per sample
+    uint32_t previousQ4 = filter.baselineQ4;
+    for (int i = 0; i < 200; i++)
+    {
+        TouchPadFilter_TrackBaseline(&filter, 0);
+        assert(previousQ4 - filter.baselineQ4 <= 16);
+        assert(filter.baselineQ4 < previousQ4);
+        previousQ4 = filter.baselineQ4;
+    }
+    assert(filter.baselineQ4 == (uint32_t)(BASELINE - 200) << 4);
+
+    // Rises are followed at the EMA rate
+    TouchPadFilter_TrackBaseline(&filter, BASELINE);
+    assert(filter.baselineQ4 - previousQ4 == ((BASELINE << 4) - previousQ4) / 16);
+}
+
+// touchDelta is clamped to the baseline, so small baselines and loud noise never wrap the thresholds
+static void TestThresholdsNeverUnderflow(void)
+{
+    TouchPadFilter filter;
+    for (uint32_t value = 0; value <= UINT16_MAX; value++)
+    {
+        TouchPadFilter_Reset(&filter, (uint16_t)value);
+        assert(filter.touchThreshold <= filter.releaseThreshold);
+        assert(filter.releaseThreshold <= value);
+    }
+
+    // Full scale swings pump the noise estimate past the baseline
+    const uint16_t baselines[] = { 0, 1, 30, 59, 60, 61, 200, BASELINE };
+    for (size_t i = 0; i < sizeof(baselines) / sizeof(baselines[0]); i++)
+    {
+        TouchPadFilter_Reset(&filter, baselines[i]);
+        for (int j = 0; j < 64; j++)
+        {
+            TouchPadFilter_TrackBaseline(&filter, (j & 1) ? UINT16_MAX : 0);
+            uint32_t baseline = filter.baselineQ4 >> 4;
+            assert(filter.touchThreshold <= filter.releaseThreshold);
+            assert(filter.releaseThreshold <= baseline);
+        }
+    }
+}
+
+int main(void)
+{
+    TestDriftIsNotATouch();
+    TestSpikesAreNotATouch();
+    TestPressesAreDetected();
+    TestSlowApproachIsDetected();
+    TestFallSlewLimit();
+    TestThresholdsNeverUnderflow();
+    printf("touch pad filter: ok\n");
+    return 0;
+}
@@ -0,0 +1,429 @@
+#ifndef TOUCH_ACTIONS_CHAINS_H_
+#define TOUCH_ACTIONS_CHAINS_H_
+
+#include "TouchActions.h"
+
+// The command checks from before the gesture table, one if chain per badge. Every pad is
+// compared on every check, so a command needs its pads held and all the others released
+static inline int ChainedTouchActions_Commands(const TouchSensorEvent *values, TouchActionsCmd *pCmds)
+{
+    int numCmds = 0;
+#if defined(TRON_BADGE)
+    if ((values[TOUCH_SENSOR_12_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED)  &&
+        (values[TOUCH_SENSOR_1_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)  &&
+        (values[TOUCH_SENSOR_2_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)  &&
+        (values[TOUCH_SENSOR_4_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)  &&
+        (values[TOUCH_SENSOR_5_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)  &&
+        (values[TOUCH_SENSOR_7_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)  &&
+        (values[TOUCH_SENSOR_8_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)  &&
+        (values[TOUCH_SENSOR_10_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED)  &&
+        (values[TOUCH_SENSOR_11_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED))
+    {
+        pCmds[numCmds++] = TOUCH_ACTIONS_CMD_CLEAR;
+    }
+    if ((values[TOUCH_SENSOR_12_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_1_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_2_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_4_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_5_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_7_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_8_OCLOCK]  >= TOUCH_SENSOR_EVENT_TOUCHED)        &&
+        (values[TOUCH_SENSOR_10_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_11_OCLOCK] >= TOUCH_SENSOR_EVENT_TOUCHED))
+    {
+        pCmds[numCmds++] = TOUCH_ACTIONS_CMD_DISPLAY_VOLTAGE_METER;
+    }
+    if ((values[TOUCH_SENSOR_12_OCLOCK] >= TOUCH_SENSOR_EVENT_TOUCHED)        &&
+        (values[TOUCH_SENSOR_1_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_2_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_4_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_5_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_7_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_8_OCLOCK]  >= TOUCH_SENSOR_EVENT_TOUCHED)        &&
+        (values[TOUCH_SENSOR_10_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_11_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED))
+    {
+        pCmds[numCmds++] = TOUCH_ACTIONS_CMD_ENABLE_BLE_PAIRING;
+    }
+    if ((values[TOUCH_SENSOR_12_OCLOCK] >= TOUCH_SENSOR_EVENT_TOUCHED)        &&
+        (values[TOUCH_SENSOR_1_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_2_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_4_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_5_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_7_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_8_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_10_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_11_OCLOCK] >= TOUCH_SENSOR_EVENT_TOUCHED))
+    {
+        pCmds[numCmds++] = TOUCH_ACTIONS_CMD_DISABLE_BLE_PAIRING;
+    }
+    if ((values[TOUCH_SENSOR_12_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_1_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_2_OCLOCK]  >= TOUCH_SENSOR_EVENT_TOUCHED)        &&
+        (values[TOUCH_SENSOR_4_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_5_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_7_OCLOCK]  >= TOUCH_SENSOR_EVENT_TOUCHED)        &&
+        (values[TOUCH_SENSOR_8_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_10_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_11_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED))
+    {
+        pCmds[numCmds++] = TOUCH_ACTIONS_CMD_NEXT_LED_SEQUENCE;
+    }
+#elif defined(REACTOR_BADGE)
+    if ((values[TOUCH_SENSOR_12_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED)  &&
+        (values[TOUCH_SENSOR_1_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)  &&
+        (values[TOUCH_SENSOR_2_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)  &&
+        (values[TOUCH_SENSOR_4_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)  &&
+        (values[TOUCH_SENSOR_5_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)  &&
+        (values[TOUCH_SENSOR_7_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)  &&
+        (values[TOUCH_SENSOR_8_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)  &&
+        (values[TOUCH_SENSOR_10_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED)  &&
+        (values[TOUCH_SENSOR_11_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED))
+    {
+        pCmds[numCmds++] = TOUCH_ACTIONS_CMD_CLEAR;
+    }
+    if ((values[TOUCH_SENSOR_12_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED)      &&
+        (values[TOUCH_SENSOR_1_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)      &&
+        (values[TOUCH_SENSOR_2_OCLOCK]  >= TOUCH_SENSOR_EVENT_SHORT_PRESSED) &&
+        (values[TOUCH_SENSOR_4_OCLOCK]  >= TOUCH_SENSOR_EVENT_SHORT_PRESSED) &&
+        (values[TOUCH_SENSOR_5_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)      &&
+        (values[TOUCH_SENSOR_7_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)      &&
+        (values[TOUCH_SENSOR_8_OCLOCK]  >= TOUCH_SENSOR_EVENT_SHORT_PRESSED) &&
+        (values[TOUCH_SENSOR_10_OCLOCK] >= TOUCH_SENSOR_EVENT_SHORT_PRESSED) &&
+        (values[TOUCH_SENSOR_11_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED))
+    {
+        pCmds[numCmds++] = TOUCH_ACTIONS_CMD_ENABLE_TOUCH;
+    }
+    if ((values[TOUCH_SENSOR_12_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_1_OCLOCK]  == TOUCH_SENSOR_EVENT_TOUCHED)        &&
+        (values[TOUCH_SENSOR_2_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_4_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_5_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_7_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_8_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_10_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_11_OCLOCK] == TOUCH_SENSOR_EVENT_TOUCHED))
+    {
+        pCmds[numCmds++] = TOUCH_ACTIONS_CMD_DISPLAY_VOLTAGE_METER;
+    }
+    if ((values[TOUCH_SENSOR_12_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_1_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_2_OCLOCK]  == TOUCH_SENSOR_EVENT_TOUCHED)        &&
+        (values[TOUCH_SENSOR_4_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_5_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_7_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_8_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_10_OCLOCK] >= TOUCH_SENSOR_EVENT_TOUCHED)        &&
+        (values[TOUCH_SENSOR_11_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED))
+    {
+        pCmds[numCmds++] = TOUCH_ACTIONS_CMD_NEXT_LED_SEQUENCE;
+    }
+    if ((values[TOUCH_SENSOR_12_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_1_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_2_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_4_OCLOCK]  == TOUCH_SENSOR_EVENT_TOUCHED)        &&
+        (values[TOUCH_SENSOR_5_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_7_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_8_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_10_OCLOCK] >= TOUCH_SENSOR_EVENT_TOUCHED)        &&
+        (values[TOUCH_SENSOR_11_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED))
+    {
+        pCmds[numCmds++] = TOUCH_ACTIONS_CMD_PREV_LED_SEQUENCE;
+    }
+    if ((values[TOUCH_SENSOR_12_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_1_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_2_OCLOCK]  == TOUCH_SENSOR_EVENT_TOUCHED)        &&
+        (values[TOUCH_SENSOR_4_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_5_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_7_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_8_OCLOCK]  >= TOUCH_SENSOR_EVENT_TOUCHED)        &&
+        (values[TOUCH_SENSOR_10_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_11_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED))
+    {
+        pCmds[numCmds++] = TOUCH_ACTIONS_CMD_ENABLE_BLE_PAIRING;
+    }
+    if ((values[TOUCH_SENSOR_12_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_1_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_2_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_4_OCLOCK]  == TOUCH_SENSOR_EVENT_TOUCHED)        &&
+        (values[TOUCH_SENSOR_5_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_7_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_8_OCLOCK]  >= TOUCH_SENSOR_EVENT_TOUCHED)        &&
+        (values[TOUCH_SENSOR_10_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_11_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED))
+    {
+        pCmds[numCmds++] = TOUCH_ACTIONS_CMD_DISABLE_BLE_PAIRING;
+    }
+    if ((values[TOUCH_SENSOR_12_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_1_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_2_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_4_OCLOCK]  == TOUCH_SENSOR_EVENT_TOUCHED)        &&
+        (values[TOUCH_SENSOR_5_OCLOCK]  == TOUCH_SENSOR_EVENT_TOUCHED)        &&
+        (values[TOUCH_SENSOR_7_OCLOCK]  == TOUCH_SENSOR_EVENT_TOUCHED)        &&
+        (values[TOUCH_SENSOR_8_OCLOCK]  >= TOUCH_SENSOR_EVENT_TOUCHED)        &&
+        (values[TOUCH_SENSOR_10_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_11_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED))
+    {
+        pCmds[numCmds++] = TOUCH_ACTIONS_CMD_TOGGLE_SYNTH_MODE_ENABLE;
+    }
+    if ((values[TOUCH_SENSOR_12_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_1_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_2_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_4_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_5_OCLOCK]  == TOUCH_SENSOR_EVENT_TOUCHED)        &&
+        (values[TOUCH_SENSOR_7_OCLOCK]  == TOUCH_SENSOR_EVENT_TOUCHED)        &&
+        (values[TOUCH_SENSOR_8_OCLOCK]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_10_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_11_OCLOCK] == TOUCH_SENSOR_EVENT_RELEASED))
+    {
+        pCmds[numCmds++] = TOUCH_ACTIONS_CMD_NETWORK_TEST;
+    }
+#elif defined(CREST_BADGE)
+    if ((values[TOUCH_SENSOR_LEFT_WING_FEATHER_1]  == TOUCH_SENSOR_EVENT_RELEASED)  &&
+        (values[TOUCH_SENSOR_LEFT_WING_FEATHER_2]  == TOUCH_SENSOR_EVENT_RELEASED)  &&
+        (values[TOUCH_SENSOR_LEFT_WING_FEATHER_3]  == TOUCH_SENSOR_EVENT_RELEASED)  &&
+        (values[TOUCH_SENSOR_LEFT_WING_FEATHER_4]  == TOUCH_SENSOR_EVENT_RELEASED)  &&
+        (values[TOUCH_SENSOR_TAIL_FEATHER]         == TOUCH_SENSOR_EVENT_RELEASED)  &&
+        (values[TOUCH_SENSOR_RIGHT_WING_FEATHER_4] == TOUCH_SENSOR_EVENT_RELEASED)  &&
+        (values[TOUCH_SENSOR_RIGHT_WING_FEATHER_3] == TOUCH_SENSOR_EVENT_RELEASED)  &&
+        (values[TOUCH_SENSOR_RIGHT_WING_FEATHER_2] == TOUCH_SENSOR_EVENT_RELEASED)  &&
+        (values[TOUCH_SENSOR_RIGHT_WING_FEATHER_1] == TOUCH_SENSOR_EVENT_RELEASED))
+    {
+        pCmds[numCmds++] = TOUCH_ACTIONS_CMD_CLEAR;
+    }
+    if ((values[TOUCH_SENSOR_LEFT_WING_FEATHER_1]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_LEFT_WING_FEATHER_2]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_LEFT_WING_FEATHER_3]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_LEFT_WING_FEATHER_4]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_TAIL_FEATHER]         >= TOUCH_SENSOR_EVENT_SHORT_PRESSED)  &&
+        (values[TOUCH_SENSOR_RIGHT_WING_FEATHER_4] == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_RIGHT_WING_FEATHER_3] == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_RIGHT_WING_FEATHER_2] == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_RIGHT_WING_FEATHER_1] == TOUCH_SENSOR_EVENT_RELEASED))
+    {
+        pCmds[numCmds++] = TOUCH_ACTIONS_CMD_ENABLE_TOUCH;
+    }
+    if ((values[TOUCH_SENSOR_LEFT_WING_FEATHER_1]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_LEFT_WING_FEATHER_2]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_LEFT_WING_FEATHER_3]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_LEFT_WING_FEATHER_4]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_TAIL_FEATHER]         == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_RIGHT_WING_FEATHER_4] == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_RIGHT_WING_FEATHER_3] >= TOUCH_SENSOR_EVENT_SHORT_PRESSED)  &&
+        (values[TOUCH_SENSOR_RIGHT_WING_FEATHER_2] >= TOUCH_SENSOR_EVENT_SHORT_PRESSED)  &&
+        (values[TOUCH_SENSOR_RIGHT_WING_FEATHER_1] >= TOUCH_SENSOR_EVENT_SHORT_PRESSED))
+    {
+        pCmds[numCmds++] = TOUCH_ACTIONS_CMD_DISABLE_TOUCH;
+    }
+    if ((values[TOUCH_SENSOR_LEFT_WING_FEATHER_1]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_LEFT_WING_FEATHER_2]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_LEFT_WING_FEATHER_3]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_LEFT_WING_FEATHER_4]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_TAIL_FEATHER]         >= TOUCH_SENSOR_EVENT_TOUCHED)        &&
+        (values[TOUCH_SENSOR_RIGHT_WING_FEATHER_4] == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_RIGHT_WING_FEATHER_3] == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_RIGHT_WING_FEATHER_2] == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_RIGHT_WING_FEATHER_1] >= TOUCH_SENSOR_EVENT_TOUCHED))
+    {
+        pCmds[numCmds++] = TOUCH_ACTIONS_CMD_DISPLAY_VOLTAGE_METER;
+    }
+    if ((values[TOUCH_SENSOR_LEFT_WING_FEATHER_1]  == TOUCH_SENSOR_EVENT_TOUCHED)        &&
+        (values[TOUCH_SENSOR_LEFT_WING_FEATHER_2]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_LEFT_WING_FEATHER_3]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_LEFT_WING_FEATHER_4]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_TAIL_FEATHER]         == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_RIGHT_WING_FEATHER_4] == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_RIGHT_WING_FEATHER_3] == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_RIGHT_WING_FEATHER_2] == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_RIGHT_WING_FEATHER_1] >= TOUCH_SENSOR_EVENT_TOUCHED))
+    {
+        pCmds[numCmds++] = TOUCH_ACTIONS_CMD_NEXT_LED_SEQUENCE;
+    }
+    if ((values[TOUCH_SENSOR_LEFT_WING_FEATHER_1]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_LEFT_WING_FEATHER_2]  == TOUCH_SENSOR_EVENT_TOUCHED)        &&
+        (values[TOUCH_SENSOR_LEFT_WING_FEATHER_3]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_LEFT_WING_FEATHER_4]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_TAIL_FEATHER]         == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_RIGHT_WING_FEATHER_4] == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_RIGHT_WING_FEATHER_3] == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_RIGHT_WING_FEATHER_2] == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_RIGHT_WING_FEATHER_1] >= TOUCH_SENSOR_EVENT_TOUCHED))
+    {
+        pCmds[numCmds++] = TOUCH_ACTIONS_CMD_PREV_LED_SEQUENCE;
+    }
+    if ((values[TOUCH_SENSOR_LEFT_WING_FEATHER_1]  >= TOUCH_SENSOR_EVENT_TOUCHED)        &&
+        (values[TOUCH_SENSOR_LEFT_WING_FEATHER_2]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_LEFT_WING_FEATHER_3]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_LEFT_WING_FEATHER_4]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_TAIL_FEATHER]         >= TOUCH_SENSOR_EVENT_TOUCHED)        &&
+        (values[TOUCH_SENSOR_RIGHT_WING_FEATHER_4] == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_RIGHT_WING_FEATHER_3] == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_RIGHT_WING_FEATHER_2] == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_RIGHT_WING_FEATHER_1] == TOUCH_SENSOR_EVENT_RELEASED))
+    {
+        pCmds[numCmds++] = TOUCH_ACTIONS_CMD_ENABLE_BLE_PAIRING;
+    }
+    if ((values[TOUCH_SENSOR_LEFT_WING_FEATHER_1]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_LEFT_WING_FEATHER_2]  >= TOUCH_SENSOR_EVENT_TOUCHED)        &&
+        (values[TOUCH_SENSOR_LEFT_WING_FEATHER_3]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_LEFT_WING_FEATHER_4]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_TAIL_FEATHER]         >= TOUCH_SENSOR_EVENT_TOUCHED)        &&
+        (values[TOUCH_SENSOR_RIGHT_WING_FEATHER_4] == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_RIGHT_WING_FEATHER_3] == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_RIGHT_WING_FEATHER_2] == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_RIGHT_WING_FEATHER_1] == TOUCH_SENSOR_EVENT_RELEASED))
+    {
+        pCmds[numCmds++] = TOUCH_ACTIONS_CMD_DISABLE_BLE_PAIRING;
+    }
+    if ((values[TOUCH_SENSOR_LEFT_WING_FEATHER_1]  == TOUCH_SENSOR_EVENT_RELEASED)      &&
+        (values[TOUCH_SENSOR_LEFT_WING_FEATHER_2]  == TOUCH_SENSOR_EVENT_RELEASED)      &&
+        (values[TOUCH_SENSOR_LEFT_WING_FEATHER_3]  == TOUCH_SENSOR_EVENT_RELEASED)      &&
+        (values[TOUCH_SENSOR_LEFT_WING_FEATHER_4]  >= TOUCH_SENSOR_EVENT_TOUCHED)       &&
+        (values[TOUCH_SENSOR_TAIL_FEATHER]         == TOUCH_SENSOR_EVENT_RELEASED)      &&
+        (values[TOUCH_SENSOR_RIGHT_WING_FEATHER_4] >= TOUCH_SENSOR_EVENT_TOUCHED)       &&
+        (values[TOUCH_SENSOR_RIGHT_WING_FEATHER_3] == TOUCH_SENSOR_EVENT_RELEASED)      &&
+        (values[TOUCH_SENSOR_RIGHT_WING_FEATHER_2] == TOUCH_SENSOR_EVENT_RELEASED)      &&
+        (values[TOUCH_SENSOR_RIGHT_WING_FEATHER_1] == TOUCH_SENSOR_EVENT_RELEASED)
+        )
+    {
+        pCmds[numCmds++] = TOUCH_ACTIONS_CMD_TOGGLE_SYNTH_MODE_ENABLE;
+    }
+    if ((values[TOUCH_SENSOR_LEFT_WING_FEATHER_1]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_LEFT_WING_FEATHER_2]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_LEFT_WING_FEATHER_3]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_LEFT_WING_FEATHER_4]  >= TOUCH_SENSOR_EVENT_TOUCHED)        &&
+        (values[TOUCH_SENSOR_TAIL_FEATHER]         >= TOUCH_SENSOR_EVENT_TOUCHED)        &&
+        (values[TOUCH_SENSOR_RIGHT_WING_FEATHER_4] >= TOUCH_SENSOR_EVENT_TOUCHED)        &&
+        (values[TOUCH_SENSOR_RIGHT_WING_FEATHER_3] == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_RIGHT_WING_FEATHER_2] == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_RIGHT_WING_FEATHER_1] == TOUCH_SENSOR_EVENT_RELEASED))
+    {
+        pCmds[numCmds++] = TOUCH_ACTIONS_CMD_NETWORK_TEST;
+    }
+#elif defined(FMAN25_BADGE)
+    if ((values[TOUCH_SENSOR_LEFT_TOUCH_1]  == TOUCH_SENSOR_EVENT_RELEASED)  &&
+        (values[TOUCH_SENSOR_LEFT_TOUCH_2]  == TOUCH_SENSOR_EVENT_RELEASED)  &&
+        (values[TOUCH_SENSOR_LEFT_TOUCH_3]  == TOUCH_SENSOR_EVENT_RELEASED)  &&
+        (values[TOUCH_SENSOR_LEFT_TOUCH_4]  == TOUCH_SENSOR_EVENT_RELEASED)  &&
+        (values[TOUCH_SENSOR_CENTER_TOUCH]  == TOUCH_SENSOR_EVENT_RELEASED)  &&
+        (values[TOUCH_SENSOR_RIGHT_TOUCH_4] == TOUCH_SENSOR_EVENT_RELEASED)  &&
+        (values[TOUCH_SENSOR_RIGHT_TOUCH_3] == TOUCH_SENSOR_EVENT_RELEASED)  &&
+        (values[TOUCH_SENSOR_RIGHT_TOUCH_2] == TOUCH_SENSOR_EVENT_RELEASED)  &&
+        (values[TOUCH_SENSOR_RIGHT_TOUCH_1] == TOUCH_SENSOR_EVENT_RELEASED))
+    {
+        pCmds[numCmds++] = TOUCH_ACTIONS_CMD_CLEAR;
+    }
+    if ((values[TOUCH_SENSOR_LEFT_TOUCH_1]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_LEFT_TOUCH_2]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_LEFT_TOUCH_3]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_LEFT_TOUCH_4]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_CENTER_TOUCH]  >= TOUCH_SENSOR_EVENT_SHORT_PRESSED)  &&
+        (values[TOUCH_SENSOR_RIGHT_TOUCH_4] == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_RIGHT_TOUCH_3] == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_RIGHT_TOUCH_2] == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_RIGHT_TOUCH_1] == TOUCH_SENSOR_EVENT_RELEASED))
+    {
+        pCmds[numCmds++] = TOUCH_ACTIONS_CMD_ENABLE_TOUCH;
+    }
+    if ((values[TOUCH_SENSOR_LEFT_TOUCH_1]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_LEFT_TOUCH_2]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_LEFT_TOUCH_3]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_LEFT_TOUCH_4]  == TOUCH_SENSOR_EVENT_SHORT_PRESSED)  &&
+        (values[TOUCH_SENSOR_CENTER_TOUCH]  == TOUCH_SENSOR_EVENT_SHORT_PRESSED)  &&
+        (values[TOUCH_SENSOR_RIGHT_TOUCH_4] == TOUCH_SENSOR_EVENT_SHORT_PRESSED)  &&
+        (values[TOUCH_SENSOR_RIGHT_TOUCH_3] == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_RIGHT_TOUCH_2] == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_RIGHT_TOUCH_1] == TOUCH_SENSOR_EVENT_RELEASED))
+    {
+        pCmds[numCmds++] = TOUCH_ACTIONS_CMD_DISABLE_TOUCH;
+    }
+    if ((values[TOUCH_SENSOR_LEFT_TOUCH_1]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_LEFT_TOUCH_2]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_LEFT_TOUCH_3]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_LEFT_TOUCH_4]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_CENTER_TOUCH]  >= TOUCH_SENSOR_EVENT_TOUCHED)        &&
+        (values[TOUCH_SENSOR_RIGHT_TOUCH_4] == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_RIGHT_TOUCH_3] == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_RIGHT_TOUCH_2] == TOUCH_SENSOR_EVENT_TOUCHED)        &&
+        (values[TOUCH_SENSOR_RIGHT_TOUCH_1] == TOUCH_SENSOR_EVENT_RELEASED))
+    {
+        pCmds[numCmds++] = TOUCH_ACTIONS_CMD_DISPLAY_VOLTAGE_METER;
+    }
+    if ((values[TOUCH_SENSOR_LEFT_TOUCH_1]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_LEFT_TOUCH_2]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_LEFT_TOUCH_3]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_LEFT_TOUCH_4]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_CENTER_TOUCH]  >= TOUCH_SENSOR_EVENT_TOUCHED)        &&
+        (values[TOUCH_SENSOR_RIGHT_TOUCH_4] == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_RIGHT_TOUCH_3] == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_RIGHT_TOUCH_2] == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_RIGHT_TOUCH_1] >= TOUCH_SENSOR_EVENT_TOUCHED))
+    {
+        pCmds[numCmds++] = TOUCH_ACTIONS_CMD_NEXT_LED_SEQUENCE;
+    }
+    if ((values[TOUCH_SENSOR_LEFT_TOUCH_1]  == TOUCH_SENSOR_EVENT_TOUCHED)        &&
+        (values[TOUCH_SENSOR_LEFT_TOUCH_2]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_LEFT_TOUCH_3]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_LEFT_TOUCH_4]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_CENTER_TOUCH]  >= TOUCH_SENSOR_EVENT_TOUCHED)        &&
+        (values[TOUCH_SENSOR_RIGHT_TOUCH_4] == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_RIGHT_TOUCH_3] == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_RIGHT_TOUCH_2] == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_RIGHT_TOUCH_1] == TOUCH_SENSOR_EVENT_RELEASED))
+    {
+        pCmds[numCmds++] = TOUCH_ACTIONS_CMD_PREV_LED_SEQUENCE;
+    }
+    if ((values[TOUCH_SENSOR_LEFT_TOUCH_1]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_LEFT_TOUCH_2]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_LEFT_TOUCH_3]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_LEFT_TOUCH_4]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_CENTER_TOUCH]  >= TOUCH_SENSOR_EVENT_TOUCHED)        &&
+        (values[TOUCH_SENSOR_RIGHT_TOUCH_4] == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_RIGHT_TOUCH_3] == TOUCH_SENSOR_EVENT_TOUCHED)        &&
+        (values[TOUCH_SENSOR_RIGHT_TOUCH_2] == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_RIGHT_TOUCH_1] == TOUCH_SENSOR_EVENT_RELEASED))
+    {
+        pCmds[numCmds++] = TOUCH_ACTIONS_CMD_ENABLE_BLE_PAIRING;
+    }
+    if ((values[TOUCH_SENSOR_LEFT_TOUCH_1]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_LEFT_TOUCH_2]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_LEFT_TOUCH_3]  == TOUCH_SENSOR_EVENT_TOUCHED)        &&
+        (values[TOUCH_SENSOR_LEFT_TOUCH_4]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_CENTER_TOUCH]  >= TOUCH_SENSOR_EVENT_TOUCHED)        &&
+        (values[TOUCH_SENSOR_RIGHT_TOUCH_4] == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_RIGHT_TOUCH_3] == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_RIGHT_TOUCH_2] == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_RIGHT_TOUCH_1] == TOUCH_SENSOR_EVENT_RELEASED))
+    {
+        pCmds[numCmds++] = TOUCH_ACTIONS_CMD_DISABLE_BLE_PAIRING;
+    }
+    if ((values[TOUCH_SENSOR_LEFT_TOUCH_1]  == TOUCH_SENSOR_EVENT_TOUCHED)       &&
+        (values[TOUCH_SENSOR_LEFT_TOUCH_2]  == TOUCH_SENSOR_EVENT_RELEASED)      &&
+        (values[TOUCH_SENSOR_LEFT_TOUCH_3]  == TOUCH_SENSOR_EVENT_RELEASED)      &&
+        (values[TOUCH_SENSOR_LEFT_TOUCH_4]  == TOUCH_SENSOR_EVENT_RELEASED)      &&
+        (values[TOUCH_SENSOR_CENTER_TOUCH]  == TOUCH_SENSOR_EVENT_RELEASED)      &&
+        (values[TOUCH_SENSOR_RIGHT_TOUCH_4] == TOUCH_SENSOR_EVENT_RELEASED)      &&
+        (values[TOUCH_SENSOR_RIGHT_TOUCH_3] == TOUCH_SENSOR_EVENT_RELEASED)      &&
+        (values[TOUCH_SENSOR_RIGHT_TOUCH_2] == TOUCH_SENSOR_EVENT_RELEASED)      &&
+        (values[TOUCH_SENSOR_RIGHT_TOUCH_1] == TOUCH_SENSOR_EVENT_TOUCHED)
+        )
+    {
+        pCmds[numCmds++] = TOUCH_ACTIONS_CMD_TOGGLE_SYNTH_MODE_ENABLE;
+    }
+    if ((values[TOUCH_SENSOR_LEFT_TOUCH_1]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_LEFT_TOUCH_2]  == TOUCH_SENSOR_EVENT_TOUCHED)        &&
+        (values[TOUCH_SENSOR_LEFT_TOUCH_3]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_LEFT_TOUCH_4]  == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_CENTER_TOUCH]  >= TOUCH_SENSOR_EVENT_TOUCHED)        &&
+        (values[TOUCH_SENSOR_RIGHT_TOUCH_4] == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_RIGHT_TOUCH_3] == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_RIGHT_TOUCH_2] == TOUCH_SENSOR_EVENT_RELEASED)       &&
+        (values[TOUCH_SENSOR_RIGHT_TOUCH_1] == TOUCH_SENSOR_EVENT_RELEASED))
+    {
+        pCmds[numCmds++] = TOUCH_ACTIONS_CMD_NETWORK_TEST;
+    }
+#endif
+    return numCmds;
+}
+
+#endif // TOUCH_ACTIONS_CHAINS_H_